@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief ARM Cortex-M d-cache maintenance by address range
+ *
+ * Backs sys_cache_flush() and sys_cache_invd() with the CMSIS cache
+ * operations so drivers can hand DMA buffers between CPU and device
+ * ownership with the d-cache enabled.
+ */
+
+#include <kernel.h>
+#include <cache.h>
+#include <arch/arm/aarch32/cortex_m/cmsis.h>
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+
+static inline bool dcache_enabled(void)
+{
+	return (SCB->CCR & SCB_CCR_DC_Msk) != 0U;
+}
+
+/* The CMSIS by-address operations require cache line aligned start
+ * addresses; align down and extend the size to cover the same bytes.
+ */
+void arch_dcache_flush(void *addr, size_t size)
+{
+	uintptr_t start = (uintptr_t)addr &
+			  ~((uintptr_t)CONFIG_CACHE_LINE_SIZE - 1);
+
+	if (!dcache_enabled()) {
+		return;
+	}
+
+	SCB_CleanDCache_by_Addr((uint32_t *)start,
+				size + ((uintptr_t)addr - start));
+}
+
+void arch_dcache_invd(void *addr, size_t size)
+{
+	uintptr_t start = (uintptr_t)addr &
+			  ~((uintptr_t)CONFIG_CACHE_LINE_SIZE - 1);
+
+	if (!dcache_enabled()) {
+		return;
+	}
+
+	SCB_InvalidateDCache_by_Addr((uint32_t *)start,
+				     size + ((uintptr_t)addr - start));
+}
+
+#else
+
+void arch_dcache_flush(void *addr, size_t size)
+{
+	ARG_UNUSED(addr);
+	ARG_UNUSED(size);
+}
+
+void arch_dcache_invd(void *addr, size_t size)
+{
+	ARG_UNUSED(addr);
+	ARG_UNUSED(size);
+}
+
+#endif /* __DCACHE_PRESENT */
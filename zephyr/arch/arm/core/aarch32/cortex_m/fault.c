@@ -538,6 +538,57 @@ static uint32_t usage_fault(const z_arch_esf_t *esf)
 	return reason;
 }
 
+#if defined(CONFIG_FPU_SHARING_LAZY)
+extern struct k_thread *z_arm_fp_owner;
+
+/**
+ *
+ * @brief Migrate the FPU register bank on a NOCP trap
+ *
+ * With lazy FPU switching, threads that do not own the FPU register bank
+ * run with CP10/CP11 access disabled, so their first FP instruction
+ * raises a UsageFault with NOCP set. Claim the bank for the faulting
+ * thread: spill the previous owner's callee-saved FP registers (the
+ * first FP access also flushes any pending lazy-stacked s0-s15/FPSCR
+ * into that thread's reserved exception frame), load the claimant's
+ * state, and let the faulting instruction be retried.
+ *
+ * @return true if the fault was a NOCP trap and has been handled
+ */
+static bool z_arm_fp_lazy_switch(void)
+{
+	if ((SCB->CFSR & SCB_CFSR_NOCP_Msk) == 0) {
+		return false;
+	}
+
+	/* Grant CP10/CP11 full access before touching the FP registers */
+	SCB->CPACR |= (0xFUL << 20);
+	__ISB();
+
+	if (z_arm_fp_owner != NULL) {
+		__asm__ volatile ("vstmia %0, {s16-s31}"
+				  :
+				  : "r" (&z_arm_fp_owner->arch.preempt_float)
+				  : "memory");
+	}
+	__asm__ volatile ("vldmia %0, {s16-s31}"
+			  :
+			  : "r" (&_current->arch.preempt_float)
+			  : "memory");
+	/* Fresh FP users start with default FPSCR settings */
+	__asm__ volatile ("vmsr fpscr, %0" : : "r" (0));
+
+	z_arm_fp_owner = _current;
+
+	/* NOCP is sticky; clear it so the retried instruction does not
+	 * appear to have faulted.
+	 */
+	SCB->CFSR = SCB_CFSR_NOCP_Msk;
+
+	return true;
+}
+#endif /* CONFIG_FPU_SHARING_LAZY */
+
 #if defined(CONFIG_ARM_SECURE_FIRMWARE)
 /**
  *
@@ -943,6 +994,16 @@ void z_arm_fault(uint32_t msp, uint32_t psp, uint32_t exc_return)
 	 */
 	z_arch_esf_t esf_copy;
 
+#if defined(CONFIG_FPU_SHARING_LAZY)
+	/* A UsageFault with NOCP set is normally a thread touching the FPU
+	 * for the first time since it lost the register bank: migrate the
+	 * bank and return, to retry the faulting instruction.
+	 */
+	if (fault == 6 && z_arm_fp_lazy_switch()) {
+		return;
+	}
+#endif /* CONFIG_FPU_SHARING_LAZY */
+
 	/* Force unlock interrupts */
 	arch_irq_unlock(0);
 
@@ -171,6 +171,7 @@ void z_arm_configure_dynamic_mpu_regions(struct k_thread *thread)
 #if defined(CONFIG_USERSPACE)
 	struct k_mem_partition thread_stack;
 
+#if !defined(CONFIG_ARM_MPU_DOMAIN_CACHE)
 	/* Memory domain */
 	LOG_DBG("configure thread %p's domain", thread);
 	struct k_mem_domain *mem_domain = thread->mem_domain_info.mem_domain;
@@ -205,6 +206,7 @@ void z_arm_configure_dynamic_mpu_regions(struct k_thread *thread)
 			}
 		}
 	}
+#endif /* !CONFIG_ARM_MPU_DOMAIN_CACHE */
 	/* Thread user stack */
 	LOG_DBG("configure user thread %p's context", thread);
 	if (thread->arch.priv_stack_start) {
@@ -280,9 +282,20 @@ void z_arm_configure_dynamic_mpu_regions(struct k_thread *thread)
 #endif /* CONFIG_MPU_STACK_GUARD */
 
 	/* Configure the dynamic MPU regions */
+#if defined(CONFIG_ARM_MPU_DOMAIN_CACHE)
+	/* Domain partitions are programmed from the domain's cached
+	 * register image; only the per-thread regions were collected
+	 * above.
+	 */
+	arm_core_mpu_configure_dynamic_mpu_regions_cached(
+		thread->mem_domain_info.mem_domain,
+		(const struct k_mem_partition **)dynamic_regions,
+		region_num);
+#else
 	arm_core_mpu_configure_dynamic_mpu_regions(
 		(const struct k_mem_partition **)dynamic_regions,
 		region_num);
+#endif
 }
 
 #if defined(CONFIG_USERSPACE)
@@ -322,6 +335,10 @@ void arch_mem_domain_destroy(struct k_mem_domain *domain)
 	int i;
 	struct k_mem_partition partition;
 
+#if defined(CONFIG_ARM_MPU_DOMAIN_CACHE)
+	domain->arch.valid = false;
+#endif
+
 	if (_current->mem_domain_info.mem_domain != domain) {
 		return;
 	}
@@ -353,6 +370,10 @@ void arch_mem_domain_partition_remove(struct k_mem_domain *domain,
 	 */
 	k_mem_partition_attr_t reset_attr = K_MEM_PARTITION_P_RW_U_NA;
 
+#if defined(CONFIG_ARM_MPU_DOMAIN_CACHE)
+	domain->arch.valid = false;
+#endif
+
 	if (_current->mem_domain_info.mem_domain != domain) {
 		return;
 	}
@@ -364,7 +385,14 @@ void arch_mem_domain_partition_remove(struct k_mem_domain *domain,
 void arch_mem_domain_partition_add(struct k_mem_domain *domain,
 				   uint32_t partition_id)
 {
+#if defined(CONFIG_ARM_MPU_DOMAIN_CACHE)
+	/* The new partition is picked up when the domain's register
+	 * image is rebuilt on the next switch into one of its threads.
+	 */
+	domain->arch.valid = false;
+#else
 	/* No-op on this architecture */
+#endif
 }
 
 void arch_mem_domain_thread_remove(struct k_thread *thread)
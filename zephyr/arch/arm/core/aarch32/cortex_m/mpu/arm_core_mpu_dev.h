@@ -187,6 +187,27 @@ void arm_core_mpu_mark_areas_for_dynamic_regions(
 void arm_core_mpu_configure_dynamic_mpu_regions(
 	const struct k_mem_partition *dynamic_regions[], uint8_t regions_num);
 
+#if defined(CONFIG_ARM_MPU_DOMAIN_CACHE)
+/**
+ * @brief configure dynamic MPU regions using a cached domain image
+ *
+ * As arm_core_mpu_configure_dynamic_mpu_regions(), but the partitions
+ * of the given memory domain are programmed from the precomputed
+ * register image stored in the domain object, which is rebuilt here if
+ * the domain's composition has changed since it was last programmed.
+ * Only the per-thread regions (user thread stack, stack guard) are
+ * passed in the dynamic regions array.
+ *
+ * @param domain Memory domain of the incoming thread; may be NULL
+ * @param dynamic_regions an array of pointers to memory partitions
+ *                        to be programmed after the domain's image
+ * @param regions_num the number of regions to be programmed
+ */
+void arm_core_mpu_configure_dynamic_mpu_regions_cached(
+	struct k_mem_domain *domain,
+	const struct k_mem_partition *dynamic_regions[], uint8_t regions_num);
+#endif /* CONFIG_ARM_MPU_DOMAIN_CACHE */
+
 #if defined(CONFIG_USERSPACE)
 /**
  * @brief update configuration of an active memory partition
@@ -291,6 +291,97 @@ void arm_core_mpu_configure_dynamic_mpu_regions(const struct k_mem_partition
 	}
 }
 
+#if defined(CONFIG_ARM_MPU_DOMAIN_CACHE)
+/* (Re-)build the cached register image for a memory domain from its
+ * partition list. Called with the image marked invalid; runs at most
+ * once per change of the domain's composition.
+ */
+static void domain_image_build(struct k_mem_domain *domain)
+{
+	struct arch_mem_domain *image = &domain->arch;
+	uint32_t num_partitions = domain->num_partitions;
+	uint8_t reg_num = 0U;
+
+	for (int i = 0; i < CONFIG_MAX_DOMAIN_PARTITIONS; i++) {
+		struct k_mem_partition *partition = &domain->partitions[i];
+		arm_mpu_region_attr_t attr;
+
+		if (partition->size == 0U) {
+			/* Zero size indicates a non-existing
+			 * memory partition.
+			 */
+			continue;
+		}
+
+		__ASSERT(mpu_partition_is_valid(partition),
+			 "Partition %d: sanity check failed.\n", i);
+
+		get_region_attr_from_k_mem_partition_info(&attr,
+			&partition->attr, partition->start, partition->size);
+
+		image->rbar[reg_num] = partition->start & MPU_RBAR_ADDR_Msk;
+		image->rasr[reg_num] = attr.rasr | MPU_RASR_ENABLE_Msk;
+
+		reg_num++;
+		num_partitions--;
+		if (num_partitions == 0U) {
+			break;
+		}
+	}
+
+	image->num_regions = reg_num;
+	image->valid = true;
+}
+
+/**
+ * @brief configure dynamic MPU regions with a cached domain image
+ */
+void arm_core_mpu_configure_dynamic_mpu_regions_cached(
+	struct k_mem_domain *domain,
+	const struct k_mem_partition *dynamic_regions[], uint8_t regions_num)
+{
+	int mpu_reg_index = static_regions_num;
+
+	if (domain != NULL) {
+		struct arch_mem_domain *image = &domain->arch;
+
+		if (!image->valid) {
+			domain_image_build(domain);
+		}
+
+		__ASSERT(mpu_reg_index + image->num_regions +
+			 regions_num <= get_num_regions(),
+			 "Out-of-bounds error for dynamic region map.");
+
+		/* Blast the precomputed image into the MPU; the cost of
+		 * this loop is a pair of register writes per partition,
+		 * independent of attribute re-computation.
+		 */
+		for (int i = 0; i < image->num_regions; i++, mpu_reg_index++) {
+			MPU->RNR = mpu_reg_index;
+			MPU->RBAR = image->rbar[i] | MPU_RBAR_VALID_Msk |
+				    mpu_reg_index;
+			MPU->RASR = image->rasr[i];
+		}
+	}
+
+	/* Program the per-thread regions (user stack, stack guard) and
+	 * disable the remaining region indices as usual.
+	 */
+	mpu_reg_index = mpu_configure_regions(dynamic_regions, regions_num,
+					      mpu_reg_index, false);
+
+	if (mpu_reg_index != -EINVAL) {
+		for (int i = mpu_reg_index; i < get_num_regions(); i++) {
+			ARM_MPU_ClrRegion(i);
+		}
+	} else {
+		__ASSERT(0, "Configuring %u dynamic MPU regions failed\n",
+			regions_num);
+	}
+}
+#endif /* CONFIG_ARM_MPU_DOMAIN_CACHE */
+
 /* ARM MPU Driver Initial Setup */
 
 /*
@@ -26,6 +26,10 @@
 
 extern void z_thread_single_abort(struct k_thread *thread);
 
+#if defined(CONFIG_FPU_SHARING_LAZY)
+extern struct k_thread *z_arm_fp_owner;
+#endif
+
 void z_impl_k_thread_abort(k_tid_t thread)
 {
 	unsigned int key;
@@ -38,6 +42,15 @@ void z_impl_k_thread_abort(k_tid_t thread)
 	z_thread_single_abort(thread);
 	z_thread_monitor_exit(thread);
 
+#if defined(CONFIG_FPU_SHARING_LAZY)
+	/* The aborted thread's FP state in the register bank is dead;
+	 * drop the ownership so it is never spilled into freed memory.
+	 */
+	if (z_arm_fp_owner == thread) {
+		z_arm_fp_owner = NULL;
+	}
+#endif
+
 	if (_current == thread) {
 		if ((SCB->ICSR & SCB_ICSR_VECTACTIVE_Msk) == 0) {
 			(void)z_swap_irqlock(key);
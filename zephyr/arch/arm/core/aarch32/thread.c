@@ -15,6 +15,21 @@
 #include <kernel.h>
 #include <ksched.h>
 #include <wait_q.h>
+#include <kernel_internal.h>
+
+#ifdef CONFIG_THREAD_LOCAL_STORAGE
+/* TLS pointer of the current thread, returned by __aeabi_read_tp and
+ * updated by the context switch code.
+ */
+uintptr_t z_arm_tls_ptr;
+#endif
+
+#ifdef CONFIG_FPU_SHARING_LAZY
+/* Thread whose FP context currently occupies the FPU register bank, or
+ * NULL. Updated by the context switch code and the NOCP fault handler.
+ */
+struct k_thread *z_arm_fp_owner;
+#endif
 
 /* An initial context, to be "restored" by z_arm_pendsv(), is put at the other
  * end of the stack, and thus reusable by the stack when not needed anymore.
@@ -398,8 +413,18 @@ void arch_switch_to_main_thread(struct k_thread *main_thread,
 	/* get high address of the stack, i.e. its start (stack grows down) */
 	char *start_of_main_stack;
 
+#ifdef CONFIG_THREAD_LOCAL_STORAGE
+	/* The TLS area was carved off the top of the stack area in
+	 * z_setup_new_thread(); the stack pointer starts below it.
+	 */
+	start_of_main_stack = Z_THREAD_STACK_BUFFER(main_stack) +
+		Z_STACK_PTR_ALIGN(main_stack_size - z_tls_data_size());
+
+	z_arm_tls_ptr = main_thread->tls;
+#else
 	start_of_main_stack =
 		Z_THREAD_STACK_BUFFER(main_stack) + main_stack_size;
+#endif
 
 	start_of_main_stack = (char *)Z_STACK_PTR_ALIGN(start_of_main_stack);
 
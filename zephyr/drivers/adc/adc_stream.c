@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Continuous sampling helper built on the standard sequence API.  The
+ * driver samples one sampling's worth of data at the configured
+ * interval; after each sampling the helper copies it into the user's
+ * ring buffer and asks for a repeat, so acquisition runs until
+ * stopped without any per-sample software re-arming.  Whenever a
+ * block of the ring completes, the user callback is notified.
+ */
+
+#include <string.h>
+
+#include <kernel.h>
+#include <drivers/adc.h>
+
+static enum adc_action adc_stream_sampling_done(
+				struct device *dev,
+				const struct adc_sequence *sequence,
+				uint16_t sampling_index)
+{
+	struct adc_stream *stream =
+		CONTAINER_OF(sequence, struct adc_stream, sequence);
+
+	ARG_UNUSED(sampling_index);
+
+	if (stream->stop) {
+		return ADC_ACTION_FINISH;
+	}
+
+	memcpy(&stream->ring_buf[stream->wr], sequence->buffer,
+	       stream->sampling_bytes);
+	stream->wr += stream->sampling_bytes;
+
+	if ((stream->wr % stream->block_size) == 0U) {
+		uint8_t *block = &stream->ring_buf[stream->wr -
+						   stream->block_size];
+
+		if (stream->wr == stream->ring_size) {
+			stream->wr = 0;
+		}
+
+		if (stream->callback != NULL) {
+			stream->callback(dev, block, stream->block_size,
+					 stream->user_data);
+		}
+	}
+
+	return ADC_ACTION_REPEAT;
+}
+
+int adc_stream_start(struct device *dev, struct adc_stream *stream)
+{
+	if ((stream->sampling_bytes == 0U) ||
+	    (stream->block_size == 0U) ||
+	    ((stream->block_size % stream->sampling_bytes) != 0U) ||
+	    ((stream->ring_size % stream->block_size) != 0U) ||
+	    (stream->sequence.buffer_size < stream->sampling_bytes)) {
+		return -EINVAL;
+	}
+
+	stream->wr = 0;
+	stream->stop = false;
+
+	stream->options.interval_us = stream->interval_us;
+	stream->options.callback = adc_stream_sampling_done;
+	stream->options.extra_samplings = 0;
+	stream->sequence.options = &stream->options;
+
+	return adc_read_async(dev, &stream->sequence, NULL);
+}
+
+void adc_stream_stop(struct adc_stream *stream)
+{
+	stream->stop = true;
+}
@@ -69,14 +69,9 @@ static struct {
 
 static struct device *h4_dev;
 
-static inline void h4_get_type(void)
+static void h4_set_type(uint8_t type)
 {
-	/* Get packet type */
-	if (uart_fifo_read(h4_dev, &rx.type, 1) != 1) {
-		BT_WARN("Unable to read H:4 packet type");
-		rx.type = H4_NONE;
-		return;
-	}
+	rx.type = type;
 
 	switch (rx.type) {
 	case H4_EVT:
@@ -93,27 +88,47 @@ static inline void h4_get_type(void)
 	}
 }
 
-static inline void get_acl_hdr(void)
+#if !defined(CONFIG_BT_H4_ASYNC)
+static inline void h4_get_type(void)
 {
-	struct bt_hci_acl_hdr *hdr = &rx.acl;
-	int to_read = sizeof(*hdr) - rx.remaining;
+	uint8_t type;
 
-	rx.remaining -= uart_fifo_read(h4_dev, (uint8_t *)hdr + to_read,
-				       rx.remaining);
+	/* Get packet type */
+	if (uart_fifo_read(h4_dev, &type, 1) != 1) {
+		BT_WARN("Unable to read H:4 packet type");
+		rx.type = H4_NONE;
+		return;
+	}
+
+	h4_set_type(type);
+}
+#endif /* !CONFIG_BT_H4_ASYNC */
+
+static void acl_hdr_check(void)
+{
 	if (!rx.remaining) {
-		rx.remaining = sys_le16_to_cpu(hdr->len);
+		rx.remaining = sys_le16_to_cpu(rx.acl.len);
 		BT_DBG("Got ACL header. Payload %u bytes", rx.remaining);
 		rx.have_hdr = true;
 	}
 }
 
-static inline void get_evt_hdr(void)
+#if !defined(CONFIG_BT_H4_ASYNC)
+static inline void get_acl_hdr(void)
 {
-	struct bt_hci_evt_hdr *hdr = &rx.evt;
-	int to_read = rx.hdr_len - rx.remaining;
+	struct bt_hci_acl_hdr *hdr = &rx.acl;
+	int to_read = sizeof(*hdr) - rx.remaining;
 
 	rx.remaining -= uart_fifo_read(h4_dev, (uint8_t *)hdr + to_read,
 				       rx.remaining);
+	acl_hdr_check();
+}
+#endif /* !CONFIG_BT_H4_ASYNC */
+
+static void evt_hdr_check(void)
+{
+	struct bt_hci_evt_hdr *hdr = &rx.evt;
+
 	if (rx.hdr_len == sizeof(*hdr) && rx.remaining < sizeof(*hdr)) {
 		switch (rx.evt.evt) {
 		case BT_HCI_EVT_LE_META_EVENT:
@@ -142,6 +157,18 @@ static inline void get_evt_hdr(void)
 	}
 }
 
+#if !defined(CONFIG_BT_H4_ASYNC)
+static inline void get_evt_hdr(void)
+{
+	struct bt_hci_evt_hdr *hdr = &rx.evt;
+	int to_read = rx.hdr_len - rx.remaining;
+
+	rx.remaining -= uart_fifo_read(h4_dev, (uint8_t *)hdr + to_read,
+				       rx.remaining);
+	evt_hdr_check();
+}
+#endif /* !CONFIG_BT_H4_ASYNC */
+
 
 static inline void copy_hdr(struct net_buf *buf)
 {
@@ -168,6 +195,291 @@ static struct net_buf *get_rx(k_timeout_t timeout)
 	return bt_buf_get_rx(BT_BUF_ACL_IN, timeout);
 }
 
+static void h4_complete_rx(void)
+{
+	struct net_buf *buf;
+	uint8_t evt_flags;
+
+	buf = rx.buf;
+	rx.buf = NULL;
+
+	if (rx.type == H4_EVT) {
+		evt_flags = bt_hci_evt_get_flags(rx.evt.evt);
+		bt_buf_set_type(buf, BT_BUF_EVT);
+	} else {
+		evt_flags = BT_HCI_EVT_FLAG_RECV;
+		bt_buf_set_type(buf, BT_BUF_ACL_IN);
+	}
+
+	reset_rx();
+
+	if (evt_flags & BT_HCI_EVT_FLAG_RECV_PRIO) {
+		BT_DBG("Calling bt_recv_prio(%p)", buf);
+		bt_recv_prio(buf);
+	}
+
+	if (evt_flags & BT_HCI_EVT_FLAG_RECV) {
+		BT_DBG("Putting buf %p to rx fifo", buf);
+		net_buf_put(&rx.fifo, buf);
+	}
+}
+
+#if defined(CONFIG_BT_H4_ASYNC)
+/* Reception is double-buffered: while the DMA fills one bounce buffer
+ * the other one is handed to the driver through UART_RX_BUF_REQUEST, so
+ * reception never stops on a buffer boundary.
+ */
+static uint8_t async_rx_bufs[2][CONFIG_BT_H4_ASYNC_RX_BUF_SIZE];
+static uint8_t async_rx_next;
+
+/* Holds bytes that could not be consumed because no net_buf was
+ * available. Reception is stopped while this is non-empty and the
+ * rx_thread resumes it once it has allocated a buffer.
+ */
+static uint8_t async_rx_stash[CONFIG_BT_H4_ASYNC_RX_BUF_SIZE];
+static uint16_t async_rx_stash_len;
+static bool async_rx_paused;
+static bool async_rx_stopped;
+
+static void h4_async_rx_start(void)
+{
+	int err;
+
+	async_rx_next = 1U;
+	async_rx_stopped = false;
+
+	err = uart_rx_enable(h4_dev, async_rx_bufs[0],
+			     sizeof(async_rx_bufs[0]),
+			     CONFIG_BT_H4_ASYNC_RX_TIMEOUT);
+	if (err) {
+		BT_ERR("Unable to enable UART reception (err %d)", err);
+	}
+}
+
+static size_t h4_async_consume(const uint8_t *data, size_t len)
+{
+	size_t consumed = 0;
+
+	while (consumed < len) {
+		size_t n;
+
+		if (rx.discard) {
+			n = MIN(len - consumed, (size_t)rx.discard);
+			rx.discard -= n;
+			consumed += n;
+			continue;
+		}
+
+		if (rx.type == H4_NONE) {
+			/* An unknown type resets rx.type back to H4_NONE,
+			 * which resynchronizes to the packet boundary one
+			 * byte at a time.
+			 */
+			h4_set_type(data[consumed]);
+			consumed++;
+			continue;
+		}
+
+		if (!rx.have_hdr) {
+			n = MIN(len - consumed, (size_t)rx.remaining);
+			memcpy(&rx.hdr[rx.hdr_len - rx.remaining],
+			       &data[consumed], n);
+			rx.remaining -= n;
+			consumed += n;
+
+			if (rx.type == H4_EVT) {
+				evt_hdr_check();
+			} else {
+				acl_hdr_check();
+			}
+
+			continue;
+		}
+
+		if (!rx.buf) {
+			rx.buf = get_rx(K_NO_WAIT);
+			if (!rx.buf) {
+				if (rx.discardable) {
+					BT_WARN("Discarding event 0x%02x",
+						rx.evt.evt);
+					rx.discard = rx.remaining;
+					reset_rx();
+					continue;
+				}
+
+				BT_WARN("Failed to allocate, deferring to rx_thread");
+				return consumed;
+			}
+
+			BT_DBG("Allocated rx.buf %p", rx.buf);
+
+			if (rx.remaining > net_buf_tailroom(rx.buf)) {
+				BT_ERR("Not enough space in buffer");
+				rx.discard = rx.remaining;
+				reset_rx();
+				continue;
+			}
+
+			copy_hdr(rx.buf);
+		}
+
+		n = MIN(len - consumed, (size_t)rx.remaining);
+		net_buf_add_mem(rx.buf, &data[consumed], n);
+		rx.remaining -= n;
+		consumed += n;
+
+		if (!rx.remaining) {
+			h4_complete_rx();
+		}
+	}
+
+	return consumed;
+}
+
+static void h4_async_pause(const uint8_t *data, size_t len)
+{
+	async_rx_stash_len = len;
+	memcpy(async_rx_stash, data, len);
+	async_rx_paused = true;
+	uart_rx_disable(h4_dev);
+}
+
+static void h4_async_resume(void)
+{
+	unsigned int key;
+	size_t consumed;
+
+	key = irq_lock();
+
+	if (!async_rx_paused) {
+		irq_unlock(key);
+		return;
+	}
+
+	consumed = h4_async_consume(async_rx_stash, async_rx_stash_len);
+	if (consumed < async_rx_stash_len) {
+		/* Still no buffer: stay paused */
+		async_rx_stash_len -= consumed;
+		memmove(async_rx_stash, &async_rx_stash[consumed],
+			async_rx_stash_len);
+		irq_unlock(key);
+		return;
+	}
+
+	async_rx_stash_len = 0U;
+	async_rx_paused = false;
+
+	if (async_rx_stopped) {
+		h4_async_rx_start();
+	}
+
+	irq_unlock(key);
+}
+
+static void h4_async_tx_start(void)
+{
+	unsigned int key;
+	uint8_t type;
+	int err;
+
+	key = irq_lock();
+
+	if (tx.buf) {
+		/* Transmission already in progress */
+		irq_unlock(key);
+		return;
+	}
+
+	tx.buf = net_buf_get(&tx.fifo, K_NO_WAIT);
+	if (!tx.buf) {
+		irq_unlock(key);
+		return;
+	}
+
+	switch (bt_buf_get_type(tx.buf)) {
+	case BT_BUF_ACL_OUT:
+		type = H4_ACL;
+		break;
+	case BT_BUF_CMD:
+		type = H4_CMD;
+		break;
+	default:
+		BT_ERR("Unknown buffer type");
+		net_buf_unref(tx.buf);
+		tx.buf = NULL;
+		irq_unlock(key);
+		return;
+	}
+
+	net_buf_push_u8(tx.buf, type);
+
+	err = uart_tx(h4_dev, tx.buf->data, tx.buf->len, SYS_FOREVER_MS);
+	if (err) {
+		BT_ERR("Unable to start UART transmission (err %d)", err);
+		net_buf_unref(tx.buf);
+		tx.buf = NULL;
+	}
+
+	irq_unlock(key);
+}
+
+static void h4_async_cb(struct device *dev, struct uart_event *evt,
+			void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+		net_buf_unref(tx.buf);
+		tx.buf = NULL;
+		h4_async_tx_start();
+		break;
+	case UART_RX_RDY: {
+		const uint8_t *data = &evt->data.rx.buf[evt->data.rx.offset];
+		size_t len = evt->data.rx.len;
+		size_t consumed;
+
+		if (async_rx_paused) {
+			/* Residual data flushed after uart_rx_disable() */
+			size_t n = MIN(len, sizeof(async_rx_stash) -
+					    async_rx_stash_len);
+			if (n < len) {
+				BT_ERR("RX stash overflow, dropping %zu bytes",
+				       len - n);
+			}
+			memcpy(&async_rx_stash[async_rx_stash_len], data, n);
+			async_rx_stash_len += n;
+			break;
+		}
+
+		consumed = h4_async_consume(data, len);
+		if (consumed < len) {
+			h4_async_pause(&data[consumed], len - consumed);
+		}
+		break;
+	}
+	case UART_RX_BUF_REQUEST:
+		uart_rx_buf_rsp(dev, async_rx_bufs[async_rx_next],
+				sizeof(async_rx_bufs[0]));
+		async_rx_next = (async_rx_next + 1U) % ARRAY_SIZE(async_rx_bufs);
+		break;
+	case UART_RX_STOPPED:
+		BT_ERR("UART reception stopped (reason %d)",
+		       evt->data.rx_stop.reason);
+		break;
+	case UART_RX_DISABLED:
+		async_rx_stopped = true;
+		if (!async_rx_paused) {
+			h4_async_rx_start();
+		}
+		break;
+	default:
+		break;
+	}
+}
+#endif /* CONFIG_BT_H4_ASYNC */
+
 static void rx_thread(void *p1, void *p2, void *p3)
 {
 	struct net_buf *buf;
@@ -197,6 +509,26 @@ static void rx_thread(void *p1, void *p2, void *p3)
 			}
 		}
 
+#if defined(CONFIG_BT_H4_ASYNC)
+		/* Process stashed bytes and restart reception if it was
+		 * stopped while waiting for a buffer.
+		 */
+		h4_async_resume();
+
+		buf = net_buf_get(&rx.fifo, K_FOREVER);
+		do {
+			BT_DBG("Calling bt_recv(%p)", buf);
+			bt_recv(buf);
+
+			/* Give other threads a chance to run if the UART
+			 * is receiving data so fast that rx.fifo never
+			 * or very rarely goes empty.
+			 */
+			k_yield();
+
+			buf = net_buf_get(&rx.fifo, K_NO_WAIT);
+		} while (buf);
+#else
 		/* Let the ISR continue receiving new packets */
 		uart_irq_rx_enable(h4_dev);
 
@@ -216,6 +548,7 @@ static void rx_thread(void *p1, void *p2, void *p3)
 			uart_irq_rx_disable(h4_dev);
 			buf = net_buf_get(&rx.fifo, K_NO_WAIT);
 		} while (buf);
+#endif /* CONFIG_BT_H4_ASYNC */
 	}
 }
 
@@ -226,10 +559,9 @@ static size_t h4_discard(struct device *uart, size_t len)
 	return uart_fifo_read(uart, buf, MIN(len, sizeof(buf)));
 }
 
+#if !defined(CONFIG_BT_H4_ASYNC)
 static inline void read_payload(void)
 {
-	struct net_buf *buf;
-	uint8_t evt_flags;
 	int read;
 
 	if (!rx.buf) {
@@ -271,28 +603,7 @@ static inline void read_payload(void)
 		return;
 	}
 
-	buf = rx.buf;
-	rx.buf = NULL;
-
-	if (rx.type == H4_EVT) {
-		evt_flags = bt_hci_evt_get_flags(rx.evt.evt);
-		bt_buf_set_type(buf, BT_BUF_EVT);
-	} else {
-		evt_flags = BT_HCI_EVT_FLAG_RECV;
-		bt_buf_set_type(buf, BT_BUF_ACL_IN);
-	}
-
-	reset_rx();
-
-	if (evt_flags & BT_HCI_EVT_FLAG_RECV_PRIO) {
-		BT_DBG("Calling bt_recv_prio(%p)", buf);
-		bt_recv_prio(buf);
-	}
-
-	if (evt_flags & BT_HCI_EVT_FLAG_RECV) {
-		BT_DBG("Putting buf %p to rx fifo", buf);
-		net_buf_put(&rx.fifo, buf);
-	}
+	h4_complete_rx();
 }
 
 static inline void read_header(void)
@@ -406,13 +717,18 @@ static void bt_uart_isr(struct device *unused, void *user_data)
 		}
 	}
 }
+#endif /* !CONFIG_BT_H4_ASYNC */
 
 static int h4_send(struct net_buf *buf)
 {
 	BT_DBG("buf %p type %u len %u", buf, bt_buf_get_type(buf), buf->len);
 
 	net_buf_put(&tx.fifo, buf);
+#if defined(CONFIG_BT_H4_ASYNC)
+	h4_async_tx_start();
+#else
 	uart_irq_tx_enable(h4_dev);
+#endif
 
 	return 0;
 }
@@ -443,7 +759,16 @@ static int h4_open(void)
 		return -EIO;
 	}
 
+#if defined(CONFIG_BT_H4_ASYNC)
+	ret = uart_callback_set(h4_dev, h4_async_cb, NULL);
+	if (ret) {
+		return ret;
+	}
+
+	h4_async_rx_start();
+#else
 	uart_irq_callback_set(h4_dev, bt_uart_isr);
+#endif
 
 	k_thread_create(&rx_thread_data, rx_thread_stack,
 			K_THREAD_STACK_SIZEOF(rx_thread_stack),
@@ -58,6 +58,116 @@ void uart_mcumgr_free_rx_buf(struct uart_mcumgr_rx_buf *rx_buf)
 	k_mem_slab_free(&uart_mcumgr_slab, &block);
 }
 
+#ifdef CONFIG_UART_MCUMGR_ASYNC
+/** DMA reception blocks, rotated through the driver so reception
+ * continues while a completed block is processed.
+ */
+static uint8_t uart_mcumgr_blocks[2][CONFIG_UART_MCUMGR_ASYNC_BLOCK_SIZE];
+static uint8_t uart_mcumgr_next_block;
+
+/** Inactivity period after which a partial block is flushed to the
+ * frame splitter, in milliseconds.
+ */
+#define UART_MCUMGR_RX_TIMEOUT_MS	1
+
+/**
+ * Appends a chunk of received data to the fragment being reassembled,
+ * dropping the rest of the line on overflow or buffer exhaustion.
+ */
+static void uart_mcumgr_rx_chunk(const uint8_t *buf, size_t len)
+{
+	struct uart_mcumgr_rx_buf *rx_buf;
+
+	if (uart_mcumgr_ignoring) {
+		return;
+	}
+
+	if (uart_mcumgr_cur_buf == NULL) {
+		uart_mcumgr_cur_buf = uart_mcumgr_alloc_rx_buf();
+		if (uart_mcumgr_cur_buf == NULL) {
+			/* Insufficient buffers; drop this fragment. */
+			uart_mcumgr_ignoring = true;
+			return;
+		}
+	}
+
+	rx_buf = uart_mcumgr_cur_buf;
+	if (len > sizeof(rx_buf->data) - rx_buf->length) {
+		/* Line too long; drop this fragment. */
+		uart_mcumgr_free_rx_buf(rx_buf);
+		uart_mcumgr_cur_buf = NULL;
+		uart_mcumgr_ignoring = true;
+		return;
+	}
+
+	memcpy(rx_buf->data + rx_buf->length, buf, len);
+	rx_buf->length += len;
+}
+
+/**
+ * Splits a received block into newline-delimited fragments, copying
+ * whole runs at a time instead of inspecting every byte in interrupt
+ * context.
+ */
+static void uart_mcumgr_rx_block(const uint8_t *buf, size_t len)
+{
+	struct uart_mcumgr_rx_buf *rx_buf;
+	const uint8_t *end;
+	size_t chunk;
+
+	while (len > 0) {
+		end = memchr(buf, '\n', len);
+		chunk = (end == NULL) ? len : (size_t)(end - buf) + 1;
+
+		uart_mcumgr_rx_chunk(buf, chunk);
+
+		if (end != NULL) {
+			/* Fragment complete. */
+			if (uart_mcumgr_ignoring) {
+				uart_mcumgr_ignoring = false;
+			} else {
+				rx_buf = uart_mcumgr_cur_buf;
+				uart_mcumgr_cur_buf = NULL;
+				if (rx_buf != NULL) {
+					uart_mgumgr_recv_cb(rx_buf);
+				}
+			}
+		}
+
+		buf += chunk;
+		len -= chunk;
+	}
+}
+
+static void uart_mcumgr_async_cb(struct device *dev, struct uart_event *evt,
+				 void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	switch (evt->type) {
+	case UART_RX_RDY:
+		uart_mcumgr_rx_block(evt->data.rx.buf + evt->data.rx.offset,
+				     evt->data.rx.len);
+		break;
+	case UART_RX_BUF_REQUEST:
+		(void)uart_rx_buf_rsp(dev,
+				      uart_mcumgr_blocks[uart_mcumgr_next_block],
+				      sizeof(uart_mcumgr_blocks[0]));
+		uart_mcumgr_next_block ^= 1;
+		break;
+	case UART_RX_DISABLED:
+		/* Restart reception, e.g. after an RX error. */
+		(void)uart_rx_enable(dev,
+				     uart_mcumgr_blocks[uart_mcumgr_next_block],
+				     sizeof(uart_mcumgr_blocks[0]),
+				     UART_MCUMGR_RX_TIMEOUT_MS);
+		uart_mcumgr_next_block ^= 1;
+		break;
+	default:
+		break;
+	}
+}
+#else /* !CONFIG_UART_MCUMGR_ASYNC */
 /**
  * Reads a chunk of received data from the UART.
  */
@@ -141,6 +251,7 @@ static void uart_mcumgr_isr(struct device *unused, void *user_data)
 		}
 	}
 }
+#endif /* !CONFIG_UART_MCUMGR_ASYNC */
 
 /**
  * Sends raw data over the UART.
@@ -164,6 +275,14 @@ int uart_mcumgr_send(const uint8_t *data, int len)
 
 static void uart_mcumgr_setup(struct device *uart)
 {
+#ifdef CONFIG_UART_MCUMGR_ASYNC
+	(void)uart_callback_set(uart, uart_mcumgr_async_cb, NULL);
+
+	(void)uart_rx_enable(uart, uart_mcumgr_blocks[0],
+			     sizeof(uart_mcumgr_blocks[0]),
+			     UART_MCUMGR_RX_TIMEOUT_MS);
+	uart_mcumgr_next_block = 1;
+#else
 	uint8_t c;
 
 	uart_irq_rx_disable(uart);
@@ -177,6 +296,7 @@ static void uart_mcumgr_setup(struct device *uart)
 	uart_irq_callback_set(uart, uart_mcumgr_isr);
 
 	uart_irq_rx_enable(uart);
+#endif
 }
 
 void uart_mcumgr_register(uart_mcumgr_recv_fn *cb)
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Asynchronous front end for the synchronous display_write() API.
+ * Submitted dirty rectangles are queued on a k_fifo and pushed to the
+ * panel in order by a dedicated thread, which invokes the completion
+ * callback once the buffer may be reused.  GUI flush callbacks submit
+ * and return immediately, so rendering of the next frame overlaps
+ * with the bus transfer of the current one.
+ */
+
+#include <kernel.h>
+#include <drivers/display.h>
+
+static K_FIFO_DEFINE(display_write_fifo);
+
+static void display_async_thread(void *p1, void *p2, void *p3)
+{
+	struct display_write_req *req;
+	int ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		req = k_fifo_get(&display_write_fifo, K_FOREVER);
+
+		ret = display_write(req->dev, req->x, req->y, req->desc,
+				    req->buf);
+
+		if (req->callback != NULL) {
+			req->callback(req->dev, ret, req->user_data);
+		}
+	}
+}
+
+int display_write_async(struct display_write_req *req)
+{
+	k_fifo_put(&display_write_fifo, req);
+
+	return 0;
+}
+
+K_THREAD_DEFINE(display_async_tid, CONFIG_DISPLAY_ASYNC_WRITE_STACK_SIZE,
+		display_async_thread, NULL, NULL, NULL,
+		K_PRIO_COOP(CONFIG_DISPLAY_ASYNC_WRITE_THREAD_PRIO), 0, 0);
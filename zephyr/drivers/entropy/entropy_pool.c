@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Driver-agnostic buffered entropy pool.  A background thread keeps a
+ * ring of random bytes topped up from the chosen entropy device, so
+ * entropy_pool_get_isr() can satisfy requests in constant time from
+ * any context; whenever the fill level drops below the low watermark,
+ * the refill thread is woken.  This generalizes the ISR pool that
+ * entropy_nrf5.c implements privately to every entropy driver.
+ */
+
+#include <string.h>
+
+#include <kernel.h>
+#include <device.h>
+#include <drivers/entropy.h>
+
+#define POOL_SIZE	CONFIG_ENTROPY_POOL_SIZE
+#define POOL_WATERMARK	CONFIG_ENTROPY_POOL_LOW_WATERMARK
+#define REFILL_CHUNK	32
+
+static uint8_t pool_buf[POOL_SIZE];
+static uint16_t pool_head; /* next byte to read */
+static uint16_t pool_level;
+static struct k_spinlock pool_lock;
+static K_SEM_DEFINE(refill_sem, 1, 1);
+
+int entropy_pool_get_isr(uint8_t *buffer, size_t length)
+{
+	k_spinlock_key_t key;
+	size_t cnt;
+	size_t i;
+
+	key = k_spin_lock(&pool_lock);
+
+	cnt = MIN(length, pool_level);
+	for (i = 0; i < cnt; i++) {
+		buffer[i] = pool_buf[pool_head];
+		pool_head = (pool_head + 1U) % POOL_SIZE;
+	}
+	pool_level -= cnt;
+
+	k_spin_unlock(&pool_lock, key);
+
+	if (pool_level < POOL_WATERMARK) {
+		k_sem_give(&refill_sem);
+	}
+
+	return cnt;
+}
+
+static void entropy_pool_thread(void *p1, void *p2, void *p3)
+{
+	struct device *dev;
+	uint8_t chunk[REFILL_CHUNK];
+	k_spinlock_key_t key;
+	uint16_t tail;
+	size_t room;
+	size_t i;
+	int ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	dev = device_get_binding(DT_CHOSEN_ZEPHYR_ENTROPY_LABEL);
+	__ASSERT(dev != NULL, "Entropy device not found");
+
+	for (;;) {
+		k_sem_take(&refill_sem, K_FOREVER);
+
+		while (pool_level < POOL_SIZE) {
+			room = MIN(POOL_SIZE - pool_level,
+				   (uint16_t)sizeof(chunk));
+
+			ret = entropy_get_entropy(dev, chunk, room);
+			if (ret < 0) {
+				/* The generator may not be ready during
+				 * early boot; back off and retry.
+				 */
+				k_sleep(K_MSEC(10));
+				continue;
+			}
+
+			key = k_spin_lock(&pool_lock);
+			tail = (pool_head + pool_level) % POOL_SIZE;
+			for (i = 0; i < room; i++) {
+				pool_buf[tail] = chunk[i];
+				tail = (tail + 1U) % POOL_SIZE;
+			}
+			pool_level += room;
+			k_spin_unlock(&pool_lock, key);
+		}
+	}
+}
+
+K_THREAD_DEFINE(entropy_pool_tid, CONFIG_ENTROPY_POOL_STACK_SIZE,
+		entropy_pool_thread, NULL, NULL, NULL,
+		K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0);
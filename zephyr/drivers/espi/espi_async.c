@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Asynchronous front end for espi_send_oob().  Queued packets are sent
+ * in submission order by a dedicated thread, back to back when several
+ * are pending, so a burst of host-bound OOB messages drains without
+ * the EC main loop blocking per packet.
+ */
+
+#include <kernel.h>
+#include <drivers/espi.h>
+
+static K_FIFO_DEFINE(espi_oob_fifo);
+
+static void espi_oob_thread(void *p1, void *p2, void *p3)
+{
+	struct espi_oob_req *req;
+	int ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		req = k_fifo_get(&espi_oob_fifo, K_FOREVER);
+
+		ret = espi_send_oob(req->dev, &req->pckt);
+
+		if (req->callback != NULL) {
+			req->callback(req->dev, &req->pckt, ret,
+				      req->user_data);
+		}
+	}
+}
+
+int espi_send_oob_async(struct espi_oob_req *req)
+{
+	k_fifo_put(&espi_oob_fifo, req);
+
+	return 0;
+}
+
+K_THREAD_DEFINE(espi_oob_tid, CONFIG_ESPI_OOB_ASYNC_STACK_SIZE,
+		espi_oob_thread, NULL, NULL, NULL,
+		K_PRIO_COOP(CONFIG_ESPI_OOB_ASYNC_THREAD_PRIO), 0, 0);
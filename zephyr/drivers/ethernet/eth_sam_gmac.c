@@ -28,6 +28,7 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 
 #include <kernel.h>
 #include <device.h>
+#include <cache.h>
 #include <sys/__assert.h>
 #include <sys/util.h>
 #include <errno.h>
@@ -52,43 +53,19 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 #include <net/gptp.h>
 #endif
 
-#ifdef __DCACHE_PRESENT
-static bool dcache_enabled;
-
-static inline void dcache_is_enabled(void)
-{
-	dcache_enabled = (SCB->CCR & SCB_CCR_DC_Msk);
-}
+/* Cache maintenance is delegated to the cpu/device buffer ownership
+ * API; sys_cache_*() compile away on cacheless cores (SAM4E) and
+ * check at runtime whether the d-cache is enabled.
+ */
 static inline void dcache_invalidate(uint32_t addr, uint32_t size)
 {
-	if (!dcache_enabled) {
-		return;
-	}
-
-	/* Make sure it is aligned to 32B */
-	uint32_t start_addr = addr & (uint32_t)~(GMAC_DCACHE_ALIGNMENT - 1);
-	uint32_t size_full = size + addr - start_addr;
-
-	SCB_InvalidateDCache_by_Addr((uint32_t *)start_addr, size_full);
+	sys_cache_buf_dev_to_cpu((void *)addr, size);
 }
 
 static inline void dcache_clean(uint32_t addr, uint32_t size)
 {
-	if (!dcache_enabled) {
-		return;
-	}
-
-	/* Make sure it is aligned to 32B */
-	uint32_t start_addr = addr & (uint32_t)~(GMAC_DCACHE_ALIGNMENT - 1);
-	uint32_t size_full = size + addr - start_addr;
-
-	SCB_CleanDCache_by_Addr((uint32_t *)start_addr, size_full);
+	sys_cache_buf_cpu_to_dev((void *)addr, size);
 }
-#else
-#define dcache_is_enabled()
-#define dcache_invalidate(addr, size)
-#define dcache_clean(addr, size)
-#endif
 
 #ifdef CONFIG_SOC_FAMILY_SAM0
 #define MCK_FREQ_HZ	SOC_ATMEL_SAM0_MCK_FREQ_HZ
@@ -475,7 +452,7 @@ static int rx_descriptors_init(Gmac *gmac, struct gmac_queue *queue)
 	rx_desc_list->tail = 0U;
 
 	for (int i = 0; i < rx_desc_list->len; i++) {
-		rx_buf = net_pkt_get_reserve_rx_data(K_NO_WAIT);
+		rx_buf = net_pkt_rx_data_loan(K_NO_WAIT);
 		if (rx_buf == NULL) {
 			free_rx_bufs(rx_frag_list, rx_desc_list->len);
 			LOG_ERR("Failed to reserve data net buffers");
@@ -1214,6 +1191,8 @@ static int nonpriority_queue_init(Gmac *gmac, struct gmac_queue *queue)
 		GMAC_DCFGR_DRBS(CONFIG_NET_BUF_DATA_SIZE >> 6) |
 		/* Attempt to use INCR4 AHB bursts (Default) */
 		GMAC_DCFGR_FBLDO_INCR4 |
+		/* Transmit Checksum Generation Offload Enable */
+		GMAC_DCFGR_TXCOEN |
 		/* DMA Queue Flags */
 		GMAC_DMA_QUEUE_FLAGS;
 
@@ -1302,8 +1281,8 @@ static struct net_pkt *frame_get(struct gmac_queue *queue)
 			/* Assure cache coherency after DMA write operation */
 			dcache_invalidate((uint32_t)frag_data, frag->size);
 
-			/* Get a new data net buffer from the buffer pool */
-			new_frag = net_pkt_get_frag(rx_frame, K_NO_WAIT);
+			/* Loan a replacement buffer for the descriptor */
+			new_frag = net_pkt_rx_data_loan(K_NO_WAIT);
 			if (new_frag == NULL) {
 				queue->err_rx_frames_dropped++;
 				net_pkt_unref(rx_frame);
@@ -1876,9 +1855,6 @@ static void eth0_iface_init(struct net_if *iface)
 		return;
 	}
 
-	/* Check the status of data caches */
-	dcache_is_enabled();
-
 	/* Initialize GMAC driver */
 	gmac_ncfgr_val =
 		  GMAC_NCFGR_MTIHEN  /* Multicast Hash Enable */
@@ -1980,6 +1956,8 @@ static enum ethernet_hw_caps eth_sam_gmac_get_capabilities(struct device *dev)
 	ARG_UNUSED(dev);
 
 	return ETHERNET_HW_VLAN | ETHERNET_LINK_10BASE_T |
+		ETHERNET_HW_TX_CHKSUM_OFFLOAD |
+		ETHERNET_HW_RX_CHKSUM_OFFLOAD |
 #if defined(CONFIG_PTP_CLOCK_SAM_GMAC)
 		ETHERNET_PTP |
 #endif
@@ -201,6 +201,20 @@ static int flash_sim_read(struct device *dev, const off_t offset, void *data,
 	return 0;
 }
 
+static int flash_sim_get_mapped_address(struct device *dev, const off_t offset,
+					const size_t len, const void **ptr)
+{
+	ARG_UNUSED(dev);
+
+	if (!flash_range_is_valid(dev, offset, len)) {
+		return -EINVAL;
+	}
+
+	*ptr = FLASH(offset);
+
+	return 0;
+}
+
 static int flash_sim_write(struct device *dev, const off_t offset,
 			   const void *data, const size_t len)
 {
@@ -363,6 +377,7 @@ static const struct flash_driver_api flash_sim_api = {
 	.erase = flash_sim_erase,
 	.write_protection = flash_wp_set,
 	.get_parameters = flash_sim_get_parameters,
+	.get_mapped_address = flash_sim_get_mapped_address,
 #ifdef CONFIG_FLASH_PAGE_LAYOUT
 	.page_layout = flash_sim_page_layout,
 #endif
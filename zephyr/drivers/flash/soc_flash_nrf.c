@@ -98,6 +98,16 @@ struct flash_op_desc {
 /* semaphore for synchronization of flash operations */
 static struct k_sem sem_sync;
 
+#if defined(CONFIG_BT_TICKER_EXT)
+/* Extension data for the flash timeslot ticker.  A non-zero slot
+ * window lets the ticker plan each flash slot into a gap between
+ * radio events ahead of time instead of colliding with them at the
+ * fixed periodic expiry and forcing radio aborts.  A single instance
+ * suffices: flash operations are serialized by sem_lock.
+ */
+static struct ticker_ext flash_ticker_ext;
+#endif /* CONFIG_BT_TICKER_EXT */
+
 static int write_op(void *context); /* instance of flash_op_handler_t */
 static int write_in_timeslice(off_t addr, const void *data, size_t len);
 
@@ -190,6 +200,23 @@ static int flash_nrf_read(struct device *dev, off_t addr,
 	return 0;
 }
 
+static int flash_nrf_get_mapped_address(struct device *dev, off_t addr,
+					size_t len, const void **ptr)
+{
+	/* The NVMC exposes the whole array in the CPU address space,
+	 * so reads follow the same address translation as flash_nrf_read().
+	 */
+	if (is_regular_addr_valid(addr, len)) {
+		addr += DT_REG_ADDR(SOC_NV_FLASH_NODE);
+	} else if (!is_uicr_addr_valid(addr, len)) {
+		return -EINVAL;
+	}
+
+	*ptr = (const void *)addr;
+
+	return 0;
+}
+
 static int flash_nrf_write(struct device *dev, off_t addr,
 			     const void *data, size_t len)
 {
@@ -301,6 +328,7 @@ static const struct flash_driver_api flash_nrf_api = {
 	.erase = flash_nrf_erase,
 	.write_protection = flash_nrf_write_protection,
 	.get_parameters = flash_nrf_get_parameters,
+	.get_mapped_address = flash_nrf_get_mapped_address,
 #if defined(CONFIG_FLASH_PAGE_LAYOUT)
 	.page_layout = flash_nrf_pages_layout,
 #endif
@@ -432,7 +460,20 @@ static int work_in_time_slice(struct flash_op_desc *p_flash_op_desc)
 
 	ll_timeslice_ticker_id_get(&instance_index, &ticker_id);
 
+#if defined(CONFIG_BT_TICKER_EXT)
+	/* Allow the slot to be re-scheduled anywhere within one
+	 * interval, so the ticker places it in a known radio gap
+	 * rather than stalling behind connection events.
+	 */
+	flash_ticker_ext.ticks_slot_window =
+		HAL_TICKER_US_TO_TICKS(context->interval);
+	flash_ticker_ext.ticks_drift = 0;
+	flash_ticker_ext.reschedule_state = 0U;
+
+	err = ticker_start_ext(instance_index,
+#else
 	err = ticker_start(instance_index,
+#endif /* CONFIG_BT_TICKER_EXT */
 			   3, /* user id for thread mode */
 			      /* (MAYFLY_CALL_ID_PROGRAM) */
 			   ticker_id, /* flash ticker id */
@@ -447,7 +488,11 @@ static int work_in_time_slice(struct flash_op_desc *p_flash_op_desc)
 			   time_slot_callback_prepare,
 			   p_flash_op_desc,
 			   NULL, /* no op callback */
-			   NULL);
+			   NULL
+#if defined(CONFIG_BT_TICKER_EXT)
+			   , &flash_ticker_ext
+#endif /* CONFIG_BT_TICKER_EXT */
+			   );
 
 	if (err != TICKER_STATUS_SUCCESS && err != TICKER_STATUS_BUSY) {
 		result = -ECANCELED;
@@ -34,7 +34,11 @@ static void gpio_stm32_isr(int line, void *arg)
 	struct device *dev = arg;
 	struct gpio_stm32_data *data = dev->driver_data;
 
+#ifdef CONFIG_GPIO_CALLBACK_INDEX
+	gpio_fire_callbacks_indexed(&data->cb, dev, BIT(line));
+#else
 	gpio_fire_callbacks(&data->cb, dev, BIT(line));
+#endif
 }
 
 /**
@@ -482,7 +486,11 @@ static int gpio_stm32_manage_callback(struct device *dev,
 {
 	struct gpio_stm32_data *data = dev->driver_data;
 
+#ifdef CONFIG_GPIO_CALLBACK_INDEX
+	return gpio_manage_callback_indexed(&data->cb, callback, set);
+#else
 	return gpio_manage_callback(&data->cb, callback, set);
+#endif
 }
 
 static const struct gpio_driver_api gpio_stm32_driver = {
@@ -15,6 +15,8 @@
 #include <pinmux/stm32/pinmux_stm32.h>
 #include <drivers/gpio.h>
 
+#include "gpio_utils.h"
+
 /* GPIO buses definitions */
 
 #define STM32_PORT_NOT_AVAILABLE 0xFFFFFFFF
@@ -219,7 +221,11 @@ struct gpio_stm32_data {
 	/* gpio_driver_data needs to be first */
 	struct gpio_driver_data common;
 	/* user ISR cb */
+#ifdef CONFIG_GPIO_CALLBACK_INDEX
+	struct gpio_callback_index cb;
+#else
 	sys_slist_t cb;
+#endif
 };
 
 /**
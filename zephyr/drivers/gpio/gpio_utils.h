@@ -72,4 +72,90 @@ static inline void gpio_fire_callbacks(sys_slist_t *list,
 	}
 }
 
+#ifdef CONFIG_GPIO_CALLBACK_INDEX
+/**
+ * @brief Per-pin callback index.
+ *
+ * Maps every pin of a port directly to the callback registered for it,
+ * so the port interrupt dispatches in constant time instead of walking
+ * the whole callback list.  At most one callback can be registered per
+ * pin; a callback covering several pins is indexed on each of them and
+ * fired only once per interrupt.
+ */
+struct gpio_callback_index {
+	struct gpio_callback *per_pin[GPIO_MAX_PINS_PER_PORT];
+};
+
+/**
+ * @brief Insert or remove a callback from a per-pin callback index
+ *
+ * @param index A pointer to the callback index
+ * @param callback A pointer of the callback to insert or remove
+ * @param set A boolean indicating insertion or removal of the callback
+ *
+ * @return 0 on success, -EBUSY if another callback already owns one of
+ *	   the requested pins.
+ */
+static inline int gpio_manage_callback_indexed(struct gpio_callback_index *index,
+					       struct gpio_callback *callback,
+					       bool set)
+{
+	uint32_t mask = callback->pin_mask;
+	int pin;
+
+	__ASSERT(callback, "No callback!");
+	__ASSERT(callback->handler, "No callback handler!");
+
+	if (set) {
+		for (pin = 0; pin < GPIO_MAX_PINS_PER_PORT; pin++) {
+			if ((mask & BIT(pin)) &&
+			    (index->per_pin[pin] != NULL) &&
+			    (index->per_pin[pin] != callback)) {
+				return -EBUSY;
+			}
+		}
+	}
+
+	for (pin = 0; pin < GPIO_MAX_PINS_PER_PORT; pin++) {
+		if (mask & BIT(pin)) {
+			index->per_pin[pin] = set ? callback : NULL;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Fire the callbacks of the triggered pins via the index
+ *
+ * @param index A pointer to the callback index
+ * @param port A pointer on the gpio driver instance
+ * @param pins The actual pin mask that triggered the interrupt
+ */
+static inline void gpio_fire_callbacks_indexed(struct gpio_callback_index *index,
+					       struct device *port,
+					       uint32_t pins)
+{
+	uint32_t remaining = pins;
+
+	while (remaining != 0U) {
+		uint8_t pin = find_lsb_set(remaining) - 1;
+		struct gpio_callback *cb = index->per_pin[pin];
+
+		if (cb == NULL) {
+			remaining &= ~BIT(pin);
+			continue;
+		}
+
+		/* Clear every triggered pin of this callback so a
+		 * multi-pin callback fires only once.
+		 */
+		remaining &= ~(cb->pin_mask | BIT(pin));
+
+		__ASSERT(cb->handler, "No callback handler!");
+		cb->handler(port, cb, cb->pin_mask & pins);
+	}
+}
+#endif /* CONFIG_GPIO_CALLBACK_INDEX */
+
 #endif /* ZEPHYR_DRIVERS_GPIO_GPIO_UTILS_H_ */
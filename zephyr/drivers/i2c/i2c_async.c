@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Asynchronous front end for the synchronous i2c_transfer() API.
+ * Submitted descriptors are queued on a k_fifo and executed in order
+ * by a dedicated thread, which invokes the completion callback with
+ * the transfer result.  Callers never block on the bus; a sensor poll
+ * cycle can overlap bus time with computation by submitting all reads
+ * up front and consuming results from the callbacks.
+ */
+
+#include <kernel.h>
+#include <drivers/i2c.h>
+
+static K_FIFO_DEFINE(i2c_async_fifo);
+
+static void i2c_async_thread(void *p1, void *p2, void *p3)
+{
+	struct i2c_async_req *req;
+	int ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		req = k_fifo_get(&i2c_async_fifo, K_FOREVER);
+
+		ret = i2c_transfer(req->dev, req->msgs, req->num_msgs,
+				   req->addr);
+
+		if (req->callback != NULL) {
+			req->callback(req->dev, ret, req->user_data);
+		}
+	}
+}
+
+int i2c_transfer_async(struct i2c_async_req *req)
+{
+	k_fifo_put(&i2c_async_fifo, req);
+
+	return 0;
+}
+
+K_THREAD_DEFINE(i2c_async_tid, CONFIG_I2C_ASYNC_STACK_SIZE,
+		i2c_async_thread, NULL, NULL, NULL,
+		K_PRIO_COOP(CONFIG_I2C_ASYNC_THREAD_PRIO), 0, 0);
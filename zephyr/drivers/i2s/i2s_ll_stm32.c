@@ -422,11 +422,42 @@ static int i2s_stm32_write(struct device *dev, void *mem_block, size_t size)
 	return 0;
 }
 
+#ifdef CONFIG_I2S_STM32_PIPELINE
+static int i2s_stm32_pipeline_stage_set(struct device *dev, enum i2s_dir dir,
+					i2s_pipeline_stage_t stage,
+					void *user_data)
+{
+	struct i2s_stm32_data *const dev_data = DEV_DATA(dev);
+	struct stream *stream;
+
+	if (dir == I2S_DIR_RX) {
+		stream = &dev_data->rx;
+	} else if (dir == I2S_DIR_TX) {
+		stream = &dev_data->tx;
+	} else {
+		LOG_ERR("Either RX or TX direction must be selected");
+		return -EINVAL;
+	}
+
+	if (stream->state == I2S_STATE_RUNNING) {
+		return -EIO;
+	}
+
+	stream->pipeline_stage = stage;
+	stream->pipeline_user_data = user_data;
+
+	return 0;
+}
+#endif /* CONFIG_I2S_STM32_PIPELINE */
+
 static const struct i2s_driver_api i2s_stm32_driver_api = {
 	.configure = i2s_stm32_configure,
 	.read = i2s_stm32_read,
 	.write = i2s_stm32_write,
 	.trigger = i2s_stm32_trigger,
+#ifdef CONFIG_I2S_STM32_PIPELINE
+	.pipeline_stage_set = i2s_stm32_pipeline_stage_set,
+#endif
 };
 
 #define STM32_DMA_NUM_CHANNELS		8
@@ -499,6 +530,7 @@ static void dma_rx_callback(struct device *dma_dev, void *arg,
 	const struct i2s_stm32_cfg *cfg = DEV_CFG(dev);
 	struct i2s_stm32_data *const dev_data = DEV_DATA(dev);
 	struct stream *stream = &dev_data->rx;
+	size_t block_size;
 	void *mblk_tmp;
 	int ret;
 
@@ -538,9 +570,17 @@ static void dma_rx_callback(struct device *dma_dev, void *arg,
 	/* Assure cache coherency after DMA write operation */
 	DCACHE_INVALIDATE(mblk_tmp, stream->cfg.block_size);
 
+	block_size = stream->cfg.block_size;
+#ifdef CONFIG_I2S_STM32_PIPELINE
+	if (stream->pipeline_stage != NULL) {
+		stream->pipeline_stage(mblk_tmp, &block_size,
+				       stream->pipeline_user_data);
+	}
+#endif
+
 	/* All block data received */
 	ret = queue_put(&stream->mem_block_queue, mblk_tmp,
-			stream->cfg.block_size);
+			block_size);
 	if (ret < 0) {
 		stream->state = I2S_STATE_ERROR;
 		goto rx_disable;
@@ -606,6 +646,13 @@ static void dma_tx_callback(struct device *dma_dev, void *arg,
 	}
 	k_sem_give(&stream->sem);
 
+#ifdef CONFIG_I2S_STM32_PIPELINE
+	if (stream->pipeline_stage != NULL) {
+		stream->pipeline_stage(stream->mem_block, &mem_block_size,
+				       stream->pipeline_user_data);
+	}
+#endif
+
 	/* Assure cache coherency before DMA read operation */
 	DCACHE_CLEAN(stream->mem_block, mem_block_size);
 
@@ -90,6 +90,10 @@ struct stream {
 	struct i2s_config cfg;
 	struct ring_buf mem_block_queue;
 	void *mem_block;
+#ifdef CONFIG_I2S_STM32_PIPELINE
+	i2s_pipeline_stage_t pipeline_stage;
+	void *pipeline_user_data;
+#endif
 	bool last_block;
 	bool master;
 	int (*stream_start)(struct stream *, struct device *dev);
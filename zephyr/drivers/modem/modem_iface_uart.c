@@ -19,6 +19,66 @@ LOG_MODULE_REGISTER(modem_iface_uart, CONFIG_MODEM_LOG_LEVEL);
 #include "modem_context.h"
 #include "modem_iface_uart.h"
 
+#ifdef CONFIG_MODEM_IFACE_UART_ASYNC
+/**
+ * @brief  Modem interface asynchronous (DMA) receive callback.
+ *
+ * @note   Received blocks are copied into the interface ring buffer
+ *         when a DMA buffer fills up or the receive line goes idle.
+ *         The other DMA buffer is handed to the driver while the
+ *         current one is drained, so reception never pauses.
+ *
+ * @param  *uart_dev: uart device.
+ * @param  *evt: uart event.
+ * @param  *user_data: modem interface data.
+ *
+ * @retval None.
+ */
+static void modem_iface_uart_async_cb(struct device *uart_dev,
+				      struct uart_event *evt, void *user_data)
+{
+	struct modem_iface_uart_data *data = user_data;
+	uint32_t written;
+
+	switch (evt->type) {
+	case UART_RX_RDY:
+		written = ring_buf_put(&data->rx_rb,
+				       evt->data.rx.buf + evt->data.rx.offset,
+				       evt->data.rx.len);
+		if (written != evt->data.rx.len) {
+			LOG_ERR("Rx buffer doesn't have enough space. "
+				"Bytes pending: %d, written: %d",
+				(int)evt->data.rx.len, (int)written);
+		}
+
+		k_sem_give(&data->rx_sem);
+		break;
+	case UART_RX_BUF_REQUEST:
+		uart_rx_buf_rsp(uart_dev,
+				data->async_rx_buf[data->async_rx_next],
+				sizeof(data->async_rx_buf[0]));
+		data->async_rx_next = (uint8_t)(data->async_rx_next ^ 1U);
+		break;
+	case UART_RX_STOPPED:
+		LOG_ERR("Rx stopped, reason: %d",
+			evt->data.rx_stop.reason);
+		break;
+	case UART_RX_DISABLED:
+		/* restart reception from a known buffer rotation */
+		data->async_rx_next = 1U;
+		if (uart_rx_enable(uart_dev, data->async_rx_buf[0],
+				   sizeof(data->async_rx_buf[0]),
+				   CONFIG_MODEM_IFACE_UART_ASYNC_RX_TIMEOUT_MS)
+		    < 0) {
+			LOG_ERR("Failed to re-enable rx");
+		}
+
+		break;
+	default:
+		break;
+	}
+}
+#else /* CONFIG_MODEM_IFACE_UART_ASYNC */
 /**
  * @brief  Drains UART.
  *
@@ -84,6 +144,7 @@ static void modem_iface_uart_isr(struct device *uart_dev, void *user_data)
 		k_sem_give(&data->rx_sem);
 	}
 }
+#endif /* CONFIG_MODEM_IFACE_UART_ASYNC */
 
 static int modem_iface_uart_read(struct modem_iface *iface,
 				 uint8_t *buf, size_t size, size_t *bytes_read)
@@ -126,12 +187,34 @@ static int modem_iface_uart_write(struct modem_iface *iface,
 int modem_iface_uart_init_dev(struct modem_iface *iface,
 			      const char *dev_name)
 {
+#ifdef CONFIG_MODEM_IFACE_UART_ASYNC
+	struct modem_iface_uart_data *data;
+	int ret;
+#endif
+
 	/* get UART device */
 	iface->dev = device_get_binding(dev_name);
 	if (!iface->dev) {
 		return -ENODEV;
 	}
 
+#ifdef CONFIG_MODEM_IFACE_UART_ASYNC
+	data = (struct modem_iface_uart_data *)(iface->iface_data);
+
+	ret = uart_callback_set(iface->dev, modem_iface_uart_async_cb, data);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* the UART fills buffer 0 first; buffer 1 is handed over on the
+	 * first UART_RX_BUF_REQUEST event
+	 */
+	data->async_rx_next = 1U;
+
+	return uart_rx_enable(iface->dev, data->async_rx_buf[0],
+			      sizeof(data->async_rx_buf[0]),
+			      CONFIG_MODEM_IFACE_UART_ASYNC_RX_TIMEOUT_MS);
+#else
 	uart_irq_rx_disable(iface->dev);
 	uart_irq_tx_disable(iface->dev);
 	modem_iface_uart_flush(iface);
@@ -139,6 +222,7 @@ int modem_iface_uart_init_dev(struct modem_iface *iface,
 	uart_irq_rx_enable(iface->dev);
 
 	return 0;
+#endif
 }
 
 int modem_iface_uart_init(struct modem_iface *iface,
@@ -33,6 +33,14 @@ struct modem_iface_uart_data {
 
 	/* rx semaphore */
 	struct k_sem rx_sem;
+
+#ifdef CONFIG_MODEM_IFACE_UART_ASYNC
+	/* DMA receive buffers, filled by the UART driver in turn */
+	uint8_t async_rx_buf[2][CONFIG_MODEM_IFACE_UART_ASYNC_RX_BUF_SIZE];
+
+	/* index of the buffer to hand over on the next buffer request */
+	uint8_t async_rx_next;
+#endif
 };
 
 /**
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Asynchronous front end for the synchronous peci_transfer() API.
+ * Requests are queued on a k_fifo and executed in order by a dedicated
+ * thread, which invokes the completion callback with the result.  The
+ * EC main loop can submit a burst of host commands and keep running
+ * while the bus works through them.
+ */
+
+#include <kernel.h>
+#include <drivers/peci.h>
+
+static K_FIFO_DEFINE(peci_async_fifo);
+
+static void peci_async_thread(void *p1, void *p2, void *p3)
+{
+	struct peci_async_req *req;
+	int ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		req = k_fifo_get(&peci_async_fifo, K_FOREVER);
+
+		ret = peci_transfer(req->dev, req->msg);
+
+		if (req->callback != NULL) {
+			req->callback(req->dev, req->msg, ret,
+				      req->user_data);
+		}
+	}
+}
+
+int peci_transfer_async(struct peci_async_req *req)
+{
+	k_fifo_put(&peci_async_fifo, req);
+
+	return 0;
+}
+
+K_THREAD_DEFINE(peci_async_tid, CONFIG_PECI_ASYNC_STACK_SIZE,
+		peci_async_thread, NULL, NULL, NULL,
+		K_PRIO_COOP(CONFIG_PECI_ASYNC_THREAD_PRIO), 0, 0);
@@ -244,6 +244,37 @@ static int pwm_stm32_pin_set(struct device *dev, uint32_t pwm,
 	return 0;
 }
 
+#ifdef CONFIG_PWM_STM32_BATCH
+static int pwm_stm32_pin_set_batch(struct device *dev, uint32_t period_cycles,
+				   const struct pwm_batch_channel *channels,
+				   size_t num_channels)
+{
+	const struct pwm_stm32_config *cfg = to_config(dev);
+
+	size_t i;
+	int r = 0;
+
+	/* Suppress the update event while staging, so the preloaded
+	 * compare values and the new period are all latched into the
+	 * shadow registers on the same period boundary.
+	 */
+	LL_TIM_DisableUpdateEvent(cfg->timer);
+
+	for (i = 0u; i < num_channels; i++) {
+		r = pwm_stm32_pin_set(dev, channels[i].pwm, period_cycles,
+				      channels[i].pulse_cycles,
+				      channels[i].flags);
+		if (r < 0) {
+			break;
+		}
+	}
+
+	LL_TIM_EnableUpdateEvent(cfg->timer);
+
+	return r;
+}
+#endif /* CONFIG_PWM_STM32_BATCH */
+
 static int pwm_stm32_get_cycles_per_sec(struct device *dev, uint32_t pwm,
 					uint64_t *cycles)
 {
@@ -258,6 +289,9 @@ static int pwm_stm32_get_cycles_per_sec(struct device *dev, uint32_t pwm,
 static const struct pwm_driver_api pwm_stm32_driver_api = {
 	.pin_set = pwm_stm32_pin_set,
 	.get_cycles_per_sec = pwm_stm32_get_cycles_per_sec,
+#ifdef CONFIG_PWM_STM32_BATCH
+	.pin_set_batch = pwm_stm32_pin_set_batch,
+#endif
 };
 
 static int pwm_stm32_init(struct device *dev)
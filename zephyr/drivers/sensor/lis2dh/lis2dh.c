@@ -257,6 +257,101 @@ static int lis2dh_attr_set(struct device *dev, enum sensor_channel chan,
 	return 0;
 }
 
+#ifdef CONFIG_LIS2DH_FIFO
+static int lis2dh_batch_read(struct device *dev, enum sensor_channel chan,
+			     uint8_t *buf, size_t buf_size,
+			     uint16_t *frame_count)
+{
+	struct lis2dh_data *lis2dh = dev->driver_data;
+	uint16_t frames;
+	uint8_t fifo_src;
+	int status;
+
+	if (chan != SENSOR_CHAN_ALL && chan != SENSOR_CHAN_ACCEL_XYZ) {
+		return -ENOTSUP;
+	}
+
+	status = lis2dh->hw_tf->read_reg(dev, LIS2DH_REG_FIFO_SRC, &fifo_src);
+	if (status < 0) {
+		return status;
+	}
+
+	frames = MIN(fifo_src & LIS2DH_FIFO_SRC_FSS_MASK,
+		     buf_size / LIS2DH_FIFO_FRAME_SIZE);
+	if (frames == 0U) {
+		*frame_count = 0U;
+		return 0;
+	}
+
+	/* reading the output registers pops the FIFO; the address rolls
+	 * back from OUT_Z_H to OUT_X_L, so one burst drains all frames
+	 */
+	status = lis2dh->hw_tf->read_data(dev, LIS2DH_REG_ACCEL_X_LSB, buf,
+					  frames * LIS2DH_FIFO_FRAME_SIZE);
+	if (status < 0) {
+		LOG_WRN("Could not read FIFO data");
+		return status;
+	}
+
+	*frame_count = frames;
+
+	return 0;
+}
+
+static int lis2dh_batch_decode(struct device *dev, enum sensor_channel chan,
+			       const uint8_t *buf, uint16_t frame_idx,
+			       struct sensor_value *val)
+{
+	struct lis2dh_data *lis2dh = dev->driver_data;
+	const uint8_t *frame = &buf[frame_idx * LIS2DH_FIFO_FRAME_SIZE];
+	int ofs_start;
+	int ofs_end;
+	int i;
+
+	switch (chan) {
+	case SENSOR_CHAN_ACCEL_X:
+		ofs_start = ofs_end = 0;
+		break;
+	case SENSOR_CHAN_ACCEL_Y:
+		ofs_start = ofs_end = 1;
+		break;
+	case SENSOR_CHAN_ACCEL_Z:
+		ofs_start = ofs_end = 2;
+		break;
+	case SENSOR_CHAN_ACCEL_XYZ:
+		ofs_start = 0;
+		ofs_end = 2;
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	for (i = ofs_start; i <= ofs_end; i++, val++) {
+		int16_t raw_val = (int16_t)sys_get_le16(
+					&frame[i * sizeof(int16_t)]);
+
+		lis2dh_convert(raw_val, lis2dh->scale, val);
+	}
+
+	return 0;
+}
+
+static int lis2dh_fifo_init(struct device *dev)
+{
+	struct lis2dh_data *lis2dh = dev->driver_data;
+	int status;
+
+	status = lis2dh->hw_tf->update_reg(dev, LIS2DH_REG_CTRL5,
+					   LIS2DH_EN_FIFO, LIS2DH_EN_FIFO);
+	if (status < 0) {
+		return status;
+	}
+
+	return lis2dh->hw_tf->write_reg(dev, LIS2DH_REG_FIFO_CTRL,
+					LIS2DH_FIFO_MODE_STREAM);
+}
+#endif /* CONFIG_LIS2DH_FIFO */
+
 static const struct sensor_driver_api lis2dh_driver_api = {
 	.attr_set = lis2dh_attr_set,
 #if CONFIG_LIS2DH_TRIGGER
@@ -264,6 +359,10 @@ static const struct sensor_driver_api lis2dh_driver_api = {
 #endif
 	.sample_fetch = lis2dh_sample_fetch,
 	.channel_get = lis2dh_channel_get,
+#ifdef CONFIG_LIS2DH_FIFO
+	.batch_read = lis2dh_batch_read,
+	.batch_decode = lis2dh_batch_decode,
+#endif
 };
 
 int lis2dh_init(struct device *dev)
@@ -336,6 +435,14 @@ int lis2dh_init(struct device *dev)
 	}
 #endif
 
+#ifdef CONFIG_LIS2DH_FIFO
+	status = lis2dh_fifo_init(dev);
+	if (status < 0) {
+		LOG_ERR("Failed to enable FIFO.");
+		return status;
+	}
+#endif
+
 	LOG_INF("bus=%s fs=%d, odr=0x%x lp_en=0x%x scale=%d",
 		    LIS2DH_BUS_DEV_NAME, 1 << (LIS2DH_FS_IDX + 1),
 		    LIS2DH_ODR_IDX, (uint8_t)LIS2DH_LP_EN_BIT, lis2dh->scale);
@@ -129,6 +129,8 @@
 #define LIS2DH_REG_CTRL5		0x24
 #define LIS2DH_LIR_INT2_SHIFT		1
 #define LIS2DH_EN_LIR_INT2		BIT(LIS2DH_LIR_INT2_SHIFT)
+#define LIS2DH_FIFO_EN_SHIFT		6
+#define LIS2DH_EN_FIFO			BIT(LIS2DH_FIFO_EN_SHIFT)
 
 #define LIS2DH_REG_CTRL6		0x25
 #define LIS2DH_EN_INT2_INT2_SHIFT	5
@@ -155,6 +157,17 @@
 #define LIS2DH_REG_ACCEL_Y_MSB		0x2B
 #define LIS2DH_REG_ACCEL_Z_MSB		0x2D
 
+#define LIS2DH_REG_FIFO_CTRL		0x2E
+#define LIS2DH_FIFO_MODE_SHIFT		6
+#define LIS2DH_FIFO_MODE_BYPASS		(0 << LIS2DH_FIFO_MODE_SHIFT)
+#define LIS2DH_FIFO_MODE_STREAM		(2 << LIS2DH_FIFO_MODE_SHIFT)
+
+#define LIS2DH_REG_FIFO_SRC		0x2F
+#define LIS2DH_FIFO_SRC_FSS_MASK	BIT_MASK(5)
+
+/* one FIFO frame holds the three accelerometer axes */
+#define LIS2DH_FIFO_FRAME_SIZE		(3 * sizeof(int16_t))
+
 #define LIS2DH_REG_INT1_CFG		0x30
 #define LIS2DH_REG_INT2_CFG		0x34
 #define LIS2DH_AOI_CFG			BIT(7)
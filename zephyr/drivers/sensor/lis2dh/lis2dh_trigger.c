@@ -58,7 +58,7 @@ static int lis2dh_trigger_drdy_set(struct device *dev, enum sensor_channel chan,
 #if defined(CONFIG_LIS2DH_TRIGGER_OWN_THREAD)
 	k_sem_give(&lis2dh->gpio_sem);
 #elif defined(CONFIG_LIS2DH_TRIGGER_GLOBAL_THREAD)
-	k_work_submit(&lis2dh->work);
+	sensor_work_submit(&lis2dh->work);
 #endif
 
 	return 0;
@@ -151,7 +151,7 @@ static int lis2dh_trigger_anym_set(struct device *dev,
 #if defined(CONFIG_LIS2DH_TRIGGER_OWN_THREAD)
 	k_sem_give(&lis2dh->gpio_sem);
 #elif defined(CONFIG_LIS2DH_TRIGGER_GLOBAL_THREAD)
-	k_work_submit(&lis2dh->work);
+	sensor_work_submit(&lis2dh->work);
 #endif
 	return 0;
 }
@@ -249,7 +249,7 @@ static void lis2dh_gpio_int1_callback(struct device *dev,
 #if defined(CONFIG_LIS2DH_TRIGGER_OWN_THREAD)
 	k_sem_give(&lis2dh->gpio_sem);
 #elif defined(CONFIG_LIS2DH_TRIGGER_GLOBAL_THREAD)
-	k_work_submit(&lis2dh->work);
+	sensor_work_submit(&lis2dh->work);
 #endif
 }
 
@@ -267,7 +267,7 @@ static void lis2dh_gpio_int2_callback(struct device *dev,
 #if defined(CONFIG_LIS2DH_TRIGGER_OWN_THREAD)
 	k_sem_give(&lis2dh->gpio_sem);
 #elif defined(CONFIG_LIS2DH_TRIGGER_GLOBAL_THREAD)
-	k_work_submit(&lis2dh->work);
+	sensor_work_submit(&lis2dh->work);
 #endif
 }
 #endif /* DT_INST_PROP_HAS_IDX(0, irq_gpios, 1) */
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Shared work queue for sensor trigger handlers.  Drivers that would
+ * otherwise spawn a thread each, or pile their handlers onto the
+ * system work queue, submit here instead: one stack serves every
+ * sensor, and a slow handler only delays other sensor handlers, never
+ * unrelated system work.
+ */
+
+#include <init.h>
+#include <kernel.h>
+#include <drivers/sensor.h>
+
+static K_THREAD_STACK_DEFINE(sensor_work_q_stack,
+			     CONFIG_SENSOR_WORKQUEUE_STACK_SIZE);
+
+static struct k_work_q sensor_work_q;
+
+struct k_work_q *sensor_work_q_get(void)
+{
+	return &sensor_work_q;
+}
+
+static int sensor_work_q_init(struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	k_work_q_start(&sensor_work_q, sensor_work_q_stack,
+		       K_THREAD_STACK_SIZEOF(sensor_work_q_stack),
+		       K_PRIO_COOP(CONFIG_SENSOR_WORKQUEUE_PRIORITY));
+	k_thread_name_set(&sensor_work_q.thread, "sensor_wq");
+
+	return 0;
+}
+
+SYS_INIT(sensor_work_q_init, POST_KERNEL, CONFIG_SENSOR_INIT_PRIORITY);
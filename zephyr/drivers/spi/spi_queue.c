@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Controller-agnostic SPI transaction queue.  Descriptors submitted
+ * with spi_txn_submit() are started in order, back to back, over the
+ * asynchronous SPI API.  A single drain thread sleeps on the
+ * completion signal of every in-flight transaction plus a submission
+ * signal, so one thread keeps any number of controllers busy while
+ * callers never block.
+ */
+
+#include <kernel.h>
+#include <drivers/spi.h>
+#include <logging/log.h>
+
+LOG_MODULE_REGISTER(spi_txn_queue, CONFIG_SPI_LOG_LEVEL);
+
+static struct spi_txn_queue *queues[CONFIG_SPI_TXN_QUEUE_MAX];
+static int queue_cnt;
+
+/* Raised whenever a descriptor is submitted or a queue registered */
+static struct k_poll_signal submit_sig = K_POLL_SIGNAL_INITIALIZER(submit_sig);
+
+static void txn_start(struct spi_txn_queue *queue)
+{
+	k_spinlock_key_t key;
+	sys_snode_t *node;
+	struct spi_txn *txn;
+	int ret;
+
+	while (queue->current == NULL) {
+		key = k_spin_lock(&queue->lock);
+		node = sys_slist_get(&queue->txns);
+		k_spin_unlock(&queue->lock, key);
+
+		if (node == NULL) {
+			return;
+		}
+
+		txn = CONTAINER_OF(node, struct spi_txn, node);
+
+		k_poll_signal_reset(&queue->sig);
+		ret = spi_transceive_async(queue->dev, txn->config,
+					   txn->tx_bufs, txn->rx_bufs,
+					   &queue->sig);
+		if (ret < 0) {
+			/* could not start: complete with the error and
+			 * move on to the next descriptor
+			 */
+			LOG_ERR("Failed to start transaction (%d)", ret);
+			if (txn->signal != NULL) {
+				k_poll_signal_raise(txn->signal, ret);
+			}
+
+			continue;
+		}
+
+		queue->current = txn;
+	}
+}
+
+static void txn_complete(struct spi_txn_queue *queue)
+{
+	struct spi_txn *txn = queue->current;
+	int signaled = 0;
+	int result = 0;
+
+	k_poll_signal_check(&queue->sig, &signaled, &result);
+	if (!signaled) {
+		return;
+	}
+
+	queue->current = NULL;
+	if (txn->signal != NULL) {
+		k_poll_signal_raise(txn->signal, result);
+	}
+}
+
+static void spi_txn_thread(void *p1, void *p2, void *p3)
+{
+	struct k_poll_event events[CONFIG_SPI_TXN_QUEUE_MAX + 1];
+	struct spi_txn_queue *queue;
+	int i, cnt;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		/* Reset before scanning the queues so a submission
+		 * racing with the scan raises it again.
+		 */
+		k_poll_signal_reset(&submit_sig);
+
+		cnt = 0;
+		k_poll_event_init(&events[cnt++], K_POLL_TYPE_SIGNAL,
+				  K_POLL_MODE_NOTIFY_ONLY, &submit_sig);
+
+		for (i = 0; i < queue_cnt; i++) {
+			queue = queues[i];
+
+			if (queue->current != NULL) {
+				txn_complete(queue);
+			}
+
+			txn_start(queue);
+
+			if (queue->current != NULL) {
+				k_poll_event_init(&events[cnt++],
+						  K_POLL_TYPE_SIGNAL,
+						  K_POLL_MODE_NOTIFY_ONLY,
+						  &queue->sig);
+			}
+		}
+
+		k_poll(events, cnt, K_FOREVER);
+	}
+}
+
+int spi_txn_queue_init(struct spi_txn_queue *queue, struct device *dev)
+{
+	if (queue_cnt >= (int)ARRAY_SIZE(queues)) {
+		return -ENOMEM;
+	}
+
+	queue->dev = dev;
+	sys_slist_init(&queue->txns);
+	k_poll_signal_init(&queue->sig);
+	queue->current = NULL;
+
+	queues[queue_cnt] = queue;
+	queue_cnt++;
+
+	k_poll_signal_raise(&submit_sig, 0);
+
+	return 0;
+}
+
+int spi_txn_submit(struct spi_txn_queue *queue, struct spi_txn *txn)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&queue->lock);
+	sys_slist_append(&queue->txns, &txn->node);
+	k_spin_unlock(&queue->lock, key);
+
+	k_poll_signal_raise(&submit_sig, 0);
+
+	return 0;
+}
+
+K_THREAD_DEFINE(spi_txn_queue_tid, CONFIG_SPI_TXN_QUEUE_STACK_SIZE,
+		spi_txn_thread, NULL, NULL, NULL,
+		K_PRIO_COOP(CONFIG_SPI_TXN_QUEUE_THREAD_PRIO), 0, 0);
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Watchdog multiplexer: many software channels over one hardware
+ * watchdog.  Channels feed a shared atomic bit mask in constant time;
+ * a periodic check running at half the hardware window feeds the
+ * hardware exactly once per interval, and only while every registered
+ * channel has checked in since the previous interval.  A starving
+ * channel first triggers the early warning callback, and if it stays
+ * silent the feed is withheld so the hardware watchdog expires.
+ */
+
+#include <kernel.h>
+#include <drivers/watchdog.h>
+
+static struct device *mux_dev;
+static int mux_hw_channel;
+static wdt_mux_warn_cb_t mux_warn_cb;
+
+static atomic_t mux_fed_mask;
+static uint32_t mux_reg_mask;
+static uint8_t mux_num_channels;
+static struct k_spinlock mux_lock;
+
+static void wdt_mux_check(struct k_timer *timer)
+{
+	uint32_t fed = (uint32_t)atomic_clear(&mux_fed_mask);
+	uint32_t starving = mux_reg_mask & ~fed;
+
+	ARG_UNUSED(timer);
+
+	if (starving == 0U) {
+		(void)wdt_feed(mux_dev, mux_hw_channel);
+	} else if (mux_warn_cb != NULL) {
+		mux_warn_cb(starving);
+	}
+}
+
+static K_TIMER_DEFINE(mux_timer, wdt_mux_check, NULL);
+
+int wdt_mux_init(struct device *dev, uint32_t window_ms,
+		 wdt_mux_warn_cb_t warn_cb)
+{
+	const struct wdt_timeout_cfg cfg = {
+		.window = {
+			.min = 0U,
+			.max = window_ms,
+		},
+		.flags = WDT_FLAG_RESET_SOC,
+	};
+	int ret;
+
+	ret = wdt_install_timeout(dev, &cfg);
+	if (ret < 0) {
+		return ret;
+	}
+
+	mux_dev = dev;
+	mux_hw_channel = ret;
+	mux_warn_cb = warn_cb;
+
+	ret = wdt_setup(dev, 0U);
+	if (ret < 0) {
+		return ret;
+	}
+
+	k_timer_start(&mux_timer, K_MSEC(window_ms / 2U),
+		      K_MSEC(window_ms / 2U));
+
+	return 0;
+}
+
+int wdt_mux_channel_add(void)
+{
+	k_spinlock_key_t key;
+	int channel;
+
+	key = k_spin_lock(&mux_lock);
+
+	if (mux_num_channels >= 32U) {
+		k_spin_unlock(&mux_lock, key);
+		return -ENOMEM;
+	}
+
+	channel = mux_num_channels++;
+	mux_reg_mask |= BIT(channel);
+
+	/* A fresh channel starts healthy until its first deadline. */
+	atomic_or(&mux_fed_mask, BIT(channel));
+
+	k_spin_unlock(&mux_lock, key);
+
+	return channel;
+}
+
+void wdt_mux_feed(int channel)
+{
+	atomic_or(&mux_fed_mask, BIT(channel));
+}
@@ -14,6 +14,9 @@
 #define _SCS_ICSR_PENDSV (1 << 28)
 #define _SCS_ICSR_UNPENDSV (1 << 27)
 #define _SCS_ICSR_RETTOBASE (1 << 11)
+#define _SCS_CPACR (_SCS_BASE_ADDR + 0xd88)
+/* full access for CP10 and CP11 */
+#define _SCS_CPACR_CP10_CP11_FULL_ACCESS (0xF << 20)
 
 #endif
 
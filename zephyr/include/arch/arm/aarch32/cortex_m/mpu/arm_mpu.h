@@ -45,6 +45,29 @@ struct arm_mpu_config {
 		.attr = _attr, \
 	}
 
+#if defined(CONFIG_ARM_MPU_DOMAIN_CACHE)
+/* Per-memory-domain MPU state, embedded in struct k_mem_domain.
+ *
+ * Holds the precomputed MPU register image for the domain's
+ * partitions, so that switching into a thread of the domain is a
+ * plain sequence of register writes. The image is (re-)built lazily
+ * on the first domain switch after the domain's partition list has
+ * changed.
+ */
+struct arch_mem_domain {
+	/* RBAR values for each partition, without the region index,
+	 * which is assigned when the image is written to the MPU
+	 */
+	uint32_t rbar[CONFIG_MAX_DOMAIN_PARTITIONS];
+	/* RASR values for each partition, including the enable bit */
+	uint32_t rasr[CONFIG_MAX_DOMAIN_PARTITIONS];
+	/* Number of valid entries in the image */
+	uint8_t num_regions;
+	/* Image matches the domain's current partition list */
+	bool valid;
+};
+#endif /* CONFIG_ARM_MPU_DOMAIN_CACHE */
+
 /* Reference to the MPU configuration.
  *
  * This struct is defined and populated for each SoC (in the SoC definition),
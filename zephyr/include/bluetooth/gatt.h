@@ -883,6 +883,27 @@ int bt_gatt_notify_cb(struct bt_conn *conn,
 int bt_gatt_notify_multiple(struct bt_conn *conn, uint16_t num_params,
 			    struct bt_gatt_notify_params *params);
 
+/** @brief Notify attribute value change on multiple connections.
+ *
+ *  Send the same notification to every connection in the given array.
+ *  The attribute and value handle are resolved only once, so fanning one
+ *  value out to many subscribed peers is cheaper than calling
+ *  @ref bt_gatt_notify_cb per connection.
+ *
+ *  A connection that is NULL, disconnected or out of buffers does not
+ *  prevent delivery to the remaining connections; the first error
+ *  encountered is returned.
+ *
+ *  @param conns Array of connection objects.
+ *  @param num_conns Number of connections in the array.
+ *  @param params Notification parameters, shared by all connections.
+ *
+ *  @return 0 if the notification was sent on every connection or
+ *  negative value in case of error.
+ */
+int bt_gatt_notify_conns(struct bt_conn **conns, uint16_t num_conns,
+			 struct bt_gatt_notify_params *params);
+
 /** @brief Notify attribute value change.
  *
  *  Send notification of attribute value change, if connection is NULL notify
@@ -1251,6 +1272,56 @@ struct bt_gatt_read_params {
  */
 int bt_gatt_read(struct bt_conn *conn, struct bt_gatt_read_params *params);
 
+struct bt_gatt_db_hash_params;
+
+/** @typedef bt_gatt_db_hash_func_t
+ *  @brief Database hash check callback function
+ *
+ *  @param conn Connection object.
+ *  @param err ATT error code.
+ *  @param unchanged True if the hash matches the value stored for the
+ *                   bond, meaning the cached discovery results are
+ *                   still valid and rediscovery can be skipped.
+ *  @param params Check parameters used.
+ */
+typedef void (*bt_gatt_db_hash_func_t)(struct bt_conn *conn, uint8_t err,
+				       bool unchanged,
+				       struct bt_gatt_db_hash_params *params);
+
+/** @brief GATT Database Hash check parameters
+ *
+ *  @param func Check callback
+ */
+struct bt_gatt_db_hash_params {
+	bt_gatt_db_hash_func_t func;
+
+	/** Internal */
+	struct bt_gatt_read_params _read;
+	/** Internal */
+	uint8_t _hash[16];
+	/** Internal */
+	uint8_t _len;
+};
+
+/** @brief Check the Database Hash of a peer server
+ *
+ *  Read the Database Hash characteristic of the peer and compare it
+ *  against the value persisted for the bond. If the hash is unchanged
+ *  the services discovered during a previous connection are still
+ *  valid and the application can skip rediscovery. A new or changed
+ *  hash is stored for the next reconnection.
+ *
+ *  @note This procedure is asynchronous therefore the parameters need to
+ *        remain valid while it is active.
+ *
+ *  @param conn Connection object.
+ *  @param params Check parameters.
+ *
+ *  @return 0 in case of success or negative value in case of error.
+ */
+int bt_gatt_db_hash_check(struct bt_conn *conn,
+			  struct bt_gatt_db_hash_params *params);
+
 struct bt_gatt_write_params;
 
 /** @typedef bt_gatt_write_func_t
@@ -142,6 +142,8 @@ struct bt_l2cap_le_chan {
 	/** Segment SDU packet from upper layer */
 	struct net_buf			*_sdu;
 	uint16_t				_sdu_len;
+	/** Credits consumed by the remote but not yet returned */
+	uint16_t			pending_rx_credits;
 
 	struct k_work			rx_work;
 	struct k_fifo			rx_queue;
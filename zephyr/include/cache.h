@@ -62,6 +62,50 @@ static inline void sys_cache_invd(void *addr, size_t size)
 	}
 }
 
+/**
+ *
+ * @brief Pass ownership of a DMA buffer from the CPU to a device
+ *
+ * Cleans the d-cache by range so that the device observes everything
+ * the CPU wrote to the buffer.  Call this after the CPU's last write
+ * and before starting a device operation that reads the buffer (e.g.
+ * a DMA TX transfer); until the operation completes the CPU must not
+ * write to the buffer.
+ *
+ * @param addr start of the buffer
+ * @param size buffer size in bytes
+ *
+ * @return N/A
+ */
+static inline void sys_cache_buf_cpu_to_dev(void *addr, size_t size)
+{
+	sys_cache_flush(addr, size);
+}
+
+/**
+ *
+ * @brief Claim a device-written buffer back for the CPU
+ *
+ * Invalidates the d-cache by range so that the CPU's next reads fetch
+ * what the device wrote.  Call this after a device operation that
+ * writes the buffer (e.g. a DMA RX transfer) completes and before the
+ * CPU reads it.
+ *
+ * Since invalidation discards whole cache lines, the buffer should be
+ * cache line aligned and padded to a cache line multiple so no
+ * unrelated data shares its first or last line; otherwise CPU writes
+ * to that data made while the device owned the buffer can be lost.
+ *
+ * @param addr start of the buffer
+ * @param size buffer size in bytes
+ *
+ * @return N/A
+ */
+static inline void sys_cache_buf_dev_to_cpu(void *addr, size_t size)
+{
+	sys_cache_invd(addr, size);
+}
+
 /**
  *
  * @brief Get the d-cache line size.
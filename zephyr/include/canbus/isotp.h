@@ -149,7 +149,8 @@ struct isotp_recv_ctx;
  * @param can_dev The CAN device to be used for sending and receiving.
  * @param rx_addr Identifier for incoming data.
  * @param tx_addr Identifier for FC frames.
- * @param opts    Flow control options.
+ * @param opts    Flow control options, or NULL to use the
+ *                CONFIG_ISOTP_FC_DEFAULT_* values.
  * @param timeout Timeout for FF SF buffer allocation.
  *
  * @retval ISOTP_N_OK on success
@@ -592,6 +592,106 @@ int json_obj_parse(char *json, size_t len,
 	const struct json_obj_descr *descr, size_t descr_len,
 	void *val);
 
+/**
+ * @brief Function pointer type for tokens emitted by the streaming parser.
+ *
+ * For JSON_TOK_STRING and JSON_TOK_NUMBER tokens, @a value points to the
+ * token text (not NUL-terminated, strings without the surrounding quotes
+ * and not unescaped); it is only valid for the duration of the call.  For
+ * all other tokens @a value is NULL and @a len is 0.
+ *
+ * @param token Token type
+ * @param value Token text, or NULL
+ * @param len Length of token text
+ * @param user_data User-provided pointer
+ *
+ * @return This callback function should return a negative number on
+ * error (which will abort parsing and be propagated to the return value
+ * of json_stream_feed()), or 0 on success.
+ */
+typedef int (*json_stream_cb_t)(enum json_tokens token, const char *value,
+				size_t len, void *user_data);
+
+/**
+ * @brief State for the incremental (SAX-style) JSON tokenizer.
+ *
+ * All members are private; initialize with json_stream_init().
+ */
+struct json_stream {
+	json_stream_cb_t cb;
+	void *user_data;
+	char *scratch;
+	size_t scratch_size;
+	size_t scratch_len;
+	uint8_t state;
+	uint8_t pending;
+	uint8_t sub;
+};
+
+/**
+ * @brief Initializes an incremental JSON tokenizer
+ *
+ * Unlike json_obj_parse(), the streaming tokenizer does not need the
+ * whole document in memory: input is supplied in arbitrary chunks with
+ * json_stream_feed() as it arrives (e.g. from a socket), and each JSON
+ * token is delivered through @a cb as soon as it is complete.  Only
+ * tokens that straddle a chunk boundary are buffered, in the
+ * caller-provided scratch area, so @a scratch_size bounds the largest
+ * representable string or number token, not the document size.
+ *
+ * The same liberties documented for json_obj_parse() apply: strings are
+ * not unescaped and no UTF-8 validation is performed.  Grammar
+ * validation is left to the callback; the tokenizer only rejects input
+ * that cannot start a valid token.
+ *
+ * @param stream Stream state to initialize
+ *
+ * @param cb Callback invoked for each complete token
+ *
+ * @param user_data Pointer passed verbatim to @a cb
+ *
+ * @param scratch Buffer used to accumulate string and number tokens
+ *
+ * @param scratch_size Size of @a scratch, in bytes
+ */
+void json_stream_init(struct json_stream *stream, json_stream_cb_t cb,
+		      void *user_data, char *scratch, size_t scratch_size);
+
+/**
+ * @brief Feeds a chunk of JSON input to the tokenizer
+ *
+ * May be called any number of times; chunks can split the document at
+ * any byte.  Tokens completed by this chunk are emitted through the
+ * callback before the call returns.
+ *
+ * @param stream Stream state
+ *
+ * @param data Chunk of JSON text
+ *
+ * @param len Number of bytes in @a data
+ *
+ * @return 0 on success, -EINVAL on malformed input, -ENOMEM if a token
+ * does not fit in the scratch buffer, or the negative value returned by
+ * the callback.  After an error the stream is poisoned and further
+ * calls fail with -EINVAL.
+ */
+int json_stream_feed(struct json_stream *stream, const char *data,
+		     size_t len);
+
+/**
+ * @brief Signals the end of the JSON input
+ *
+ * Emits a trailing number token left pending by the last chunk (numbers
+ * have no terminator, so their end is only known here or at the next
+ * token) and verifies no string or literal was left unterminated.
+ *
+ * @param stream Stream state
+ *
+ * @return 0 on success, -EINVAL if the input ended inside a token, or
+ * the negative value returned by the callback.
+ */
+int json_stream_finish(struct json_stream *stream);
+
 /**
  * @brief Escapes the string so it can be used to encode JSON objects
  *
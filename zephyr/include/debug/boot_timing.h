@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/** @file
+ *  @brief Boot time breakdown instrumentation API
+ */
+
+#ifndef ZEPHYR_INCLUDE_DEBUG_BOOT_TIMING_H_
+#define ZEPHYR_INCLUDE_DEBUG_BOOT_TIMING_H_
+
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct init_entry;
+
+/** One recorded SYS_INIT/device init function invocation */
+struct boot_init_record {
+	/** Device name, or NULL for a plain SYS_INIT entry */
+	const char *name;
+	/** Address of the init function, for symbolizing SYS_INIT
+	 *  entries that have no device name
+	 */
+	const void *init_fn;
+	/** Init level the entry ran at (_SYS_INIT_LEVEL_*) */
+	uint8_t level;
+	/** Time spent inside the init function, in hardware cycles */
+	uint32_t cycles;
+};
+
+/** @typedef boot_timing_cb_t
+ * @brief Callback invoked for each boot init record
+ *
+ * @param rec The record; only valid during the callback.
+ * @param user_data User data passed to boot_timing_foreach()
+ */
+typedef void (*boot_timing_cb_t)(const struct boot_init_record *rec,
+				 void *user_data);
+
+/**
+ * @brief Iterate over the retained boot report
+ *
+ * Records are visited in execution order. Entries that ran before the
+ * system clock driver was initialized report zero cycles. This is the
+ * export hook: call it once connectivity is up and forward the records
+ * over whatever transport the product uses.
+ *
+ * @param cb Callback invoked for each record
+ * @param user_data Passed to the callback
+ */
+void boot_timing_foreach(boot_timing_cb_t cb, void *user_data);
+
+/**
+ * @brief Total recorded init time of one level, in hardware cycles
+ *
+ * @param level Init level (_SYS_INIT_LEVEL_*)
+ *
+ * @return Sum of the cycles of all records at that level
+ */
+uint32_t boot_timing_level_cycles(int level);
+
+/**
+ * @brief Number of init entries that could not be recorded
+ *
+ * Non-zero when more init functions ran than
+ * CONFIG_BOOT_INIT_TIMING_MAX_RECORDS; increase that option to get a
+ * complete report.
+ */
+uint32_t boot_timing_dropped(void);
+
+/* Instrumentation hook, called from z_sys_init_run_level() around each
+ * init entry. Not application API.
+ */
+void z_boot_timing_record(const struct init_entry *entry, int32_t level,
+			  uint32_t cycles);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DEBUG_BOOT_TIMING_H_ */
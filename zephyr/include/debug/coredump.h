@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DEBUG_COREDUMP_H_
+#define ZEPHYR_INCLUDE_DEBUG_COREDUMP_H_
+
+#include <kernel.h>
+#include <arch/cpu.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Magic number identifying a stored core dump */
+#define COREDUMP_MAGIC		0x434f5245
+/** Version of the dump layout */
+#define COREDUMP_VERSION	1
+
+/**
+ * @brief Header preceding a core dump in flash.
+ *
+ * The header is followed by @a esf_len bytes of raw exception stack
+ * frame and @a stack_len bytes of the faulting thread's stack,
+ * starting at address @a stack_start.
+ */
+struct coredump_hdr {
+	/** COREDUMP_MAGIC */
+	uint32_t magic;
+	/** COREDUMP_VERSION */
+	uint16_t version;
+	/** Fatal error reason (one of the K_ERR_* codes) */
+	uint16_t reason;
+	/** Length of the stored exception stack frame, may be zero */
+	uint32_t esf_len;
+	/** Length of the stored stack snapshot, may be zero */
+	uint32_t stack_len;
+	/** Address the stack snapshot was taken from */
+	uint32_t stack_start;
+	/** Faulting thread, as a debugging hint */
+	uint32_t thread_addr;
+	/** Name of the faulting thread, if thread names are enabled */
+	char thread_name[16];
+} __packed;
+
+/**
+ * @brief Capture a core dump of the current fatal error.
+ *
+ * Writes the header, the exception stack frame and as much of the
+ * faulting thread's stack as fits to the coredump flash partition.
+ * Called from the fatal error path with interrupts locked; the flash
+ * driver backing the partition must therefore not rely on interrupts
+ * or the scheduler.
+ *
+ * @param reason Fatal error reason.
+ * @param esf Exception stack frame, or NULL if not available.
+ * @param thread Faulting thread.
+ */
+void coredump(unsigned int reason, const z_arch_esf_t *esf,
+	      struct k_thread *thread);
+
+/**
+ * @brief Check for and size a stored core dump.
+ *
+ * @param size Filled with the total dump size in bytes (header
+ *             included) when one is present. May be NULL.
+ *
+ * @retval 0 a valid dump is stored.
+ * @retval -ENOENT no dump is stored.
+ * @retval -errno flash access error.
+ */
+int coredump_stored_size(size_t *size);
+
+/**
+ * @brief Read back a stored core dump.
+ *
+ * @param off Offset into the dump, from the start of the header.
+ * @param dst Buffer to read into.
+ * @param len Number of bytes to read.
+ *
+ * @return 0 on success, negative errno code on fail.
+ */
+int coredump_read(off_t off, void *dst, size_t len);
+
+/**
+ * @brief Invalidate the stored core dump.
+ *
+ * @return 0 on success, negative errno code on fail.
+ */
+int coredump_erase(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DEBUG_COREDUMP_H_ */
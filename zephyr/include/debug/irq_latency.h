@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/** @file
+ *  @brief Interrupt latency instrumentation API
+ */
+
+#ifndef ZEPHYR_INCLUDE_DEBUG_IRQ_LATENCY_H_
+#define ZEPHYR_INCLUDE_DEBUG_IRQ_LATENCY_H_
+
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Number of log2 histogram buckets per IRQ line. Bucket n counts
+ *  samples whose latency in cycles satisfies 2^n <= latency < 2^(n+1);
+ *  the last bucket also absorbs everything larger.
+ */
+#define IRQ_LATENCY_BUCKETS 16
+
+/** Latency statistics accumulated for one IRQ line */
+struct irq_latency_stats {
+	/** Number of samples recorded */
+	uint32_t count;
+	/** Largest latency seen, in hardware cycles */
+	uint32_t max_cycles;
+	/** Log2 histogram of latencies, in hardware cycles */
+	uint32_t bucket[IRQ_LATENCY_BUCKETS];
+};
+
+/**
+ * @brief Snapshot the latency statistics of one IRQ line
+ *
+ * The reported latency is measured from interrupt entry to the resume
+ * of the thread scheduled in consequence, so it includes ISR execution
+ * and the context switch itself. Interrupts that do not cause a
+ * context switch are not sampled.
+ *
+ * @param irq IRQ line number
+ * @param stats Output buffer for the statistics
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @a irq is not a valid IRQ line
+ */
+int irq_latency_get(unsigned int irq, struct irq_latency_stats *stats);
+
+/**
+ * @brief Reset the latency statistics of all IRQ lines
+ */
+void irq_latency_reset(void);
+
+/* Instrumentation hooks, called from the arch interrupt entry/exit and
+ * context switch code. Not application API.
+ */
+void z_irq_latency_enter(void);
+void z_irq_latency_drop(void);
+void z_irq_latency_thread_resumed(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DEBUG_IRQ_LATENCY_H_ */
@@ -13,6 +13,7 @@
 #define ZEPHYR_INCLUDE_DEBUG_OBJECT_TRACING_COMMON_H_
 
 #include <stdbool.h>
+#include <sys/atomic.h>
 
 #ifndef CONFIG_OBJECT_TRACING
 
@@ -30,21 +31,24 @@
  * @details The object is added for tracing into a trace list. This is usually
  * called at the moment of object initialization.
  *
+ * The list is prepend-only and the next pointers of linked objects are
+ * never modified, so insertion is a lock-free CAS on the list head and
+ * debug tools may walk the list concurrently without locking.
+ *
  * @param name Name of the trace list.
  * @param obj Object to be added in the trace list.
  */
-#define SYS_TRACING_OBJ_INIT(name, obj)			       \
-	do {						       \
-		unsigned int key;			       \
-							       \
-		key = irq_lock();			       \
-		if (!(obj)->__linked) {			       \
-			(obj)->__next =  _trace_list_ ## name; \
-			_trace_list_ ## name = obj;	       \
-			(obj)->__linked = 1;		       \
-		}					       \
-		irq_unlock(key);			       \
-	}						       \
+#define SYS_TRACING_OBJ_INIT(name, obj)				       \
+	do {							       \
+		if (!(obj)->__linked) {				       \
+			(obj)->__linked = 1;			       \
+			do {					       \
+				(obj)->__next = _trace_list_ ## name;  \
+			} while (!atomic_ptr_cas(		       \
+				(atomic_ptr_t *)&_trace_list_ ## name, \
+				(obj)->__next, (obj)));		       \
+		}						       \
+	}							       \
 	while (false)
 
 /**
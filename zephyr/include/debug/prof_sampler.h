@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/** @file
+ *  @brief Sampling profiler API
+ */
+
+#ifndef ZEPHYR_INCLUDE_DEBUG_PROF_SAMPLER_H_
+#define ZEPHYR_INCLUDE_DEBUG_PROF_SAMPLER_H_
+
+#include <zephyr/types.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Size of one sample record in the stream, in bytes */
+#define PROF_SAMPLE_SIZE 8
+
+/** PC value recorded when the sample hit interrupt context */
+#define PROF_SAMPLE_PC_IN_IRQ 0xFFFFFFFFU
+
+/**
+ * @brief Start periodic sampling
+ *
+ * Every CONFIG_PROF_SAMPLER_PERIOD_US microseconds the interrupted
+ * program counter and current thread are captured into the sample
+ * buffer. Samples arriving while the buffer is full are counted as
+ * dropped, never overwritten, so a stalled reader cannot corrupt the
+ * stream.
+ */
+void prof_sampler_start(void);
+
+/**
+ * @brief Stop periodic sampling
+ *
+ * Buffered samples remain readable after stopping.
+ */
+void prof_sampler_stop(void);
+
+/**
+ * @brief Drain captured samples
+ *
+ * The stream is a sequence of PROF_SAMPLE_SIZE records, each two
+ * native-endian 32-bit words: the sampled PC (PROF_SAMPLE_PC_IN_IRQ
+ * for samples taken in interrupt context) followed by the thread
+ * pointer, matching the thread addresses reported by the kernel shell
+ * commands. Fold against the ELF on the host to produce flamegraphs.
+ *
+ * @param buf Destination buffer
+ * @param len Size of @a buf in bytes; rounded down to a multiple of
+ *            PROF_SAMPLE_SIZE
+ *
+ * @return Number of bytes copied out
+ */
+size_t prof_sampler_read(uint8_t *buf, size_t len);
+
+/** @brief Number of samples captured since boot */
+uint32_t prof_sampler_samples(void);
+
+/** @brief Number of samples lost to a full buffer since boot */
+uint32_t prof_sampler_dropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DEBUG_PROF_SAMPLER_H_ */
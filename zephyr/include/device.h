@@ -213,6 +213,12 @@ struct device {
 	/** Pointer to device instance power management data */
 	struct device_pm * const pm;
 #endif
+#ifdef CONFIG_DEFERRED_INIT
+	/** Saved API pointer while a DEFERRED-level device awaits its
+	 * init function; NULL once the function has run
+	 */
+	const void *deferred_api;
+#endif
 };
 
 /**
@@ -239,6 +245,25 @@ __syscall struct device *device_get_binding(const char *name);
  */
 size_t z_device_get_all_static(struct device **devices);
 
+#ifdef CONFIG_DEFERRED_INIT
+/** @brief Initialize all DEFERRED-level devices that have not run yet.
+ *
+ * Devices defined at the DEFERRED initialization level are skipped at
+ * boot and normally initialized on demand by the first
+ * device_get_binding() call naming them. This function instead runs
+ * every init entry at that level which is still pending, including
+ * plain SYS_INIT() entries, and is intended to be called from a
+ * low-priority background thread once boot-critical work is done.
+ *
+ * Must be called from thread context.
+ *
+ * @retval 0 every deferred init entry has run successfully.
+ * @retval -EIO at least one init function failed; the affected devices
+ * report as not ready.
+ */
+int device_deferred_init_all(void);
+#endif
+
 /** @brief Determine whether a device has been successfully initialized.
  *
  * @param dev pointer to the device in question.
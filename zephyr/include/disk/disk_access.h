@@ -129,6 +129,64 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
  */
 int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buff);
 
+/* Operation codes for asynchronous disk requests */
+#define DISK_ACCESS_OP_READ		0
+#define DISK_ACCESS_OP_WRITE		1
+#define DISK_ACCESS_OP_SYNC		2
+
+struct disk_access_request;
+
+/*
+ * @brief Completion callback for an asynchronous disk request
+ *
+ * Invoked from the disk service thread once the request has been
+ * executed. The request object may be reused or freed from within
+ * the callback.
+ *
+ * @param[in] req     Completed request
+ * @param[in] result  0 on success, negative errno code on fail
+ */
+typedef void (*disk_access_callback_t)(struct disk_access_request *req,
+				       int result);
+
+struct disk_access_request {
+	/* Used internally to queue the request, do not touch */
+	void *fifo_reserved;
+	/* Disk resolved at submission time, do not touch */
+	struct disk_info *disk;
+	/* One of the DISK_ACCESS_OP_* codes */
+	uint8_t op;
+	/* Buffer read into or written from, unused for SYNC */
+	uint8_t *data_buf;
+	/* First disk sector of the transfer */
+	uint32_t start_sector;
+	/* Number of disk sectors to transfer */
+	uint32_t num_sector;
+	/* Completion callback, or NULL when no notification is needed */
+	disk_access_callback_t cb;
+	/* Free for use by the submitter */
+	void *user_data;
+};
+
+/*
+ * @brief submit an asynchronous disk request
+ *
+ * Queue a read, write or sync request for execution on the disk
+ * service thread and return immediately; the outcome is reported
+ * through the request's callback. Requests are executed in submission
+ * order. The request object and data buffer must stay valid until the
+ * callback runs. Must be called from thread context; the disk registry
+ * lookup takes a mutex.
+ *
+ * Requires CONFIG_DISK_ACCESS_ASYNC.
+ *
+ * @param[in] req  Request to queue, with op, buffer, sector range and
+ *                 callback filled in
+ *
+ * @return 0 if the request was queued, negative errno code on fail
+ */
+int disk_access_submit(const char *pdrv, struct disk_access_request *req);
+
 int disk_access_register(struct disk_info *disk);
 
 int disk_access_unregister(struct disk_info *disk);
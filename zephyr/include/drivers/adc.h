@@ -469,6 +469,92 @@ static inline uint16_t adc_ref_internal(struct device *dev)
 	return api->ref_internal;
 }
 
+#ifdef CONFIG_ADC_STREAM
+/**
+ * @typedef adc_stream_callback_t
+ * @brief Callback invoked each time a block of the ring is filled.
+ *
+ * Called from the driver's sampling context (usually an ISR); it
+ * should only hand the block over, e.g. by submitting a work item.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param block Pointer to the completed block inside the ring buffer.
+ *        The block stays valid until the ring wraps back around to it.
+ * @param block_size Size of the block in bytes.
+ * @param user_data User data supplied in the stream structure.
+ */
+typedef void (*adc_stream_callback_t)(struct device *dev, void *block,
+				      size_t block_size, void *user_data);
+
+/**
+ * @brief Continuous acquisition stream into a ring buffer.
+ *
+ * The embedded sequence is filled by the user like for adc_read(),
+ * except that its buffer must hold exactly one sampling (all selected
+ * channels once); the stream helper supplies the sequence options.
+ */
+struct adc_stream {
+	/** Sampling sequence; buffer/buffer_size cover one sampling */
+	struct adc_sequence sequence;
+
+	/** Used internally; overwrites sequence.options on start */
+	struct adc_sequence_options options;
+
+	/** Interval between consecutive samplings (in microseconds) */
+	uint32_t interval_us;
+
+	/** Ring buffer receiving the samples */
+	uint8_t *ring_buf;
+
+	/** Size of the ring buffer in bytes; a multiple of block_size */
+	size_t ring_size;
+
+	/** Bytes per completed-block notification; a multiple of the
+	 * sampling size
+	 */
+	size_t block_size;
+
+	/** Size of one sampling in bytes (sample width times the
+	 * number of selected channels)
+	 */
+	size_t sampling_bytes;
+
+	/** Called whenever a block of the ring has been filled */
+	adc_stream_callback_t callback;
+
+	/** Passed back to the block callback */
+	void *user_data;
+
+	/* Internal state */
+	size_t wr;
+	bool stop;
+};
+
+/**
+ * @brief Start continuous sampling into the stream's ring buffer.
+ *
+ * Sampling is paced by the driver's interval mechanism (a dedicated
+ * hardware timer where available) and continues without software
+ * re-arming until adc_stream_stop() is called.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param stream Stream to start; must stay valid until stopped.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL If the stream geometry is inconsistent.
+ */
+int adc_stream_start(struct device *dev, struct adc_stream *stream);
+
+/**
+ * @brief Request the stream to stop.
+ *
+ * The sequence finishes after the sampling in progress.
+ *
+ * @param stream Stream to stop.
+ */
+void adc_stream_stop(struct adc_stream *stream);
+#endif /* CONFIG_ADC_STREAM */
+
 /**
  * @}
  */
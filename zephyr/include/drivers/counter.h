@@ -589,6 +589,113 @@ static inline uint32_t z_impl_counter_get_guard_period(struct device *dev,
 	return (api->get_guard_period) ? api->get_guard_period(dev, flags) : 0;
 }
 
+#ifdef CONFIG_COUNTER_BATCH
+/** @brief Batch alarm callback
+ *
+ * Called from the counter interrupt for every consumed batch entry.
+ *
+ * @param dev       Pointer to the device structure for the driver instance.
+ * @param ticks     Absolute tick value of the consumed entry.
+ * @param index     Index of the consumed entry in the submitted array.
+ * @param user_data User data.
+ */
+typedef void (*counter_batch_callback_t)(struct device *dev, uint32_t ticks,
+					 uint32_t index, void *user_data);
+
+/** @brief Batch alarm descriptor.
+ *
+ * Must remain valid until the last entry has expired or the batch is
+ * cancelled. Internal fields are managed by the helper.
+ *
+ * @param dev	    Counter device the batch was started on (internal).
+ * @param ticks	    Array of absolute expiration values, sorted ascending.
+ * @param count	    Number of entries in @a ticks.
+ * @param callback  Called per consumed entry (cannot be NULL).
+ * @param user_data User data returned in callback.
+ */
+struct counter_batch {
+	struct device *dev;
+	const uint32_t *ticks;
+	uint32_t count;
+	counter_batch_callback_t callback;
+	void *user_data;
+	/* internal */
+	uint32_t next;
+	uint32_t done;
+	uint8_t channels;
+};
+
+/**
+ * @brief Submit a batch of absolute alarms.
+ *
+ * Arms one absolute alarm per available channel and refills each channel
+ * from the remaining entries directly in the expiration interrupt, so no
+ * scheduler round trip is needed between consecutive events. Entries must
+ * be sorted in ascending expiration order. The helper takes over all alarm
+ * channels of the device until the batch completes.
+ *
+ * @param dev	Pointer to the device structure for the driver instance.
+ * @param batch	Batch descriptor, valid until completion.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL if the batch is empty or has no callback.
+ * @retval -EBUSY if a batch is already running on the device channels.
+ * @retval Negative error code from counter_set_channel_alarm() otherwise.
+ */
+int counter_batch_start(struct device *dev, struct counter_batch *batch);
+
+/**
+ * @brief Cancel a running batch.
+ *
+ * Cancels all channel alarms still armed for the batch. Entries already
+ * consumed have had their callback invoked; the rest are dropped.
+ *
+ * @param batch Batch descriptor passed to counter_batch_start().
+ *
+ * @retval 0 If successful.
+ */
+int counter_batch_cancel(struct counter_batch *batch);
+
+/** @brief Free-running capture timestamp ring.
+ *
+ * Single producer, single consumer. @a buf holds @a size tick values.
+ */
+struct counter_capture_ring {
+	uint32_t *buf;
+	uint16_t size;
+	volatile uint16_t head;
+	volatile uint16_t tail;
+};
+
+/**
+ * @brief Capture the current counter value into a ring.
+ *
+ * Reads the free-running counter and appends the value to the ring.
+ * Intended to be called from the interrupt handler of the captured
+ * event (e.g. a GPIO edge); safe against a single concurrent reader.
+ *
+ * @param dev  Pointer to the device structure for the driver instance.
+ * @param ring Capture ring.
+ *
+ * @retval 0 If successful.
+ * @retval -ENOBUFS if the ring is full; the sample is dropped.
+ */
+int counter_capture_ring_put(struct device *dev,
+			     struct counter_capture_ring *ring);
+
+/**
+ * @brief Pop the oldest captured timestamp from a ring.
+ *
+ * @param ring  Capture ring.
+ * @param ticks Where to store the timestamp.
+ *
+ * @retval 0 If successful.
+ * @retval -EAGAIN if the ring is empty.
+ */
+int counter_capture_ring_get(struct counter_capture_ring *ring,
+			     uint32_t *ticks);
+#endif /* CONFIG_COUNTER_BATCH */
+
 /* Deprecated counter callback. */
 typedef void (*counter_callback_t)(struct device *dev, void *user_data);
 
@@ -256,6 +256,67 @@ static inline int display_write(const struct device *dev, const uint16_t x,
 	return api->write(dev, x, y, desc, buf);
 }
 
+#ifdef CONFIG_DISPLAY_ASYNC_WRITE
+/**
+ * @typedef display_write_callback_t
+ * @brief Completion callback for an asynchronous write.
+ *
+ * Called from the display write thread once the update reached the
+ * panel; the request's buffer may be reused from this point on.
+ *
+ * @param dev Pointer to device structure
+ * @param result Result of the write, as returned by display_write()
+ * @param user_data User data supplied at submission
+ */
+typedef void (*display_write_callback_t)(const struct device *dev, int result,
+					 void *user_data);
+
+/**
+ * @brief Asynchronous display write request.
+ *
+ * The request, the descriptor and the buffer must stay valid until
+ * the completion callback runs.
+ */
+struct display_write_req {
+	/** Used internally to queue the request */
+	void *fifo_reserved;
+
+	/** Display device to write to */
+	const struct device *dev;
+
+	/** Upper left corner of the dirty rectangle */
+	uint16_t x;
+	uint16_t y;
+
+	/** Descriptor of the dirty rectangle */
+	const struct display_buffer_descriptor *desc;
+
+	/** Pixel data */
+	const void *buf;
+
+	/** Completion callback, or NULL if none is needed */
+	display_write_callback_t callback;
+
+	/** Passed back to the completion callback */
+	void *user_data;
+};
+
+/**
+ * @brief Submit a dirty rectangle for asynchronous writing.
+ *
+ * Requests are written to the panel in submission order by a
+ * dedicated thread, so the caller (e.g. a GUI flush callback) does
+ * not block for the transfer and rendering of the next frame overlaps
+ * with the update of the current one.
+ *
+ * @param req Write request; owned by the display layer until the
+ *        completion callback runs.
+ *
+ * @retval 0 If successfully queued.
+ */
+int display_write_async(struct display_write_req *req);
+#endif /* CONFIG_DISPLAY_ASYNC_WRITE */
+
 /**
  * @brief Read data from display
  *
@@ -249,6 +249,127 @@ static inline int dma_config(struct device *dev, uint32_t channel,
 	return api->config(dev, channel, config);
 }
 
+/**
+ * @brief One element of a scatter-gather list.
+ *
+ * A compact description of a single transfer; dma_config_sg() expands
+ * an array of these into a chain of block configurations.
+ */
+struct dma_sg_entry {
+#ifdef CONFIG_DMA_64BIT
+	uint64_t source_address;
+	uint64_t dest_address;
+#else
+	uint32_t source_address;
+	uint32_t dest_address;
+#endif
+	uint32_t block_size;
+};
+
+/**
+ * @brief Configure a channel from a scatter-gather list.
+ *
+ * Links @a count block configurations into a chain carrying the
+ * addresses and sizes from @a entries and hands the chain to the
+ * driver in one dma_config() call, so the whole list executes without
+ * per-block reconfiguration; controllers with hardware linked-list
+ * support chain the blocks without CPU intervention.
+ *
+ * Only the address, size and linkage fields of @a blocks are written;
+ * any other per-block settings (address adjustment, scatter/gather
+ * controls) set by the caller beforehand are preserved.
+ *
+ * @param dev     Pointer to the device structure for the driver instance.
+ * @param channel Numeric identification of the channel to configure
+ * @param config  Channel configuration; block_count and head_block are
+ *                filled in from the list
+ * @param blocks  Caller-provided array of at least @a count block
+ *                configurations, which must stay valid while the
+ *                transfer is active
+ * @param entries Scatter-gather list to execute, in order
+ * @param count   Number of list elements
+ *
+ * @retval 0 if successful.
+ * @retval Negative errno code if failure.
+ */
+static inline int dma_config_sg(struct device *dev, uint32_t channel,
+				struct dma_config *config,
+				struct dma_block_config *blocks,
+				const struct dma_sg_entry *entries,
+				uint32_t count)
+{
+	uint32_t i;
+
+	if (count == 0U) {
+		return -EINVAL;
+	}
+
+	for (i = 0U; i < count; i++) {
+		blocks[i].source_address = entries[i].source_address;
+		blocks[i].dest_address = entries[i].dest_address;
+		blocks[i].block_size = entries[i].block_size;
+		blocks[i].next_block = (i + 1U < count) ? &blocks[i + 1U]
+							: NULL;
+	}
+
+	config->block_count = count;
+	config->head_block = blocks;
+
+	return dma_config(dev, channel, config);
+}
+
+/**
+ * @brief Pool of DMA channels for lock-free allocation.
+ *
+ * Describes a contiguous range of up to 32 channels of one controller
+ * that peripheral drivers may share.
+ */
+struct dma_channel_pool {
+	/** Allocation state, one bit per channel */
+	atomic_t bitmap;
+
+	/** First channel number covered by the pool */
+	uint8_t base;
+
+	/** Number of channels in the pool (at most 32) */
+	uint8_t count;
+};
+
+/**
+ * @brief Allocate a channel from a pool.
+ *
+ * Lock-free; may be called from any context.
+ *
+ * @param pool Pool to allocate from.
+ *
+ * @retval The channel number if successful.
+ * @retval -EBUSY if all channels of the pool are in use.
+ */
+static inline int dma_channel_alloc(struct dma_channel_pool *pool)
+{
+	int bit;
+
+	for (bit = 0; bit < pool->count; bit++) {
+		if (!atomic_test_and_set_bit(&pool->bitmap, bit)) {
+			return pool->base + bit;
+		}
+	}
+
+	return -EBUSY;
+}
+
+/**
+ * @brief Return a channel to its pool.
+ *
+ * @param pool Pool the channel was allocated from.
+ * @param channel Channel number returned by dma_channel_alloc().
+ */
+static inline void dma_channel_release(struct dma_channel_pool *pool,
+				       uint32_t channel)
+{
+	atomic_clear_bit(&pool->bitmap, channel - pool->base);
+}
+
 /**
  * @brief Reload buffer(s) for a DMA channel
  *
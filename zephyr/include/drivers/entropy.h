@@ -105,6 +105,21 @@ static inline int entropy_get_entropy_isr(struct device *dev,
 	return api->get_entropy_isr(dev, buffer, length, flags);
 }
 
+#ifdef CONFIG_ENTROPY_POOL
+/**
+ * @brief Get entropy from the buffered entropy pool.
+ *
+ * Satisfies the request in constant time from a ring that a
+ * background thread keeps topped up from the chosen entropy device.
+ * Callable from any context, including ISRs.
+ *
+ * @param buffer Buffer to fill with entropy.
+ * @param length Buffer length.
+ * @retval number of bytes filled with entropy; may be less than
+ *	   @a length if the pool is running low.
+ */
+int entropy_pool_get_isr(uint8_t *buffer, size_t length);
+#endif /* CONFIG_ENTROPY_POOL */
 
 #ifdef __cplusplus
 }
@@ -696,6 +696,53 @@ static inline int z_impl_espi_receive_oob(struct device *dev,
 	return api->receive_oob(dev, pckt);
 }
 
+#ifdef CONFIG_ESPI_OOB_ASYNC
+/**
+ * @brief Completion callback for an asynchronous OOB transmission.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param pckt Packet that completed.
+ * @param result 0 on success, negative errno code on failure.
+ * @param user_data User data supplied with the request.
+ */
+typedef void (*espi_oob_callback_t)(struct device *dev,
+				    struct espi_oob_packet *pckt, int result,
+				    void *user_data);
+
+/**
+ * @brief Asynchronous OOB transmission request.
+ *
+ * Must remain valid, including the packet buffer, until the completion
+ * callback has run.
+ */
+struct espi_oob_req {
+	/** Used internally for request queuing, do not touch. */
+	void *fifo_reserved;
+	/** Device to send the packet on. */
+	struct device *dev;
+	/** Packet to send, valid until completion. */
+	struct espi_oob_packet pckt;
+	/** Completion callback, may be NULL. */
+	espi_oob_callback_t callback;
+	/** User data passed to the callback. */
+	void *user_data;
+};
+
+/**
+ * @brief Queue an OOB packet for asynchronous transmission.
+ *
+ * Queued packets are sent in submission order by a dedicated thread,
+ * back to back when several are pending, and each completion callback
+ * is invoked with the result.  The caller never blocks on the bus, so
+ * the EC main loop can queue a whole burst of messages at once.
+ *
+ * @param req Request descriptor, valid until completion.
+ *
+ * @retval 0 Request was queued.
+ */
+int espi_send_oob_async(struct espi_oob_req *req);
+#endif /* CONFIG_ESPI_OOB_ASYNC */
+
 /**
  * @brief Sends a read request packet for shared flash.
  *
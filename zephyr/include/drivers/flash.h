@@ -54,6 +54,19 @@ typedef int (*flash_api_erase)(struct device *dev, off_t offset, size_t size);
 typedef int (*flash_api_write_protection)(struct device *dev, bool enable);
 typedef const struct flash_parameters* (*flash_api_get_parameters)(const struct device *dev);
 
+/**
+ * @brief Retrieve the memory-mapped address of a flash region.
+ *
+ * Optional API, provided only by drivers whose storage is directly
+ * readable from the CPU address space (XIP-capable controllers and
+ * on-die flash).
+ *
+ * See flash_get_mapped_address() for the contract the implementation
+ * must honor.
+ */
+typedef int (*flash_api_get_mapped_address)(struct device *dev, off_t offset,
+					    size_t len, const void **ptr);
+
 #if defined(CONFIG_FLASH_PAGE_LAYOUT)
 /**
  * @brief Retrieve a flash device's layout.
@@ -87,6 +100,7 @@ __subsystem struct flash_driver_api {
 	flash_api_erase erase;
 	flash_api_write_protection write_protection;
 	flash_api_get_parameters get_parameters;
+	flash_api_get_mapped_address get_mapped_address;
 #if defined(CONFIG_FLASH_PAGE_LAYOUT)
 	flash_api_pages_layout page_layout;
 #endif /* CONFIG_FLASH_PAGE_LAYOUT */
@@ -118,6 +132,48 @@ static inline int z_impl_flash_read(struct device *dev, off_t offset, void *data
 	return api->read(dev, offset, data, len);
 }
 
+/**
+ *  @brief  Get a directly readable mapping of a flash region
+ *
+ *  On devices whose storage is visible in the CPU address space, obtain
+ *  the address at which the given flash region can be read without
+ *  copying. Callers holding such a pointer can parse or verify data in
+ *  place instead of staging it through flash_read().
+ *
+ *  The returned pointer stays valid for the lifetime of the device and
+ *  is read-only; writing through it is undefined behavior. Its contents
+ *  match what flash_read() would return except while a flash_write() or
+ *  flash_erase() touching the region is in progress. Drivers providing
+ *  this API must perform any data cache maintenance needed after writes
+ *  and erases before those operations return, so that subsequent reads
+ *  through the mapping observe the new contents.
+ *
+ *  This routine is not a system call; user mode threads must use
+ *  flash_read() instead.
+ *
+ *  @param  dev             : flash device
+ *  @param  offset          : Offset of the region to map
+ *  @param  len             : Length of the region to map
+ *  @param  ptr             : Filled with the mapped address on success
+ *
+ *  @retval 0 on success.
+ *  @retval -ENOTSUP if the device (or this region of it) is not
+ *  memory mapped.
+ *  @retval -EINVAL if the region is out of bounds.
+ */
+static inline int flash_get_mapped_address(struct device *dev, off_t offset,
+					   size_t len, const void **ptr)
+{
+	const struct flash_driver_api *api =
+		(const struct flash_driver_api *)dev->driver_api;
+
+	if (api->get_mapped_address == NULL) {
+		return -ENOTSUP;
+	}
+
+	return api->get_mapped_address(dev, offset, len, ptr);
+}
+
 /**
  *  @brief  Write buffer into flash memory.
  *
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_GPIO_GPIO_NRFX_H_
+#define ZEPHYR_INCLUDE_DRIVERS_GPIO_GPIO_NRFX_H_
+
+#include <device.h>
+#include <drivers/gpio.h>
+#include <hal/nrf_gpio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Direct-access helpers for nRF GPIO
+ *
+ * When the build has exactly one GPIO port enabled, the port a device
+ * pointer refers to is known at compile time and the pin operations
+ * below compile down to a single register access, bypassing the
+ * driver vtable and configuration lookups of the generic API. With
+ * both ports enabled they fall back to the generic calls, so they are
+ * always safe to use as drop-in replacements on configured pins.
+ *
+ * Only raw accesses are provided: GPIO_ACTIVE_LOW inversion handling
+ * needs the runtime driver data and is inherently not resolvable at
+ * compile time.
+ */
+
+#if defined(CONFIG_GPIO_NRF_P0) && !defined(CONFIG_GPIO_NRF_P1)
+#define GPIO_NRFX_UNIQUE_PORT 0
+#elif defined(CONFIG_GPIO_NRF_P1) && !defined(CONFIG_GPIO_NRF_P0)
+#define GPIO_NRFX_UNIQUE_PORT 1
+#endif
+
+#if defined(GPIO_NRFX_UNIQUE_PORT)
+#define GPIO_NRFX_ABS_PIN(pin) \
+	NRF_GPIO_PIN_MAP(GPIO_NRFX_UNIQUE_PORT, pin)
+#endif
+
+static inline int gpio_nrfx_pin_set_raw(struct device *port, gpio_pin_t pin,
+					int value)
+{
+#if defined(GPIO_NRFX_UNIQUE_PORT)
+	ARG_UNUSED(port);
+
+	nrf_gpio_pin_write(GPIO_NRFX_ABS_PIN(pin), value != 0);
+
+	return 0;
+#else
+	return gpio_pin_set_raw(port, pin, value);
+#endif
+}
+
+static inline int gpio_nrfx_pin_get_raw(struct device *port, gpio_pin_t pin)
+{
+#if defined(GPIO_NRFX_UNIQUE_PORT)
+	ARG_UNUSED(port);
+
+	return nrf_gpio_pin_read(GPIO_NRFX_ABS_PIN(pin)) ? 1 : 0;
+#else
+	return gpio_pin_get_raw(port, pin);
+#endif
+}
+
+static inline int gpio_nrfx_pin_toggle(struct device *port, gpio_pin_t pin)
+{
+#if defined(GPIO_NRFX_UNIQUE_PORT)
+	ARG_UNUSED(port);
+
+	nrf_gpio_pin_toggle(GPIO_NRFX_ABS_PIN(pin));
+
+	return 0;
+#else
+	return gpio_pin_toggle(port, pin);
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_GPIO_GPIO_NRFX_H_ */
@@ -255,6 +255,66 @@ static inline int z_impl_i2c_transfer(struct device *dev,
 	return api->transfer(dev, msgs, num_msgs, addr);
 }
 
+#ifdef CONFIG_I2C_ASYNC
+/**
+ * @typedef i2c_async_callback_t
+ * @brief Completion callback for an asynchronous transfer.
+ *
+ * Called from the transfer thread when the transaction finishes.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param result Result of the transfer, as returned by i2c_transfer().
+ * @param user_data User data supplied at submission.
+ */
+typedef void (*i2c_async_callback_t)(struct device *dev, int result,
+				     void *user_data);
+
+/**
+ * @brief Asynchronous I2C transaction descriptor.
+ *
+ * The descriptor and the messages it points to must stay valid until
+ * the completion callback runs.
+ */
+struct i2c_async_req {
+	/** Used internally to queue the descriptor */
+	void *fifo_reserved;
+
+	/** Device the transaction is addressed to */
+	struct device *dev;
+
+	/** Array of messages transacted as one unit, in order */
+	struct i2c_msg *msgs;
+
+	/** Number of messages */
+	uint8_t num_msgs;
+
+	/** Address of the I2C target device */
+	uint16_t addr;
+
+	/** Completion callback, or NULL if none is needed */
+	i2c_async_callback_t callback;
+
+	/** Passed back to the completion callback */
+	void *user_data;
+};
+
+/**
+ * @brief Submit an I2C transaction for asynchronous execution.
+ *
+ * The messages are transacted in submission order as one scheduled
+ * unit (e.g. a register write followed by a read), exactly as
+ * i2c_transfer() would, but the caller does not block; the completion
+ * callback is invoked with the transfer result.  May be called from
+ * any context, including ISRs.
+ *
+ * @param req Transaction descriptor; owned by the I2C layer until the
+ *        completion callback runs.
+ *
+ * @retval 0 If successfully queued.
+ */
+int i2c_transfer_async(struct i2c_async_req *req);
+#endif /* CONFIG_I2C_ASYNC */
+
 /**
  * @brief Recover the I2C bus
  *
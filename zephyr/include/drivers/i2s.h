@@ -307,6 +307,21 @@ struct i2s_config {
 	int32_t timeout;
 };
 
+/** @brief In-driver pipeline stage.
+ *
+ * Called by the driver for every data block moved between the DMA and
+ * the RX/TX queue, from the DMA completion context.  The stage may
+ * process the block in place (e.g. sample rate conversion or
+ * filtering) and update its size; the block capacity is the configured
+ * block size of the stream's memory slab.  The stage must not block.
+ *
+ * @param block Data block to process.
+ * @param size Block size in bytes; may be updated by the stage.
+ * @param user_data User data supplied when the stage was set.
+ */
+typedef void (*i2s_pipeline_stage_t)(void *block, size_t *size,
+				     void *user_data);
+
 /**
  * @cond INTERNAL_HIDDEN
  *
@@ -321,6 +336,9 @@ __subsystem struct i2s_driver_api {
 	int (*write)(struct device *dev, void *mem_block, size_t size);
 	int (*trigger)(struct device *dev, enum i2s_dir dir,
 		       enum i2s_trigger_cmd cmd);
+	int (*pipeline_stage_set)(struct device *dev, enum i2s_dir dir,
+				  i2s_pipeline_stage_t stage,
+				  void *user_data);
 };
 /**
  * @endcond
@@ -374,6 +392,37 @@ static inline struct i2s_config *i2s_config_get(struct device *dev,
 	return api->config_get(dev, dir);
 }
 
+/**
+ * @brief Install a processing stage into a stream's data path.
+ *
+ * The stage runs in the driver between the DMA and the RX/TX queue, so
+ * audio blocks are converted or filtered without waking the application
+ * thread per block.  Pass a NULL stage to remove a previously installed
+ * one.  The stage must be set before the stream is started.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param dir Stream direction: RX or TX as defined by I2S_DIR_*
+ * @param stage Processing function, or NULL to remove.
+ * @param user_data User data passed to the stage.
+ *
+ * @retval 0 If successful.
+ * @retval -ENOTSUP if the driver does not support pipeline stages.
+ * @retval -EINVAL Invalid argument.
+ */
+static inline int i2s_pipeline_stage_set(struct device *dev, enum i2s_dir dir,
+					 i2s_pipeline_stage_t stage,
+					 void *user_data)
+{
+	const struct i2s_driver_api *api =
+		(const struct i2s_driver_api *)dev->driver_api;
+
+	if (api->pipeline_stage_set == NULL) {
+		return -ENOTSUP;
+	}
+
+	return api->pipeline_stage_set(dev, dir, stage, user_data);
+}
+
 /**
  * @brief Read data from the RX queue.
  *
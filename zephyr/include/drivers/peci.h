@@ -285,6 +285,50 @@ static inline int z_impl_peci_transfer(struct device *dev,
 	return api->transfer(dev, msg);
 }
 
+#ifdef CONFIG_PECI_ASYNC
+/**
+ * @brief Completion callback for an asynchronous PECI transaction.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param msg Transaction that completed, including any read data.
+ * @param result 0 on success, negative errno code on failure.
+ * @param user_data User data supplied with the request.
+ */
+typedef void (*peci_async_callback_t)(struct device *dev,
+				      struct peci_msg *msg, int result,
+				      void *user_data);
+
+/**
+ * @brief Asynchronous PECI transaction request.
+ *
+ * Must remain valid until the completion callback has run.
+ */
+struct peci_async_req {
+	/** Used internally for request queuing, do not touch. */
+	void *fifo_reserved;
+	/** Device to run the transaction on. */
+	struct device *dev;
+	/** Transaction to perform, valid until completion. */
+	struct peci_msg *msg;
+	/** Completion callback, may be NULL. */
+	peci_async_callback_t callback;
+	/** User data passed to the callback. */
+	void *user_data;
+};
+
+/**
+ * @brief Queue a PECI transaction for asynchronous execution.
+ *
+ * The request is executed in submission order by a dedicated thread
+ * and the completion callback is invoked with the result; the caller
+ * never blocks on the bus.
+ *
+ * @param req Request descriptor, valid until completion.
+ *
+ * @retval 0 Request was queued.
+ */
+int peci_transfer_async(struct peci_async_req *req);
+#endif /* CONFIG_PECI_ASYNC */
 
 #ifdef __cplusplus
 }
@@ -51,10 +51,32 @@ typedef int (*pwm_pin_set_t)(struct device *dev, uint32_t pwm,
 typedef int (*pwm_get_cycles_per_sec_t)(struct device *dev, uint32_t pwm,
 					uint64_t *cycles);
 
+/** @brief Single channel entry of a batch update.
+ *
+ * @param pwm PWM pin.
+ * @param pulse_cycles Pulse width (in clock cycle). HW specific.
+ * @param flags Flags for pin configuration (polarity).
+ */
+struct pwm_batch_channel {
+	uint32_t pwm;
+	uint32_t pulse_cycles;
+	pwm_flags_t flags;
+};
+
+/**
+ * @typedef pwm_pin_set_batch_t
+ * @brief Callback API upon setting a batch of pins
+ * See @a pwm_pin_set_cycles_batch() for argument description
+ */
+typedef int (*pwm_pin_set_batch_t)(struct device *dev, uint32_t period_cycles,
+				   const struct pwm_batch_channel *channels,
+				   size_t num_channels);
+
 /** @brief PWM driver API definition. */
 __subsystem struct pwm_driver_api {
 	pwm_pin_set_t pin_set;
 	pwm_get_cycles_per_sec_t get_cycles_per_sec;
+	pwm_pin_set_batch_t pin_set_batch;
 };
 
 /**
@@ -87,6 +109,37 @@ static inline int z_impl_pwm_pin_set_cycles(struct device *dev, uint32_t pwm,
 	return api->pin_set(dev, pwm, period, pulse, flags);
 }
 
+/**
+ * @brief Update several PWM outputs of one controller atomically.
+ *
+ * All compare values are staged and committed together, synchronized
+ * to the hardware period boundary where the controller supports it, so
+ * no output ever carries a mix of old and new values within one
+ * period.  All channels share the same period.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param period Period (in clock cycle) applied to all channels.
+ * @param channels Array of per-channel settings.
+ * @param num_channels Number of entries in @p channels.
+ *
+ * @retval 0 If successful.
+ * @retval -ENOTSUP if the driver does not support batch updates.
+ * @retval Negative errno code if failure.
+ */
+static inline int pwm_pin_set_cycles_batch(struct device *dev, uint32_t period,
+					   const struct pwm_batch_channel *channels,
+					   size_t num_channels)
+{
+	struct pwm_driver_api *api;
+
+	api = (struct pwm_driver_api *)dev->driver_api;
+	if (api->pin_set_batch == NULL) {
+		return -ENOTSUP;
+	}
+
+	return api->pin_set_batch(dev, period, channels, num_channels);
+}
+
 /**
  * @brief Get the clock rate (cycles per second) for a single PWM output.
  *
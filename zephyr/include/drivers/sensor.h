@@ -370,6 +370,27 @@ typedef int (*sensor_sample_fetch_t)(struct device *dev,
 typedef int (*sensor_channel_get_t)(struct device *dev,
 				    enum sensor_channel chan,
 				    struct sensor_value *val);
+/**
+ * @typedef sensor_batch_read_t
+ * @brief Callback API for draining a sensor FIFO into a raw buffer
+ *
+ * See sensor_batch_read() for argument description
+ */
+typedef int (*sensor_batch_read_t)(struct device *dev,
+				   enum sensor_channel chan,
+				   uint8_t *buf, size_t buf_size,
+				   uint16_t *frame_count);
+/**
+ * @typedef sensor_batch_decode_t
+ * @brief Callback API for decoding one frame of a raw batch
+ *
+ * See sensor_batch_decode() for argument description
+ */
+typedef int (*sensor_batch_decode_t)(struct device *dev,
+				     enum sensor_channel chan,
+				     const uint8_t *buf,
+				     uint16_t frame_idx,
+				     struct sensor_value *val);
 
 __subsystem struct sensor_driver_api {
 	sensor_attr_set_t attr_set;
@@ -377,6 +398,8 @@ __subsystem struct sensor_driver_api {
 	sensor_trigger_set_t trigger_set;
 	sensor_sample_fetch_t sample_fetch;
 	sensor_channel_get_t channel_get;
+	sensor_batch_read_t batch_read;
+	sensor_batch_decode_t batch_decode;
 };
 
 /**
@@ -566,6 +589,96 @@ static inline int z_impl_sensor_channel_get(struct device *dev,
 	return api->channel_get(dev, chan, val);
 }
 
+/**
+ * @brief Drain a sensor's hardware FIFO into a raw buffer
+ *
+ * Reads as many complete frames as the FIFO holds and the buffer can
+ * fit, in a single bus burst.  Frames are stored back to back in the
+ * device's raw format; use sensor_batch_decode() to convert
+ * individual frames on demand, deferring the scaling cost until a
+ * value is actually needed.
+ *
+ * @param dev Pointer to the sensor device
+ * @param chan The channel the frames belong to.
+ * @param buf Buffer receiving the raw frames.
+ * @param buf_size Size of the buffer in bytes.
+ * @param frame_count Filled in with the number of frames read; may be
+ *        zero if the FIFO was empty.
+ *
+ * @return 0 if successful, negative errno code if failure.
+ * @return -ENOTSUP if the driver has no FIFO support.
+ */
+static inline int sensor_batch_read(struct device *dev,
+				    enum sensor_channel chan,
+				    uint8_t *buf, size_t buf_size,
+				    uint16_t *frame_count)
+{
+	const struct sensor_driver_api *api =
+		(const struct sensor_driver_api *)dev->driver_api;
+
+	if (api->batch_read == NULL) {
+		return -ENOTSUP;
+	}
+
+	return api->batch_read(dev, chan, buf, buf_size, frame_count);
+}
+
+/**
+ * @brief Decode one frame of a raw batch into sensor values
+ *
+ * @param dev Pointer to the sensor device
+ * @param chan The channel to decode from the frame.
+ * @param buf Buffer filled by sensor_batch_read().
+ * @param frame_idx Index of the frame to decode.
+ * @param val Where to store the value(s); multi-axis channels store
+ *        one value per axis, as with sensor_channel_get().
+ *
+ * @return 0 if successful, negative errno code if failure.
+ * @return -ENOTSUP if the driver has no FIFO support.
+ */
+static inline int sensor_batch_decode(struct device *dev,
+				      enum sensor_channel chan,
+				      const uint8_t *buf,
+				      uint16_t frame_idx,
+				      struct sensor_value *val)
+{
+	const struct sensor_driver_api *api =
+		(const struct sensor_driver_api *)dev->driver_api;
+
+	if (api->batch_decode == NULL) {
+		return -ENOTSUP;
+	}
+
+	return api->batch_decode(dev, chan, buf, frame_idx, val);
+}
+
+#ifdef CONFIG_SENSOR_WORKQUEUE
+/**
+ * @brief Get the shared sensor trigger work queue.
+ *
+ * @return Pointer to the work queue started by the sensor core.
+ */
+struct k_work_q *sensor_work_q_get(void);
+#endif
+
+/**
+ * @brief Submit a trigger work item to the sensor work queue.
+ *
+ * When CONFIG_SENSOR_WORKQUEUE is enabled the item runs on the shared
+ * sensor work queue, so slow trigger handlers only delay other sensor
+ * handlers; otherwise it falls back to the system work queue.
+ *
+ * @param work Work item to submit.
+ */
+static inline void sensor_work_submit(struct k_work *work)
+{
+#ifdef CONFIG_SENSOR_WORKQUEUE
+	k_work_submit_to_queue(sensor_work_q_get(), work);
+#else
+	k_work_submit(work);
+#endif
+}
+
 /**
  * @brief The value of gravitational constant in micro m/s^2.
  */
@@ -23,6 +23,10 @@
 #include <stddef.h>
 #include <device.h>
 #include <drivers/gpio.h>
+#ifdef CONFIG_SPI_TXN_QUEUE
+#include <kernel.h>
+#include <sys/slist.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -426,6 +430,77 @@ static inline int z_impl_spi_release(struct device *dev,
 	return api->release(dev, config);
 }
 
+#ifdef CONFIG_SPI_TXN_QUEUE
+/**
+ * @brief SPI transaction descriptor for queued submission.
+ *
+ * The descriptor and the buffer sets it points to must stay valid
+ * until the completion signal is raised.
+ */
+struct spi_txn {
+	/** Used internally to link the descriptor into the queue */
+	sys_snode_t node;
+
+	/** Configuration to apply for this transaction */
+	const struct spi_config *config;
+
+	/** Buffer array where data to be sent originates from,
+	 * or NULL if none
+	 */
+	const struct spi_buf_set *tx_bufs;
+
+	/** Buffer array where data to be read will be written to,
+	 * or NULL if none
+	 */
+	const struct spi_buf_set *rx_bufs;
+
+	/** Signal raised on completion with the transaction result,
+	 * or NULL if no notification is needed
+	 */
+	struct k_poll_signal *signal;
+};
+
+/**
+ * @brief Per-controller queue of SPI transactions.
+ *
+ * All members are initialized by spi_txn_queue_init() and internal to
+ * the queue implementation.
+ */
+struct spi_txn_queue {
+	struct device *dev;
+	sys_slist_t txns;
+	struct k_spinlock lock;
+	struct k_poll_signal sig;
+	struct spi_txn *current;
+};
+
+/**
+ * @brief Initialize a transaction queue for an SPI controller.
+ *
+ * @param queue Queue to initialize.
+ * @param dev Pointer to the device structure for the driver instance.
+ *
+ * @retval 0 If successful.
+ * @retval -ENOMEM All CONFIG_SPI_TXN_QUEUE_MAX queue slots are in use.
+ */
+int spi_txn_queue_init(struct spi_txn_queue *queue, struct device *dev);
+
+/**
+ * @brief Submit a transaction to a queue.
+ *
+ * Appends the descriptor and returns immediately; transactions are
+ * started in submission order, back to back, as the controller becomes
+ * free.  May be called from any context, including ISRs.
+ *
+ * @param queue Queue to submit to.
+ * @param txn Transaction descriptor; owned by the queue until its
+ *        completion signal is raised.
+ *
+ * @retval 0 If successful.
+ */
+int spi_txn_submit(struct spi_txn_queue *queue, struct spi_txn *txn);
+#endif /* CONFIG_SPI_TXN_QUEUE */
+
 #ifdef __cplusplus
 }
 #endif
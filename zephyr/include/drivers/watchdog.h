@@ -246,6 +246,56 @@ static inline int z_impl_wdt_feed(struct device *dev, int channel_id)
 	return api->feed(dev, channel_id);
 }
 
+#ifdef CONFIG_WDT_MULTIPLEXER
+/**
+ * @brief Early warning callback of the watchdog multiplexer.
+ *
+ * Called from the periodic check when at least one registered channel
+ * has not been fed since the previous check, one check interval before
+ * the hardware watchdog is allowed to expire.
+ *
+ * @param starving_mask Bit mask of the channels that were not fed.
+ */
+typedef void (*wdt_mux_warn_cb_t)(uint32_t starving_mask);
+
+/**
+ * @brief Set up the watchdog multiplexer over one hardware watchdog.
+ *
+ * Installs a single hardware timeout of @a window_ms and starts a
+ * periodic check at half that interval.  The hardware watchdog is fed
+ * once per check, and only while every registered channel has been fed
+ * since the previous check; when a channel starves, @a warn_cb fires
+ * first and the hardware reset follows if the channel stays silent.
+ *
+ * @param dev Pointer to the hardware watchdog device.
+ * @param window_ms Hardware watchdog timeout in milliseconds.
+ * @param warn_cb Early warning callback, may be NULL.
+ *
+ * @retval 0 If successful.
+ * @retval Negative errno code from wdt_install_timeout()/wdt_setup().
+ */
+int wdt_mux_init(struct device *dev, uint32_t window_ms,
+		 wdt_mux_warn_cb_t warn_cb);
+
+/**
+ * @brief Register a channel with the watchdog multiplexer.
+ *
+ * @retval channel index to be passed to wdt_mux_feed().
+ * @retval -ENOMEM if all channels are in use.
+ */
+int wdt_mux_channel_add(void);
+
+/**
+ * @brief Feed a watchdog multiplexer channel.
+ *
+ * Constant time and callable from any context, including ISRs; the
+ * hardware watchdog itself is only touched by the periodic check.
+ *
+ * @param channel Channel index returned by wdt_mux_channel_add().
+ */
+void wdt_mux_feed(int channel);
+#endif /* CONFIG_WDT_MULTIPLEXER */
+
 #ifdef __cplusplus
 }
 #endif
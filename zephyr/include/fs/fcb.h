@@ -76,6 +76,21 @@ struct fcb_entry_ctx {
 	/**< Flash area where the entry is placed */
 };
 
+#if defined(CONFIG_FCB_SECTOR_CACHE)
+/**
+ * @brief Per-sector entry cache slot.
+ *
+ * Summary of the valid entries in one FCB sector, kept in RAM so that
+ * reverse iteration does not have to walk the whole buffer.
+ */
+struct fcb_sector_cache {
+	uint32_t fsc_last_off;
+	/**< Offset of the newest valid entry in the sector */
+
+	uint16_t fsc_cnt; /**< Number of valid entries in the sector */
+};
+#endif
+
 /**
  * @brief FCB instance structure
  *
@@ -121,6 +136,13 @@ struct fcb {
 	/**< Flash area used by the fcb instance, , internal state.
 	 * This can be transfer to FCB user
 	 */
+
+#if defined(CONFIG_FCB_SECTOR_CACHE)
+	struct fcb_sector_cache f_cache[CONFIG_FCB_SECTOR_CACHE_SECTORS];
+	/**< Per-sector entry count and newest entry offset, indexed as
+	 * f_sectors, internal state
+	 */
+#endif
 };
 
 /**
@@ -224,6 +246,25 @@ int fcb_walk(struct fcb *fcb, struct flash_sector *sector, fcb_walk_cb cb,
  */
 int fcb_getnext(struct fcb *fcb, struct fcb_entry *loc);
 
+/**
+ * Get previous fcb entry location.
+ *
+ * Function to obtain location of the fcb entry preceding the entry pointed
+ * by <p> loc, walking from the newest entry towards the oldest.
+ * If loc->fe_sector is NULL function fetches the newest entry location
+ * within FCB storage.
+ *
+ * Finding the predecessor of an entry requires re-reading the entries of
+ * its sector; with CONFIG_FCB_SECTOR_CACHE the newest entry is located
+ * without any scan.
+ *
+ * @param[in] fcb FCB instance structure.
+ * @param[in,out] loc entry location information
+ *
+ * @return 0 on success, -ENOTSUP when there is no earlier entry.
+ */
+int fcb_getprev(struct fcb *fcb, struct fcb_entry *loc);
+
 /*
  * Rotate fcb sectors
  *
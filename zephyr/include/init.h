@@ -123,6 +123,12 @@ void z_sys_init_run_level(int32_t level);
  * \li APPLICATION: Used for application components (i.e. non-kernel components)
  * that need automatic configuration. These objects can use all services
  * provided by the kernel during configuration.
+ * \n
+ * \li DEFERRED: Only available with CONFIG_DEFERRED_INIT. Objects at this
+ * level are not initialized at boot; a device's init function runs on the
+ * first device_get_binding() call naming it, and plain SYS_INIT() functions
+ * run when device_deferred_init_all() is called. Use this level for devices
+ * that are not needed on the boot-critical path.
  *
  * @param prio The initialization priority of the object, relative to
  * other objects of the same initialization level. Specified as an integer
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Shared-memory ring transport over an IPM doorbell.
+ */
+
+#ifndef ZEPHYR_INCLUDE_IPC_IPM_RING_H_
+#define ZEPHYR_INCLUDE_IPC_IPM_RING_H_
+
+#include <kernel.h>
+#include <device.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief IPM ring transport
+ * @defgroup ipm_ring IPM ring transport
+ * @ingroup io_interfaces
+ * @{
+ */
+
+/**
+ * Shared-memory end of one unidirectional ring.  head is only ever
+ * written by the consuming core and tail only by the producing core;
+ * both are free-running indices taken modulo the slot count.  The
+ * memory must be mapped uncached or the cores must otherwise be
+ * coherent for this region.
+ */
+struct ipm_ring_shm {
+	atomic_t head;
+	atomic_t tail;
+	uint8_t slots[];
+};
+
+/** Per-slot overhead: the 32-bit payload length stored in the slot */
+#define IPM_RING_SLOT_HDR_SIZE	sizeof(uint32_t)
+
+/** Largest payload one message can carry */
+#define IPM_RING_MAX_PAYLOAD \
+	(CONFIG_IPM_RING_SLOT_SIZE - IPM_RING_SLOT_HDR_SIZE)
+
+/** Shared memory needed for one unidirectional ring */
+#define IPM_RING_SHM_SIZE \
+	(sizeof(struct ipm_ring_shm) + \
+	 (CONFIG_IPM_RING_SLOTS * CONFIG_IPM_RING_SLOT_SIZE))
+
+/**
+ * @typedef ipm_ring_recv_cb_t
+ * @brief Called for each received message while draining the ring.
+ *
+ * Runs in the IPM device's interrupt context.  The data pointer
+ * references the shared-memory slot and is only valid during the
+ * callback; copy out anything that must be kept.
+ *
+ * @param data Payload location in shared memory.
+ * @param len Payload length in bytes.
+ * @param user_data Pointer provided at init time.
+ */
+typedef void (*ipm_ring_recv_cb_t)(const void *data, size_t len,
+				   void *user_data);
+
+/** Local endpoint state; one per direction pair */
+struct ipm_ring {
+	struct ipm_ring_shm *tx;
+	struct ipm_ring_shm *rx;
+	struct device *ipm;
+	ipm_ring_recv_cb_t cb;
+	void *user_data;
+};
+
+/**
+ * @brief Initializes an endpoint of a ring pair.
+ *
+ * The two cores must pass the same shared memory areas with tx and rx
+ * swapped.  Whichever side is brought up first zeroes its TX ring
+ * indices; initialize both sides before sending.  The IPM device is
+ * used purely as a doorbell: a zero-length message is sent when a
+ * ring goes from empty to non-empty, and received messages are pulled
+ * from shared memory in batches, so the doorbell rate stays low no
+ * matter the message rate.
+ *
+ * @param ring Endpoint to initialize.
+ * @param ipm IPM device used for the doorbell.
+ * @param tx_shm IPM_RING_SHM_SIZE bytes of shared memory this core
+ *               produces into.
+ * @param rx_shm IPM_RING_SHM_SIZE bytes of shared memory this core
+ *               consumes from.
+ * @param cb Callback invoked per received message.
+ * @param user_data Passed to the callback.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the IPM device cannot signal a zero-length message.
+ */
+int ipm_ring_init(struct ipm_ring *ring, struct device *ipm,
+		  void *tx_shm, void *rx_shm,
+		  ipm_ring_recv_cb_t cb, void *user_data);
+
+/**
+ * @brief Sends one message through the ring.
+ *
+ * Copies the payload into the next free slot and publishes it.  The
+ * remote core is only interrupted when the ring was empty, so bursts
+ * of messages share a single doorbell.  Safe to call from ISRs; there
+ * must be a single sending context per ring.
+ *
+ * @param ring Endpoint to send on.
+ * @param data Payload to copy.
+ * @param len Payload length, up to IPM_RING_MAX_PAYLOAD bytes.
+ *
+ * @retval 0 on success.
+ * @retval -EMSGSIZE if the payload does not fit a slot.
+ * @retval -ENOMEM if the ring is full.
+ */
+int ipm_ring_send(struct ipm_ring *ring, const void *data, size_t len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_IPC_IPM_RING_H_ */
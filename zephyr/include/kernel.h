@@ -405,6 +405,41 @@ static inline void k_object_free(void *obj)
 /* LCOV_EXCL_STOP */
 #endif /* CONFIG_DYNAMIC_OBJECTS */
 
+/**
+ * @brief Batched system call descriptor
+ *
+ * One system call invocation within a k_syscall_batch() array:
+ * the call identifier from syscall_list.h, its arguments, and the
+ * slot the return value is written back to.
+ */
+struct k_syscall_batch_entry {
+	/** K_SYSCALL_ identifier of the call to make */
+	uint32_t call_id;
+	/** Arguments, in calling order; unused slots are ignored */
+	uintptr_t args[6];
+	/** Return value of the call, written back by the kernel */
+	uintptr_t ret;
+};
+
+/**
+ * @brief Dispatch a batch of system calls in a single trap
+ *
+ * Executes each descriptor in order through the normal system call
+ * verification machinery, writing each return value back into the
+ * corresponding entry. This amortizes the user/kernel transition
+ * cost over tight sequences of small system calls.
+ *
+ * Only useful when invoked from user mode; supervisor mode callers
+ * can simply invoke the APIs directly. Requires CONFIG_SYSCALL_BATCH.
+ *
+ * @param entries Array of system call descriptors
+ * @param count Number of entries in the array
+ * @retval 0 on success (individual calls report via their ret slot)
+ * @retval -ENOSYS if called from supervisor mode
+ */
+__syscall int k_syscall_batch(struct k_syscall_batch_entry *entries,
+			      size_t count);
+
 /** @} */
 
 
@@ -594,6 +629,11 @@ struct k_thread {
 	struct _thread_userspace_local_data *userspace_local_data;
 #endif
 
+#ifdef CONFIG_THREAD_LOCAL_STORAGE
+	/** Base address of the thread's TLS area */
+	uintptr_t tls;
+#endif
+
 #ifdef CONFIG_ERRNO
 #ifndef CONFIG_USERSPACE
 	/** per-thread errno variable */
@@ -606,6 +646,19 @@ struct k_thread {
 	struct _thread_stack_info stack_info;
 #endif /* CONFIG_THREAD_STACK_INFO */
 
+#if defined(CONFIG_THREAD_STACK_WATERMARK)
+	/** Lowest stack pointer sampled when the thread swapped out */
+	uintptr_t stack_watermark;
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
+
+#if defined(CONFIG_TIMESLICE_PER_THREAD)
+	/** Time slice budget in ticks; 0 selects the global slice */
+	int32_t slice_budget;
+
+	/** Number of times this thread exhausted its time slice */
+	uint32_t slice_expired;
+#endif /* CONFIG_TIMESLICE_PER_THREAD */
+
 #if defined(CONFIG_USERSPACE)
 	/** memory domain info of the thread */
 	struct _mem_domain_info mem_domain_info;
@@ -871,6 +924,31 @@ __syscall int k_thread_stack_space_get(const struct k_thread *thread,
 				       size_t *unused_ptr);
 #endif
 
+#if defined(CONFIG_THREAD_STACK_WATERMARK)
+/**
+ * @brief Obtain the sampled stack usage high-watermark of a thread
+ *
+ * Unlike k_thread_stack_space_get(), this routine does not scan the
+ * stack buffer; it reports the lowest stack pointer sampled each time
+ * the thread swapped out, so it runs in constant time and may be
+ * called at any rate from monitoring code.
+ *
+ * Stack consumed between two context switches may be missed, so the
+ * reported unused space is an upper bound; use
+ * k_thread_stack_space_get() when an exact figure is needed.
+ *
+ * @param thread Thread to inspect stack information
+ * @param unused_ptr Output parameter, filled in with the unused stack
+ *	space of the target thread in bytes, based on the sampled
+ *	watermark.
+ * @return 0 on success
+ * @return -EINVAL The sampled watermark lies outside the thread's
+ *	stack area (thread not started yet, or stack overflow).
+ */
+int k_thread_stack_watermark_get(const struct k_thread *thread,
+				 size_t *unused_ptr);
+#endif
+
 #if (CONFIG_HEAP_MEM_POOL_SIZE > 0)
 /**
  * @brief Assign the system heap as a thread's resource pool
@@ -1360,6 +1438,38 @@ __syscall void k_thread_resume(k_tid_t thread);
  */
 extern void k_sched_time_slice_set(int32_t slice, int prio);
 
+/**
+ * @brief Set a per-thread time slice budget.
+ *
+ * This routine gives @a thread its own time slice length, overriding
+ * the global value set with k_sched_time_slice_set(). A budget of
+ * zero restores the global slice for the thread.
+ *
+ * The budget takes effect the next time the thread is scheduled in
+ * (immediately, if @a thread is currently running).
+ *
+ * @param thread ID of thread whose budget to set.
+ * @param slice_ms Time slice budget of the thread (in milliseconds),
+ *        or 0 to use the global slice.
+ *
+ * @return N/A
+ */
+extern void k_thread_time_slice_set(k_tid_t thread, int32_t slice_ms);
+
+/**
+ * @brief Get the number of time slice expirations of a thread.
+ *
+ * This routine reports how many times @a thread ran until the
+ * scheduler preempted it at the end of its time slice, as opposed to
+ * yielding or blocking on its own. A growing count identifies threads
+ * that monopolize their priority level.
+ *
+ * @param thread ID of thread to query.
+ *
+ * @return Number of expired time slices.
+ */
+extern uint32_t k_thread_time_slice_expired(k_tid_t thread);
+
 /** @} */
 
 /**
@@ -2014,6 +2124,39 @@ static inline void *z_impl_k_timer_user_data_get(struct k_timer *timer)
 	return timer->user_data;
 }
 
+/**
+ * @brief Set the expiry slack of a timer.
+ *
+ * This routine declares that the timer's expiry may be deferred by up
+ * to @a slack ticks if that lets it share a hardware wakeup with
+ * another timeout expiring in that window.  Periodic housekeeping
+ * timers that do not care about exact phase should set a generous
+ * slack so they gang up on one tick instead of each waking the CPU
+ * separately.  A slack of zero (the default) keeps exact expiry.
+ *
+ * Has no effect unless :option:`CONFIG_TIMEOUT_SLACK` is enabled.
+ *
+ * @param timer     Address of timer.
+ * @param slack     Permitted expiry deferral, in ticks.
+ *
+ * @return N/A
+ */
+__syscall void k_timer_slack_set(struct k_timer *timer, k_ticks_t slack);
+
+/**
+ * @internal
+ */
+static inline void z_impl_k_timer_slack_set(struct k_timer *timer,
+					    k_ticks_t slack)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	timer->timeout.slack = (uint32_t)slack;
+#else
+	ARG_UNUSED(timer);
+	ARG_UNUSED(slack);
+#endif
+}
+
 /** @} */
 
 /**
@@ -2180,6 +2323,14 @@ struct k_queue {
 	struct k_spinlock lock;
 	_wait_q_t wait_q;
 
+#ifdef CONFIG_QUEUE_ISR_APPEND
+	/* Lock-free staging stack for k_queue_isr_append(), plus the
+	 * count of consumers pending on an empty queue
+	 */
+	atomic_ptr_t isr_stack;
+	atomic_t isr_waiting;
+#endif
+
 	_POLL_EVENT;
 	_OBJECT_TRACING_NEXT_PTR(k_queue)
 	_OBJECT_TRACING_LINKED_FLAG
@@ -2252,6 +2403,31 @@ __syscall void k_queue_cancel_wait(struct k_queue *queue);
  */
 extern void k_queue_append(struct k_queue *queue, void *data);
 
+/**
+ * @brief Append an element to a queue without taking its lock.
+ *
+ * This routine pushes a data item onto a lock-free staging stack with
+ * a single compare-and-swap, making it cheap enough for hot interrupt
+ * handlers that would otherwise bounce the queue spinlock between
+ * CPUs.  Staged items are folded into the queue, in arrival order,
+ * by the next k_queue_get() call (or here, when a consumer is known
+ * to be waiting).  As with k_queue_append(), the first word of the
+ * item is reserved for the kernel's use and no allocation is
+ * performed.
+ *
+ * @note Items staged by this call are not visible to k_queue_peek_head(),
+ * k_queue_is_empty() or an already-registered k_poll() until a consumer
+ * next drains the queue, so it pairs best with k_queue_get() consumers.
+ *
+ * @note Can be called by ISRs.  Not available from user mode.
+ *
+ * @param queue Address of the queue.
+ * @param data Address of the data item.
+ *
+ * @return N/A
+ */
+extern void k_queue_isr_append(struct k_queue *queue, void *data);
+
 /**
  * @brief Append an element to a queue.
  *
@@ -3054,6 +3230,16 @@ struct k_work_q {
 	struct k_thread thread;
 };
 
+#ifdef CONFIG_WORK_POOL
+struct k_work_pool {
+	/* Shared submission queue; the embedded thread is worker 0 */
+	struct k_work_q work_q;
+	/* Workers 1..num_workers-1 */
+	struct k_thread workers[CONFIG_WORK_POOL_MAX_WORKERS - 1];
+	uint8_t num_workers;
+};
+#endif
+
 enum {
 	K_WORK_STATE_PENDING,	/* Work item pending state */
 };
@@ -3068,6 +3254,9 @@ struct k_delayed_work {
 	struct k_work work;
 	struct _timeout timeout;
 	struct k_work_q *work_q;
+#ifdef CONFIG_WORK_DELAY_COALESCE
+	uint32_t granularity_ticks;
+#endif
 };
 
 struct k_work_poll {
@@ -3229,6 +3418,51 @@ extern void k_work_q_start(struct k_work_q *work_q,
 			   k_thread_stack_t *stack,
 			   size_t stack_size, int prio);
 
+#ifdef CONFIG_WORK_POOL
+/**
+ * @brief Start a work pool.
+ *
+ * This routine starts work pool @a pool: @a num_workers threads all
+ * draining the pool's shared queue, so one slow work handler only
+ * occupies one worker instead of head-of-line blocking every other
+ * pending item.  Work items remain processed one-at-a-time each, but
+ * independent items run concurrently (on SMP, genuinely in parallel).
+ *
+ * @param pool Address of work pool.
+ * @param stacks Pointer to an array of @a num_workers stacks, as defined
+ *		by K_THREAD_STACK_ARRAY_DEFINE()
+ * @param stack_size Size of each worker stack (in bytes), the same
+ *		constant passed to K_THREAD_STACK_ARRAY_DEFINE().
+ * @param prio Priority of the worker threads.
+ * @param num_workers Number of worker threads, at most
+ *		CONFIG_WORK_POOL_MAX_WORKERS.
+ *
+ * @return N/A
+ */
+extern void k_work_pool_start(struct k_work_pool *pool,
+			      k_thread_stack_t *stacks,
+			      size_t stack_size, int prio, int num_workers);
+
+/**
+ * @brief Submit a work item to a work pool.
+ *
+ * Identical to k_work_submit_to_queue() against the pool's shared queue;
+ * whichever worker is free first will run the item.
+ *
+ * @note Can be called by ISRs.
+ *
+ * @param pool Address of work pool.
+ * @param work Address of work item.
+ *
+ * @return N/A
+ */
+static inline void k_work_pool_submit(struct k_work_pool *pool,
+				      struct k_work *work)
+{
+	k_work_submit_to_queue(&pool->work_q, work);
+}
+#endif /* CONFIG_WORK_POOL */
+
 /**
  * @brief Start a workqueue in user mode
  *
@@ -3266,6 +3500,31 @@ extern void k_work_q_user_start(struct k_work_q *work_q,
 extern void k_delayed_work_init(struct k_delayed_work *work,
 				k_work_handler_t handler);
 
+#ifdef CONFIG_WORK_DELAY_COALESCE
+/**
+ * @brief Set the expiration granularity of a delayed work item.
+ *
+ * Deadlines of subsequent submissions of @a work are rounded up to
+ * the next multiple of @a granularity, measured from system boot.
+ * Items sharing a granularity thus expire on shared timer events,
+ * reducing timer interrupts for work with sloppy deadlines.
+ *
+ * A granularity of K_NO_WAIT (the initial value) disables rounding.
+ *
+ * @param work Address of delayed work item.
+ * @param granularity Expiration granularity. Must not be K_FOREVER.
+ */
+static inline void k_delayed_work_granularity_set(struct k_delayed_work *work,
+						  k_timeout_t granularity)
+{
+#ifdef CONFIG_LEGACY_TIMEOUT_API
+	work->granularity_ticks = k_ms_to_ticks_ceil32(granularity);
+#else
+	work->granularity_ticks = granularity.ticks;
+#endif
+}
+#endif /* CONFIG_WORK_DELAY_COALESCE */
+
 /**
  * @brief Submit a delayed work item.
  *
@@ -3545,6 +3804,92 @@ static inline int k_work_poll_submit(struct k_work_poll *work,
  */
 extern int k_work_poll_cancel(struct k_work_poll *work);
 
+/** @} */
+/**
+ * @defgroup softirq_apis Softirq APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+struct k_softirq;
+
+/**
+ * @typedef k_softirq_handler_t
+ * @brief Softirq handler function type.
+ *
+ * Runs on the softirq thread at the highest cooperative priority, so
+ * it preempts all ordinary threads but, unlike an ISR, may be written
+ * without interrupt-context restrictions. It must not block.
+ *
+ * @param softirq Softirq that was raised.
+ */
+typedef void (*k_softirq_handler_t)(struct k_softirq *softirq);
+
+/**
+ * @brief Softirq bottom half.
+ *
+ * Deferred interrupt work with its own priority class: an ISR raises
+ * the softirq and returns immediately, and the handler is drained by
+ * a shared kernel thread running above every ordinary thread. This
+ * gives long-running driver interrupt work predictable latency
+ * without a dedicated thread per driver and without competing with
+ * application work on the system workqueue.
+ */
+struct k_softirq {
+	void *_reserved;	/* Used by k_queue implementation. */
+	k_softirq_handler_t handler;
+	atomic_t pending;
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#define Z_SOFTIRQ_INITIALIZER(softirq_handler) \
+	{ \
+	._reserved = NULL, \
+	.handler = softirq_handler, \
+	.pending = ATOMIC_INIT(0), \
+	}
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Statically define and initialize a softirq.
+ *
+ * @param name Name of the softirq.
+ * @param softirq_handler Function to invoke each time the softirq
+ *        is raised.
+ */
+#define K_SOFTIRQ_DEFINE(name, softirq_handler) \
+	struct k_softirq name = Z_SOFTIRQ_INITIALIZER(softirq_handler)
+
+/**
+ * @brief Initialize a softirq, prior to its first use.
+ *
+ * @param softirq Address of softirq.
+ * @param handler Function to invoke each time the softirq is raised.
+ *
+ * @return N/A
+ */
+extern void k_softirq_init(struct k_softirq *softirq,
+			   k_softirq_handler_t handler);
+
+/**
+ * @brief Raise a softirq.
+ *
+ * Queues the softirq for execution on the softirq thread. Raising a
+ * softirq that is already pending has no effect; a raise while its
+ * handler is running queues one further execution.
+ *
+ * @note Can be called by ISRs.
+ *
+ * @param softirq Address of softirq.
+ *
+ * @return N/A
+ */
+extern void k_softirq_raise(struct k_softirq *softirq);
+
 /** @} */
 /**
  * @defgroup mutex_apis Mutex APIs
@@ -3835,6 +4180,15 @@ struct k_msgq {
 	/** Number of used messages */
 	uint32_t used_msgs;
 
+#ifdef CONFIG_MSGQ_MPSC
+	/** MPSC mode: producer slot reservation counter */
+	atomic_t mpsc_head;
+	/** MPSC mode: consumer position */
+	uint32_t mpsc_tail;
+	/** MPSC mode: consumer is (about to be) sleeping */
+	atomic_t mpsc_waiting;
+#endif
+
 	_OBJECT_TRACING_NEXT_PTR(k_msgq)
 	_OBJECT_TRACING_LINKED_FLAG
 
@@ -3865,6 +4219,7 @@ struct k_msgq {
 
 
 #define K_MSGQ_FLAG_ALLOC	BIT(0)
+#define K_MSGQ_FLAG_MPSC	BIT(1)
 
 /**
  * @brief Message Queue Attributes
@@ -3927,6 +4282,41 @@ struct k_msgq_attrs {
 void k_msgq_init(struct k_msgq *q, char *buffer, size_t msg_size,
 		 uint32_t max_msgs);
 
+#ifdef CONFIG_MSGQ_MPSC
+/** @brief Ring slot size of an MPSC message queue, in bytes. */
+#define K_MSGQ_MPSC_SLOT_SIZE(msg_size) \
+	ROUND_UP(sizeof(atomic_t) + (msg_size), sizeof(atomic_t))
+
+/** @brief Required buffer size for an MPSC message queue, in bytes. */
+#define K_MSGQ_MPSC_BUF_SIZE(msg_size, max_msgs) \
+	((max_msgs) * K_MSGQ_MPSC_SLOT_SIZE(msg_size))
+
+/**
+ * @brief Initialize a lock-free multi-producer/single-consumer message queue.
+ *
+ * This routine initializes a message queue in MPSC mode: any number of
+ * producers (including ISRs on other CPUs) may call k_msgq_put() without
+ * taking the queue lock, and exactly one consumer thread may call
+ * k_msgq_get().  Producers never block; a put on a full queue fails with
+ * -ENOMSG regardless of the timeout.  k_msgq_peek() and k_msgq_purge()
+ * are not supported on MPSC queues.
+ *
+ * Unlike k_msgq_init(), each ring slot carries a sequence word ahead of
+ * the message payload, so @a buffer must be
+ * K_MSGQ_MPSC_BUF_SIZE(msg_size, max_msgs) bytes long and aligned to
+ * sizeof(atomic_t).
+ *
+ * @param q Address of the message queue.
+ * @param buffer Pointer to ring buffer that holds queued messages.
+ * @param msg_size Message size (in bytes).
+ * @param max_msgs Maximum number of messages that can be queued.
+ *
+ * @return N/A
+ */
+void k_msgq_init_mpsc(struct k_msgq *q, char *buffer, size_t msg_size,
+		      uint32_t max_msgs);
+#endif /* CONFIG_MSGQ_MPSC */
+
 /**
  * @brief Initialize a message queue.
  *
@@ -4479,6 +4869,68 @@ __syscall size_t k_pipe_read_avail(struct k_pipe *pipe);
  */
 __syscall size_t k_pipe_write_avail(struct k_pipe *pipe);
 
+/**
+ * @brief Claim a contiguous region of a pipe's buffer for writing.
+ *
+ * This routine hands out a pointer into the pipe's ring buffer so the
+ * caller (or a DMA engine) can produce data in place, skipping the
+ * copy-in that k_pipe_put() performs.  The claim must be completed
+ * with k_pipe_put_finish() once the region has been filled.
+ *
+ * At a buffer wrap point the contiguous region is shorter than the
+ * free space; claim again after finishing to obtain the remainder.
+ *
+ * The pipe must have a single producer, which must not mix an
+ * outstanding claim with other write operations on the same pipe.
+ * This API is not available to user mode threads.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Output: start of the claimed region, or NULL.
+ * @param size Maximum number of bytes to claim.
+ *
+ * @return Number of bytes claimed, possibly zero.
+ */
+size_t k_pipe_put_claim(struct k_pipe *pipe, void **data, size_t size);
+
+/**
+ * @brief Commit bytes written into a region claimed with k_pipe_put_claim().
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes actually produced, at most the claimed size.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @a size exceeds what could have been claimed.
+ */
+int k_pipe_put_finish(struct k_pipe *pipe, size_t size);
+
+/**
+ * @brief Claim a contiguous region of a pipe's buffer for reading.
+ *
+ * The read-side counterpart of k_pipe_put_claim(): the caller consumes
+ * data directly out of the pipe's ring buffer and then releases it
+ * with k_pipe_get_finish(), skipping the copy-out of k_pipe_get().
+ * The pipe must have a single consumer; the same mixing restrictions
+ * as the write side apply.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Output: start of the readable region, or NULL.
+ * @param size Maximum number of bytes to claim.
+ *
+ * @return Number of bytes claimed, possibly zero.
+ */
+size_t k_pipe_get_claim(struct k_pipe *pipe, void **data, size_t size);
+
+/**
+ * @brief Release bytes consumed from a region claimed with k_pipe_get_claim().
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes actually consumed, at most the claimed size.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @a size exceeds what could have been claimed.
+ */
+int k_pipe_get_finish(struct k_pipe *pipe, size_t size);
+
 /** @} */
 
 /**
@@ -4491,7 +4943,19 @@ struct k_mem_slab {
 	size_t block_size;
 	char *buffer;
 	char *free_list;
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	atomic_t num_used;
+	/* Tagged head of the lock-free free list: block index in the
+	 * low half-word, ABA tag in the high half
+	 */
+	atomic_t free_head;
+	/* Number of threads blocked waiting for a free block */
+	atomic_t waiters;
+#else
 	uint32_t num_used;
+#endif
+	/* Highest number of simultaneously allocated blocks seen */
+	uint32_t max_used;
 
 	_OBJECT_TRACING_NEXT_PTR(k_mem_slab)
 	_OBJECT_TRACING_LINKED_FLAG
@@ -4506,6 +4970,7 @@ struct k_mem_slab {
 	.buffer = slab_buffer, \
 	.free_list = NULL, \
 	.num_used = 0, \
+	.max_used = 0, \
 	_OBJECT_TRACING_INIT \
 	}
 
@@ -4635,6 +5100,23 @@ static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 	return slab->num_blocks - slab->num_used;
 }
 
+/**
+ * @brief Get the high watermark of used blocks in a memory slab.
+ *
+ * This routine gets the maximum number of memory blocks that have been
+ * simultaneously allocated in @a slab since it was initialized. The
+ * watermark is maintained unconditionally, so pools can be right-sized
+ * from production builds without instrumentation.
+ *
+ * @param slab Address of the memory slab.
+ *
+ * @return Peak number of allocated memory blocks.
+ */
+static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
+{
+	return slab->max_used;
+}
+
 /** @} */
 
 /**
@@ -4686,6 +5168,19 @@ void *k_heap_alloc(struct k_heap *h, size_t bytes, k_timeout_t timeout);
  */
 void k_heap_free(struct k_heap *h, void *mem);
 
+/**
+ * @brief Snapshot runtime statistics of a k_heap
+ *
+ * Fills @a stats from the underlying sys_heap, holding the heap lock
+ * across the scan.  Available when CONFIG_SYS_HEAP_RUNTIME_STATS is
+ * enabled.
+ *
+ * @param h Heap to query
+ * @param stats Struct to fill with the heap's statistics
+ */
+void k_heap_runtime_stats_get(struct k_heap *h,
+			      struct sys_heap_runtime_stats *stats);
+
 /**
  * @brief Define a static k_heap
  *
@@ -4840,6 +5335,67 @@ extern void k_free(void *ptr);
  */
 extern void *k_calloc(size_t nmemb, size_t size);
 
+/**
+ * @brief Per-class allocation statistics for the k_malloc_rt() pools.
+ */
+struct k_malloc_rt_stats {
+	/** Usable bytes per block in this size class */
+	size_t block_size;
+	/** Total number of blocks in this size class */
+	uint32_t num_blocks;
+	/** Number of blocks currently allocated */
+	uint32_t num_used;
+	/** Peak number of simultaneously allocated blocks */
+	uint32_t max_used;
+};
+
+/**
+ * @brief Allocate memory with a bounded worst-case latency.
+ *
+ * This routine allocates memory from a set of preallocated size-class
+ * pools rather than from the heap memory pool, so its worst-case
+ * execution time is constant and independent of heap fragmentation.
+ * It is suitable for use in time-critical threads and ISRs, and never
+ * blocks. When the best-fitting size class is exhausted the allocation
+ * spills into the next larger class.
+ *
+ * Memory allocated with this routine must be released with k_free_rt().
+ *
+ * @param size Amount of memory requested (in bytes). Requests larger
+ *        than the biggest configured size class fail.
+ *
+ * @return Address of the allocated memory if successful; otherwise NULL.
+ */
+extern void *k_malloc_rt(size_t size);
+
+/**
+ * @brief Free memory allocated with k_malloc_rt().
+ *
+ * This routine returns a block to its size-class pool in constant time.
+ *
+ * If @a ptr is NULL, no operation is performed.
+ *
+ * @param ptr Pointer to previously allocated memory.
+ *
+ * @return N/A
+ */
+extern void k_free_rt(void *ptr);
+
+/**
+ * @brief Get occupancy statistics for one k_malloc_rt() size class.
+ *
+ * Size classes are indexed from 0 in order of increasing block size;
+ * iterating until this routine fails enumerates all of them.
+ *
+ * @param class_idx Index of the size class.
+ * @param stats Where to store the statistics.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @a class_idx is not a valid size class index
+ */
+extern int k_malloc_rt_stats_get(unsigned int class_idx,
+				 struct k_malloc_rt_stats *stats);
+
 /** @} */
 
 /* polling API - PRIVATE */
@@ -5077,6 +5633,80 @@ extern void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 __syscall int k_poll(struct k_poll_event *events, int num_events,
 		     k_timeout_t timeout);
 
+/**
+ * @brief Persistent poll registration set
+ *
+ * Unlike k_poll(), which registers with and unregisters from every
+ * polled object on every call, a poll set registers its events once
+ * and then only pays for the events that actually trigger.
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	struct _poller poller;
+	/** PRIVATE - list of triggered events awaiting collection */
+	sys_dlist_t ready;
+	/** PRIVATE - thread waiting in k_poll_set_wait(), if any */
+	_wait_q_t wait_q;
+	/** the registered event array, owned by the user */
+	struct k_poll_event *events;
+	/** number of registered events */
+	int num_events;
+};
+
+/**
+ * @brief Register an event array with a poll set.
+ *
+ * This routine registers every event in @a events with its polled
+ * object, once.  The events stay registered until
+ * k_poll_set_unregister(); triggered events are collected with
+ * k_poll_set_wait().  The event array must remain valid and must not
+ * be passed to k_poll() while registered.
+ *
+ * Events are delivered level-triggered: an event is (re)reported as
+ * long as its condition holds when k_poll_set_wait() collects it.
+ *
+ * @param pset The poll set to initialize and register with.
+ * @param events An array of events to register.
+ * @param num_events The number of events in the array.
+ *
+ * @retval 0 on success.
+ */
+int k_poll_set_register(struct k_poll_set *pset, struct k_poll_event *events,
+			int num_events);
+
+/**
+ * @brief Collect triggered events from a poll set.
+ *
+ * This routine waits until at least one registered event has
+ * triggered, then stores up to @a max_events triggered events into
+ * @a ready_events.  Only triggered events are visited; the cost per
+ * wakeup is proportional to the number of ready events, not to the
+ * number registered.
+ *
+ * @param pset The poll set to wait on.
+ * @param ready_events Output array of triggered events.
+ * @param max_events Capacity of @a ready_events.
+ * @param timeout Waiting period for an event to trigger,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval n The number of events stored into @a ready_events (> 0).
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_poll_set_wait(struct k_poll_set *pset,
+		    struct k_poll_event **ready_events, int max_events,
+		    k_timeout_t timeout);
+
+/**
+ * @brief Unregister all of a poll set's events.
+ *
+ * After this routine returns, the event array may be reused freely.
+ *
+ * @param pset The poll set to unregister.
+ *
+ * @return N/A
+ */
+void k_poll_set_unregister(struct k_poll_set *pset);
+
 /**
  * @brief Initialize a poll signal object.
  *
@@ -5322,6 +5952,12 @@ struct k_mem_domain {
 	sys_dlist_t mem_domain_q;
 	/** number of partitions in the domain */
 	uint8_t num_partitions;
+#ifdef CONFIG_ARCH_MEM_DOMAIN_DATA
+	/** architecture-specific domain data, e.g. a cached protection
+	 * hardware register image
+	 */
+	struct arch_mem_domain arch;
+#endif
 };
 
 
@@ -99,6 +99,24 @@ struct _ready_q {
 
 typedef struct _ready_q _ready_q_t;
 
+/**
+ * @brief Cache-line isolation for objects hot on multiple CPUs
+ *
+ * K_OBJ_CACHE_ALIGNED is an attribute that aligns an object, struct
+ * member or type to K_OBJ_CACHE_LINE_SIZE and, applied to a type,
+ * pads it out to a line multiple. Use it on spinlock-containing
+ * objects that different CPUs pound on concurrently, so that they
+ * never false-share a cache line with their neighbours. Both expand
+ * to nothing unless CONFIG_KERNEL_CACHE_ALIGN is enabled.
+ */
+#ifdef CONFIG_KERNEL_CACHE_ALIGN
+#define K_OBJ_CACHE_LINE_SIZE CONFIG_KERNEL_CACHE_LINE_SIZE
+#define K_OBJ_CACHE_ALIGNED __aligned(CONFIG_KERNEL_CACHE_LINE_SIZE)
+#else
+#define K_OBJ_CACHE_LINE_SIZE 0
+#define K_OBJ_CACHE_ALIGNED
+#endif
+
 struct _cpu {
 	/* nested interrupt count */
 	uint32_t nested;
@@ -128,7 +146,23 @@ struct _cpu {
 	/* True when _current is allowed to context switch */
 	uint8_t swap_ok;
 #endif
-};
+
+#ifdef CONFIG_SCHED_IPI_OPTIMIZE
+	/* Priority of the thread this CPU is running, used to decide
+	 * whether a wakeup needs to interrupt it at all
+	 */
+	int8_t curr_prio;
+#endif
+
+#ifdef CONFIG_SCHED_CPU_QUEUES
+	/* Ready queue for threads homed to this CPU.  Threads queue on
+	 * the CPU they last ran on; CPUs whose queue runs dry steal
+	 * from their peers.
+	 */
+	struct _ready_q ready_q;
+#endif
+/* Padded and aligned so no two CPUs' state shares a cache line */
+} K_OBJ_CACHE_ALIGNED;
 
 typedef struct _cpu _cpu_t;
 
@@ -146,9 +180,11 @@ struct z_kernel {
 
 	/*
 	 * ready queue: can be big, keep after small fields, since some
-	 * assembly (e.g. ARC) are limited in the encoding of the offset
+	 * assembly (e.g. ARC) are limited in the encoding of the offset.
+	 * Isolated from the per-CPU data above, which is written from
+	 * every CPU on every context switch.
 	 */
-	struct _ready_q ready_q;
+	struct _ready_q ready_q K_OBJ_CACHE_ALIGNED;
 
 #ifdef CONFIG_FPU_SHARING
 	/*
@@ -227,6 +263,12 @@ struct _timeout {
 #else
 	uint32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_SLACK
+	/* Ticks the expiry may be deferred to share a wakeup with a
+	 * neighboring timeout
+	 */
+	uint32_t slack;
+#endif
 };
 
 /* kernel spinlock type */
@@ -243,6 +285,13 @@ struct k_spinlock {
 	uintptr_t thread_cpu;
 #endif
 
+#ifdef CONFIG_SPIN_LOCK_PROFILE
+	/* Cycle counter stamp taken when the lock was acquired, used
+	 * to compute the hold time at release.
+	 */
+	uint32_t profile_stamp;
+#endif
+
 #if defined(CONFIG_CPLUSPLUS) && !defined(CONFIG_SMP) && \
 	!defined(CONFIG_SPIN_VALIDATE)
 	/* If CONFIG_SMP and CONFIG_SPIN_VALIDATE are both not defined
@@ -264,10 +313,27 @@ struct k_spinlock {
 
 /* kernel synchronized heap struct */
 
+#ifdef CONFIG_KHEAP_MAGAZINE
+/* Small per-CPU cache of freed blocks, filed by power-of-two size
+ * class from 16 to 256 bytes.  Each CPU's magazine has its own lock,
+ * which is uncontended except when a peer drains it.
+ */
+#define K_HEAP_MAG_CLASSES 5
+
+struct k_heap_magazine {
+	struct k_spinlock lock;
+	uint8_t count[K_HEAP_MAG_CLASSES];
+	void *rounds[K_HEAP_MAG_CLASSES][CONFIG_KHEAP_MAGAZINE_DEPTH];
+};
+#endif
+
 struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_KHEAP_MAGAZINE
+	struct k_heap_magazine magazine[CONFIG_MP_NUM_CPUS];
+#endif
 };
 
 #endif /* _ASMLANGUAGE */
@@ -50,6 +50,13 @@ extern "C" {
  */
 #define LOG_OUTPUT_FLAG_FORMAT_SYST		BIT(7)
 
+/** @brief Flag forcing dictionary-based binary output.
+ *
+ * Messages are emitted as format string addresses and raw arguments;
+ * the host decodes them against the ELF file.
+ */
+#define LOG_OUTPUT_FLAG_FORMAT_DICT		BIT(8)
+
 /**
  * @brief Prototype of the function processing output data.
  *
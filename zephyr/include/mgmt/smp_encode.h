@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_MGMT_SMP_ENCODE_H_
+#define ZEPHYR_INCLUDE_MGMT_SMP_ENCODE_H_
+
+#include <zephyr/types.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct net_buf;
+
+/**
+ * @brief Flat CBOR encoder for fixed-shape mcumgr responses.
+ *
+ * Response maps with a known shape (echo, taskstat, img list) do not
+ * need tinycbor's generic streaming encoder, whose per-primitive
+ * function-pointer writer dominates encode time for small payloads.
+ * This encoder fills the tailroom of a response net_buf directly:
+ * each primitive is a straight-line memory fill against a sticky
+ * overflow flag, and bounds are resolved exactly once, when
+ * smp_enc_commit() either extends the buffer or reports -ENOMEM.
+ *
+ * Output is canonical CBOR (shortest-form integer heads), so streams
+ * produced here are byte-identical to tinycbor's for the same data.
+ */
+struct smp_enc {
+	uint8_t *buf;
+	size_t size;
+	size_t len;
+	bool oom;
+};
+
+/**
+ * @brief Initializes an encoder over the tailroom of a net_buf.
+ *
+ * The net_buf is not modified until @ref smp_enc_commit.
+ *
+ * @param enc The encoder to initialize.
+ * @param nb  The response buffer to encode into.
+ */
+void smp_enc_init(struct smp_enc *enc, struct net_buf *nb);
+
+/**
+ * @brief Appends encoded data to the net_buf passed at init time.
+ *
+ * @return 0 on success; -ENOMEM if the encoded data overran the
+ *         buffer's tailroom (in which case the net_buf is unchanged).
+ */
+int smp_enc_commit(struct smp_enc *enc, struct net_buf *nb);
+
+/** @brief Begins a map of @a pairs key/value pairs. */
+void smp_enc_map(struct smp_enc *enc, size_t pairs);
+
+/** @brief Begins an indefinite-length map (close with smp_enc_end()). */
+void smp_enc_map_indef(struct smp_enc *enc);
+
+/** @brief Begins an array of @a items elements. */
+void smp_enc_array(struct smp_enc *enc, size_t items);
+
+/** @brief Terminates an indefinite-length map or array. */
+void smp_enc_end(struct smp_enc *enc);
+
+/** @brief Appends an unsigned integer. */
+void smp_enc_uint(struct smp_enc *enc, uint64_t value);
+
+/** @brief Appends a signed integer. */
+void smp_enc_int(struct smp_enc *enc, int64_t value);
+
+/** @brief Appends a boolean. */
+void smp_enc_bool(struct smp_enc *enc, bool value);
+
+/** @brief Appends a text string of known length. */
+void smp_enc_text(struct smp_enc *enc, const char *str, size_t len);
+
+/** @brief Appends a NUL-terminated text string (typically a map key). */
+void smp_enc_str(struct smp_enc *enc, const char *str);
+
+/** @brief Appends a byte string. */
+void smp_enc_bytes(struct smp_enc *enc, const void *data, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_MGMT_SMP_ENCODE_H_ */
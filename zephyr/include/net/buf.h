@@ -1022,6 +1022,24 @@ extern const struct net_buf_data_cb net_buf_var_cb;
  */
 struct net_buf_pool *net_buf_pool_get(int id);
 
+/**
+ * @brief Get the high watermark of buffers in use in a pool.
+ *
+ * Buffers are drawn from the pool's uninitialized backing array only
+ * when the free list is empty, so the number of buffers ever
+ * initialized equals the peak number simultaneously in use. The
+ * watermark is therefore available unconditionally and at no run-time
+ * cost, for right-sizing pools from production builds.
+ *
+ * @param pool Which pool to query.
+ *
+ * @return Peak number of buffers simultaneously allocated from the pool.
+ */
+static inline uint16_t net_buf_pool_peak_used_get(struct net_buf_pool *pool)
+{
+	return pool->buf_count - pool->uninit_count;
+}
+
 /**
  * @brief Get a zero-based index for a buffer.
  *
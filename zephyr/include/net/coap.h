@@ -238,6 +238,7 @@ typedef int (*coap_reply_t)(const struct coap_packet *response,
  */
 struct coap_pending {
 	struct sockaddr addr;
+	sys_snode_t node;
 	uint32_t t0;
 	uint32_t timeout;
 	uint16_t id;
@@ -606,6 +607,26 @@ int coap_update_from_block(const struct coap_packet *cpkt,
 size_t coap_next_block(const struct coap_packet *cpkt,
 		       struct coap_block_context *ctx);
 
+/**
+ * @brief Append a BLOCK2 option requesting the block at the given
+ * payload offset.
+ *
+ * @details Unlike coap_append_block2_option(), which always requests
+ * the block at ctx->current, this allows a client to keep several
+ * block requests in flight (NSTART > 1) by issuing requests ahead of
+ * the confirmed position. The block size is taken from the context;
+ * the offset must be a multiple of it.
+ *
+ * @param cpkt Packet to be updated, must be a request
+ * @param ctx Block context from which block size will be taken
+ * @param offset Payload offset of the requested block, in bytes
+ *
+ * @return 0 in case of success or negative in case of error.
+ */
+int coap_append_block2_option_at(struct coap_packet *cpkt,
+				 const struct coap_block_context *ctx,
+				 size_t offset);
+
 /**
  * @brief Indicates that the remote device referenced by @a addr, with
  * @a request, wants to observe a resource.
@@ -719,6 +740,46 @@ struct coap_pending *coap_pending_next_unused(
 struct coap_reply *coap_reply_next_unused(
 	struct coap_reply *replies, size_t len);
 
+/**
+ * @brief Insert a pending request into an expiry ordered queue.
+ *
+ * @details Keeping the pending requests in a queue sorted by their
+ * next retransmission time makes finding the next one to expire a
+ * constant time peek of the queue head, instead of a scan over the
+ * whole array as done by coap_pending_next_to_expire(). Call this
+ * after coap_pending_init() and again after every
+ * coap_pending_cycle(). If the pending request is already queued it
+ * is moved to its new position.
+ *
+ * @param queue Queue of pending requests, initialized with
+ * sys_slist_init()
+ * @param pending Pending request to schedule
+ */
+void coap_pending_schedule(sys_slist_t *queue, struct coap_pending *pending);
+
+/**
+ * @brief Remove a pending request from the expiry queue.
+ *
+ * Call before coap_pending_clear() when the request was queued with
+ * coap_pending_schedule().
+ *
+ * @param queue Queue of pending requests
+ * @param pending Pending request to remove
+ */
+void coap_pending_unschedule(sys_slist_t *queue,
+			     struct coap_pending *pending);
+
+/**
+ * @brief Returns the pending request closest to its retransmission
+ * time, without removing it from the queue.
+ *
+ * @param queue Queue of pending requests
+ *
+ * @return pointer to the next expiring #coap_pending structure, NULL
+ * if the queue is empty.
+ */
+struct coap_pending *coap_pending_next_scheduled(sys_slist_t *queue);
+
 /**
  * @brief After a response is received, returns if there is any
  * matching pending request exits. User has to clear all pending
@@ -265,8 +265,38 @@ struct http_request {
 	 * headers will be placed into this field.
 	 */
 	const char **optional_headers;
+
+#if defined(CONFIG_HTTP_CLIENT_CONNECTION_POOL)
+	/** IP protocol for pooled connections, for example IPPROTO_TLS_1_2.
+	 * Leave as 0 for plain TCP. Only used by http_client_pool_req().
+	 */
+	int proto;
+
+	/** Optional callback to configure a newly created pooled socket
+	 * before it is connected. Only used by http_client_pool_req().
+	 */
+	int (*setup_cb)(int sock, struct http_request *req, void *user_data);
+#endif /* CONFIG_HTTP_CLIENT_CONNECTION_POOL */
 };
 
+#if defined(CONFIG_HTTP_CLIENT_CONNECTION_POOL)
+/**
+ * @typedef http_socket_setup_cb_t
+ * @brief Callback used to configure a newly created pooled socket before
+ * it is connected, for example to set TLS secure tags or the hostname.
+ *
+ * @param sock Socket id of the new connection
+ * @param req HTTP request information
+ * @param user_data User specified data specified in http_client_pool_req()
+ *
+ * @return 0 if the socket is ready to connect, <0 otherwise in which case
+ *         the socket is closed and the error returned to the caller.
+ */
+typedef int (*http_socket_setup_cb_t)(int sock,
+				      struct http_request *req,
+				      void *user_data);
+#endif /* CONFIG_HTTP_CLIENT_CONNECTION_POOL */
+
 /**
  * @brief Do a HTTP request. The callback is called when data is received
  * from the HTTP server. The caller must have created a connection to the
@@ -285,6 +315,33 @@ struct http_request {
 int http_client_req(int sock, struct http_request *req,
 		    int32_t timeout, void *user_data);
 
+#if defined(CONFIG_HTTP_CLIENT_CONNECTION_POOL)
+/**
+ * @brief Do a HTTP request over a pooled connection. An established
+ * connection to the host and port of the request is reused if one exists
+ * in the pool, otherwise a new connection is created, and kept open after
+ * the request if the server allows it. A reused connection that turns out
+ * to be stale is reconnected and the request retried once.
+ *
+ * @param req HTTP request information. The host and port fields must be
+ *        set as they form the pool key. The proto and setup_cb fields
+ *        control how new connections are created.
+ * @param timeout Max timeout to wait for the data. The timeout value cannot
+ *        be 0 as there would be no time to receive the data.
+ *        The timeout value is in milliseconds.
+ * @param user_data User specified data that is passed to the callback.
+ *
+ * @return <0 if error, >=0 amount of data sent to the server
+ */
+int http_client_pool_req(struct http_request *req, int32_t timeout,
+			 void *user_data);
+
+/**
+ * @brief Close all idle pooled HTTP client connections.
+ */
+void http_client_pool_purge(void);
+#endif /* CONFIG_HTTP_CLIENT_CONNECTION_POOL */
+
 #ifdef __cplusplus
 }
 #endif
@@ -591,6 +591,49 @@ int mqtt_connect(struct mqtt_client *client);
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param);
 
+/**
+ * @brief Callback supplying publish payload data in chunks.
+ *
+ * Called repeatedly by @ref mqtt_publish_stream until the payload
+ * length declared in the publish parameters has been produced.
+ *
+ * @param[in] client Client instance the payload is produced for.
+ * @param[out] buf Buffer to fill with payload data.
+ * @param[in] buf_len Size of the buffer.
+ * @param[in] offset Payload offset the chunk starts at.
+ * @param[in] user_data User data given to @ref mqtt_publish_stream.
+ *
+ * @return Number of bytes written to buf (> 0), or a negative error
+ *         code to abort the publish.
+ */
+typedef int (*mqtt_payload_stream_cb_t)(struct mqtt_client *client,
+					uint8_t *buf, size_t buf_len,
+					size_t offset, void *user_data);
+
+/**
+ * @brief API to publish a message whose payload is produced in chunks.
+ *
+ * Behaves like @ref mqtt_publish but instead of taking the complete
+ * payload as a contiguous buffer, the payload bytes are pulled through
+ * the given callback and sent in pieces of at most the transmit buffer
+ * size. This allows publishing multi-kilobyte payloads straight from
+ * flash or a sensor FIFO without staging them in RAM. The payload
+ * length must be set in param->message.payload.len and
+ * param->message.payload.data is ignored.
+ *
+ * @param[in] client Client instance for which the procedure is
+ *                   requested. Shall not be NULL.
+ * @param[in] param Parameters to be used for the publish message.
+ *                  Shall not be NULL.
+ * @param[in] cb Callback producing the payload. Shall not be NULL.
+ * @param[in] user_data Passed as-is to the callback.
+ *
+ * @return 0 or a negative error code (errno.h) indicating reason of failure.
+ */
+int mqtt_publish_stream(struct mqtt_client *client,
+			const struct mqtt_publish_param *param,
+			mqtt_payload_stream_cb_t cb, void *user_data);
+
 /**
  * @brief API used by client to send acknowledgment on receiving QoS1 publish
  *        message. Should be called on reception of @ref MQTT_EVT_PUBLISH with
@@ -188,6 +188,8 @@ struct net_tcp;
 
 struct net_conn_handle;
 
+struct net_socket_filter;
+
 struct tls_context;
 
 /**
@@ -292,6 +294,23 @@ __net_socket struct net_context {
 	int can_filter_id;
 #endif /* CONFIG_NET_SOCKETS_CAN */
 
+#if defined(CONFIG_NET_SOCKETS_PACKET_FILTER)
+	/** Classic BPF filter program attached with SO_ATTACH_FILTER */
+	struct net_socket_filter *pkt_filter;
+#endif /* CONFIG_NET_SOCKETS_PACKET_FILTER */
+
+#if defined(CONFIG_NET_CONTEXT_UDP_HDR_TEMPLATE)
+	/** Precomputed IPv4 + UDP header for the connected peer.
+	 *  Filled when the context is connected and copied verbatim
+	 *  to each outgoing packet; the length and checksum fields
+	 *  are patched during packet finalization as usual.
+	 */
+	struct {
+		uint8_t hdr[NET_IPV4UDPH_LEN];
+		bool valid;
+	} udp_tmpl;
+#endif /* CONFIG_NET_CONTEXT_UDP_HDR_TEMPLATE */
+
 	/** Option values */
 	struct {
 #if defined(CONFIG_NET_CONTEXT_PRIORITY)
@@ -309,6 +328,22 @@ __net_socket struct net_context {
 			struct sockaddr addr;
 			socklen_t addrlen;
 		} proxy;
+#endif
+#if defined(CONFIG_NET_TCP2_AUTOCORK)
+		/** Send TCP segments immediately, do not coalesce */
+		bool tcp_nodelay;
+		/** Hold back partial TCP segments until uncorked */
+		bool tcp_cork;
+#endif
+#if defined(CONFIG_NET_TCP2_CONG_CTRL)
+		/** Congestion control algorithm index plus one;
+		 *  0 selects the build-time default
+		 */
+		uint8_t tcp_cong;
+		/** TCP pacing rate in bytes per second, 0 disables
+		 *  pacing
+		 */
+		uint32_t tcp_pacing_rate;
 #endif
 	} options;
 
@@ -1049,6 +1084,10 @@ enum net_context_option {
 	NET_OPT_TIMESTAMP	= 2,
 	NET_OPT_TXTIME		= 3,
 	NET_OPT_SOCKS5		= 4,
+	NET_OPT_NODELAY		= 5,
+	NET_OPT_CORK		= 6,
+	NET_OPT_TCP_CONG	= 7,
+	NET_OPT_PACING_RATE	= 8,
 };
 
 /**
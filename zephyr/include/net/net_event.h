@@ -159,6 +159,8 @@ enum net_event_l4_cmd {
 	NET_EVENT_L4_CMD_DISCONNECTED,
 	NET_EVENT_L4_CMD_DNS_SERVER_ADD,
 	NET_EVENT_L4_CMD_DNS_SERVER_DEL,
+	NET_EVENT_L4_CMD_MEM_PRESSURE,
+	NET_EVENT_L4_CMD_MEM_ALLOC_FAIL,
 };
 
 #define NET_EVENT_L4_CONNECTED				\
@@ -173,6 +175,12 @@ enum net_event_l4_cmd {
 #define NET_EVENT_DNS_SERVER_DEL			\
 	(_NET_EVENT_L4_BASE | NET_EVENT_L4_CMD_DNS_SERVER_DEL)
 
+#define NET_EVENT_MEM_PRESSURE				\
+	(_NET_EVENT_L4_BASE | NET_EVENT_L4_CMD_MEM_PRESSURE)
+
+#define NET_EVENT_MEM_ALLOC_FAIL			\
+	(_NET_EVENT_L4_BASE | NET_EVENT_L4_CMD_MEM_ALLOC_FAIL)
+
 /** @endcond */
 
 #ifdef CONFIG_NET_MGMT_EVENT_INFO
@@ -2071,6 +2071,82 @@ void net_if_call_timestamp_cb(struct net_pkt *pkt);
 void net_if_add_tx_timestamp(struct net_pkt *pkt);
 #endif /* CONFIG_NET_PKT_TIMESTAMP */
 
+#if defined(CONFIG_NET_IF_RX_POLL)
+/**
+ * @typedef net_if_rx_poll_t
+ * @brief Define callback that processes received frames from the
+ *        driver's RX ring while interrupts are masked.
+ * @param "struct net_if *iface" Interface being polled.
+ * @param "int budget" Maximum number of frames to process.
+ *
+ * @return Number of frames processed. A value smaller than @p budget
+ *         tells the stack the ring is drained and the RX interrupt can
+ *         be re-armed.
+ */
+typedef int (*net_if_rx_poll_t)(struct net_if *iface, int budget);
+
+/**
+ * @typedef net_if_rx_irq_t
+ * @brief Define callback that masks or unmasks the driver's RX
+ *        interrupt.
+ * @param "struct net_if *iface" Interface whose interrupt to control.
+ * @param "bool enable" True to unmask the interrupt, false to mask it.
+ */
+typedef void (*net_if_rx_irq_t)(struct net_if *iface, bool enable);
+
+/**
+ * @brief RX polling state for one interface.
+ *
+ * Drivers adopting interrupt-deferred RX embed this in their context
+ * and call net_if_rx_poll_schedule() from the RX interrupt handler
+ * instead of processing frames there. The variable must be valid for
+ * the lifetime of the interface.
+ */
+struct net_if_rx_poll {
+	/** Used internally to queue the poll request */
+	void *fifo_reserved;
+
+	/** Interface being polled */
+	struct net_if *iface;
+
+	/** Frame processing callback */
+	net_if_rx_poll_t poll;
+
+	/** RX interrupt mask/unmask callback */
+	net_if_rx_irq_t rx_irq;
+
+	/** Whether polling is currently scheduled */
+	atomic_t scheduled;
+};
+
+/**
+ * @brief Initialize RX polling state, prior to its first scheduling.
+ *
+ * @param ctx RX polling state to initialize.
+ * @param iface Interface the state belongs to.
+ * @param poll Frame processing callback.
+ * @param rx_irq RX interrupt mask/unmask callback. If the interrupt is
+ *        edge triggered, the callback must check the ring when
+ *        re-enabling and latch a new interrupt for frames that arrived
+ *        while masked, or they stall until the next frame.
+ */
+void net_if_rx_poll_init(struct net_if_rx_poll *ctx, struct net_if *iface,
+			 net_if_rx_poll_t poll, net_if_rx_irq_t rx_irq);
+
+/**
+ * @brief Switch an interface from interrupt-driven to polled RX.
+ *
+ * Called from the driver's RX interrupt handler on the first received
+ * frame. Masks the RX interrupt through the driver callback and hands
+ * the interface to the RX poll thread, which calls the poll callback
+ * in budget-sized batches until the ring is drained and then unmasks
+ * the interrupt. Scheduling an already scheduled interface is a no-op.
+ *
+ * @param ctx RX polling state of the interface.
+ */
+void net_if_rx_poll_schedule(struct net_if_rx_poll *ctx);
+#endif /* CONFIG_NET_IF_RX_POLL */
+
 /**
  * @brief Set network interface into promiscuous mode
  *
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/** @file
+ * @brief Network buffer pool usage telemetry
+ */
+
+#ifndef ZEPHYR_INCLUDE_NET_NET_MEM_MONITOR_H_
+#define ZEPHYR_INCLUDE_NET_NET_MEM_MONITOR_H_
+
+#include <kernel.h>
+#include <net/buf.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Network memory monitoring library
+ * @defgroup net_mem_monitor Network Memory Monitor Library
+ * @ingroup networking
+ * @{
+ */
+
+/** Current occupancy of the packet slabs and data buffer pools */
+struct net_mem_usage {
+	/** Total/used RX packet slab blocks */
+	uint32_t rx_pkt_total;
+	uint32_t rx_pkt_used;
+	/** Total/used TX packet slab blocks */
+	uint32_t tx_pkt_total;
+	uint32_t tx_pkt_used;
+	/** Total/used RX data buffers */
+	uint32_t rx_data_total;
+	uint32_t rx_data_used;
+	/** Total/used TX data buffers */
+	uint32_t tx_data_total;
+	uint32_t tx_data_used;
+};
+
+#if defined(CONFIG_NET_MEM_MONITOR)
+
+/**
+ * @brief Get a snapshot of the current network buffer occupancy
+ *
+ * Pull counterpart of the NET_EVENT_MEM_PRESSURE event, intended for
+ * periodic fleet monitoring.
+ *
+ * @param usage Output buffer for the occupancy figures
+ */
+void net_mem_usage_get(struct net_mem_usage *usage);
+
+/* Allocation-path hooks, called by net_pkt.c. Not application API. */
+void net_mem_monitor_slab_check(struct k_mem_slab *slab);
+void net_mem_monitor_pool_check(struct net_buf_pool *pool);
+void net_mem_monitor_alloc_failed(void);
+
+#else /* CONFIG_NET_MEM_MONITOR */
+
+static inline void net_mem_usage_get(struct net_mem_usage *usage)
+{
+	ARG_UNUSED(usage);
+}
+
+static inline void net_mem_monitor_slab_check(struct k_mem_slab *slab)
+{
+	ARG_UNUSED(slab);
+}
+
+static inline void net_mem_monitor_pool_check(struct net_buf_pool *pool)
+{
+	ARG_UNUSED(pool);
+}
+
+static inline void net_mem_monitor_alloc_failed(void)
+{
+}
+
+#endif /* CONFIG_NET_MEM_MONITOR */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_NET_NET_MEM_MONITOR_H_ */
@@ -230,6 +230,18 @@ static inline void net_mgmt_event_notify(uint32_t mgmt_event, struct net_if *ifa
 #define net_mgmt_event_notify_with_info(...)
 #endif
 
+/**
+ * @brief Get the number of events of a given layer that were dropped
+ *        because the event queue overflowed.
+ * @param layer The management event layer, for instance NET_MGMT_LAYER_L2.
+ * @return Number of dropped events for that layer since boot.
+ */
+#ifdef CONFIG_NET_MGMT_EVENT
+uint32_t net_mgmt_event_dropped(uint8_t layer);
+#else
+#define net_mgmt_event_dropped(...) 0U
+#endif
+
 /**
  * @brief Used to wait synchronously on an event mask
  * @param mgmt_event_mask A mask of relevant events to wait on.
@@ -1504,6 +1504,43 @@ struct net_pkt *net_pkt_rx_alloc_with_buffer(struct net_if *iface,
  */
 void net_pkt_append_buffer(struct net_pkt *pkt, struct net_buf *buffer);
 
+#if defined(CONFIG_NET_BUF_FIXED_DATA_SIZE)
+/**
+ * @brief Loan a data buffer from the RX pool for driver DMA use
+ *
+ * @details Returns a single, unchained buffer of CONFIG_NET_BUF_DATA_SIZE
+ *          bytes. A driver that manages its own RX DMA descriptor ring can
+ *          post the buffer data pointer directly into a descriptor and,
+ *          once the hardware has filled it, hand the buffer chain to the
+ *          stack with net_pkt_rx_claim_loaned() without copying the frame.
+ *          Loaned buffers that are not handed to the stack must be released
+ *          with net_buf_unref().
+ *
+ * @param timeout Maximum time to wait for an allocation.
+ *
+ * @return a pointer to an allocated net_buf on success, NULL otherwise.
+ */
+struct net_buf *net_pkt_rx_data_loan(k_timeout_t timeout);
+
+/**
+ * @brief Wrap loaned, hardware-filled buffers into an RX packet
+ *
+ * @details The buffer chain must have its lengths set (net_buf_add()) to
+ *          the amount of data the hardware wrote into each buffer. On
+ *          success the packet takes ownership of the chain; on failure the
+ *          chain is untouched and stays owned by the caller.
+ *
+ * @param iface   The network interface the frame was received on.
+ * @param buffer  Chain of loaned buffers holding the frame.
+ * @param timeout Maximum time to wait for an allocation.
+ *
+ * @return a pointer to a newly allocated net_pkt on success, NULL otherwise.
+ */
+struct net_pkt *net_pkt_rx_claim_loaned(struct net_if *iface,
+					struct net_buf *buffer,
+					k_timeout_t timeout);
+#endif /* CONFIG_NET_BUF_FIXED_DATA_SIZE */
+
 /**
  * @brief Get available buffer space from a pkt
  *
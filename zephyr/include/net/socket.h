@@ -385,6 +385,161 @@ static inline ssize_t zsock_recv(int sock, void *buf, size_t max_len,
 	return zsock_recvfrom(sock, buf, max_len, flags, NULL, NULL);
 }
 
+/** Message header for zsock_sendmmsg() and zsock_recvmmsg() */
+struct zsock_mmsghdr {
+	/** Message header for this datagram */
+	struct msghdr msg_hdr;
+	/** Number of bytes sent or received for this datagram */
+	unsigned int msg_len;
+};
+
+/**
+ * @brief Send multiple datagrams in one call
+ *
+ * @details
+ * @rst
+ * See `Linux sendmmsg
+ * <http://man7.org/linux/man-pages/man2/sendmmsg.2.html>`__
+ * for normative description.
+ * Sends up to ``vlen`` datagrams described by ``msgs``, filling in each
+ * ``msg_len`` field, and returns the number of datagrams sent. This
+ * function is also exposed as ``sendmmsg()``
+ * if :option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ * @endrst
+ */
+__syscall int zsock_sendmmsg(int sock, struct zsock_mmsghdr *msgs,
+			     unsigned int vlen, int flags);
+
+/**
+ * @brief Receive multiple datagrams in one call
+ *
+ * @details
+ * @rst
+ * See `Linux recvmmsg
+ * <http://man7.org/linux/man-pages/man2/recvmmsg.2.html>`__
+ * for normative description (the timeout argument is not supported).
+ * Receives up to ``vlen`` datagrams into the buffers described by
+ * ``msgs``, filling in each ``msg_len`` field, and returns the number of
+ * datagrams received. Only the first datagram may block; the rest of the
+ * burst is drained without waiting. Each datagram is stored into the
+ * first ``msg_iov`` entry of its message header. This function is also
+ * exposed as ``recvmmsg()``
+ * if :option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ * @endrst
+ */
+__syscall int zsock_recvmmsg(int sock, struct zsock_mmsghdr *msgs,
+			     unsigned int vlen, int flags);
+
+#if defined(CONFIG_NET_SOCKETS_STATIC_HOSTS)
+
+/** Entry in the compile time hosts table. Use
+ *  ZSOCK_STATIC_HOST_REGISTER() to define entries.
+ */
+struct zsock_static_host {
+	/** Hostname to match */
+	const char *name;
+	/** IPv4 or IPv6 address literal */
+	const char *address;
+};
+
+/**
+ * @brief Register a static hostname to address mapping
+ *
+ * @details The getaddrinfo() call consults the registered entries
+ * before contacting a DNS server, similar to an /etc/hosts file. The
+ * same hostname may be registered multiple times, for example with
+ * one IPv4 and one IPv6 address.
+ *
+ * @param reg_name Unique identifier for the registration.
+ * @param hostname Hostname string to match.
+ * @param addr IPv4 or IPv6 address literal string.
+ */
+#define ZSOCK_STATIC_HOST_REGISTER(reg_name, hostname, addr)		static const Z_STRUCT_SECTION_ITERABLE(zsock_static_host, 					       reg_name) = {			.name = (hostname),						.address = (addr),					}
+
+#endif /* CONFIG_NET_SOCKETS_STATIC_HOSTS */
+
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+
+struct net_pkt;
+
+/**
+ * @brief Receive a packet without copying the payload
+ *
+ * @details Removes the next packet from the socket receive queue and
+ * transfers ownership of its buffers to the caller, who must release
+ * them with zsock_pkt_free() once the payload has been consumed. The
+ * payload can be accessed in place through zsock_pkt_iovec().
+ * Only the ZSOCK_MSG_DONTWAIT flag is supported. As the returned
+ * packet points to kernel buffers, this function can only be used
+ * from supervisor threads.
+ *
+ * @param sock Socket file descriptor.
+ * @param pkt Where to store the received packet.
+ * @param flags Receive flags.
+ * @param src_addr Source address of the packet, may be NULL.
+ * @param addrlen Length of the src_addr buffer, value-result.
+ *
+ * @return Payload length of the packet, or -1 with errno set.
+ */
+ssize_t zsock_recv_pkt(int sock, struct net_pkt **pkt, int flags,
+		       struct sockaddr *src_addr, socklen_t *addrlen);
+
+/**
+ * @brief Build a scatter/gather view over a received packet
+ *
+ * @details Fills iov with pointers to the unread payload of each
+ * fragment of a packet returned by zsock_recv_pkt(). The pointers
+ * stay valid until the packet is released with zsock_pkt_free().
+ *
+ * @param pkt Packet received with zsock_recv_pkt().
+ * @param iov Array of iovec entries to fill.
+ * @param iov_cnt Number of entries in the iov array.
+ *
+ * @return Number of entries filled, or -EMSGSIZE if the packet has
+ * more fragments than iov_cnt.
+ */
+int zsock_pkt_iovec(struct net_pkt *pkt, struct iovec *iov, int iov_cnt);
+
+/**
+ * @brief Release a packet received with zsock_recv_pkt()
+ *
+ * @param pkt Packet to release.
+ */
+void zsock_pkt_free(struct net_pkt *pkt);
+
+#endif /* CONFIG_NET_SOCKETS_ZEROCOPY */
+
+#if defined(CONFIG_NET_SOCKETS_SENDFILE)
+
+struct fs_file_t;
+
+/**
+ * @brief Send file contents over a socket
+ *
+ * @details Streams up to @a count bytes from @a file to @a sock
+ * without any application-level buffering: data moves through a
+ * fixed window of CONFIG_NET_SOCKETS_SENDFILE_CHUNK_SIZE bytes on
+ * the caller's stack, so serving large static content needs no heap.
+ * Semantics follow sendfile(): when @a offset is non-NULL the
+ * transfer starts there, the value is advanced by the number of
+ * bytes sent and the file position is left unchanged; when NULL the
+ * transfer starts at and advances the current file position.
+ * Hitting end of file before @a count bytes is not an error.
+ *
+ * @param sock Socket file descriptor.
+ * @param file Open file to read from.
+ * @param offset Starting offset in the file, or NULL to use and
+ *        advance the current position. Value-result.
+ * @param count Maximum number of bytes to send.
+ *
+ * @return Number of bytes sent, or -1 with errno set if nothing
+ * could be sent.
+ */
+ssize_t zsock_sendfile(int sock, struct fs_file_t *file, off_t *offset,
+		       size_t count);
+
+#endif /* CONFIG_NET_SOCKETS_SENDFILE */
+
 /**
  * @brief Control blocking/non-blocking mode of a socket
  *
@@ -685,12 +840,26 @@ static inline ssize_t sendmsg(int sock, const struct msghdr *message,
 	return zsock_sendmsg(sock, message, flags);
 }
 
+#define mmsghdr zsock_mmsghdr
+
+static inline int sendmmsg(int sock, struct mmsghdr *msgs, unsigned int vlen,
+			   int flags)
+{
+	return zsock_sendmmsg(sock, msgs, vlen, flags);
+}
+
 static inline ssize_t recvfrom(int sock, void *buf, size_t max_len, int flags,
 			       struct sockaddr *src_addr, socklen_t *addrlen)
 {
 	return zsock_recvfrom(sock, buf, max_len, flags, src_addr, addrlen);
 }
 
+static inline int recvmmsg(int sock, struct mmsghdr *msgs, unsigned int vlen,
+			   int flags)
+{
+	return zsock_recvmmsg(sock, msgs, vlen, flags);
+}
+
 static inline int poll(struct zsock_pollfd *fds, int nfds, int timeout)
 {
 	return zsock_poll(fds, nfds, timeout);
@@ -789,12 +958,28 @@ static inline char *inet_ntop(sa_family_t family, const void *src, char *dst,
 /** sockopt: Async error (ignored, for compatibility) */
 #define SO_ERROR 4
 
+/** sockopt: Attach a classic BPF filter program to a packet socket.
+ *  The option value is a struct sock_fprog, see net/socket_filter.h.
+ */
+#define SO_ATTACH_FILTER 26
+/** sockopt: Detach the filter program from a packet socket */
+#define SO_DETACH_FILTER 27
+
 /** sockopt: Timestamp TX packets */
 #define SO_TIMESTAMPING 37
 
+/** sockopt: Upper bound for the transmit pacing rate, in bytes per
+ *  second. Zero disables pacing.
+ */
+#define SO_MAX_PACING_RATE 47
+
 /* Socket options for IPPROTO_TCP level */
-/** sockopt: Disable TCP buffering (ignored, for compatibility) */
+/** sockopt: Send segments as soon as possible, disabling coalescing */
 #define TCP_NODELAY 1
+/** sockopt: Hold back partial segments until uncorked */
+#define TCP_CORK 3
+/** sockopt: Select the congestion control algorithm by name */
+#define TCP_CONGESTION 13
 
 /* Socket options for IPPROTO_IPV6 level */
 /** sockopt: Don't support IPv4 access (ignored, for compatibility) */
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Classic BPF socket filter definitions
+ *
+ * An overview of the filter program encoding can be found from
+ * the classic BSD/Linux packet filter documentation. The structures
+ * and opcode values here follow that encoding so existing filter
+ * programs (e.g. ones generated by tcpdump -dd) can be attached
+ * unmodified with the SO_ATTACH_FILTER socket option.
+ */
+
+#ifndef ZEPHYR_INCLUDE_NET_SOCKET_FILTER_H_
+#define ZEPHYR_INCLUDE_NET_SOCKET_FILTER_H_
+
+/**
+ * @brief BSD socket filter API
+ * @defgroup socket_filter Socket filter API
+ * @ingroup networking
+ * @{
+ */
+
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** A single filter program instruction. */
+struct sock_filter {
+	uint16_t code; /**< Opcode */
+	uint8_t jt;    /**< Jump offset if true */
+	uint8_t jf;    /**< Jump offset if false */
+	uint32_t k;    /**< Generic multiuse field */
+};
+
+/** A filter program, as passed to SO_ATTACH_FILTER. */
+struct sock_fprog {
+	unsigned short len;         /**< Number of instructions */
+	struct sock_filter *filter; /**< Instruction array */
+};
+
+/* Instruction classes */
+#define BPF_CLASS(code) ((code) & 0x07)
+#define BPF_LD		0x00
+#define BPF_LDX		0x01
+#define BPF_ST		0x02
+#define BPF_STX		0x03
+#define BPF_ALU		0x04
+#define BPF_JMP		0x05
+#define BPF_RET		0x06
+#define BPF_MISC	0x07
+
+/* Load/store width */
+#define BPF_SIZE(code)	((code) & 0x18)
+#define BPF_W		0x00
+#define BPF_H		0x08
+#define BPF_B		0x10
+
+/* Load/store addressing mode */
+#define BPF_MODE(code)	((code) & 0xe0)
+#define BPF_IMM		0x00
+#define BPF_ABS		0x20
+#define BPF_IND		0x40
+#define BPF_MEM		0x60
+#define BPF_LEN		0x80
+#define BPF_MSH		0xa0
+
+/* ALU/jump operation */
+#define BPF_OP(code)	((code) & 0xf0)
+#define BPF_ADD		0x00
+#define BPF_SUB		0x10
+#define BPF_MUL		0x20
+#define BPF_DIV		0x30
+#define BPF_OR		0x40
+#define BPF_AND		0x50
+#define BPF_LSH		0x60
+#define BPF_RSH		0x70
+#define BPF_NEG		0x80
+#define BPF_MOD		0x90
+#define BPF_XOR		0xa0
+#define BPF_JA		0x00
+#define BPF_JEQ		0x10
+#define BPF_JGT		0x20
+#define BPF_JGE		0x30
+#define BPF_JSET	0x40
+
+/* ALU/jump operand source */
+#define BPF_SRC(code)	((code) & 0x08)
+#define BPF_K		0x00
+#define BPF_X		0x08
+
+/* Return value source */
+#define BPF_RVAL(code)	((code) & 0x18)
+#define BPF_A		0x10
+
+/* Miscellaneous operations */
+#define BPF_MISCOP(code) ((code) & 0xf8)
+#define BPF_TAX		0x00
+#define BPF_TXA		0x80
+
+/** Number of scratch memory words available to a program */
+#define BPF_MEMWORDS	16
+
+/** Helper to construct a non-jumping instruction */
+#define BPF_STMT(code, k) { (unsigned short)(code), 0, 0, k }
+
+/** Helper to construct a conditional jump instruction */
+#define BPF_JUMP(code, k, jt, jf) { (unsigned short)(code), jt, jf, k }
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_NET_SOCKET_FILTER_H_ */
@@ -34,6 +34,8 @@ enum net_request_wifi_cmd {
 	NET_REQUEST_WIFI_CMD_DISCONNECT,
 	NET_REQUEST_WIFI_CMD_AP_ENABLE,
 	NET_REQUEST_WIFI_CMD_AP_DISABLE,
+	NET_REQUEST_WIFI_CMD_SCAN_RESULTS,
+	NET_REQUEST_WIFI_CMD_CONN_STATE,
 };
 
 #define NET_REQUEST_WIFI_SCAN					\
@@ -61,6 +63,16 @@ NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_WIFI_AP_ENABLE);
 
 NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_WIFI_AP_DISABLE);
 
+#define NET_REQUEST_WIFI_SCAN_RESULTS				\
+	(_NET_WIFI_BASE | NET_REQUEST_WIFI_CMD_SCAN_RESULTS)
+
+NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_WIFI_SCAN_RESULTS);
+
+#define NET_REQUEST_WIFI_CONN_STATE				\
+	(_NET_WIFI_BASE | NET_REQUEST_WIFI_CMD_CONN_STATE)
+
+NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_WIFI_CONN_STATE);
+
 enum net_event_wifi_cmd {
 	NET_EVENT_WIFI_CMD_SCAN_RESULT = 1,
 	NET_EVENT_WIFI_CMD_SCAN_DONE,
@@ -108,6 +120,30 @@ struct wifi_status {
 	int status;
 };
 
+/* Parameter of NET_REQUEST_WIFI_SCAN_RESULTS: the cached results of the
+ * last completed scan are copied into the caller provided array in one
+ * request, instead of one management event per access point.
+ */
+struct wifi_scan_results {
+	/* Caller provided array of at least @a capacity entries. */
+	struct wifi_scan_result *results;
+	uint8_t capacity;
+	/* Number of entries copied into @a results. */
+	uint8_t count;
+	/* Milliseconds since the cached scan completed. */
+	uint32_t age_ms;
+};
+
+/* Parameter of NET_REQUEST_WIFI_CONN_STATE: connection state as tracked
+ * from the connect/disconnect result events, answered without a round
+ * trip to the offload chip.
+ */
+struct wifi_conn_state {
+	bool connected;
+	/* Status code of the last connect or disconnect result. */
+	int last_status;
+};
+
 #include <net/net_if.h>
 
 typedef void (*scan_result_cb_t)(struct net_if *iface, int status,
@@ -73,10 +73,18 @@ struct posix_thread {
  *
  * @param name Symbol name of the condition variable
  */
+#ifdef CONFIG_PTHREAD_FUTEX_FASTPATH
+#define PTHREAD_COND_DEFINE(name)					\
+	struct pthread_cond name = {					\
+		.futex = { .val = ATOMIC_INIT(0) },			\
+		.waiters = ATOMIC_INIT(0),				\
+	}
+#else
 #define PTHREAD_COND_DEFINE(name)					\
 	struct pthread_cond name = {					\
 		.wait_q = Z_WAIT_Q_INIT(&name.wait_q),			\
 	}
+#endif
 
 /**
  * @brief POSIX threading compatibility API
@@ -87,7 +95,12 @@ static inline int pthread_cond_init(pthread_cond_t *cv,
 				    const pthread_condattr_t *att)
 {
 	ARG_UNUSED(att);
+#ifdef CONFIG_PTHREAD_FUTEX_FASTPATH
+	(void)atomic_set(&cv->futex.val, 0);
+	(void)atomic_set(&cv->waiters, 0);
+#else
 	z_waitq_init(&cv->wait_q);
+#endif
 	return 0;
 }
 
@@ -163,6 +176,15 @@ static inline int pthread_condattr_destroy(pthread_condattr_t *att)
  *
  * @param name Symbol name of the mutex
  */
+#ifdef CONFIG_PTHREAD_FUTEX_FASTPATH
+#define PTHREAD_MUTEX_DEFINE(name) \
+	struct pthread_mutex name = \
+	{ \
+		.lock_count = 0, \
+		.futex = { .val = ATOMIC_INIT(0) }, \
+		.owner = NULL, \
+	}
+#else
 #define PTHREAD_MUTEX_DEFINE(name) \
 	struct pthread_mutex name = \
 	{ \
@@ -170,6 +192,7 @@ static inline int pthread_condattr_destroy(pthread_condattr_t *att)
 		.wait_q = Z_WAIT_Q_INIT(&name.wait_q),	\
 		.owner = NULL, \
 	}
+#endif
 
 /*
  *  Mutex attributes - type
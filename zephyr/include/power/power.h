@@ -9,6 +9,7 @@
 
 #include <zephyr/types.h>
 #include <stdbool.h>
+#include <sys/slist.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -214,6 +215,73 @@ bool sys_pm_ctrl_is_state_enabled(enum power_states state);
 
 #endif /* CONFIG_SYS_PM_STATE_LOCK */
 
+#ifdef CONFIG_SYS_PM_LATENCY_QOS
+/**
+ * @brief Wakeup latency constraint request.
+ *
+ * Embed one in the requesting subsystem; the structure must stay
+ * valid until the request is removed.
+ */
+struct sys_pm_latency_req {
+	sys_snode_t node;
+	int32_t latency_us;
+};
+
+/**
+ * @brief Register a wakeup latency constraint
+ *
+ * @details While registered, the power management policy will not
+ *	    select a sleep state whose exit latency exceeds
+ *	    @p latency_us.  The tightest constraint across all
+ *	    registered requests wins.
+ *
+ * @param [in] req Request structure, valid until removed.
+ * @param [in] latency_us Maximum tolerated wakeup latency in
+ *	       microseconds.
+ */
+void sys_pm_latency_request_add(struct sys_pm_latency_req *req,
+				int32_t latency_us);
+
+/**
+ * @brief Update a registered wakeup latency constraint
+ *
+ * @param [in] req Registered request structure.
+ * @param [in] latency_us New latency bound in microseconds.
+ */
+void sys_pm_latency_request_update(struct sys_pm_latency_req *req,
+				   int32_t latency_us);
+
+/**
+ * @brief Remove a wakeup latency constraint
+ *
+ * @param [in] req Registered request structure.
+ */
+void sys_pm_latency_request_remove(struct sys_pm_latency_req *req);
+
+/**
+ * @brief Current effective wakeup latency constraint
+ *
+ * @return Tightest registered latency bound in microseconds, or
+ *	   INT32_MAX when no request is registered.
+ */
+int32_t sys_pm_latency_constraint_us(void);
+#endif /* CONFIG_SYS_PM_LATENCY_QOS */
+
+#ifdef CONFIG_SYS_PM_IDLE_PREDICT
+/**
+ * @brief Feed an observed idle period to the idle duration predictor
+ *
+ * @details Called by the idle loop with the measured length of the
+ *	    idle period that just ended. The predictor maintains an
+ *	    exponentially weighted moving average which the power
+ *	    management policy consults when selecting a power state.
+ *
+ * @param [in] cycles Length of the completed idle period, in
+ *	       hardware cycles.
+ */
+void sys_pm_idle_predictor_update(uint32_t cycles);
+#endif /* CONFIG_SYS_PM_IDLE_PREDICT */
+
 /**
  * @}
  */
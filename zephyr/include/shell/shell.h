@@ -15,6 +15,9 @@
 #include <logging/log_instance.h>
 #include <logging/log.h>
 #include <sys/util.h>
+#ifdef CONFIG_SHELL_ASYNC_OUTPUT
+#include <sys/ring_buffer.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -530,6 +533,15 @@ struct shell_stats {
 #define SHELL_STATS_PTR(_name) NULL
 #endif /* CONFIG_SHELL_STATS */
 
+#ifdef CONFIG_SHELL_ASYNC_OUTPUT
+#define SHELL_ASYNC_TX_DEFINE(_name) \
+	static uint8_t _name##_tx_buffer[CONFIG_SHELL_ASYNC_OUTPUT_BUF_SIZE]
+#define SHELL_ASYNC_TX_INIT(_name) .tx_buf = _name##_tx_buffer,
+#else
+#define SHELL_ASYNC_TX_DEFINE(_name)
+#define SHELL_ASYNC_TX_INIT(_name)
+#endif /* CONFIG_SHELL_ASYNC_OUTPUT */
+
 /**
  * @internal @brief Flags for internal shell usage.
  */
@@ -604,6 +616,20 @@ struct shell_ctx {
 
 	struct k_mutex wr_mtx;
 	k_tid_t tid;
+
+#ifdef CONFIG_SHELL_ASYNC_OUTPUT
+	/*!< Instance owning this context, for the TX work handler.*/
+	const struct shell *shell;
+
+	/*!< Ring buffer decoupling output from the transport.*/
+	struct ring_buf tx_ringbuf;
+
+	/*!< Work item draining the TX ring buffer to the transport.*/
+	struct k_work tx_work;
+
+	/*!< Signalled when the drain frees TX ring buffer space.*/
+	struct k_sem tx_sem;
+#endif
 };
 
 extern const struct log_backend_api log_backend_shell_api;
@@ -637,6 +663,10 @@ struct shell {
 
 	LOG_INSTANCE_PTR_DECLARE(log);
 
+#ifdef CONFIG_SHELL_ASYNC_OUTPUT
+	uint8_t *tx_buf; /*!< Asynchronous output buffer.*/
+#endif
+
 	const char *thread_name;
 	struct k_thread *thread;
 	k_thread_stack_t *stack;
@@ -671,6 +701,7 @@ extern void shell_print_stream(const void *user_ctx, const char *data,
 			     true, shell_print_stream);			      \
 	LOG_INSTANCE_REGISTER(shell, _name, CONFIG_SHELL_LOG_LEVEL);	      \
 	SHELL_STATS_DEFINE(_name);					      \
+	SHELL_ASYNC_TX_DEFINE(_name);					      \
 	static K_THREAD_STACK_DEFINE(_name##_stack, CONFIG_SHELL_STACK_SIZE); \
 	static struct k_thread _name##_thread;				      \
 	static const Z_STRUCT_SECTION_ITERABLE(shell, _name) = {	      \
@@ -684,6 +715,7 @@ extern void shell_print_stream(const void *user_ctx, const char *data,
 		.stats = SHELL_STATS_PTR(_name),			      \
 		.log_backend = SHELL_LOG_BACKEND_PTR(_name),		      \
 		LOG_INSTANCE_PTR_INIT(log, shell, _name)		      \
+		SHELL_ASYNC_TX_INIT(_name)				      \
 		.thread_name = STRINGIFY(_name),			      \
 		.thread = &_name##_thread,				      \
 		.stack = _name##_stack					      \
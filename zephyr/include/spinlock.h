@@ -23,6 +23,53 @@ void z_spin_lock_set_owner(struct k_spinlock *l);
 BUILD_ASSERT(CONFIG_MP_NUM_CPUS < 4, "Too many CPUs for mask");
 #endif /* CONFIG_SPIN_VALIDATE */
 
+#ifdef CONFIG_SPIN_LOCK_PROFILE
+struct k_spinlock;
+
+/* Profiler hot-path hooks, implemented in kernel/spin_profile.c */
+void z_spin_lock_profile_spin(struct k_spinlock *l);
+void z_spin_lock_profile_acquired(struct k_spinlock *l);
+void z_spin_lock_profile_released(struct k_spinlock *l);
+
+/** Contention statistics accumulated for one spinlock */
+struct k_spin_profile_stats {
+	/** Lock the entry belongs to */
+	struct k_spinlock *lock;
+	/** Times the lock was taken */
+	uint32_t acquisitions;
+	/** Times a CPU found the lock already held and had to spin */
+	uint32_t contentions;
+	/** Total cycles spent spinning on the lock */
+	uint64_t spin_cycles;
+	/** Longest single spin, in cycles */
+	uint32_t max_spin_cycles;
+	/** Total cycles the lock was held */
+	uint64_t hold_cycles;
+	/** Longest single hold, in cycles */
+	uint32_t max_hold_cycles;
+};
+
+typedef void (*k_spin_profile_cb_t)(const struct k_spin_profile_stats *stats,
+				    void *user_data);
+
+/**
+ * @brief Iterate over all profiled spinlocks
+ *
+ * Invokes @a cb with a snapshot of each populated profile table entry.
+ * Snapshots race with CPUs updating the statistics and are
+ * statistics-grade, not linearized.
+ *
+ * @param cb Callback invoked per profiled lock
+ * @param user_data Opaque pointer passed through to the callback
+ */
+void k_spin_profile_foreach(k_spin_profile_cb_t cb, void *user_data);
+
+/**
+ * @brief Reset the spinlock profile table
+ */
+void k_spin_profile_reset(void);
+#endif /* CONFIG_SPIN_LOCK_PROFILE */
+
 struct k_spinlock_key {
 	int key;
 };
@@ -93,8 +140,18 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 #endif
 
 #ifdef CONFIG_SMP
+#ifdef CONFIG_SPIN_LOCK_PROFILE
+	if (!atomic_cas(&l->locked, 0, 1)) {
+		/* Contended: spin inside the profiler so the wait is
+		 * measured and attributed to this lock
+		 */
+		z_spin_lock_profile_spin(l);
+	}
+	z_spin_lock_profile_acquired(l);
+#else
 	while (!atomic_cas(&l->locked, 0, 1)) {
 	}
+#endif /* CONFIG_SPIN_LOCK_PROFILE */
 #endif
 
 #ifdef CONFIG_SPIN_VALIDATE
@@ -140,6 +197,9 @@ static ALWAYS_INLINE void k_spin_unlock(struct k_spinlock *l,
 	 * a memory barrier when used like this, and we don't have a
 	 * Zephyr framework for that.
 	 */
+#ifdef CONFIG_SPIN_LOCK_PROFILE
+	z_spin_lock_profile_released(l);
+#endif
 	atomic_clear(&l->locked);
 #endif
 	arch_irq_unlock(key.key);
@@ -155,6 +215,9 @@ static ALWAYS_INLINE void k_spin_release(struct k_spinlock *l)
 	__ASSERT(z_spin_unlock_valid(l), "Not my spinlock %p", l);
 #endif
 #ifdef CONFIG_SMP
+#ifdef CONFIG_SPIN_LOCK_PROFILE
+	z_spin_lock_profile_released(l);
+#endif
 	atomic_clear(&l->locked);
 #endif
 }
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Public API for asynchronous flash operations
+ */
+
+#ifndef ZEPHYR_INCLUDE_STORAGE_FLASH_ASYNC_H_
+#define ZEPHYR_INCLUDE_STORAGE_FLASH_ASYNC_H_
+
+/**
+ * @brief Queued writes and erases on top of the flash API
+ *
+ * @defgroup flash_async Asynchronous flash operation queue
+ * @{
+ */
+
+#include <drivers/flash.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct flash_async_op;
+
+/**
+ * @typedef flash_async_callback_t
+ *
+ * @brief Signature for callback invoked when a queued operation completes.
+ *
+ * @details The callback runs in the context draining the queue (the
+ * system work queue) and must not block. The operation structure may be
+ * reused or freed from within the callback.
+ *
+ * @param op Completed operation.
+ * @param result 0 on success, negative errno code returned by the
+ *               flash API on failure.
+ */
+typedef void (*flash_async_callback_t)(struct flash_async_op *op, int result);
+
+/** Operation types */
+enum flash_async_op_type {
+	FLASH_ASYNC_WRITE,
+	FLASH_ASYNC_ERASE,
+};
+
+/**
+ * @brief Queued flash operation
+ *
+ * The structure, and for writes the data buffer, must remain valid
+ * until the callback has been invoked. Embed it in a larger structure
+ * and use CONTAINER_OF() in the callback to carry user state.
+ */
+struct flash_async_op {
+	/** Internal, used to link queued operations */
+	void *fifo_reserved;
+	/** Flash device to operate on */
+	struct device *dev;
+	/** One of the flash_async_op_type values */
+	uint8_t type;
+	/** Offset within the device */
+	off_t offset;
+	/** Data to write, unused for erase */
+	const void *data;
+	/** Number of bytes to write or erase */
+	size_t len;
+	/** Completion callback, may be NULL */
+	flash_async_callback_t cb;
+};
+
+/**
+ * @brief Queue a flash operation.
+ *
+ * The operation is performed from the system work queue in submission
+ * order; the caller returns immediately. Write protection is disabled
+ * around each operation and re-enabled afterwards.
+ *
+ * @param op Operation to queue, filled in by the caller.
+ *
+ * @return 0 on successful submission, negative errno code on invalid
+ *         arguments.
+ */
+int flash_async_submit(struct flash_async_op *op);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_STORAGE_FLASH_ASYNC_H_ */
@@ -23,6 +23,10 @@
 #include <stdbool.h>
 #include <drivers/flash.h>
 
+#ifdef CONFIG_STREAM_FLASH_SHA256
+#include <tinycrypt/sha256.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -62,6 +66,9 @@ struct stream_flash_ctx {
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	off_t last_erased_page_start_offset; /* Last erased offset */
 #endif
+#ifdef CONFIG_STREAM_FLASH_SHA256
+	struct tc_sha256_state_struct sha256; /* Running hash of the payload */
+#endif
 };
 
 /**
@@ -128,6 +135,24 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
  */
 int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off);
 
+#ifdef CONFIG_STREAM_FLASH_SHA256
+/**
+ * @brief Finalize and read the running SHA-256 of the streamed data.
+ *
+ * The digest covers all payload bytes passed to
+ * stream_flash_buffered_write() so far, excluding any flush padding, so
+ * a downloaded image can be verified without reading it back from
+ * flash. Finalizing ends the running hash; call this once, after the
+ * flushing write.
+ *
+ * @param ctx context
+ * @param hash Buffer of TC_SHA256_DIGEST_SIZE bytes receiving the digest
+ *
+ * @return non-negative on success, negative errno code on fail
+ */
+int stream_flash_sha256(struct stream_flash_ctx *ctx, uint8_t *hash);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
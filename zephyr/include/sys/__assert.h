@@ -81,9 +81,29 @@ void assert_post_action(const char *file, unsigned int line);
 }
 #endif
 
+#ifdef CONFIG_ASSERT_SAMPLED
+#ifndef __ASSERT_SAMPLE_RATE
+#define __ASSERT_SAMPLE_RATE CONFIG_ASSERT_SAMPLE_RATE
+#endif
+
+/* Evaluate the predicate only on every __ASSERT_SAMPLE_RATE'th
+ * execution of the site; skipped hits pass unconditionally. The
+ * per-site counter is deliberately not atomic: concurrent updates
+ * merely perturb which hits get sampled.
+ */
+#define Z_ASSERT_TEST(test)                                               \
+	({                                                                \
+		static unsigned int z_assert_hits;                        \
+		((++z_assert_hits % __ASSERT_SAMPLE_RATE) != 0) ||        \
+			(test);                                           \
+	})
+#else  /* CONFIG_ASSERT_SAMPLED */
+#define Z_ASSERT_TEST(test) (test)
+#endif /* CONFIG_ASSERT_SAMPLED */
+
 #define __ASSERT_NO_MSG(test)                                             \
 	do {                                                              \
-		if (!(test)) {                                            \
+		if (!Z_ASSERT_TEST(test)) {                               \
 			__ASSERT_LOC(test);                               \
 			__ASSERT_POST_ACTION();                           \
 		}                                                         \
@@ -91,7 +111,7 @@ void assert_post_action(const char *file, unsigned int line);
 
 #define __ASSERT(test, fmt, ...)                                          \
 	do {                                                              \
-		if (!(test)) {                                            \
+		if (!Z_ASSERT_TEST(test)) {                               \
 			__ASSERT_LOC(test);                               \
 			__ASSERT_MSG_INFO(fmt, ##__VA_ARGS__);            \
 			__ASSERT_POST_ACTION();                           \
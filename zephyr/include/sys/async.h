@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_ASYNC_H_
+#define ZEPHYR_INCLUDE_SYS_ASYNC_H_
+
+#include <kernel.h>
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup async_apis Async task executor APIs
+ * @ingroup kernel_apis
+ *
+ * Stackless asynchronous tasks scheduled by a shared executor thread.
+ *
+ * An async task is a step function that runs to its next wait point and
+ * returns, remembering where to resume in the task object instead of on
+ * a stack. While a task waits for poll events the executor thread is
+ * free to run other tasks, so any number of event-driven state machines
+ * (protocol engines, monitors, ...) share one thread and one stack
+ * instead of each blocking a dedicated thread in k_poll().
+ *
+ * Step functions are written in a coroutine style using ASYNC_BEGIN(),
+ * ASYNC_AWAIT() and ASYNC_END(). As the resume point is stored as a
+ * line-based label, local variables do not survive across ASYNC_AWAIT();
+ * state that must persist belongs in the structure embedding the task.
+ *
+ * @{
+ */
+
+/** @brief Step result: the task has completed. */
+#define ASYNC_TASK_DONE 0
+
+/** @brief Step result: the task waits for the events it registered. */
+#define ASYNC_TASK_WAIT 1
+
+struct async_task;
+
+/**
+ * @brief Task step function.
+ *
+ * Invoked on the executor thread when the task is submitted and again
+ * each time an awaited event is signaled (or the await times out).
+ *
+ * @param task Task being resumed.
+ *
+ * @return ASYNC_TASK_DONE or ASYNC_TASK_WAIT.
+ */
+typedef int (*async_task_step_t)(struct async_task *task);
+
+/**
+ * @brief Task completion callback.
+ *
+ * Invoked on the executor thread after the step function returns
+ * ASYNC_TASK_DONE, or when an await could not be armed.
+ *
+ * @param task Task that completed.
+ * @param result Value of the task result field.
+ */
+typedef void (*async_task_done_t)(struct async_task *task, int result);
+
+/**
+ * @brief Stackless asynchronous task.
+ *
+ * All fields other than @a result and @a user_data are managed through
+ * the API and the ASYNC_*() macros.
+ */
+struct async_task {
+	/** Triggered work item carrying the task (internal) */
+	struct k_work_poll work;
+
+	/** Step function */
+	async_task_step_t step;
+
+	/** Completion callback, or NULL */
+	async_task_done_t done;
+
+	/** Events awaited while suspended (set by ASYNC_AWAIT()) */
+	struct k_poll_event *events;
+
+	/** Number of awaited events */
+	int num_events;
+
+	/** Timeout for the pending await */
+	k_timeout_t timeout;
+
+	/** Resume point within the step function */
+	uint32_t label;
+
+	/** Task result, owned by the step function */
+	int result;
+
+	/** Untouched by the executor */
+	void *user_data;
+};
+
+/**
+ * @brief Open a coroutine-style step function body.
+ *
+ * Must be matched by ASYNC_END() at the end of the function.
+ *
+ * @param task Task executing the function.
+ */
+#define ASYNC_BEGIN(task) switch ((task)->label) { case 0:
+
+/**
+ * @brief Suspend the task until one of the events is signaled.
+ *
+ * Returns ASYNC_TASK_WAIT from the step function; execution resumes
+ * just after this macro once an event fires. The event array must stay
+ * valid while the task waits, and event state must be reset to
+ * K_POLL_STATE_NOT_READY (as after k_poll()) before awaiting the same
+ * events again.
+ *
+ * @param task Task executing the function.
+ * @param _events Array of events to wait for.
+ * @param _num_events Number of events in the array.
+ */
+#define ASYNC_AWAIT(task, _events, _num_events) \
+	ASYNC_AWAIT_TIMEOUT(task, _events, _num_events, K_FOREVER)
+
+/**
+ * @brief As ASYNC_AWAIT(), giving up after a timeout.
+ *
+ * After resuming, async_task_poll_result() is 0 when an event fired
+ * and -EAGAIN when the timeout expired.
+ *
+ * @param task Task executing the function.
+ * @param _events Array of events to wait for.
+ * @param _num_events Number of events in the array.
+ * @param _timeout Maximum time to wait.
+ */
+#define ASYNC_AWAIT_TIMEOUT(task, _events, _num_events, _timeout) \
+	do { \
+		(task)->events = (_events); \
+		(task)->num_events = (_num_events); \
+		(task)->timeout = (_timeout); \
+		(task)->label = __LINE__; \
+		return ASYNC_TASK_WAIT; \
+	case __LINE__: ; \
+	} while (false)
+
+/**
+ * @brief Close a coroutine-style step function body.
+ *
+ * Falling through to this macro completes the task with the current
+ * value of the result field.
+ *
+ * @param task Task executing the function.
+ */
+#define ASYNC_END(task) } (task)->label = 0; return ASYNC_TASK_DONE
+
+/**
+ * @brief Tell why the last await returned.
+ *
+ * @param task Task to query.
+ *
+ * @retval 0 an awaited event was signaled.
+ * @retval -EAGAIN the await timed out.
+ */
+static inline int async_task_poll_result(const struct async_task *task)
+{
+	return task->work.poll_result;
+}
+
+/**
+ * @brief Initialize an async task, prior to its first submission.
+ *
+ * @param task Task to initialize.
+ * @param step Step function.
+ * @param done Completion callback, or NULL.
+ */
+void async_task_init(struct async_task *task,
+		     async_task_step_t step,
+		     async_task_done_t done);
+
+/**
+ * @brief Submit a task to the executor.
+ *
+ * The first step runs on the executor thread. A completed task may be
+ * resubmitted; a task that is still running or waiting must not be.
+ *
+ * @param task Task to run.
+ */
+void async_task_submit(struct async_task *task);
+
+/**
+ * @brief Cancel a waiting task.
+ *
+ * Only a task suspended in an await can be canceled; its completion
+ * callback is not invoked.
+ *
+ * @param task Task to cancel.
+ *
+ * @retval 0 Task canceled.
+ * @retval -EINVAL Task is running, pending, or already completed.
+ */
+int async_task_cancel(struct async_task *task);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_ASYNC_H_ */
@@ -17,6 +17,23 @@ extern "C" {
  * and kernel.h
  */
 
+#ifdef CONFIG_ERRNO_IN_TLS
+extern __thread int z_errno_var;
+
+/**
+ * return a pointer to a memory location containing errno
+ *
+ * errno lives in native thread-local storage, so this compiles down
+ * to an offset from the thread pointer register with no kernel
+ * involvement, from kernel and user mode alike.
+ *
+ * @return Memory location of errno data for current thread
+ */
+static inline int *z_errno(void)
+{
+	return &z_errno_var;
+}
+#else
 /**
  * return a pointer to a memory location containing errno
  *
@@ -26,11 +43,14 @@ extern "C" {
  * @return Memory location of errno data for current thread
  */
 __syscall int *z_errno(void);
+#endif /* CONFIG_ERRNO_IN_TLS */
 
 #ifdef __cplusplus
 }
 #endif
 
+#ifndef CONFIG_ERRNO_IN_TLS
 #include <syscalls/errno_private.h>
+#endif
 
 #endif /* ZEPHYR_INCLUDE_SYS_ERRNO_PRIVATE_H_ */
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_IO_RING_H_
+#define ZEPHYR_INCLUDE_SYS_IO_RING_H_
+
+#include <kernel.h>
+#include <device.h>
+#include <toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Asynchronous I/O rings
+ *
+ * A pair of single-producer/single-consumer rings in memory shared
+ * between one user thread and the kernel. The shared area, the data
+ * buffer region and the target device are validated once at
+ * registration; after that the user thread posts submission entries
+ * and reaps completion entries with plain loads and stores, and only
+ * traps to kick or wait for the kernel-side dispatcher.
+ *
+ * Index convention: head is owned by the consumer, tail by the
+ * producer; both increment monotonically and are masked on access.
+ * The user thread produces submissions (sq_tail) and consumes
+ * completions (cq_head).
+ */
+
+/** Submission opcodes */
+enum k_io_ring_op {
+	/** No I/O; completes with result 0 */
+	K_IO_RING_OP_NOP,
+	/** Write len bytes at buf_offset to the device */
+	K_IO_RING_OP_TX,
+	/** Read up to len bytes from the device into buf_offset */
+	K_IO_RING_OP_RX,
+};
+
+/** Submission queue entry */
+struct k_io_ring_sqe {
+	/** One of enum k_io_ring_op */
+	uint8_t opcode;
+	uint8_t reserved[3];
+	/** Byte offset of the I/O buffer within the registered region */
+	uint32_t buf_offset;
+	/** Length of the I/O in bytes */
+	uint32_t len;
+	/** Opaque tag copied into the matching completion */
+	uint32_t user_data;
+};
+
+/** Completion queue entry */
+struct k_io_ring_cqe {
+	/** Bytes transferred, or negative errno */
+	int32_t result;
+	/** Tag from the matching submission */
+	uint32_t user_data;
+};
+
+/** Ring area shared between the user thread and the kernel */
+struct k_io_ring_shared {
+	/** Submission consumer index (written by the kernel) */
+	volatile uint32_t sq_head;
+	/** Submission producer index (written by the user) */
+	volatile uint32_t sq_tail;
+	/** Completion consumer index (written by the user) */
+	volatile uint32_t cq_head;
+	/** Completion producer index (written by the kernel) */
+	volatile uint32_t cq_tail;
+	struct k_io_ring_sqe sqes[CONFIG_IO_RING_ENTRIES];
+	struct k_io_ring_cqe cqes[CONFIG_IO_RING_ENTRIES];
+};
+
+/**
+ * @brief Register an I/O ring
+ *
+ * Validates the shared ring area, the buffer region and the device
+ * once, and binds them together for subsequent submissions. The
+ * calling thread must have access to the device object, and the
+ * shared area and buffer region must remain valid until the ring is
+ * unregistered. Rings are torn down automatically when the owning
+ * thread is aborted.
+ *
+ * @param shared Ring area, zero-initialized by the caller
+ * @param dev UART device the ring's I/O is directed at
+ * @param buf Base of the buffer region submissions refer into
+ * @param buf_size Size of the buffer region in bytes
+ * @retval 0 on success
+ * @retval -ENOMEM if all ring slots are in use
+ * @retval -EEXIST if the shared area is already registered
+ */
+__syscall int k_io_ring_register(struct k_io_ring_shared *shared,
+				 struct device *dev,
+				 void *buf, size_t buf_size);
+
+/**
+ * @brief Unregister an I/O ring
+ *
+ * Releases the ring slot and quiesces the kernel-side dispatcher
+ * before returning, so the caller may free or reuse the shared area
+ * and buffer region afterwards. Submissions not yet executed are
+ * discarded without completions. May only be called by the thread
+ * that registered the ring, from thread context.
+ *
+ * @param shared Registered ring area
+ * @retval 0 on success
+ * @retval -EINVAL if the ring is not registered to this thread
+ */
+__syscall int k_io_ring_unregister(struct k_io_ring_shared *shared);
+
+/**
+ * @brief Kick the dispatcher after posting submissions
+ *
+ * Call after publishing one or more submission entries. A single
+ * kick covers everything posted before it.
+ *
+ * @param shared Registered ring area
+ * @retval 0 on success
+ * @retval -EINVAL if the ring is not registered to this thread
+ */
+__syscall int k_io_ring_submit(struct k_io_ring_shared *shared);
+
+/**
+ * @brief Wait until at least one completion is pending
+ *
+ * Returns immediately if the completion ring is non-empty.
+ *
+ * @param shared Registered ring area
+ * @param timeout Wait period
+ * @retval 0 when completions are available
+ * @retval -EAGAIN on timeout
+ * @retval -EINVAL if the ring is not registered to this thread
+ */
+__syscall int k_io_ring_wait(struct k_io_ring_shared *shared,
+			     k_timeout_t timeout);
+
+/**
+ * @brief Post a submission entry (user side)
+ *
+ * Fills the next free submission slot. The entry is not visible to
+ * the kernel until k_io_ring_submit() is called.
+ *
+ * @param shared Registered ring area
+ * @param sqe Entry to post
+ * @retval 0 on success
+ * @retval -ENOSPC if the submission ring is full
+ */
+static inline int k_io_ring_post(struct k_io_ring_shared *shared,
+				 const struct k_io_ring_sqe *sqe)
+{
+	uint32_t tail = shared->sq_tail;
+
+	if ((tail - shared->sq_head) >= CONFIG_IO_RING_ENTRIES) {
+		return -ENOSPC;
+	}
+
+	shared->sqes[tail % CONFIG_IO_RING_ENTRIES] = *sqe;
+
+	/* Publish the entry before moving the producer index */
+	compiler_barrier();
+	shared->sq_tail = tail + 1;
+
+	return 0;
+}
+
+/**
+ * @brief Reap a completion entry (user side)
+ *
+ * The dispatcher stops executing submissions while the completion
+ * ring is full; after reaping, kick it with k_io_ring_submit() (or
+ * wait with k_io_ring_wait()) to resume the stalled work.
+ *
+ * @param shared Registered ring area
+ * @param cqe Filled with the oldest pending completion
+ * @retval 0 on success
+ * @retval -EAGAIN if the completion ring is empty
+ */
+static inline int k_io_ring_reap(struct k_io_ring_shared *shared,
+				 struct k_io_ring_cqe *cqe)
+{
+	uint32_t head = shared->cq_head;
+
+	if (head == shared->cq_tail) {
+		return -EAGAIN;
+	}
+
+	/* Read the entry before releasing the slot */
+	*cqe = shared->cqes[head % CONFIG_IO_RING_ENTRIES];
+	compiler_barrier();
+	shared->cq_head = head + 1;
+
+	return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <syscalls/io_ring.h>
+
+#endif /* ZEPHYR_INCLUDE_SYS_IO_RING_H_ */
@@ -101,6 +101,68 @@ void k_mem_map(uint8_t **linear_addr, uintptr_t phys_addr, size_t size,
 size_t k_mem_region_align(uintptr_t *aligned_addr, size_t *aligned_size,
 			  uintptr_t addr, size_t size, size_t align);
 
+#ifdef CONFIG_DEMAND_PAGING
+/**
+ * Evict a region to the backing store, freeing its page frames
+ *
+ * Useful to proactively return memory ahead of a known burst of
+ * demand, instead of taking eviction latency inside page faults.
+ * Pinned and reserved pages cannot be paged out.
+ *
+ * This API is only available if CONFIG_DEMAND_PAGING is enabled.
+ *
+ * @param addr Page-aligned base address of the region
+ * @param size Page-aligned size of the region
+ * @retval 0 Success
+ * @retval -EINVAL A page in the region is pinned or reserved
+ * @retval -ENOMEM The backing store is full
+ */
+int k_mem_page_out(void *addr, size_t size);
+
+/**
+ * Fault a region resident ahead of use
+ *
+ * Any pages of the region currently in the backing store are paged
+ * back in, so a subsequent access in a latency-sensitive path takes
+ * no fault.  The pages remain evictable; use k_mem_pin() to also
+ * lock them in RAM.
+ *
+ * This API is only available if CONFIG_DEMAND_PAGING is enabled.
+ *
+ * @param addr Page-aligned base address of the region
+ * @param size Page-aligned size of the region
+ * @retval 0 Success
+ * @retval -EFAULT A page could not be made resident
+ */
+int k_mem_page_in(void *addr, size_t size);
+
+/**
+ * Fault a region resident and pin it in RAM
+ *
+ * As k_mem_page_in(), but the pages' frames are additionally marked
+ * ineligible for eviction until k_mem_unpin() releases them.
+ * Required for memory touched by ISRs or with paging disabled.
+ *
+ * This API is only available if CONFIG_DEMAND_PAGING is enabled.
+ *
+ * @param addr Page-aligned base address of the region
+ * @param size Page-aligned size of the region
+ * @retval 0 Success
+ * @retval -EFAULT A page could not be made resident
+ */
+int k_mem_pin(void *addr, size_t size);
+
+/**
+ * Make a pinned region evictable again
+ *
+ * This API is only available if CONFIG_DEMAND_PAGING is enabled.
+ *
+ * @param addr Page-aligned base address of the region
+ * @param size Page-aligned size of the region
+ */
+void k_mem_unpin(void *addr, size_t size);
+#endif /* CONFIG_DEMAND_PAGING */
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_PERCPU_H_
+#define ZEPHYR_INCLUDE_SYS_PERCPU_H_
+
+#include <zephyr/types.h>
+#include <sys/util.h>
+#include <sys/arch_interface.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup percpu_apis Per-CPU variable APIs
+ * @ingroup kernel_apis
+ * @{
+ *
+ * Generic per-CPU variables for SMP hot-path state.
+ *
+ * K_PERCPU_DEFINE() and friends instantiate one copy of an arbitrary
+ * type per CPU, each copy padded onto its own cache-line-aligned slot
+ * so CPUs touching their own copy never falsely share a line with a
+ * neighbour's. k_this_cpu_ptr() compiles down to one index into the
+ * slot array, making it cheap enough for statistics, tracing buffers
+ * and allocator caches.
+ *
+ * A pointer obtained from k_this_cpu_ptr() is only guaranteed to stay
+ * this CPU's copy while the caller cannot migrate: in an ISR, under a
+ * spinlock or with interrupts locked. Code that merely wants
+ * statistics-grade accuracy may use it without such protection and
+ * tolerate the occasional update landing on a stale CPU's copy.
+ *
+ * On uniprocessor builds everything degenerates to a single unpadded
+ * copy with zero overhead.
+ */
+
+#ifdef CONFIG_SMP
+#define Z_PERCPU_NUM_SLOTS CONFIG_MP_NUM_CPUS
+#define Z_PERCPU_SLOT_ALIGN __aligned(CONFIG_PERCPU_SLOT_ALIGN)
+#else
+#define Z_PERCPU_NUM_SLOTS 1
+#define Z_PERCPU_SLOT_ALIGN
+#endif /* CONFIG_SMP */
+
+/**
+ * @brief Declare a per-CPU variable visible to several files
+ *
+ * Defines the padded slot type for @a name and declares the backing
+ * array extern. Put this in a header; exactly one translation unit
+ * must then instantiate the variable with K_PERCPU_DEFINE().
+ *
+ * @param type Type of one CPU's copy
+ * @param name Name of the per-CPU variable
+ */
+#define K_PERCPU_DECLARE(type, name) \
+	struct _percpu_##name { \
+		type value; \
+	} Z_PERCPU_SLOT_ALIGN; \
+	extern struct _percpu_##name name[Z_PERCPU_NUM_SLOTS]
+
+/**
+ * @brief Instantiate a per-CPU variable declared with K_PERCPU_DECLARE()
+ *
+ * @param name Name of the per-CPU variable
+ */
+#define K_PERCPU_DEFINE(name) \
+	struct _percpu_##name name[Z_PERCPU_NUM_SLOTS]
+
+/**
+ * @brief Define a file-local per-CPU variable
+ *
+ * One-step variant of K_PERCPU_DECLARE()/K_PERCPU_DEFINE() for
+ * per-CPU state private to a single translation unit.
+ *
+ * @param type Type of one CPU's copy
+ * @param name Name of the per-CPU variable
+ */
+#define K_PERCPU_DEFINE_STATIC(type, name) \
+	struct _percpu_##name { \
+		type value; \
+	} Z_PERCPU_SLOT_ALIGN; \
+	static struct _percpu_##name name[Z_PERCPU_NUM_SLOTS]
+
+/**
+ * @brief Get a pointer to a given CPU's copy of a per-CPU variable
+ *
+ * @param name Name of the per-CPU variable
+ * @param cpu CPU index
+ * @return Pointer to CPU @a cpu's copy
+ */
+#define k_percpu_ptr(name, cpu) (&(name)[cpu].value)
+
+/**
+ * @brief Get a pointer to the current CPU's copy of a per-CPU variable
+ *
+ * See the migration caveat in the group documentation above.
+ *
+ * @param name Name of the per-CPU variable
+ * @return Pointer to the current CPU's copy
+ */
+#ifdef CONFIG_SMP
+#define k_this_cpu_ptr(name) k_percpu_ptr(name, arch_curr_cpu()->id)
+#else
+#define k_this_cpu_ptr(name) k_percpu_ptr(name, 0)
+#endif /* CONFIG_SMP */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_PERCPU_H_ */
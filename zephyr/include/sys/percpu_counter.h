@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_PERCPU_COUNTER_H_
+#define ZEPHYR_INCLUDE_SYS_PERCPU_COUNTER_H_
+
+#include <zephyr/types.h>
+#include <string.h>
+#include <sys/util.h>
+#include <sys/arch_interface.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup percpu_counter_apis Per-CPU counter APIs
+ * @ingroup kernel_apis
+ * @{
+ *
+ * Statistics counters incremented from hot paths on SMP systems.
+ *
+ * Each CPU increments a private slot with a plain (non-atomic) add, so
+ * counting neither bounces a shared cache line between cores nor pays
+ * for an atomic read-modify-write; readers sum the slots on demand.
+ *
+ * These counters are statistics-grade, not exact: an increment that is
+ * preempted and migrated to another CPU between reading and writing
+ * its slot may rarely be lost, and a sum taken while other CPUs are
+ * counting is a snapshot, not a linearization point. Callers needing
+ * exact counts should use the atomic APIs instead.
+ */
+
+#ifdef CONFIG_SMP
+struct sys_percpu_counter_slot {
+	uint32_t v;
+} __aligned(CONFIG_PERCPU_COUNTER_SLOT_ALIGN);
+
+struct sys_percpu_counter {
+	/* Each slot is padded onto its own cache line so that CPUs
+	 * counting concurrently do not falsely share one
+	 */
+	struct sys_percpu_counter_slot slot[CONFIG_MP_NUM_CPUS];
+};
+#else
+/* Uniprocessor: a per-CPU counter degenerates to a plain counter */
+struct sys_percpu_counter {
+	struct {
+		uint32_t v;
+	} slot[1];
+};
+#endif /* CONFIG_SMP */
+
+/**
+ * @brief Add a value to a per-CPU counter
+ *
+ * Safe to call from any context, including ISRs.
+ *
+ * @param counter Counter to update
+ * @param n Amount to add
+ */
+static inline void sys_percpu_counter_add(struct sys_percpu_counter *counter,
+					  uint32_t n)
+{
+#ifdef CONFIG_SMP
+	counter->slot[arch_curr_cpu()->id].v += n;
+#else
+	counter->slot[0].v += n;
+#endif
+}
+
+/**
+ * @brief Increment a per-CPU counter by one
+ *
+ * @param counter Counter to update
+ */
+static inline void sys_percpu_counter_inc(struct sys_percpu_counter *counter)
+{
+	sys_percpu_counter_add(counter, 1U);
+}
+
+/**
+ * @brief Sum all CPUs' slots of a per-CPU counter
+ *
+ * @param counter Counter to read
+ * @return Snapshot of the counter's aggregate value
+ */
+static inline uint32_t sys_percpu_counter_sum(struct sys_percpu_counter
+					      *counter)
+{
+	uint32_t total = 0U;
+
+	for (int i = 0; i < (int)ARRAY_SIZE(counter->slot); i++) {
+		total += counter->slot[i].v;
+	}
+
+	return total;
+}
+
+/**
+ * @brief Sum a per-CPU counter and reset its slots to zero
+ *
+ * Useful for periodically folding deltas into a canonical aggregate.
+ * As with all operations here, an increment racing with the reset of
+ * its slot may be lost.
+ *
+ * @param counter Counter to drain
+ * @return Aggregate value accumulated since the last fold
+ */
+static inline uint32_t sys_percpu_counter_fold(struct sys_percpu_counter
+					       *counter)
+{
+	uint32_t total = 0U;
+
+	for (int i = 0; i < (int)ARRAY_SIZE(counter->slot); i++) {
+		total += counter->slot[i].v;
+		counter->slot[i].v = 0U;
+	}
+
+	return total;
+}
+
+/**
+ * @brief Reset a per-CPU counter to zero
+ *
+ * @param counter Counter to reset
+ */
+static inline void sys_percpu_counter_reset(struct sys_percpu_counter
+					    *counter)
+{
+	(void)memset(counter->slot, 0, sizeof(counter->slot));
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_PERCPU_COUNTER_H_ */
@@ -413,6 +413,152 @@ int ring_buf_get_finish(struct ring_buf *buf, uint32_t size);
  */
 uint32_t ring_buf_get(struct ring_buf *buf, uint8_t *data, uint32_t size);
 
+/* Indices of a SPSC ring buffer are placed on separate cache lines so
+ * the producer and consumer cores do not write to the same line. The
+ * value is a conservative upper bound of the cache line sizes of the
+ * SMP-capable targets currently supported.
+ */
+#define RING_BUF_SPSC_CACHE_LINE 64
+
+/**
+ * @brief A single-producer, single-consumer byte ring buffer
+ *
+ * Unlike struct ring_buf, one thread (or ISR) may produce into and one
+ * may consume from this buffer concurrently without locking: the
+ * producer only writes the tail index and the consumer only the head
+ * index, each on its own cache line. Each side additionally keeps a
+ * cached snapshot of the other side's index and re-reads the shared
+ * copy only when the buffer appears full (producer) or empty
+ * (consumer), so steady-state operation causes no cross-core cache
+ * line traffic beyond the payload itself.
+ *
+ * The buffer size must be a power of two; indices run free and are
+ * reduced modulo the size only when addressing the data area.
+ */
+struct ring_buf_spsc {
+	/* Producer-owned cache line */
+	atomic_t tail;
+	uint32_t cached_head;
+
+	/* Consumer-owned cache line */
+	atomic_t head __aligned(RING_BUF_SPSC_CACHE_LINE);
+	uint32_t cached_tail;
+
+	/* Read-only after initialization, on a line of its own so
+	 * neither index write invalidates it
+	 */
+	uint8_t *buf __aligned(RING_BUF_SPSC_CACHE_LINE);
+	uint32_t size;
+	uint32_t mask;
+};
+
+/**
+ * @brief Statically define and initialize an SPSC ring buffer.
+ *
+ * The ring buffer contains 2^pow bytes, where @a pow is the specified
+ * size exponent; a power of two is required for the lock-free index
+ * arithmetic.
+ *
+ * The ring buffer can be accessed outside the module where it is
+ * defined using:
+ *
+ * @code extern struct ring_buf_spsc <name>; @endcode
+ *
+ * @param name Name of the ring buffer.
+ * @param pow Ring buffer size exponent.
+ */
+#define RING_BUF_SPSC_DECLARE_POW2(name, pow) \
+	static uint8_t _ring_buffer_data_spsc_##name[BIT(pow)]; \
+	struct ring_buf_spsc name = { \
+		.buf = _ring_buffer_data_spsc_##name, \
+		.size = (BIT(pow)), \
+		.mask = (BIT(pow)) - 1, \
+	}
+
+/**
+ * @brief Initialize an SPSC ring buffer.
+ *
+ * This routine initializes a ring buffer not defined using
+ * RING_BUF_SPSC_DECLARE_POW2, prior to its first use.
+ *
+ * @param buf Address of ring buffer.
+ * @param size Ring buffer size in bytes; must be a power of two.
+ * @param data Ring buffer data area (uint8_t data[size]).
+ */
+static inline void ring_buf_spsc_init(struct ring_buf_spsc *buf,
+				      uint32_t size, uint8_t *data)
+{
+	__ASSERT(is_power_of_two(size), "SPSC ring size must be power of two");
+
+	memset(buf, 0, sizeof(struct ring_buf_spsc));
+	buf->buf = data;
+	buf->size = size;
+	buf->mask = size - 1;
+}
+
+/**
+ * @brief Write bytes to an SPSC ring buffer.
+ *
+ * May only be called from the single producing context. Safe against a
+ * concurrent ring_buf_spsc_get() from the consuming context.
+ *
+ * @param buf  Address of ring buffer.
+ * @param data Data to write.
+ * @param size Data size (in bytes).
+ *
+ * @return Number of bytes written, which is less than @a size if the
+ *         buffer lacked space.
+ */
+uint32_t ring_buf_spsc_put(struct ring_buf_spsc *buf, const uint8_t *data,
+			   uint32_t size);
+
+/**
+ * @brief Read bytes from an SPSC ring buffer.
+ *
+ * May only be called from the single consuming context. Safe against a
+ * concurrent ring_buf_spsc_put() from the producing context.
+ *
+ * @param buf  Address of ring buffer.
+ * @param data Address of the output buffer.
+ * @param size Output buffer size (in bytes).
+ *
+ * @return Number of bytes read, which is less than @a size if the
+ *         buffer held fewer bytes.
+ */
+uint32_t ring_buf_spsc_get(struct ring_buf_spsc *buf, uint8_t *data,
+			   uint32_t size);
+
+/**
+ * @brief Determine the free space in an SPSC ring buffer.
+ *
+ * Accurate when called from the producing context; from elsewhere the
+ * result is a point-in-time snapshot.
+ *
+ * @param buf Address of ring buffer.
+ *
+ * @return Ring buffer free space (in bytes).
+ */
+static inline uint32_t ring_buf_spsc_space_get(struct ring_buf_spsc *buf)
+{
+	return buf->size - (uint32_t)(atomic_get(&buf->tail) -
+				      atomic_get(&buf->head));
+}
+
+/**
+ * @brief Determine if an SPSC ring buffer is empty.
+ *
+ * Accurate when called from the consuming context; from elsewhere the
+ * result is a point-in-time snapshot.
+ *
+ * @param buf Address of ring buffer.
+ *
+ * @return 1 if the ring buffer is empty, or 0 if not.
+ */
+static inline int ring_buf_spsc_is_empty(struct ring_buf_spsc *buf)
+{
+	return atomic_get(&buf->head) == atomic_get(&buf->tail);
+}
+
 /**
  * @}
  */
@@ -54,6 +54,29 @@ struct sys_heap {
 	size_t init_bytes;
 };
 
+/* Number of entries in the free-chunk histogram; matches the maximum
+ * number of power-of-two size buckets a heap can have.
+ */
+#define SYS_HEAP_RUNTIME_STATS_BUCKETS 32
+
+/* Snapshot of a heap's runtime statistics, filled in by
+ * sys_heap_runtime_stats_get().  Byte counts are chunk-granular and
+ * include the per-chunk header overhead, so allocated_bytes plus
+ * free_bytes accounts for the whole data area of the heap.
+ */
+struct sys_heap_runtime_stats {
+	size_t allocated_bytes;
+	size_t max_allocated_bytes;
+	size_t free_bytes;
+	/* Usable size of the largest free chunk: the biggest
+	 * sys_heap_alloc() guaranteed to succeed right now
+	 */
+	size_t largest_free_bytes;
+	uint32_t failed_allocs;
+	/* Count of free chunks per power-of-two bucket, smallest first */
+	uint32_t free_chunks[SYS_HEAP_RUNTIME_STATS_BUCKETS];
+};
+
 struct z_heap_stress_result {
 	uint32_t total_allocs;
 	uint32_t successful_allocs;
@@ -118,6 +141,39 @@ void *sys_heap_aligned_alloc(struct sys_heap *h, size_t align, size_t bytes);
  */
 void sys_heap_free(struct sys_heap *h, void *mem);
 
+/** @brief Usable size of an allocated block
+
+ * Returns the number of bytes actually available in a block returned
+ * from sys_heap_alloc() or sys_heap_aligned_alloc(), which due to
+ * chunk rounding may be somewhat larger than the size requested.
+ * Because only header fields of a chunk owned by the caller are read,
+ * it is legal to call this without the lock protecting other heap
+ * operations.
+ *
+ * @param h Heap from which the block was allocated
+ * @param mem A pointer returned from sys_heap_alloc()
+ * @return Size in bytes usable by the caller
+ */
+size_t sys_heap_usable_size(struct sys_heap *h, void *mem);
+
+/** @brief Snapshot runtime statistics of a sys_heap
+ *
+ * Fills @a stats with the current allocation counters and a scan of
+ * the free chunks (total free bytes, largest free chunk, per-bucket
+ * histogram).  Requires CONFIG_SYS_HEAP_RUNTIME_STATS; the counters
+ * are maintained by the allocation paths at negligible cost, while
+ * this call walks the whole chunk list and is intended for shell
+ * diagnostics or periodic sampling, not hot paths.
+ *
+ * @note As with the allocation functions, the caller must provide
+ * locking against concurrent modification of the heap.
+ *
+ * @param h Heap to query
+ * @param stats Struct to fill with the heap's statistics
+ */
+void sys_heap_runtime_stats_get(struct sys_heap *h,
+				struct sys_heap_runtime_stats *stats);
+
 /** @brief Validate heap integrity
  *
  * Validates the internal integrity of a sys_heap.  Intended for unit
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_TIME_PAGE_H_
+#define ZEPHYR_INCLUDE_SYS_TIME_PAGE_H_
+
+#include <zephyr/types.h>
+#include <toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Userspace-readable time page
+ *
+ * The kernel publishes the current uptime tick count here on every
+ * tick announcement, guarded by a sequence counter. User threads
+ * whose memory domain includes z_time_page_partition can read the
+ * tick count without a system call trap; the value lags real time
+ * by at most one tick announcement.
+ */
+struct sys_time_page {
+	/** Sequence counter; odd while an update is in progress */
+	uint32_t seq;
+	uint32_t reserved;
+	/** Uptime in ticks as of the last tick announcement */
+	uint64_t ticks;
+	/** Pad out to the 32-byte MPU region granularity */
+	uint8_t unused[16];
+};
+
+extern struct sys_time_page z_time_page;
+extern struct k_mem_partition z_time_page_partition;
+
+/**
+ * @brief Read the uptime tick count from the time page
+ *
+ * Spins until a consistent snapshot is observed, so it is safe
+ * against concurrent updates from the tick announcement.
+ *
+ * @return Uptime in ticks as of the last tick announcement
+ */
+static inline uint64_t sys_time_page_ticks(void)
+{
+	uint32_t seq;
+	uint64_t ticks;
+
+	do {
+		seq = z_time_page.seq;
+		compiler_barrier();
+		ticks = z_time_page.ticks;
+		compiler_barrier();
+	} while ((seq & 1U) != 0U || seq != z_time_page.seq);
+
+	return ticks;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_TIME_PAGE_H_ */
@@ -8,6 +8,9 @@
 #include <device.h>
 #include <sys/atomic.h>
 #include <syscall_handler.h>
+#ifdef CONFIG_BOOT_INIT_TIMING
+#include <debug/boot_timing.h>
+#endif
 
 extern const struct init_entry __init_start[];
 extern const struct init_entry __init_PRE_KERNEL_1_start[];
@@ -20,15 +23,127 @@ extern const struct init_entry __init_end[];
 extern const struct init_entry __init_SMP_start[];
 #endif
 
+#ifdef CONFIG_DEFERRED_INIT
+extern const struct init_entry __init_DEFERRED_start[];
+#endif
+
 extern struct device __device_start[];
 extern struct device __device_end[];
 
+#ifdef CONFIG_DEFERRED_INIT
+extern struct device __device_DEFERRED_start[];
+#endif
+
 #ifdef CONFIG_DEVICE_POWER_MANAGEMENT
 extern uint32_t __device_busy_start[];
 extern uint32_t __device_busy_end[];
 #define DEVICE_BUSY_SIZE (__device_busy_end - __device_busy_start)
 #endif
 
+#ifdef CONFIG_DEFERRED_INIT
+/* Serializes on-demand initialization of DEFERRED-level devices. A
+ * mutex rather than a spinlock since driver init functions are allowed
+ * to block; deferred devices may therefore only be bound from thread
+ * context.
+ */
+static K_MUTEX_DEFINE(deferred_init_lock);
+
+/* A deferred device is "pending" while its statically initialized API
+ * pointer is parked in deferred_api; once its init function has run,
+ * the pointer is restored (or left NULL on failure, exactly as for a
+ * failed boot-time init) and deferred_api is cleared.
+ */
+static void deferred_init_stash(void)
+{
+	struct device *dev;
+
+	for (dev = __device_DEFERRED_start; dev != __device_end; dev++) {
+		dev->deferred_api = dev->driver_api;
+		dev->driver_api = NULL;
+	}
+}
+
+/* Run the init entry for one pending deferred device, with
+ * deferred_init_lock held. Readiness afterwards is reported the same
+ * way as for boot-time initialization: through the API pointer.
+ */
+static void deferred_device_init_locked(struct device *dev)
+{
+	const struct init_entry *entry;
+
+	for (entry = __init_DEFERRED_start; entry != __init_end; entry++) {
+		if (entry->dev != dev) {
+			continue;
+		}
+
+		z_object_init(dev);
+		if (entry->init(dev) == 0) {
+			dev->driver_api = dev->deferred_api;
+		}
+		break;
+	}
+	dev->deferred_api = NULL;
+}
+
+/* Called by device_get_binding() when a name lookup matched a device
+ * in the deferred range; makes sure its init function has run before
+ * the binding is handed out.
+ */
+static struct device *deferred_device_resolve(struct device *dev)
+{
+	if (dev >= __device_DEFERRED_start) {
+		k_mutex_lock(&deferred_init_lock, K_FOREVER);
+		if (dev->deferred_api != NULL) {
+			deferred_device_init_locked(dev);
+		}
+		k_mutex_unlock(&deferred_init_lock);
+
+		if (!z_device_ready(dev)) {
+			return NULL;
+		}
+	}
+	return dev;
+}
+
+int device_deferred_init_all(void)
+{
+	static bool anon_done;
+	const struct init_entry *entry;
+	int ret = 0;
+
+	k_mutex_lock(&deferred_init_lock, K_FOREVER);
+	for (entry = __init_DEFERRED_start; entry != __init_end; entry++) {
+		struct device *dev = entry->dev;
+
+		if (dev != NULL) {
+			if (dev->deferred_api != NULL) {
+				deferred_device_init_locked(dev);
+			}
+			if (!z_device_ready(dev)) {
+				ret = -EIO;
+			}
+		} else if (!anon_done) {
+			/* Plain SYS_INIT() entry at DEFERRED level;
+			 * these only ever run from here since there is
+			 * no device to look up.
+			 */
+			if (entry->init(NULL) != 0) {
+				ret = -EIO;
+			}
+		}
+	}
+	anon_done = true;
+	k_mutex_unlock(&deferred_init_lock);
+
+	return ret;
+}
+#else
+static inline struct device *deferred_device_resolve(struct device *dev)
+{
+	return dev;
+}
+#endif /* CONFIG_DEFERRED_INIT */
+
 /**
  * @brief Execute all the init entry initialization functions at a given level
  *
@@ -50,20 +165,39 @@ void z_sys_init_run_level(int32_t level)
 #ifdef CONFIG_SMP
 		__init_SMP_start,
 #endif
-		/* End marker */
+		/* End marker; entries at the DEFERRED pseudo-level are
+		 * never run from here
+		 */
+#ifdef CONFIG_DEFERRED_INIT
+		__init_DEFERRED_start,
+#else
 		__init_end,
+#endif
 	};
 	const struct init_entry *entry;
 
+#ifdef CONFIG_DEFERRED_INIT
+	if (level == _SYS_INIT_LEVEL_PRE_KERNEL_1) {
+		deferred_init_stash();
+	}
+#endif
+
 	for (entry = levels[level]; entry < levels[level+1]; entry++) {
 		struct device *dev = entry->dev;
 		int retval;
+#ifdef CONFIG_BOOT_INIT_TIMING
+		uint32_t init_start = k_cycle_get_32();
+#endif
 
 		if (dev != NULL) {
 			z_object_init(dev);
 		}
 
 		retval = entry->init(dev);
+#ifdef CONFIG_BOOT_INIT_TIMING
+		z_boot_timing_record(entry, level,
+				     k_cycle_get_32() - init_start);
+#endif
 		if (retval != 0) {
 			if (dev) {
 				/* Initialization failed. Clear the API struct
@@ -86,13 +220,17 @@ struct device *z_impl_device_get_binding(const char *name)
 	 * performed. Reserve string comparisons for a fallback.
 	 */
 	for (dev = __device_start; dev != __device_end; dev++) {
-		if (z_device_ready(dev) && (dev->name == name)) {
+		if (dev->name == name &&
+		    deferred_device_resolve(dev) != NULL &&
+		    z_device_ready(dev)) {
 			return dev;
 		}
 	}
 
 	for (dev = __device_start; dev != __device_end; dev++) {
-		if (z_device_ready(dev) && (strcmp(name, dev->name) == 0)) {
+		if (strcmp(name, dev->name) == 0 &&
+		    deferred_device_resolve(dev) != NULL &&
+		    z_device_ready(dev)) {
 			return dev;
 		}
 	}
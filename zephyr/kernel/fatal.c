@@ -13,6 +13,12 @@
 #include <logging/log_ctrl.h>
 #include <logging/log.h>
 #include <fatal.h>
+#ifdef CONFIG_TRACING_FLIGHT_RECORDER
+#include <tracing_core.h>
+#endif
+#ifdef CONFIG_DEBUG_COREDUMP
+#include <debug/coredump.h>
+#endif
 
 LOG_MODULE_DECLARE(os);
 
@@ -99,6 +105,13 @@ void z_fatal_error(unsigned int reason, const z_arch_esf_t *esf)
 	unsigned int key = arch_irq_lock();
 	struct k_thread *thread = k_current_get();
 
+#ifdef CONFIG_TRACING_FLIGHT_RECORDER
+	/* Freeze before anything else runs so the snapshot reflects the
+	 * scheduling history leading up to the fault.
+	 */
+	tracing_flight_recorder_freeze();
+#endif
+
 	/* sanitycheck looks for the "ZEPHYR FATAL ERROR" string, don't
 	 * change it without also updating sanitycheck
 	 */
@@ -120,6 +133,10 @@ void z_fatal_error(unsigned int reason, const z_arch_esf_t *esf)
 	LOG_ERR("Current thread: %p (%s)", thread,
 		log_strdup(thread_name_get(thread)));
 
+#ifdef CONFIG_DEBUG_COREDUMP
+	coredump(reason, esf, thread);
+#endif
+
 	k_sys_fatal_error_handler(reason, esf);
 
 	/* If the system fatal error handler returns, then kill the faulting
@@ -73,6 +73,9 @@ static void set_kernel_idle_time_in_ticks(int32_t ticks)
 static void sys_power_save_idle(void)
 {
 	int32_t ticks = z_get_next_timeout_expiry();
+#ifdef CONFIG_SYS_PM_IDLE_PREDICT
+	uint32_t idle_start = k_cycle_get_32();
+#endif
 
 	/* The documented behavior of CONFIG_TICKLESS_IDLE_THRESH is
 	 * that the system should not enter a tickless idle for
@@ -110,6 +113,14 @@ static void sys_power_save_idle(void)
 #else
 	k_cpu_idle();
 #endif
+
+#ifdef CONFIG_SYS_PM_IDLE_PREDICT
+	/* Execution resumes here once the wakeup interrupt has been
+	 * serviced, so this measures the actual idle period including
+	 * early wakeups the timeout queue did not know about.
+	 */
+	sys_pm_idle_predictor_update(k_cycle_get_32() - idle_start);
+#endif
 }
 #endif
 
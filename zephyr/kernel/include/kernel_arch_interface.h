@@ -255,6 +255,71 @@ static inline bool arch_is_in_isr(void);
  * @retval -ENOMEM Memory for additional paging structures unavailable
  */
 int arch_mem_map(void *dest, uintptr_t addr, size_t size, uint32_t flags);
+
+#ifdef CONFIG_DEMAND_PAGING
+/** Status of a virtual page, as reported by arch_page_location_get() */
+enum arch_page_location {
+	/** The page is mapped to physical memory */
+	ARCH_PAGE_LOCATION_PAGED_IN,
+
+	/** The page is not mapped; its data lives in the backing store */
+	ARCH_PAGE_LOCATION_PAGED_OUT,
+
+	/** The address is not a valid pageable page at all */
+	ARCH_PAGE_LOCATION_BAD
+};
+
+/**
+ * Retrieve the status of a virtual page
+ *
+ * For a paged-in page, *location receives the physical address; for a
+ * paged-out page, the backing store location token that was handed to
+ * arch_mem_page_out() when it was evicted.
+ *
+ * Calls are serialized by the core kernel's paging lock.
+ *
+ * @param addr Page-aligned virtual address
+ * @param location [out] Physical address or backing store location
+ * @return The page's location status
+ */
+enum arch_page_location arch_page_location_get(void *addr,
+					       uintptr_t *location);
+
+/**
+ * Retrieve mapping and dirty state of a resident virtual page
+ *
+ * @param addr Page-aligned virtual address
+ * @param phys [out] Physical address the page is mapped to
+ * @param dirty [out] Whether the page was written since it was last
+ *                    paged in or cleaned
+ * @retval 0 Success
+ * @retval -EFAULT The page is not currently mapped
+ */
+int arch_page_info_get(void *addr, uintptr_t *phys, bool *dirty);
+
+/**
+ * Evict a virtual page from the page tables
+ *
+ * Marks the page non-present and records the backing store location
+ * token in its paging structures so a later fault (and
+ * arch_page_location_get()) can find the data again.  Other CPUs must
+ * no longer see the old mapping on return.
+ *
+ * @param addr Page-aligned virtual address to evict
+ * @param location Backing store location token for the page's data
+ */
+void arch_mem_page_out(void *addr, uintptr_t location);
+
+/**
+ * Map a virtual page to a physical frame after paging its data in
+ *
+ * Restores the access attributes the page was originally mapped with.
+ *
+ * @param addr Page-aligned virtual address
+ * @param phys Physical address of the frame holding the page's data
+ */
+void arch_mem_page_in(void *addr, uintptr_t phys);
+#endif /* CONFIG_DEMAND_PAGING */
 #endif /* CONFIG_MMU */
 /** @} */
 
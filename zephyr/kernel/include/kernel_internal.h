@@ -46,6 +46,21 @@ extern void z_setup_new_thread(struct k_thread *new_thread,
 			      void *p1, void *p2, void *p3,
 			      int prio, uint32_t options, const char *name);
 
+#ifdef CONFIG_THREAD_LOCAL_STORAGE
+/**
+ * @brief Size of the per-thread TLS area, including the control block
+ */
+size_t z_tls_data_size(void);
+
+/**
+ * @brief Initialize a TLS area from the linker-provided templates
+ *
+ * @param tls_area Destination area of at least z_tls_data_size() bytes
+ * @return Thread pointer value to use for TLS accesses
+ */
+uintptr_t z_tls_setup(char *tls_area);
+#endif
+
 static inline void z_new_thread_init(struct k_thread *thread,
 				     char *stack, size_t stack_size)
 {
@@ -77,6 +77,10 @@ GEN_OFFSET_SYM(_thread_t, next_thread);
 GEN_OFFSET_SYM(_thread_t, custom_data);
 #endif
 
+#ifdef CONFIG_THREAD_LOCAL_STORAGE
+GEN_OFFSET_SYM(_thread_t, tls);
+#endif
+
 GEN_ABSOLUTE_SYM(K_THREAD_SIZEOF, sizeof(struct k_thread));
 
 /* size of the device structure. Used by linker scripts */
@@ -16,6 +16,24 @@ extern void z_check_stack_sentinel(void);
 #define z_check_stack_sentinel() /**/
 #endif
 
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+/* We are still running on the outgoing thread's stack here, so the
+ * address of a local variable is a close upper bound for the deepest
+ * stack pointer of this activation.  Record the minimum ever seen; the
+ * sample is a handful of instructions and runs on every swap.
+ */
+static ALWAYS_INLINE void z_stack_watermark_sample(struct k_thread *thread)
+{
+	char marker;
+
+	if ((uintptr_t)&marker < thread->stack_watermark) {
+		thread->stack_watermark = (uintptr_t)&marker;
+	}
+}
+#else
+#define z_stack_watermark_sample(thread) /**/
+#endif
+
 /* In SMP, the irq_lock() is a spinlock which is implicitly released
  * and reacquired on context switch to preserve the existing
  * semantics.  This means that whenever we are about to return to a
@@ -72,6 +90,7 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 	old_thread = _current;
 
 	z_check_stack_sentinel();
+	z_stack_watermark_sample(old_thread);
 
 	if (is_spinlock) {
 		k_spin_release(lock);
@@ -155,6 +174,7 @@ static inline int z_swap_irqlock(unsigned int key)
 {
 	int ret;
 	z_check_stack_sentinel();
+	z_stack_watermark_sample(_current);
 #ifndef CONFIG_ARM
 	sys_trace_thread_switched_out();
 #endif
@@ -202,6 +222,12 @@ static inline void z_dummy_thread_init(struct k_thread *dummy_thread)
 	dummy_thread->stack_info.start = 0U;
 	dummy_thread->stack_info.size = 0U;
 #endif
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+	/* A zero watermark compares below any real stack pointer, so
+	 * the dummy thread is never sampled.
+	 */
+	dummy_thread->stack_watermark = 0U;
+#endif
 #ifdef CONFIG_USERSPACE
 	dummy_thread->mem_domain_info.mem_domain = 0;
 #endif
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_KERNEL_INCLUDE_MMU_H_
+#define ZEPHYR_KERNEL_INCLUDE_MMU_H_
+
+#ifdef CONFIG_DEMAND_PAGING
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <zephyr/types.h>
+#include <sys/util.h>
+
+/* Bookkeeping for each page-sized frame of physical RAM: which
+ * virtual page it currently backs and whether paging code may touch
+ * it.  All demand paging state is protected by the mm_lock in mmu.c.
+ */
+struct z_page_frame {
+	/* Virtual page this frame backs, or NULL if the frame is free */
+	void *addr;
+
+	uint8_t flags;
+};
+
+/* Frame may never be paged out or reclaimed (kernel image, page
+ * tables, DMA buffers, ...)
+ */
+#define Z_PAGE_FRAME_RESERVED	BIT(0)
+
+/* Frame contents were pinned with k_mem_pin() */
+#define Z_PAGE_FRAME_PINNED	BIT(1)
+
+#define Z_NUM_PAGE_FRAMES	(KB((size_t)CONFIG_SRAM_SIZE) / \
+				 CONFIG_MMU_PAGE_SIZE)
+
+extern struct z_page_frame z_page_frames[Z_NUM_PAGE_FRAMES];
+
+static inline uintptr_t z_page_frame_to_phys(struct z_page_frame *pf)
+{
+	return (uintptr_t)CONFIG_SRAM_BASE_ADDRESS +
+	       (uintptr_t)(pf - z_page_frames) * CONFIG_MMU_PAGE_SIZE;
+}
+
+static inline struct z_page_frame *z_phys_to_page_frame(uintptr_t phys)
+{
+	return &z_page_frames[(phys - CONFIG_SRAM_BASE_ADDRESS) /
+			      CONFIG_MMU_PAGE_SIZE];
+}
+
+/*
+ * Backing store driver API, implemented by the board or subsystem
+ * providing the swap device (flash partition, host file, ...).
+ * "location" tokens are opaque to the kernel; the driver encodes
+ * whatever it needs to find the data again.
+ */
+
+/* Reserve a backing store location for the contents of pf.
+ * Returns 0 and a location token, or -ENOMEM if the store is full.
+ */
+int z_backing_store_location_get(struct z_page_frame *pf,
+				 uintptr_t *location);
+
+/* Release a backing store location obtained from
+ * z_backing_store_location_get() once its data has been paged back in
+ */
+void z_backing_store_location_free(uintptr_t location);
+
+/* Copy one page of RAM at phys out to the backing store location */
+void z_backing_store_page_out(uintptr_t location, uintptr_t phys);
+
+/* Copy the page stored at location into RAM at phys */
+void z_backing_store_page_in(uintptr_t location, uintptr_t phys);
+
+/*
+ * Eviction algorithm API.  The algorithm tracks page accesses however
+ * it likes (arch accessed bits, FIFO, ...) and recommends victims.
+ */
+
+/* Return the page frame to evict next, or NULL if every frame is
+ * reserved or pinned.  Sets *dirty if the frame's contents have been
+ * modified since they were last written to the backing store and so
+ * must be written back before the frame is reused.
+ */
+struct z_page_frame *z_eviction_select(bool *dirty);
+
+/* Called by arch fault handlers on an access to a non-present page.
+ * Returns true if the fault was resolved by paging the data back in,
+ * in which case the faulting instruction should be retried, or false
+ * if addr is simply not a valid pageable address.
+ */
+bool z_page_fault(void *addr);
+
+#endif /* CONFIG_DEMAND_PAGING */
+#endif /* ZEPHYR_KERNEL_INCLUDE_MMU_H_ */
@@ -66,6 +66,11 @@
 
 #define _thread_offset_to_stack_start \
 	(___thread_t_stack_info_OFFSET + ___thread_stack_info_t_start_OFFSET)
+
+#ifdef CONFIG_THREAD_LOCAL_STORAGE
+#define _thread_offset_to_tls \
+	(___thread_t_tls_OFFSET)
+#endif
 /* end - threads */
 
 #endif /* ZEPHYR_KERNEL_INCLUDE_OFFSETS_SHORT_H_ */
@@ -8,13 +8,171 @@
 #include <ksched.h>
 #include <wait_q.h>
 #include <init.h>
+#include <string.h>
 
 void k_heap_init(struct k_heap *h, void *mem, size_t bytes)
 {
 	z_waitq_init(&h->wait_q);
 	sys_heap_init(&h->heap, mem, bytes);
+#ifdef CONFIG_KHEAP_MAGAZINE
+	(void)memset(h->magazine, 0, sizeof(h->magazine));
+#endif
 }
 
+#ifdef CONFIG_KHEAP_MAGAZINE
+/* Per-CPU magazines of freed blocks layered over the shared heap, so
+ * the common small alloc/free pair never touches h->lock.  Blocks are
+ * filed by power-of-two size class; a block in class c has a usable
+ * size in [16 << c, 32 << c), so any request the class admits fits in
+ * any block the class holds.
+ */
+#define MAG_MIN_SHIFT 4
+#define MAG_MAX_SIZE  (BIT(MAG_MIN_SHIFT + K_HEAP_MAG_CLASSES - 1))
+
+static inline struct k_heap_magazine *mag_local(struct k_heap *h)
+{
+#ifdef CONFIG_SMP
+	/* Racy by design: migrating between this read and taking the
+	 * magazine lock just lands us in a peer's (equally valid)
+	 * magazine.
+	 */
+	return &h->magazine[arch_curr_cpu()->id];
+#else
+	return &h->magazine[0];
+#endif
+}
+
+/* Smallest class whose blocks satisfy a request, or -1 */
+static int mag_alloc_class(size_t bytes)
+{
+	for (int c = 0; c < K_HEAP_MAG_CLASSES; c++) {
+		if (bytes <= (BIT(MAG_MIN_SHIFT) << c)) {
+			return c;
+		}
+	}
+	return -1;
+}
+
+/* Largest class a freed block may be filed under, or -1 */
+static int mag_free_class(size_t usable)
+{
+	if (usable < BIT(MAG_MIN_SHIFT) || usable >= 2 * MAG_MAX_SIZE) {
+		return -1;
+	}
+	for (int c = K_HEAP_MAG_CLASSES - 1; c >= 0; c--) {
+		if (usable >= (BIT(MAG_MIN_SHIFT) << c)) {
+			return c;
+		}
+	}
+	return -1;
+}
+
+static void *mag_pop(struct k_heap *h, size_t bytes)
+{
+	int c = mag_alloc_class(bytes);
+	struct k_heap_magazine *mag;
+	void *ret = NULL;
+
+	if (c < 0) {
+		return NULL;
+	}
+
+	mag = mag_local(h);
+
+	k_spinlock_key_t key = k_spin_lock(&mag->lock);
+
+	if (mag->count[c] > 0U) {
+		ret = mag->rounds[c][--mag->count[c]];
+	}
+	k_spin_unlock(&mag->lock, key);
+	return ret;
+}
+
+/* Return a batch of blocks to the heap proper, waking any waiters */
+static void mag_spill(struct k_heap *h, void **blocks, int n)
+{
+	k_spinlock_key_t key = k_spin_lock(&h->lock);
+
+	for (int i = 0; i < n; i++) {
+		sys_heap_free(&h->heap, blocks[i]);
+	}
+
+	if (z_unpend_all(&h->wait_q) != 0) {
+		z_reschedule(&h->lock, key);
+	} else {
+		k_spin_unlock(&h->lock, key);
+	}
+}
+
+static bool mag_push(struct k_heap *h, void *mem)
+{
+	/* Safe without h->lock: only header fields of a chunk we own
+	 * are read
+	 */
+	int c = mag_free_class(sys_heap_usable_size(&h->heap, mem));
+	struct k_heap_magazine *mag;
+	void *spill[CONFIG_KHEAP_MAGAZINE_DEPTH / 2];
+	int nspill = 0;
+
+	/* Waiters need the block in the heap, not parked in a cache */
+	if ((c < 0) || (z_waitq_head(&h->wait_q) != NULL)) {
+		return false;
+	}
+
+	mag = mag_local(h);
+
+	k_spinlock_key_t key = k_spin_lock(&mag->lock);
+
+	if (mag->count[c] == CONFIG_KHEAP_MAGAZINE_DEPTH) {
+		/* Full: batch half back to the heap (outside the
+		 * magazine lock, to keep lock ordering one-way) so the
+		 * next few frees stay on the fast path
+		 */
+		while (nspill < (int)ARRAY_SIZE(spill)) {
+			spill[nspill++] = mag->rounds[c][--mag->count[c]];
+		}
+	}
+	mag->rounds[c][mag->count[c]++] = mem;
+	k_spin_unlock(&mag->lock, key);
+
+	if (nspill > 0) {
+		mag_spill(h, spill, nspill);
+	}
+	return true;
+}
+
+/* Drain every CPU's magazine into the heap; called (without h->lock)
+ * when an allocation finds the heap empty.  Returns true if any block
+ * was recovered.
+ */
+static bool mag_flush(struct k_heap *h)
+{
+	void *spill[CONFIG_KHEAP_MAGAZINE_DEPTH];
+	bool recovered = false;
+
+	for (int cpu = 0; cpu < CONFIG_MP_NUM_CPUS; cpu++) {
+		struct k_heap_magazine *mag = &h->magazine[cpu];
+
+		for (int c = 0; c < K_HEAP_MAG_CLASSES; c++) {
+			int n = 0;
+
+			k_spinlock_key_t key = k_spin_lock(&mag->lock);
+
+			while (mag->count[c] > 0U) {
+				spill[n++] = mag->rounds[c][--mag->count[c]];
+			}
+			k_spin_unlock(&mag->lock, key);
+
+			if (n > 0) {
+				mag_spill(h, spill, n);
+				recovered = true;
+			}
+		}
+	}
+	return recovered;
+}
+#endif /* CONFIG_KHEAP_MAGAZINE */
+
 static int statics_init(struct device *unused)
 {
 	ARG_UNUSED(unused);
@@ -30,13 +188,34 @@ void *k_heap_alloc(struct k_heap *h, size_t bytes, k_timeout_t timeout)
 {
 	int64_t now, end = z_timeout_end_calc(timeout);
 	void *ret = NULL;
-	k_spinlock_key_t key = k_spin_lock(&h->lock);
 
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
+#ifdef CONFIG_KHEAP_MAGAZINE
+	ret = mag_pop(h, bytes);
+	if (ret != NULL) {
+		return ret;
+	}
+#endif
+
+	k_spinlock_key_t key = k_spin_lock(&h->lock);
+
 	while (ret == NULL) {
 		ret = sys_heap_alloc(&h->heap, bytes);
 
+#ifdef CONFIG_KHEAP_MAGAZINE
+		if (ret == NULL) {
+			k_spin_unlock(&h->lock, key);
+
+			bool recovered = mag_flush(h);
+
+			key = k_spin_lock(&h->lock);
+			if (recovered) {
+				continue;
+			}
+		}
+#endif
+
 		now = z_tick_get();
 		if ((ret != NULL) || ((end - now) <= 0)) {
 			break;
@@ -53,6 +232,12 @@ void *k_heap_alloc(struct k_heap *h, size_t bytes, k_timeout_t timeout)
 
 void k_heap_free(struct k_heap *h, void *mem)
 {
+#ifdef CONFIG_KHEAP_MAGAZINE
+	if ((mem != NULL) && mag_push(h, mem)) {
+		return;
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&h->lock);
 
 	sys_heap_free(&h->heap, mem);
@@ -64,6 +249,18 @@ void k_heap_free(struct k_heap *h, void *mem)
 	}
 }
 
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+void k_heap_runtime_stats_get(struct k_heap *h,
+			      struct sys_heap_runtime_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&h->lock);
+
+	sys_heap_runtime_stats_get(&h->heap, stats);
+
+	k_spin_unlock(&h->lock, key);
+}
+#endif
+
 #ifdef CONFIG_MEM_POOL_HEAP_BACKEND
 /* Compatibility layer for legacy k_mem_pool code on top of a k_heap
  * backend.
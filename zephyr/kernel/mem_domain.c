@@ -110,6 +110,9 @@ void k_mem_domain_init(struct k_mem_domain *domain, uint8_t num_parts,
 
 	domain->num_partitions = 0U;
 	(void)memset(domain->partitions, 0, sizeof(domain->partitions));
+#ifdef CONFIG_ARCH_MEM_DOMAIN_DATA
+	(void)memset(&domain->arch, 0, sizeof(domain->arch));
+#endif
 
 	if (num_parts != 0U) {
 		uint32_t i;
@@ -17,6 +17,62 @@
 
 static struct k_spinlock lock;
 
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+/* The free list is kept as a linked stack of block indices, with the
+ * head packed into a single atomic word: block index in the low
+ * half-word, a tag incremented on every update in the high half-word
+ * so that a pop/repush of the same block between a competitor's read
+ * and its compare-and-swap can't go unnoticed (the ABA problem).
+ * Each free block stores the index of its successor in its first two
+ * bytes.
+ */
+#define SLAB_LIST_END	0xffffU
+#define SLAB_IDX_MASK	0xffffU
+#define SLAB_TAG_MASK	0xffff0000U
+#define SLAB_TAG_INC	0x10000U
+
+static inline char *slab_block(struct k_mem_slab *slab, uint32_t idx)
+{
+	return slab->buffer + idx * slab->block_size;
+}
+
+static int slab_pop(struct k_mem_slab *slab, void **mem)
+{
+	atomic_val_t old, new;
+	uint32_t idx;
+
+	do {
+		old = atomic_get(&slab->free_head);
+		idx = (uint32_t)old & SLAB_IDX_MASK;
+		if (idx == SLAB_LIST_END) {
+			return -ENOMEM;
+		}
+
+		/* Reading the successor index from a block we don't yet
+		 * own is safe: if the block is claimed meanwhile, the
+		 * tag has changed and the CAS below fails.
+		 */
+		new = (((uint32_t)old + SLAB_TAG_INC) & SLAB_TAG_MASK) |
+		      *(uint16_t *)slab_block(slab, idx);
+	} while (!atomic_cas(&slab->free_head, old, new));
+
+	*mem = slab_block(slab, idx);
+	return 0;
+}
+
+static void slab_push(struct k_mem_slab *slab, void *mem)
+{
+	uint32_t idx = ((char *)mem - slab->buffer) / slab->block_size;
+	atomic_val_t old, new;
+
+	do {
+		old = atomic_get(&slab->free_head);
+		*(uint16_t *)mem = (uint16_t)((uint32_t)old & SLAB_IDX_MASK);
+		new = (((uint32_t)old + SLAB_TAG_INC) & SLAB_TAG_MASK) | idx;
+	} while (!atomic_cas(&slab->free_head, old, new));
+}
+#endif /* CONFIG_MEM_SLAB_LOCKFREE */
+
 #ifdef CONFIG_OBJECT_TRACING
 struct k_mem_slab *_trace_list_k_mem_slab;
 #endif	/* CONFIG_OBJECT_TRACING */
@@ -40,6 +96,23 @@ static int create_free_list(struct k_mem_slab *slab)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	CHECKIF(slab->num_blocks >= SLAB_LIST_END) {
+		return -EINVAL;
+	}
+
+	/* Chain the blocks by index; the last one ends the list */
+	p = slab->buffer;
+	for (j = 0U; j < slab->num_blocks; j++) {
+		*(uint16_t *)p = (j + 1U == slab->num_blocks)
+			? SLAB_LIST_END : (uint16_t)(j + 1U);
+		p += slab->block_size;
+	}
+
+	slab->free_list = NULL;
+	slab->free_head = (slab->num_blocks > 0U) ? 0 : SLAB_LIST_END;
+	slab->waiters = 0;
+#else
 	slab->free_list = NULL;
 	p = slab->buffer;
 
@@ -48,6 +121,7 @@ static int create_free_list(struct k_mem_slab *slab)
 		slab->free_list = p;
 		p += slab->block_size;
 	}
+#endif
 	return 0;
 }
 
@@ -88,6 +162,7 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->block_size = block_size;
 	slab->buffer = buffer;
 	slab->num_used = 0U;
+	slab->max_used = 0U;
 	rc = create_free_list(slab);
 	if (rc < 0) {
 		goto out;
@@ -101,8 +176,60 @@ out:
 	return rc;
 }
 
+/* Track the occupancy high watermark on the allocation path. Under SMP
+ * a racing allocation can make the stored peak lag by the width of the
+ * race, which is fine for a sizing statistic and keeps the cost to a
+ * compare and a store.
+ */
+static inline void slab_update_max_used(struct k_mem_slab *slab)
+{
+	uint32_t used = (uint32_t)slab->num_used;
+
+	if (used > slab->max_used) {
+		slab->max_used = used;
+	}
+}
+
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	k_spinlock_key_t key;
+	int result;
+
+	/* Fast path: a handful of instructions, safe from any context */
+	if (slab_pop(slab, mem) == 0) {
+		atomic_inc(&slab->num_used);
+		slab_update_max_used(slab);
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		*mem = NULL;
+		return -ENOMEM;
+	}
+
+	/* Slow path: wait for a free block or timeout.  The waiter
+	 * count is raised under the lock and re-checked against the
+	 * free list so a concurrent free can't slip between the failed
+	 * pop above and the pend below.
+	 */
+	key = k_spin_lock(&lock);
+	atomic_inc(&slab->waiters);
+	if (slab_pop(slab, mem) == 0) {
+		atomic_dec(&slab->waiters);
+		atomic_inc(&slab->num_used);
+		slab_update_max_used(slab);
+		k_spin_unlock(&lock, key);
+		return 0;
+	}
+
+	result = z_pend_curr(&lock, key, &slab->wait_q, timeout);
+	atomic_dec(&slab->waiters);
+	if (result == 0) {
+		*mem = _current->base.swap_data;
+	}
+	return result;
+#else
 	k_spinlock_key_t key = k_spin_lock(&lock);
 	int result;
 
@@ -111,6 +238,7 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 		*mem = slab->free_list;
 		slab->free_list = *(char **)(slab->free_list);
 		slab->num_used++;
+		slab_update_max_used(slab);
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 		/* don't wait for a free block to become available */
@@ -128,10 +256,40 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 	k_spin_unlock(&lock, key);
 
 	return result;
+#endif /* CONFIG_MEM_SLAB_LOCKFREE */
 }
 
 void k_mem_slab_free(struct k_mem_slab *slab, void **mem)
 {
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	slab_push(slab, *mem);
+	atomic_dec(&slab->num_used);
+
+	/* A waiter announces itself before its final re-check of the
+	 * free list, so if one raced with the push above we will see
+	 * it here and hand a block over under the lock.
+	 */
+	if (atomic_get(&slab->waiters) != 0) {
+		k_spinlock_key_t key = k_spin_lock(&lock);
+		void *block;
+
+		if (slab_pop(slab, &block) == 0) {
+			struct k_thread *pending_thread =
+				z_unpend_first_thread(&slab->wait_q);
+
+			if (pending_thread != NULL) {
+				atomic_inc(&slab->num_used);
+				z_thread_return_value_set_with_data(
+					pending_thread, 0, block);
+				z_ready_thread(pending_thread);
+				z_reschedule(&lock, key);
+				return;
+			}
+			slab_push(slab, block);
+		}
+		k_spin_unlock(&lock, key);
+	}
+#else
 	k_spinlock_key_t key = k_spin_lock(&lock);
 	struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
 
@@ -145,4 +303,5 @@ void k_mem_slab_free(struct k_mem_slab *slab, void **mem)
 		slab->num_used--;
 		k_spin_unlock(&lock, key);
 	}
+#endif /* CONFIG_MEM_SLAB_LOCKFREE */
 }
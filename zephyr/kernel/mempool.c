@@ -47,6 +47,96 @@ void k_free(void *ptr)
 	}
 }
 
+#if defined(CONFIG_MALLOC_RT)
+
+/*
+ * Bounded-latency allocator built on preallocated size-class slabs.
+ *
+ * Unlike the heap memory pool, whose worst case grows with fragmentation,
+ * every operation here is a constant-time slab alloc/free plus a scan of
+ * the (small, fixed) class table. Each block is prefixed by a hidden
+ * pointer to its owning slab, mirroring the block descriptor that
+ * k_mem_pool_malloc() hides at the start of its blocks, so k_free_rt()
+ * can return the block without being told its size.
+ */
+
+#define MALLOC_RT_HDR_SIZE WB_UP(sizeof(struct k_mem_slab *))
+
+#define MALLOC_RT_SLAB(size) \
+	K_MEM_SLAB_DEFINE(malloc_rt_slab_##size, \
+			  (size) + MALLOC_RT_HDR_SIZE, \
+			  CONFIG_MALLOC_RT_NUM_BLOCKS_##size, \
+			  sizeof(void *))
+
+MALLOC_RT_SLAB(16);
+MALLOC_RT_SLAB(32);
+MALLOC_RT_SLAB(64);
+MALLOC_RT_SLAB(128);
+MALLOC_RT_SLAB(256);
+
+/* Ascending block size order; k_malloc_rt() takes the first fit and
+ * spills into the next larger class when a pool is exhausted.
+ */
+static struct k_mem_slab *const malloc_rt_classes[] = {
+	&malloc_rt_slab_16,
+	&malloc_rt_slab_32,
+	&malloc_rt_slab_64,
+	&malloc_rt_slab_128,
+	&malloc_rt_slab_256,
+};
+
+void *k_malloc_rt(size_t size)
+{
+	for (int i = 0; i < ARRAY_SIZE(malloc_rt_classes); i++) {
+		struct k_mem_slab *slab = malloc_rt_classes[i];
+		void *mem;
+
+		if (size > slab->block_size - MALLOC_RT_HDR_SIZE) {
+			continue;
+		}
+
+		if (k_mem_slab_alloc(slab, &mem, K_NO_WAIT) == 0) {
+			/* save the owning slab at the start of the block */
+			*(struct k_mem_slab **)mem = slab;
+
+			return (char *)mem + MALLOC_RT_HDR_SIZE;
+		}
+	}
+
+	return NULL;
+}
+
+void k_free_rt(void *ptr)
+{
+	if (ptr != NULL) {
+		/* point to hidden slab pointer at start of block */
+		void *mem = (char *)ptr - MALLOC_RT_HDR_SIZE;
+		struct k_mem_slab *slab = *(struct k_mem_slab **)mem;
+
+		k_mem_slab_free(slab, &mem);
+	}
+}
+
+int k_malloc_rt_stats_get(unsigned int class_idx,
+			  struct k_malloc_rt_stats *stats)
+{
+	struct k_mem_slab *slab;
+
+	if (class_idx >= ARRAY_SIZE(malloc_rt_classes)) {
+		return -EINVAL;
+	}
+
+	slab = malloc_rt_classes[class_idx];
+	stats->block_size = slab->block_size - MALLOC_RT_HDR_SIZE;
+	stats->num_blocks = slab->num_blocks;
+	stats->num_used = k_mem_slab_num_used_get(slab);
+	stats->max_used = k_mem_slab_max_used_get(slab);
+
+	return 0;
+}
+
+#endif /* CONFIG_MALLOC_RT */
+
 #if (CONFIG_HEAP_MEM_POOL_SIZE > 0)
 
 /*
@@ -9,6 +9,9 @@
  #include <stdint.h>
  #include <kernel_arch_interface.h>
  #include <spinlock.h>
+#include <errno.h>
+#include <mmu.h>
+#include <linker/linker-defs.h>
 
 #define LOG_LEVEL CONFIG_KERNEL_LOG_LEVEL
 #include <logging/log.h>
@@ -81,3 +84,234 @@ fail:
 		phys_addr, size, flags);
 	k_panic();
 }
+
+#ifdef CONFIG_DEMAND_PAGING
+/* Demand paging: pages evicted from RAM live in a backing store and
+ * are faulted back in on access.  The frame table, the backing store
+ * driver and the eviction algorithm are tied together here; all state
+ * is serialized by mm_lock, including the arch paging calls.
+ */
+
+struct z_page_frame z_page_frames[Z_NUM_PAGE_FRAMES];
+
+static bool frames_ready;
+
+/* Frames holding the kernel image itself can never be reclaimed */
+static void page_frames_init(void)
+{
+	uintptr_t start = ROUND_DOWN((uintptr_t)&_image_ram_start,
+				     CONFIG_MMU_PAGE_SIZE);
+	uintptr_t end = ROUND_UP((uintptr_t)&_image_ram_end,
+				 CONFIG_MMU_PAGE_SIZE);
+
+	for (size_t i = 0; i < Z_NUM_PAGE_FRAMES; i++) {
+		uintptr_t phys = z_page_frame_to_phys(&z_page_frames[i]);
+
+		if (phys >= start && phys < end) {
+			z_page_frames[i].addr = (void *)phys;
+			z_page_frames[i].flags = Z_PAGE_FRAME_RESERVED;
+		}
+	}
+	frames_ready = true;
+}
+
+static struct z_page_frame *free_frame_get(void)
+{
+	for (size_t i = 0; i < Z_NUM_PAGE_FRAMES; i++) {
+		if (z_page_frames[i].flags == 0U &&
+		    z_page_frames[i].addr == NULL) {
+			return &z_page_frames[i];
+		}
+	}
+	return NULL;
+}
+
+/* Evict the contents of a mapped page to the backing store and mark
+ * its frame free.  Returns 0, or -ENOMEM if the store is full.
+ */
+static int page_frame_evict(struct z_page_frame *pf, bool dirty)
+{
+	uintptr_t location;
+	int ret;
+
+	ret = z_backing_store_location_get(pf, &location);
+	if (ret != 0) {
+		return ret;
+	}
+
+	arch_mem_page_out(pf->addr, location);
+	if (dirty) {
+		z_backing_store_page_out(location, z_page_frame_to_phys(pf));
+	}
+	pf->addr = NULL;
+	return 0;
+}
+
+/* Obtain a frame to satisfy a fault, evicting a victim if no frame is
+ * free.  Returns NULL only if every frame is reserved or pinned, or
+ * the backing store is full.
+ */
+static struct z_page_frame *page_frame_obtain(void)
+{
+	struct z_page_frame *pf = free_frame_get();
+	bool dirty;
+
+	if (pf != NULL) {
+		return pf;
+	}
+
+	pf = z_eviction_select(&dirty);
+	if (pf == NULL || page_frame_evict(pf, dirty) != 0) {
+		return NULL;
+	}
+	return pf;
+}
+
+bool z_page_fault(void *addr)
+{
+	uintptr_t location, phys;
+	struct z_page_frame *pf;
+	bool ret = false;
+	k_spinlock_key_t key = k_spin_lock(&mm_lock);
+
+	addr = (void *)ROUND_DOWN((uintptr_t)addr, CONFIG_MMU_PAGE_SIZE);
+
+	if (!frames_ready) {
+		page_frames_init();
+	}
+
+	switch (arch_page_location_get(addr, &location)) {
+	case ARCH_PAGE_LOCATION_PAGED_IN:
+		/* Raced with another CPU faulting the same page in;
+		 * nothing left to do but retry the access
+		 */
+		ret = true;
+		goto out;
+	case ARCH_PAGE_LOCATION_PAGED_OUT:
+		break;
+	case ARCH_PAGE_LOCATION_BAD:
+	default:
+		goto out;
+	}
+
+	pf = page_frame_obtain();
+	if (pf == NULL) {
+		goto out;
+	}
+
+	phys = z_page_frame_to_phys(pf);
+	z_backing_store_page_in(location, phys);
+	arch_mem_page_in(addr, phys);
+	z_backing_store_location_free(location);
+	pf->addr = addr;
+	ret = true;
+out:
+	k_spin_unlock(&mm_lock, key);
+	return ret;
+}
+
+static int page_out_locked(void *addr)
+{
+	uintptr_t phys;
+	bool dirty;
+	struct z_page_frame *pf;
+
+	if (arch_page_info_get(addr, &phys, &dirty) != 0) {
+		/* Already paged out: nothing to do */
+		return 0;
+	}
+
+	pf = z_phys_to_page_frame(phys);
+	if ((pf->flags & (Z_PAGE_FRAME_RESERVED | Z_PAGE_FRAME_PINNED))
+	    != 0U) {
+		return -EINVAL;
+	}
+
+	return page_frame_evict(pf, dirty);
+}
+
+int k_mem_page_out(void *addr, size_t size)
+{
+	int ret = 0;
+	k_spinlock_key_t key = k_spin_lock(&mm_lock);
+
+	__ASSERT(((uintptr_t)addr % CONFIG_MMU_PAGE_SIZE) == 0U, "");
+	__ASSERT((size % CONFIG_MMU_PAGE_SIZE) == 0U, "");
+
+	if (!frames_ready) {
+		page_frames_init();
+	}
+
+	for (size_t offset = 0; offset < size;
+	     offset += CONFIG_MMU_PAGE_SIZE) {
+		ret = page_out_locked((uint8_t *)addr + offset);
+		if (ret != 0) {
+			break;
+		}
+	}
+
+	k_spin_unlock(&mm_lock, key);
+	return ret;
+}
+
+/* Fault pages resident, optionally pinning their frames */
+static int page_in_region(void *addr, size_t size, uint8_t pin_flag)
+{
+	__ASSERT(((uintptr_t)addr % CONFIG_MMU_PAGE_SIZE) == 0U, "");
+	__ASSERT((size % CONFIG_MMU_PAGE_SIZE) == 0U, "");
+
+	for (size_t offset = 0; offset < size;
+	     offset += CONFIG_MMU_PAGE_SIZE) {
+		void *page = (uint8_t *)addr + offset;
+		uintptr_t phys;
+		bool dirty;
+
+		if (arch_page_info_get(page, &phys, &dirty) != 0 &&
+		    !z_page_fault(page)) {
+			return -EFAULT;
+		}
+
+		if (pin_flag != 0U) {
+			k_spinlock_key_t key = k_spin_lock(&mm_lock);
+
+			if (arch_page_info_get(page, &phys, &dirty) == 0) {
+				z_phys_to_page_frame(phys)->flags |= pin_flag;
+			}
+			k_spin_unlock(&mm_lock, key);
+		}
+	}
+	return 0;
+}
+
+int k_mem_page_in(void *addr, size_t size)
+{
+	return page_in_region(addr, size, 0U);
+}
+
+int k_mem_pin(void *addr, size_t size)
+{
+	return page_in_region(addr, size, Z_PAGE_FRAME_PINNED);
+}
+
+void k_mem_unpin(void *addr, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&mm_lock);
+
+	__ASSERT(((uintptr_t)addr % CONFIG_MMU_PAGE_SIZE) == 0U, "");
+	__ASSERT((size % CONFIG_MMU_PAGE_SIZE) == 0U, "");
+
+	for (size_t offset = 0; offset < size;
+	     offset += CONFIG_MMU_PAGE_SIZE) {
+		uintptr_t phys;
+		bool dirty;
+
+		if (arch_page_info_get((uint8_t *)addr + offset, &phys,
+				       &dirty) == 0) {
+			z_phys_to_page_frame(phys)->flags &=
+				~Z_PAGE_FRAME_PINNED;
+		}
+	}
+
+	k_spin_unlock(&mm_lock, key);
+}
+#endif /* CONFIG_DEMAND_PAGING */
@@ -65,6 +65,136 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	z_object_init(msgq);
 }
 
+#ifdef CONFIG_MSGQ_MPSC
+/* In MPSC mode each ring slot carries an atomic sequence word ahead of
+ * the payload.  Producers reserve a slot by advancing mpsc_head with a
+ * compare-and-swap and publish it by bumping the slot sequence; they
+ * never take the queue lock, so an ISR enqueue can't spin on another
+ * CPU's critical section.  The single consumer drains slots in order
+ * and only takes the lock to sleep when the ring is empty.
+ */
+
+static inline atomic_t *mpsc_slot(struct k_msgq *msgq, uint32_t pos)
+{
+	return (atomic_t *)(msgq->buffer_start +
+			    (pos % msgq->max_msgs) *
+			    K_MSGQ_MPSC_SLOT_SIZE(msgq->msg_size));
+}
+
+void k_msgq_init_mpsc(struct k_msgq *msgq, char *buffer, size_t msg_size,
+		      uint32_t max_msgs)
+{
+	k_msgq_init(msgq, buffer, msg_size, max_msgs);
+	msgq->buffer_end = buffer + K_MSGQ_MPSC_BUF_SIZE(msg_size, max_msgs);
+	msgq->flags = K_MSGQ_FLAG_MPSC;
+	msgq->mpsc_head = 0;
+	msgq->mpsc_tail = 0;
+	msgq->mpsc_waiting = 0;
+
+	for (uint32_t i = 0; i < max_msgs; i++) {
+		atomic_set(mpsc_slot(msgq, i), i);
+	}
+}
+
+static int mpsc_put(struct k_msgq *msgq, void *data)
+{
+	uint32_t pos;
+	atomic_t *slot;
+
+	for (;;) {
+		pos = (uint32_t)atomic_get(&msgq->mpsc_head);
+		slot = mpsc_slot(msgq, pos);
+
+		int32_t dif = (int32_t)((uint32_t)atomic_get(slot) - pos);
+
+		if (dif == 0) {
+			if (atomic_cas(&msgq->mpsc_head, pos, pos + 1)) {
+				break;
+			}
+		} else if (dif < 0) {
+			/* ring full */
+			return -ENOMSG;
+		}
+		/* else: another producer claimed this slot, retry */
+	}
+
+	(void)memcpy((char *)slot + sizeof(atomic_t), data, msgq->msg_size);
+	atomic_set(slot, pos + 1);	/* publish */
+
+	/* Only an empty-ring consumer ever sets mpsc_waiting, so the
+	 * lock below is uncontended on the line-rate path.
+	 */
+	if (atomic_get(&msgq->mpsc_waiting) != 0) {
+		k_spinlock_key_t key = k_spin_lock(&msgq->lock);
+		struct k_thread *pending_thread =
+			z_unpend_first_thread(&msgq->wait_q);
+
+		atomic_clear(&msgq->mpsc_waiting);
+		if (pending_thread != NULL) {
+			arch_thread_return_value_set(pending_thread, 0);
+			z_ready_thread(pending_thread);
+			z_reschedule(&msgq->lock, key);
+			return 0;
+		}
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return 0;
+}
+
+static int mpsc_try_get(struct k_msgq *msgq, void *data)
+{
+	uint32_t pos = msgq->mpsc_tail;
+	atomic_t *slot = mpsc_slot(msgq, pos);
+
+	if ((uint32_t)atomic_get(slot) != pos + 1) {
+		/* next slot not yet published */
+		return -ENOMSG;
+	}
+
+	(void)memcpy(data, (char *)slot + sizeof(atomic_t), msgq->msg_size);
+	atomic_set(slot, pos + msgq->max_msgs);	/* recycle */
+	msgq->mpsc_tail = pos + 1;
+
+	return 0;
+}
+
+static int mpsc_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
+{
+	for (;;) {
+		int ret;
+
+		if (mpsc_try_get(msgq, data) == 0) {
+			return 0;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -ENOMSG;
+		}
+
+		k_spinlock_key_t key = k_spin_lock(&msgq->lock);
+
+		/* Announce we're going to sleep, then re-check: a
+		 * producer publishing after the check below is
+		 * guaranteed to see mpsc_waiting set and wake us.
+		 */
+		atomic_set(&msgq->mpsc_waiting, 1);
+		if (mpsc_try_get(msgq, data) == 0) {
+			atomic_clear(&msgq->mpsc_waiting);
+			k_spin_unlock(&msgq->lock, key);
+			return 0;
+		}
+
+		ret = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		if (ret != 0) {
+			/* timed out */
+			atomic_clear(&msgq->mpsc_waiting);
+			return ret;
+		}
+	}
+}
+#endif /* CONFIG_MSGQ_MPSC */
+
 int z_impl_k_msgq_alloc_init(struct k_msgq *msgq, size_t msg_size,
 			    uint32_t max_msgs)
 {
@@ -121,6 +251,14 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 	k_spinlock_key_t key;
 	int result;
 
+#ifdef CONFIG_MSGQ_MPSC
+	if ((msgq->flags & K_MSGQ_FLAG_MPSC) != 0) {
+		/* MPSC producers never block */
+		ARG_UNUSED(timeout);
+		return mpsc_put(msgq, data);
+	}
+#endif
+
 	key = k_spin_lock(&msgq->lock);
 
 	if (msgq->used_msgs < msgq->max_msgs) {
@@ -175,6 +313,13 @@ void z_impl_k_msgq_get_attrs(struct k_msgq *msgq, struct k_msgq_attrs *attrs)
 {
 	attrs->msg_size = msgq->msg_size;
 	attrs->max_msgs = msgq->max_msgs;
+#ifdef CONFIG_MSGQ_MPSC
+	if ((msgq->flags & K_MSGQ_FLAG_MPSC) != 0) {
+		attrs->used_msgs = (uint32_t)atomic_get(&msgq->mpsc_head) -
+				   msgq->mpsc_tail;
+		return;
+	}
+#endif
 	attrs->used_msgs = msgq->used_msgs;
 }
 
@@ -197,6 +342,12 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 	struct k_thread *pending_thread;
 	int result;
 
+#ifdef CONFIG_MSGQ_MPSC
+	if ((msgq->flags & K_MSGQ_FLAG_MPSC) != 0) {
+		return mpsc_get(msgq, data, timeout);
+	}
+#endif
+
 	key = k_spin_lock(&msgq->lock);
 
 	if (msgq->used_msgs > 0) {
@@ -93,6 +93,22 @@ static inline int z_vrfy_k_mutex_init(struct k_mutex *mutex)
 #include <syscalls/k_mutex_init_mrsh.c>
 #endif
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/* Racy by design: a stale read can only extend or cut short the spin
+ * by one iteration, the decision to take or pend on the mutex is
+ * always made under the lock.
+ */
+static bool owner_running_elsewhere(struct k_thread *owner)
+{
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		if (_kernel.cpus[i].current == owner) {
+			return true;
+		}
+	}
+	return false;
+}
+#endif
+
 static int32_t new_prio_for_inheritance(int32_t target, int32_t limit)
 {
 	int new_prio = z_is_prio_higher(target, limit) ? target : limit;
@@ -152,6 +168,35 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		return -EBUSY;
 	}
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	/* The owner may be mid-critical-section on another CPU and
+	 * about to release; spinning is then much cheaper than a
+	 * pend/unpend context switch round trip.  The lock is dropped
+	 * each iteration so the owner can get through
+	 * k_mutex_unlock(), and we stop as soon as the owner goes
+	 * off-CPU, since from that point only the pend path (and its
+	 * priority inheritance) can help it along.
+	 */
+	while (owner_running_elsewhere(mutex->owner)) {
+		k_spin_unlock(&lock, key);
+		arch_nop();
+		key = k_spin_lock(&lock);
+
+		if (likely(mutex->lock_count == 0U)) {
+			mutex->owner_orig_prio = _current->base.prio;
+			mutex->lock_count = 1U;
+			mutex->owner = _current;
+
+			LOG_DBG("%p took mutex %p by spinning", _current,
+				mutex);
+
+			k_spin_unlock(&lock, key);
+			sys_trace_end_call(SYS_TRACE_ID_MUTEX_LOCK);
+			return 0;
+		}
+	}
+#endif
+
 	new_prio = new_prio_for_inheritance(_current->base.prio,
 					    mutex->owner->base.prio);
 
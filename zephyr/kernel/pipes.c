@@ -877,3 +877,109 @@ size_t z_vrfy_k_pipe_write_avail(struct k_pipe *pipe)
 }
 #include <syscalls/k_pipe_write_avail_mrsh.c>
 #endif
+
+/* The claim/finish API hands out windows into the pipe's ring buffer
+ * directly, so streaming paths (e.g. DMA-driven audio) avoid both the
+ * copy-in and the copy-out.  Claims don't reserve: callers are
+ * responsible for having a single producer and a single consumer, and
+ * for not mixing an outstanding claim with k_pipe_put()/k_pipe_get()
+ * on the same side of the pipe.
+ */
+
+size_t k_pipe_put_claim(struct k_pipe *pipe, void **data, size_t size)
+{
+	k_spinlock_key_t key;
+	size_t run;
+
+	if (pipe->buffer == NULL || pipe->size == 0U) {
+		*data = NULL;
+		return 0;
+	}
+
+	key = k_spin_lock(&pipe->lock);
+
+	if (pipe->bytes_used == pipe->size) {
+		run = 0;
+	} else if (pipe->write_index >= pipe->read_index) {
+		run = pipe->size - pipe->write_index;
+	} else {
+		run = pipe->read_index - pipe->write_index;
+	}
+
+	run = MIN(size, run);
+	*data = (run > 0U) ? &pipe->buffer[pipe->write_index] : NULL;
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return run;
+}
+
+int k_pipe_put_finish(struct k_pipe *pipe, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	CHECKIF((size > pipe->size - pipe->bytes_used) ||
+		(size > pipe->size - pipe->write_index)) {
+		k_spin_unlock(&pipe->lock, key);
+		return -EINVAL;
+	}
+
+	pipe->write_index += size;
+	if (pipe->write_index == pipe->size) {
+		pipe->write_index = 0;
+	}
+	pipe->bytes_used += size;
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return 0;
+}
+
+size_t k_pipe_get_claim(struct k_pipe *pipe, void **data, size_t size)
+{
+	k_spinlock_key_t key;
+	size_t run;
+
+	if (pipe->buffer == NULL || pipe->size == 0U) {
+		*data = NULL;
+		return 0;
+	}
+
+	key = k_spin_lock(&pipe->lock);
+
+	if (pipe->bytes_used == 0U) {
+		run = 0;
+	} else if (pipe->read_index < pipe->write_index) {
+		run = pipe->write_index - pipe->read_index;
+	} else {
+		run = pipe->size - pipe->read_index;
+	}
+
+	run = MIN(size, run);
+	*data = (run > 0U) ? &pipe->buffer[pipe->read_index] : NULL;
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return run;
+}
+
+int k_pipe_get_finish(struct k_pipe *pipe, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	CHECKIF((size > pipe->bytes_used) ||
+		(size > pipe->size - pipe->read_index)) {
+		k_spin_unlock(&pipe->lock, key);
+		return -EINVAL;
+	}
+
+	pipe->read_index += size;
+	if (pipe->read_index == pipe->size) {
+		pipe->read_index = 0;
+	}
+	pipe->bytes_used -= size;
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return 0;
+}
@@ -376,6 +376,141 @@ oops_free:
 #include <syscalls/k_poll_mrsh.c>
 #endif
 
+/* Poller callback for poll sets: the triggering object has already
+ * unlinked the event from its own list, so its node is free to carry
+ * it on the set's ready list until the owner collects it.
+ */
+static int poll_set_cb(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_set *pset = CONTAINER_OF(event->poller,
+					       struct k_poll_set, poller);
+	struct k_thread *thread;
+
+	ARG_UNUSED(state);
+
+	sys_dlist_append(&pset->ready, &event->_node);
+
+	thread = z_unpend_first_thread(&pset->wait_q);
+	if (thread != NULL) {
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+	}
+
+	return 0;
+}
+
+/* must be called with interrupts locked.  Arm one event: immediately
+ * ready events go straight onto the ready list (level-triggered),
+ * everything else is registered with its object.
+ */
+static void poll_set_arm(struct k_poll_set *pset, struct k_poll_event *event)
+{
+	uint32_t state;
+
+	if (is_condition_met(event, &state)) {
+		set_event_ready(event, state);
+		sys_dlist_append(&pset->ready, &event->_node);
+	} else {
+		(void)register_event(event, &pset->poller);
+	}
+}
+
+int k_poll_set_register(struct k_poll_set *pset, struct k_poll_event *events,
+			int num_events)
+{
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT(events != NULL, "NULL events\n");
+	__ASSERT(num_events >= 0, "<0 events\n");
+
+	pset->poller = (struct _poller) { .is_polling = false,
+					  .thread     = _current,
+					  .cb         = poll_set_cb };
+	pset->events = events;
+	pset->num_events = num_events;
+	sys_dlist_init(&pset->ready);
+	z_waitq_init(&pset->wait_q);
+
+	for (int ii = 0; ii < num_events; ii++) {
+		k_spinlock_key_t key = k_spin_lock(&lock);
+
+		poll_set_arm(pset, &events[ii]);
+		k_spin_unlock(&lock, key);
+	}
+
+	return 0;
+}
+
+int k_poll_set_wait(struct k_poll_set *pset,
+		    struct k_poll_event **ready_events, int max_events,
+		    k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT(ready_events != NULL && max_events > 0, "");
+
+	for (;;) {
+		k_spinlock_key_t key = k_spin_lock(&lock);
+		int num_ready = 0;
+
+		/* Drain first, then re-arm: poll_set_arm() can re-append
+		 * a still-ready event, which must not be collected twice
+		 * in this pass.
+		 */
+		int num_popped = 0;
+
+		while (num_popped < max_events) {
+			sys_dnode_t *node = sys_dlist_get(&pset->ready);
+
+			if (node == NULL) {
+				break;
+			}
+			ready_events[num_popped++] =
+				CONTAINER_OF(node, struct k_poll_event, _node);
+		}
+
+		/* Re-arming re-checks the condition, so an entry gone
+		 * stale since it triggered is quietly re-registered
+		 * rather than reported.
+		 */
+		pset->poller.thread = _current;
+		for (int ii = 0; ii < num_popped; ii++) {
+			struct k_poll_event *event = ready_events[ii];
+
+			event->state = K_POLL_STATE_NOT_READY;
+			poll_set_arm(pset, event);
+			if (event->state != K_POLL_STATE_NOT_READY) {
+				ready_events[num_ready++] = event;
+			}
+		}
+
+		if (num_ready > 0) {
+			k_spin_unlock(&lock, key);
+			return num_ready;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EAGAIN;
+		}
+
+		int swap_rc = z_pend_curr(&lock, key, &pset->wait_q, timeout);
+
+		if (swap_rc != 0) {
+			return swap_rc;
+		}
+	}
+}
+
+void k_poll_set_unregister(struct k_poll_set *pset)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	/* clear_event_registration() unlinks the node wherever it is,
+	 * including from the ready list
+	 */
+	clear_event_registrations(pset->events, pset->num_events, key);
+	k_spin_unlock(&lock, key);
+}
+
 /* must be called with interrupts locked */
 static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 {
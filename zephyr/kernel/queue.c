@@ -81,6 +81,10 @@ void z_impl_k_queue_init(struct k_queue *queue)
 	sys_sflist_init(&queue->data_q);
 	queue->lock = (struct k_spinlock) {};
 	z_waitq_init(&queue->wait_q);
+#ifdef CONFIG_QUEUE_ISR_APPEND
+	queue->isr_stack = NULL;
+	queue->isr_waiting = ATOMIC_INIT(0);
+#endif
 #if defined(CONFIG_POLL)
 	sys_dlist_init(&queue->poll_events);
 #endif
@@ -111,6 +115,71 @@ static inline void handle_poll_events(struct k_queue *queue, uint32_t state)
 #endif
 }
 
+#ifdef CONFIG_QUEUE_ISR_APPEND
+/* Producers push onto isr_stack with a single CAS; consumers fold the
+ * staged items into data_q here, under the queue lock.  The stack pops
+ * in reverse arrival order, so the chain is flipped before appending.
+ * Staged nodes carry plain next pointers (flags 0), i.e. they read
+ * back as directly-enqueued data, never as alloc_node wrappers.
+ */
+static bool isr_stack_drain(struct k_queue *queue)
+{
+	void *head = atomic_ptr_set(&queue->isr_stack, NULL);
+	void *tail = head;
+	void *rev = NULL;
+
+	if (head == NULL) {
+		return false;
+	}
+
+	while (head != NULL) {
+		void *next = *(void **)head;
+
+		*(void **)head = rev;
+		rev = head;
+		head = next;
+	}
+
+	sys_sflist_append_list(&queue->data_q, rev, tail);
+	return true;
+}
+
+void k_queue_isr_append(struct k_queue *queue, void *data)
+{
+	void *old;
+
+	do {
+		old = atomic_ptr_get(&queue->isr_stack);
+		*(void **)data = old;
+	} while (!atomic_ptr_cas(&queue->isr_stack, old, data));
+
+	/* A consumer announces itself before its final check of the
+	 * staging stack, so the lock is only ever taken here when
+	 * someone is (or was just) asleep on an empty queue.
+	 */
+	if (atomic_get(&queue->isr_waiting) != 0) {
+		k_spinlock_key_t key = k_spin_lock(&queue->lock);
+
+		if (isr_stack_drain(queue)) {
+			struct k_thread *thread =
+				z_unpend_first_thread(&queue->wait_q);
+
+			if (thread != NULL) {
+				sys_sfnode_t *node = sys_sflist_get_not_empty(
+					&queue->data_q);
+
+				prepare_thread_to_run(
+					thread, z_queue_node_peek(node, true));
+			}
+			handle_poll_events(queue, K_POLL_STATE_DATA_AVAILABLE);
+			z_reschedule(&queue->lock, key);
+			return;
+		}
+		k_spin_unlock(&queue->lock, key);
+	}
+}
+#endif /* CONFIG_QUEUE_ISR_APPEND */
+
 void z_impl_k_queue_cancel_wait(struct k_queue *queue)
 {
 	k_spinlock_key_t key = k_spin_lock(&queue->lock);
@@ -279,6 +348,10 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 	k_spinlock_key_t key = k_spin_lock(&queue->lock);
 	void *data;
 
+#ifdef CONFIG_QUEUE_ISR_APPEND
+	(void)isr_stack_drain(queue);
+#endif
+
 	if (likely(!sys_sflist_is_empty(&queue->data_q))) {
 		sys_sfnode_t *node;
 
@@ -293,8 +366,28 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 		return NULL;
 	}
 
+#ifdef CONFIG_QUEUE_ISR_APPEND
+	/* Announce ourselves, then look one last time: either a racing
+	 * producer sees the count and takes the wakeup path, or this
+	 * drain sees its item.
+	 */
+	atomic_inc(&queue->isr_waiting);
+	if (isr_stack_drain(queue)) {
+		sys_sfnode_t *node = sys_sflist_get_not_empty(&queue->data_q);
+
+		atomic_dec(&queue->isr_waiting);
+		data = z_queue_node_peek(node, true);
+		k_spin_unlock(&queue->lock, key);
+		return data;
+	}
+#endif
+
 	int ret = z_pend_curr(&queue->lock, key, &queue->wait_q, timeout);
 
+#ifdef CONFIG_QUEUE_ISR_APPEND
+	atomic_dec(&queue->isr_waiting);
+#endif
+
 	return (ret != 0) ? NULL : _current->base.swap_data;
 }
 
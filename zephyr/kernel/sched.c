@@ -35,11 +35,19 @@ LOG_MODULE_DECLARE(os);
 #elif defined(CONFIG_SCHED_SCALABLE)
 #define _priq_run_add		z_priq_rb_add
 #define _priq_run_remove	z_priq_rb_remove
-#define _priq_run_best		z_priq_rb_best
+# if defined(CONFIG_SCHED_CPU_MASK)
+#  define _priq_run_best	_priq_rb_mask_best
+# else
+#  define _priq_run_best	z_priq_rb_best
+# endif
 #elif defined(CONFIG_SCHED_MULTIQ)
 #define _priq_run_add		z_priq_mq_add
 #define _priq_run_remove	z_priq_mq_remove
-#define _priq_run_best		z_priq_mq_best
+# if defined(CONFIG_SCHED_CPU_MASK)
+#  define _priq_run_best	_priq_mq_mask_best
+# else
+#  define _priq_run_best	z_priq_mq_best
+# endif
 #endif
 
 #if defined(CONFIG_WAITQ_SCALABLE)
@@ -162,6 +170,7 @@ static ALWAYS_INLINE bool should_preempt(struct k_thread *thread,
 }
 
 #ifdef CONFIG_SCHED_CPU_MASK
+#ifdef CONFIG_SCHED_DUMB
 static ALWAYS_INLINE struct k_thread *_priq_dumb_mask_best(sys_dlist_t *pq)
 {
 	/* With masks enabled we need to be prepared to walk the list
@@ -178,9 +187,157 @@ static ALWAYS_INLINE struct k_thread *_priq_dumb_mask_best(sys_dlist_t *pq)
 }
 #endif
 
+#ifdef CONFIG_SCHED_SCALABLE
+static ALWAYS_INLINE struct k_thread *_priq_rb_mask_best(struct _priq_rb *pq)
+{
+	/* The tree iterates in priority order, so the first node
+	 * whose mask admits this CPU wins.  Threads pinned elsewhere
+	 * cost an extra walk step each, same tradeoff as the dumb
+	 * scheduler's list scan.
+	 */
+	struct k_thread *thread;
+
+	RB_FOR_EACH_CONTAINER(&pq->tree, thread, base.qnode_rb) {
+		if ((thread->base.cpu_mask & BIT(_current_cpu->id)) != 0) {
+			return thread;
+		}
+	}
+	return NULL;
+}
+#endif
+
+#ifdef CONFIG_SCHED_MULTIQ
+static ALWAYS_INLINE struct k_thread *_priq_mq_mask_best(struct _priq_mq *pq)
+{
+	/* Scan priority levels in order, and within each level walk
+	 * past threads whose mask excludes this CPU.
+	 */
+	uint32_t bits = pq->bitmask;
+
+	while (bits != 0U) {
+		int priority_bit = __builtin_ctz(bits);
+		struct k_thread *thread;
+
+		SYS_DLIST_FOR_EACH_CONTAINER(&pq->queues[priority_bit],
+					     thread, base.qnode_dlist) {
+			if ((thread->base.cpu_mask &
+			     BIT(_current_cpu->id)) != 0) {
+				return thread;
+			}
+		}
+		bits &= ~BIT(priority_bit);
+	}
+	return NULL;
+}
+#endif
+#endif /* CONFIG_SCHED_CPU_MASK */
+
+/* The run queue on which a thread lives.  With per-CPU queues this is
+ * the queue of the CPU the thread last ran on (stable while the thread
+ * is queued: base.cpu only changes in do_swap(), at which point the
+ * thread has already been dequeued), otherwise the single global one.
+ */
+static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
+{
+#ifdef CONFIG_SCHED_CPU_QUEUES
+	int cpu = thread->base.cpu;
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	/* A thread whose mask excludes the CPU it last ran on must be
+	 * homed somewhere it may execute: its owner would skip it
+	 * forever and stealing honors the mask too.
+	 */
+	if ((thread->base.cpu_mask & BIT(cpu)) == 0 &&
+	    thread->base.cpu_mask != 0) {
+		cpu = __builtin_ctz(thread->base.cpu_mask);
+	}
+#endif
+
+	return &_kernel.cpus[cpu].ready_q.runq;
+#else
+	ARG_UNUSED(thread);
+	return &_kernel.ready_q.runq;
+#endif
+}
+
+static ALWAYS_INLINE void *curr_cpu_runq(void)
+{
+#ifdef CONFIG_SCHED_CPU_QUEUES
+	return &_current_cpu->ready_q.runq;
+#else
+	return &_kernel.ready_q.runq;
+#endif
+}
+
+static ALWAYS_INLINE void runq_add(struct k_thread *thread)
+{
+	_priq_run_add(thread_runq(thread), thread);
+}
+
+static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
+{
+	_priq_run_remove(thread_runq(thread), thread);
+}
+
+#ifdef CONFIG_SCHED_CPU_QUEUES
+/* Called with sched_spinlock held when this CPU's own queue has no
+ * eligible thread: take the best thread a peer CPU has queued and
+ * re-home it here.  The queues are priority ordered, so only the
+ * first eligible entry of each victim queue needs considering.
+ */
+static struct k_thread *runq_steal(void)
+{
+	struct k_thread *best = NULL;
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		struct k_thread *thread;
+
+		if (i == _current_cpu->id) {
+			continue;
+		}
+
+		SYS_DLIST_FOR_EACH_CONTAINER(&_kernel.cpus[i].ready_q.runq,
+					     thread, base.qnode_dlist) {
+#ifdef CONFIG_SCHED_CPU_MASK
+			if ((thread->base.cpu_mask &
+			     BIT(_current_cpu->id)) == 0) {
+				continue;
+			}
+#endif
+			if (best == NULL ||
+			    z_is_t1_higher_prio_than_t2(thread, best)) {
+				best = thread;
+			}
+			break;
+		}
+	}
+
+	if (best != NULL) {
+		sys_dlist_remove(&best->base.qnode_dlist);
+		best->base.cpu = _current_cpu->id;
+		runq_add(best);
+	}
+
+	return best;
+}
+#endif
+
+static ALWAYS_INLINE struct k_thread *runq_best(void)
+{
+	struct k_thread *thread = _priq_run_best(curr_cpu_runq());
+
+#ifdef CONFIG_SCHED_CPU_QUEUES
+	if (thread == NULL) {
+		thread = runq_steal();
+	}
+#endif
+
+	return thread;
+}
+
 static ALWAYS_INLINE struct k_thread *next_up(void)
 {
-	struct k_thread *thread = _priq_run_best(&_kernel.ready_q.runq);
+	struct k_thread *thread = runq_best();
 
 #if (CONFIG_NUM_METAIRQ_PRIORITIES > 0) && (CONFIG_NUM_COOP_PRIORITIES > 0)
 	/* MetaIRQs must always attempt to return back to a
@@ -250,13 +407,13 @@ static ALWAYS_INLINE struct k_thread *next_up(void)
 	/* Put _current back into the queue */
 	if (thread != _current && active &&
 		!z_is_idle_thread_object(_current) && !queued) {
-		_priq_run_add(&_kernel.ready_q.runq, _current);
+		runq_add(_current);
 		z_mark_thread_as_queued(_current);
 	}
 
 	/* Take the new _current out of the queue */
 	if (z_is_thread_queued(thread)) {
-		_priq_run_remove(&_kernel.ready_q.runq, thread);
+		runq_remove(thread);
 	}
 	z_mark_thread_as_not_queued(thread);
 
@@ -269,6 +426,42 @@ static ALWAYS_INLINE struct k_thread *next_up(void)
 static int slice_time;
 static int slice_max_prio;
 
+#ifdef CONFIG_TIMESLICE_PER_THREAD
+static inline int thread_slice_time(struct k_thread *thread)
+{
+	return thread->slice_budget != 0 ? thread->slice_budget : slice_time;
+}
+#else
+#define thread_slice_time(thread) slice_time
+#endif
+
+#if defined(CONFIG_TIMESLICE_PER_THREAD) && !defined(CONFIG_SMP) && \
+	defined(CONFIG_SCHED_DUMB)
+#define SLICE_CONTENTION_CHECK 1
+
+/* True when at least one other ready thread shares the priority of
+ * @a thread. In uniprocessor mode the running thread stays in the run
+ * queue, so contention means two or more queued threads at the level.
+ */
+static inline bool slice_contended(struct k_thread *thread)
+{
+	struct k_thread *t;
+	int n = 0;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&_kernel.ready_q.runq, t,
+				     base.qnode_dlist) {
+		if (t->base.prio == thread->base.prio) {
+			n++;
+			if (n > 1) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+#endif
+
 #ifdef CONFIG_SWAP_NONATOMIC
 /* If z_swap() isn't atomic, then it's possible for a timer interrupt
  * to try to timeslice away _current after it has already pended
@@ -284,9 +477,23 @@ void z_reset_time_slice(void)
 	 * slice count, as we'll see those "expired" ticks arrive in a
 	 * FUTURE z_time_slice() call.
 	 */
-	if (slice_time != 0) {
-		_current_cpu->slice_ticks = slice_time + z_clock_elapsed();
-		z_set_timeout_expiry(slice_time, false);
+	int ticks = thread_slice_time(_current);
+
+	if (ticks != 0) {
+#ifdef SLICE_CONTENTION_CHECK
+		/* Without a same-priority competitor there is nothing
+		 * to round-robin with; leave the comparator unarmed so
+		 * tickless idle is not broken by slice wakeups. The
+		 * clock starts from update_cache() when a peer becomes
+		 * ready.
+		 */
+		if (!slice_contended(_current)) {
+			_current_cpu->slice_ticks = 0;
+			return;
+		}
+#endif
+		_current_cpu->slice_ticks = ticks + z_clock_elapsed();
+		z_set_timeout_expiry(ticks, false);
 	}
 }
 
@@ -300,6 +507,23 @@ void k_sched_time_slice_set(int32_t slice, int prio)
 	}
 }
 
+#ifdef CONFIG_TIMESLICE_PER_THREAD
+void k_thread_time_slice_set(k_tid_t thread, int32_t slice_ms)
+{
+	LOCKED(&sched_spinlock) {
+		thread->slice_budget = k_ms_to_ticks_ceil32(slice_ms);
+		if (thread == _current) {
+			z_reset_time_slice();
+		}
+	}
+}
+
+uint32_t k_thread_time_slice_expired(k_tid_t thread)
+{
+	return thread->slice_expired;
+}
+#endif /* CONFIG_TIMESLICE_PER_THREAD */
+
 static inline int sliceable(struct k_thread *thread)
 {
 	return is_preempt(thread)
@@ -319,8 +543,12 @@ void z_time_slice(int ticks)
 	pending_current = NULL;
 #endif
 
-	if (slice_time && sliceable(_current)) {
+	if (thread_slice_time(_current) && sliceable(_current) &&
+	    (_current_cpu->slice_ticks != 0)) {
 		if (ticks >= _current_cpu->slice_ticks) {
+#ifdef CONFIG_TIMESLICE_PER_THREAD
+			_current->slice_expired++;
+#endif
 			z_move_thread_to_end_of_prio_q(_current);
 			z_reset_time_slice();
 		} else {
@@ -364,6 +592,15 @@ static void update_cache(int preempt_ok)
 		update_metairq_preempt(thread);
 		_kernel.ready_q.cache = thread;
 	} else {
+#ifdef SLICE_CONTENTION_CHECK
+		/* A peer at the running thread's priority may have just
+		 * become ready; start the round-robin clock if it is
+		 * not already running.
+		 */
+		if (_current_cpu->slice_ticks == 0 && sliceable(_current)) {
+			z_reset_time_slice();
+		}
+#endif
 		_kernel.ready_q.cache = _current;
 	}
 
@@ -378,15 +615,51 @@ static void update_cache(int preempt_ok)
 #endif
 }
 
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+/* Signal the other CPUs that "thread" became runnable (or changed
+ * priority).  With CONFIG_SCHED_IPI_OPTIMIZE the interrupt is elided
+ * entirely unless some other CPU is running a lower priority thread
+ * that "thread" is allowed to preempt, so wakeups that can't change
+ * any scheduling decision don't perturb the other cores.  The
+ * arch_sched_ipi() call itself remains a broadcast, as that is all
+ * the architecture layer provides.
+ */
+static void thread_ipi(struct k_thread *thread)
+{
+#ifdef CONFIG_SCHED_IPI_OPTIMIZE
+	int id = _current_cpu->id;
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		if (i == id) {
+			/* The local CPU reschedules without an IPI */
+			continue;
+		}
+#ifdef CONFIG_SCHED_CPU_MASK
+		if ((thread->base.cpu_mask & BIT(i)) == 0) {
+			continue;
+		}
+#endif
+		if (thread->base.prio < _kernel.cpus[i].curr_prio) {
+			arch_sched_ipi();
+			return;
+		}
+	}
+#else
+	ARG_UNUSED(thread);
+	arch_sched_ipi();
+#endif
+}
+#endif
+
 static void ready_thread(struct k_thread *thread)
 {
 	if (z_is_thread_ready(thread)) {
 		sys_trace_thread_ready(thread);
-		_priq_run_add(&_kernel.ready_q.runq, thread);
+		runq_add(thread);
 		z_mark_thread_as_queued(thread);
 		update_cache(0);
 #if defined(CONFIG_SMP) &&  defined(CONFIG_SCHED_IPI_SUPPORTED)
-		arch_sched_ipi();
+		thread_ipi(thread);
 #endif
 	}
 }
@@ -402,9 +675,9 @@ void z_move_thread_to_end_of_prio_q(struct k_thread *thread)
 {
 	LOCKED(&sched_spinlock) {
 		if (z_is_thread_queued(thread)) {
-			_priq_run_remove(&_kernel.ready_q.runq, thread);
+			runq_remove(thread);
 		}
-		_priq_run_add(&_kernel.ready_q.runq, thread);
+		runq_add(thread);
 		z_mark_thread_as_queued(thread);
 		update_cache(thread == _current);
 	}
@@ -430,7 +703,7 @@ void z_impl_k_thread_suspend(struct k_thread *thread)
 
 	LOCKED(&sched_spinlock) {
 		if (z_is_thread_queued(thread)) {
-			_priq_run_remove(&_kernel.ready_q.runq, thread);
+			runq_remove(thread);
 			z_mark_thread_as_not_queued(thread);
 		}
 		z_mark_thread_as_suspended(thread);
@@ -477,12 +750,23 @@ static _wait_q_t *pended_on(struct k_thread *thread)
 	return thread->base.pended_on;
 }
 
+#ifdef CONFIG_IO_RING
+extern void z_io_ring_thread_abort(struct k_thread *thread);
+#endif
+
 void z_thread_single_abort(struct k_thread *thread)
 {
 	if (thread->fn_abort != NULL) {
 		thread->fn_abort();
 	}
 
+#ifdef CONFIG_IO_RING
+	/* Tear down any I/O rings owned by the dying thread so the
+	 * dispatcher stops referencing its memory.
+	 */
+	z_io_ring_thread_abort(thread);
+#endif
+
 	(void)z_abort_thread_timeout(thread);
 
 	if (IS_ENABLED(CONFIG_SMP)) {
@@ -494,8 +778,7 @@ void z_thread_single_abort(struct k_thread *thread)
 
 		if (z_is_thread_ready(thread)) {
 			if (z_is_thread_queued(thread)) {
-				_priq_run_remove(&_kernel.ready_q.runq,
-						 thread);
+				runq_remove(thread);
 				z_mark_thread_as_not_queued(thread);
 			}
 			update_cache(thread == _current);
@@ -559,7 +842,7 @@ void z_thread_single_abort(struct k_thread *thread)
 static void unready_thread(struct k_thread *thread)
 {
 	if (z_is_thread_queued(thread)) {
-		_priq_run_remove(&_kernel.ready_q.runq, thread);
+		runq_remove(thread);
 		z_mark_thread_as_not_queued(thread);
 	}
 	update_cache(thread == _current);
@@ -710,9 +993,9 @@ bool z_set_prio(struct k_thread *thread, int prio)
 		if (need_sched) {
 			/* Don't requeue on SMP if it's the running thread */
 			if (!IS_ENABLED(CONFIG_SMP) || z_is_thread_queued(thread)) {
-				_priq_run_remove(&_kernel.ready_q.runq, thread);
+				runq_remove(thread);
 				thread->base.prio = prio;
-				_priq_run_add(&_kernel.ready_q.runq, thread);
+				runq_add(thread);
 			} else {
 				thread->base.prio = prio;
 			}
@@ -731,7 +1014,7 @@ void z_thread_priority_set(struct k_thread *thread, int prio)
 	bool need_sched = z_set_prio(thread, prio);
 
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
-	arch_sched_ipi();
+	thread_ipi(thread);
 #endif
 
 	if (need_sched && _current->base.sched_locked == 0) {
@@ -807,6 +1090,13 @@ struct k_thread *z_get_next_ready_thread(void)
 /* Just a wrapper around _current = xxx with tracing */
 static inline void set_current(struct k_thread *new_thread)
 {
+#ifdef CONFIG_SCHED_IPI_OPTIMIZE
+	/* Snapshot consumed by thread_ipi().  A reader racing with a
+	 * context switch here can only see the outgoing thread's
+	 * priority, which at worst sends one spurious (broadcast) IPI.
+	 */
+	_current_cpu->curr_prio = new_thread->base.prio;
+#endif
 	_current_cpu->current = new_thread;
 }
 
@@ -1021,8 +1311,14 @@ int z_unpend_all(_wait_q_t *wait_q)
 void z_sched_init(void)
 {
 #ifdef CONFIG_SCHED_DUMB
+#ifdef CONFIG_SCHED_CPU_QUEUES
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		sys_dlist_init(&_kernel.cpus[i].ready_q.runq);
+	}
+#else
 	sys_dlist_init(&_kernel.ready_q.runq);
 #endif
+#endif
 
 #ifdef CONFIG_SCHED_SCALABLE
 	_kernel.ready_q.runq = (struct _priq_rb) {
@@ -1038,6 +1334,15 @@ void z_sched_init(void)
 	}
 #endif
 
+#ifdef CONFIG_SCHED_IPI_OPTIMIZE
+	/* Pessimistic until each CPU runs its first thread: anything
+	 * that becomes runnable warrants the IPI.
+	 */
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		_kernel.cpus[i].curr_prio = K_LOWEST_THREAD_PRIO;
+	}
+#endif
+
 #ifdef CONFIG_TIMESLICING
 	k_sched_time_slice_set(CONFIG_TIMESLICE_SIZE,
 		CONFIG_TIMESLICE_PRIORITY);
@@ -1095,8 +1400,8 @@ void z_impl_k_thread_deadline_set(k_tid_t tid, int deadline)
 	LOCKED(&sched_spinlock) {
 		thread->base.prio_deadline = k_cycle_get_32() + deadline;
 		if (z_is_thread_queued(thread)) {
-			_priq_run_remove(&_kernel.ready_q.runq, thread);
-			_priq_run_add(&_kernel.ready_q.runq, thread);
+			runq_remove(thread);
+			runq_add(thread);
 		}
 	}
 }
@@ -1125,10 +1430,9 @@ void z_impl_k_yield(void)
 		LOCKED(&sched_spinlock) {
 			if (!IS_ENABLED(CONFIG_SMP) ||
 			    z_is_thread_queued(_current)) {
-				_priq_run_remove(&_kernel.ready_q.runq,
-						 _current);
+				runq_remove(_current);
 			}
-			_priq_run_add(&_kernel.ready_q.runq, _current);
+			runq_add(_current);
 			z_mark_thread_as_queued(_current);
 			update_cache(1);
 		}
@@ -1259,10 +1563,6 @@ void z_impl_k_wakeup(k_tid_t thread)
 	z_mark_thread_as_not_suspended(thread);
 	z_ready_thread(thread);
 
-#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
-	arch_sched_ipi();
-#endif
-
 	if (!arch_is_in_isr()) {
 		z_reschedule_unlocked();
 	}
@@ -1313,7 +1613,7 @@ void z_sched_abort(struct k_thread *thread)
 			thread->base.thread_state |= _THREAD_DEAD;
 			k_spin_unlock(&sched_spinlock, key);
 		} else if (z_is_thread_queued(thread)) {
-			_priq_run_remove(&_kernel.ready_q.runq, thread);
+			runq_remove(thread);
 			z_mark_thread_as_not_queued(thread);
 			thread->base.thread_state |= _THREAD_DEAD;
 			k_spin_unlock(&sched_spinlock, key);
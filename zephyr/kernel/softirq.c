@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * Softirq bottom halves: deferred interrupt work drained by a shared
+ * thread at the highest cooperative priority, ahead of all ordinary
+ * threads including the system workqueue.
+ */
+
+#include <kernel.h>
+#include <init.h>
+
+K_THREAD_STACK_DEFINE(softirq_stack, CONFIG_SOFTIRQ_STACK_SIZE);
+K_FIFO_DEFINE(softirq_fifo);
+
+static struct k_thread softirq_thread;
+
+static void softirq_loop(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		struct k_softirq *softirq;
+
+		softirq = k_fifo_get(&softirq_fifo, K_FOREVER);
+
+		/* Clear before invoking the handler so a raise from an
+		 * ISR during execution queues another pass instead of
+		 * being lost.
+		 */
+		atomic_clear(&softirq->pending);
+		softirq->handler(softirq);
+	}
+}
+
+void k_softirq_init(struct k_softirq *softirq, k_softirq_handler_t handler)
+{
+	softirq->handler = handler;
+	atomic_clear(&softirq->pending);
+}
+
+void k_softirq_raise(struct k_softirq *softirq)
+{
+	if (atomic_cas(&softirq->pending, 0, 1)) {
+		k_fifo_put(&softirq_fifo, softirq);
+	}
+}
+
+static int k_softirq_thread_init(struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	k_thread_create(&softirq_thread, softirq_stack,
+			K_THREAD_STACK_SIZEOF(softirq_stack),
+			softirq_loop, NULL, NULL, NULL,
+			K_HIGHEST_THREAD_PRIO, 0, K_NO_WAIT);
+	k_thread_name_set(&softirq_thread, "softirq");
+
+	return 0;
+}
+
+SYS_INIT(k_softirq_thread_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -29,9 +29,10 @@
 #include <random/rand32.h>
 
 #ifdef CONFIG_THREAD_MONITOR
-/* This lock protects the linked list of active threads; i.e. the
- * initial _kernel.threads pointer and the linked list made up of
- * thread->next_thread (until NULL)
+/* This lock serializes walks of the active thread list against thread
+ * removal; i.e. the linked list made up of thread->next_thread (until
+ * NULL). Creation prepends to the initial _kernel.threads pointer with
+ * a lock-free CAS so it never contends with monitoring walks.
  */
 static struct k_spinlock z_thread_monitor_lock;
 #endif /* CONFIG_THREAD_MONITOR */
@@ -184,8 +185,14 @@ void z_thread_monitor_exit(struct k_thread *thread)
 {
 	k_spinlock_key_t key = k_spin_lock(&z_thread_monitor_lock);
 
-	if (thread == _kernel.threads) {
-		_kernel.threads = _kernel.threads->next_thread;
+	/* Creators prepend without taking the lock, so unlinking the
+	 * head must CAS against them; when that fails a new head was
+	 * just prepended and the predecessor search finds the thread.
+	 */
+	if ((thread == _kernel.threads) &&
+	    atomic_ptr_cas((atomic_ptr_t *)&_kernel.threads, thread,
+			   thread->next_thread)) {
+		/* Thread was the list head and got unlinked. */
 	} else {
 		struct k_thread *prev_thread;
 
@@ -447,6 +454,42 @@ static inline size_t adjust_stack_size(size_t stack_size)
 
 #endif /* CONFIG_STACK_POINTER_RANDOM */
 
+#ifdef CONFIG_THREAD_LOCAL_STORAGE
+extern char __tls_start[];
+extern char __tdata_start[];
+extern char __tdata_size[];
+extern char __tbss_start[];
+extern char __tbss_size[];
+
+/* "Variant 1" TLS layout: the thread pointer addresses a small
+ * thread control block with the TLS data placed directly above it,
+ * and the offsets the compiler emits account for the control block.
+ */
+#define TLS_TCB_SIZE 8
+
+size_t z_tls_data_size(void)
+{
+	return TLS_TCB_SIZE + ROUND_UP((uintptr_t)__tdata_size, 4) +
+	       ROUND_UP((uintptr_t)__tbss_size, 4);
+}
+
+uintptr_t z_tls_setup(char *tls_area)
+{
+	char *data = tls_area + TLS_TCB_SIZE;
+
+	(void)memset(tls_area, 0, TLS_TCB_SIZE);
+	(void)memcpy(data, __tdata_start, (uintptr_t)__tdata_size);
+
+	/* .tbss follows .tdata in the link, so re-using the link-time
+	 * offset preserves whatever alignment the linker gave it.
+	 */
+	(void)memset(data + (__tbss_start - __tls_start), 0,
+		     (uintptr_t)__tbss_size);
+
+	return (uintptr_t)tls_area;
+}
+#endif /* CONFIG_THREAD_LOCAL_STORAGE */
+
 /*
  * Note:
  * The caller must guarantee that the stack_size passed here corresponds
@@ -480,6 +523,10 @@ void z_setup_new_thread(struct k_thread *new_thread,
 	stack_size = Z_STACK_PTR_ALIGN(stack_size
 			- sizeof(*new_thread->userspace_local_data));
 #endif
+#endif
+#ifdef CONFIG_THREAD_LOCAL_STORAGE
+	/* reserve space on top of stack for the TLS area */
+	stack_size = Z_STACK_PTR_ALIGN(stack_size - z_tls_data_size());
 #endif
 	/* Initialize various struct k_thread members */
 	z_init_thread_base(&new_thread->base, prio, _THREAD_PRESTART, options);
@@ -490,6 +537,11 @@ void z_setup_new_thread(struct k_thread *new_thread,
 	new_thread->init_data = NULL;
 	new_thread->fn_abort = NULL;
 
+#ifdef CONFIG_TIMESLICE_PER_THREAD
+	new_thread->slice_budget = 0;
+	new_thread->slice_expired = 0U;
+#endif
+
 #ifdef CONFIG_USE_SWITCH
 	/* switch_handle must be non-null except when inside z_swap()
 	 * for synchronization reasons.  Historically some notional
@@ -505,6 +557,11 @@ void z_setup_new_thread(struct k_thread *new_thread,
 	 */
 	*((uint32_t *)new_thread->stack_info.start) = STACK_SENTINEL;
 #endif /* CONFIG_STACK_SENTINEL */
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+	/* No sample taken yet: start at the top of the writable area */
+	new_thread->stack_watermark = new_thread->stack_info.start +
+				      new_thread->stack_info.size;
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
 #ifdef CONFIG_THREAD_USERSPACE_LOCAL_DATA
 #ifndef CONFIG_THREAD_USERSPACE_LOCAL_DATA_ARCH_DEFER_SETUP
 	/* don't set again if the arch's own code in arch_new_thread() has
@@ -515,6 +572,13 @@ void z_setup_new_thread(struct k_thread *new_thread,
 		(Z_THREAD_STACK_BUFFER(stack) + stack_size);
 #endif
 #endif
+#ifdef CONFIG_THREAD_LOCAL_STORAGE
+	/* The TLS area sits in the space carved off the top of the
+	 * stack area above.
+	 */
+	new_thread->tls =
+		z_tls_setup(Z_THREAD_STACK_BUFFER(stack) + stack_size);
+#endif
 #ifdef CONFIG_THREAD_CUSTOM_DATA
 	/* Initialize custom data field (value is opaque to kernel) */
 	new_thread->custom_data = NULL;
@@ -525,11 +589,14 @@ void z_setup_new_thread(struct k_thread *new_thread,
 	new_thread->entry.parameter2 = p2;
 	new_thread->entry.parameter3 = p3;
 
-	k_spinlock_key_t key = k_spin_lock(&z_thread_monitor_lock);
-
-	new_thread->next_thread = _kernel.threads;
-	_kernel.threads = new_thread;
-	k_spin_unlock(&z_thread_monitor_lock, key);
+	/* Lock-free prepend; only the list head is contended and the
+	 * next pointers of linked threads are left untouched, so
+	 * monitor walks never block thread creation.
+	 */
+	do {
+		new_thread->next_thread = _kernel.threads;
+	} while (!atomic_ptr_cas((atomic_ptr_t *)&_kernel.threads,
+				 new_thread->next_thread, new_thread));
 #endif
 #ifdef CONFIG_THREAD_NAME
 	if (name != NULL) {
@@ -907,6 +974,35 @@ int z_vrfy_k_thread_stack_space_get(const struct k_thread *thread,
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_INIT_STACKS && CONFIG_THREAD_STACK_INFO */
 
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+int k_thread_stack_watermark_get(const struct k_thread *thread,
+				 size_t *unused_ptr)
+{
+	uintptr_t watermark = thread->stack_watermark;
+
+	if (thread == _current) {
+		/* The current activation has not been sampled yet;
+		 * fold in the stack pointer we are running on now.
+		 */
+		char marker;
+
+		if ((uintptr_t)&marker < watermark) {
+			watermark = (uintptr_t)&marker;
+		}
+	}
+
+	if ((watermark < thread->stack_info.start) ||
+	    (watermark > (thread->stack_info.start +
+			  thread->stack_info.size))) {
+		return -EINVAL;
+	}
+
+	*unused_ptr = watermark - thread->stack_info.start;
+
+	return 0;
+}
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
+
 #ifdef CONFIG_USERSPACE
 static inline k_ticks_t z_vrfy_k_thread_timeout_remaining_ticks(
 						    struct k_thread *t)
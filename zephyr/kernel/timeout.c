@@ -11,6 +11,9 @@
 #include <syscall_handler.h>
 #include <drivers/timer/system_timer.h>
 #include <sys_clock.h>
+#ifdef CONFIG_TIME_PAGE
+#include <sys/time_page.h>
+#endif
 
 #define LOCKED(lck) for (k_spinlock_key_t __i = {},			\
 					  __key = k_spin_lock(lck);	\
@@ -19,7 +22,61 @@
 
 static uint64_t curr_tick;
 
+#ifdef CONFIG_TIME_PAGE
+struct sys_time_page z_time_page __aligned(32);
+
+K_MEM_PARTITION_DEFINE(z_time_page_partition, &z_time_page,
+		       sizeof(z_time_page),
+#ifdef K_MEM_PARTITION_P_RW_U_RO
+		       K_MEM_PARTITION_P_RW_U_RO
+#else
+		       K_MEM_PARTITION_P_RW_U_RW
+#endif
+		       );
+
+static void time_page_update(uint64_t ticks)
+{
+	z_time_page.seq++;
+	compiler_barrier();
+	z_time_page.ticks = ticks;
+	compiler_barrier();
+	z_time_page.seq++;
+}
+#else
+#define time_page_update(ticks)
+#endif /* CONFIG_TIME_PAGE */
+
+#ifdef CONFIG_TIMEOUT_WHEEL
+/* Hashed timing wheel.  A timeout due within WHEEL_SIZE ticks lives in
+ * the bucket its absolute expiry tick hashes to; anything further out
+ * waits on an overflow list and is migrated in as the wheel turns.
+ * Because every in-wheel expiry lies in (curr_tick, curr_tick +
+ * WHEEL_MASK], each bucket's slot time is unique and all entries in
+ * one bucket share the same expiry, so buckets need no sorting and
+ * insert/cancel are O(1).
+ *
+ * In this mode the dticks field holds the absolute expiry tick, not a
+ * delta.
+ */
+#define WHEEL_SIZE CONFIG_TIMEOUT_WHEEL_SLOTS
+#define WHEEL_MASK (WHEEL_SIZE - 1)
+
+BUILD_ASSERT((WHEEL_SIZE & WHEEL_MASK) == 0,
+	     "timing wheel slot count must be a power of two");
+
+static sys_dlist_t wheel[WHEEL_SIZE];
+static sys_dlist_t overflow = SYS_DLIST_STATIC_INIT(&overflow);
+static bool wheel_ready;
+
+/* Cached earliest overflow expiry, lazily recomputed after the cached
+ * entry is removed
+ */
+static uint64_t overflow_min = UINT64_MAX;
+static struct _timeout *overflow_min_t;
+static bool overflow_stale;
+#else
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif
 
 static struct k_spinlock timeout_lock;
 
@@ -41,6 +98,102 @@ static inline int z_vrfy_z_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_WHEEL
+
+static void wheel_init(void)
+{
+	for (int i = 0; i < WHEEL_SIZE; i++) {
+		sys_dlist_init(&wheel[i]);
+	}
+	wheel_ready = true;
+}
+
+static void overflow_recompute(void)
+{
+	struct _timeout *t;
+
+	overflow_min = UINT64_MAX;
+	overflow_min_t = NULL;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&overflow, t, node) {
+		if (t->dticks < overflow_min) {
+			overflow_min = t->dticks;
+			overflow_min_t = t;
+		}
+	}
+	overflow_stale = false;
+}
+
+/* Earliest armed timeout, or NULL.  Every in-wheel entry expires
+ * before every overflow entry, so the overflow cache only matters when
+ * the wheel is empty.
+ */
+static struct _timeout *first(void)
+{
+	struct _timeout *ret = NULL;
+
+	for (int i = 0; wheel_ready && i < WHEEL_SIZE; i++) {
+		sys_dnode_t *n = sys_dlist_peek_head(&wheel[i]);
+
+		if (n != NULL) {
+			struct _timeout *t =
+				CONTAINER_OF(n, struct _timeout, node);
+
+			if (ret == NULL || t->dticks < ret->dticks) {
+				ret = t;
+			}
+		}
+	}
+
+	if (ret == NULL) {
+		if (overflow_stale) {
+			overflow_recompute();
+		}
+		ret = overflow_min_t;
+	}
+
+	return ret;
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	sys_dlist_remove(&t->node);
+
+	if (t == overflow_min_t) {
+		overflow_stale = true;
+		overflow_min_t = NULL;
+		overflow_min = UINT64_MAX;
+	}
+}
+
+/* Move overflow entries now due within the wheel span into their
+ * buckets.  The cached minimum makes this a no-op unless something
+ * actually qualifies.
+ */
+static void migrate_overflow(void)
+{
+	struct _timeout *t, *tmp;
+
+	if (overflow_stale) {
+		overflow_recompute();
+	}
+
+	if (overflow_min > curr_tick + WHEEL_MASK) {
+		return;
+	}
+
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&overflow, t, tmp, node) {
+		if (t->dticks <= curr_tick + WHEEL_MASK) {
+			sys_dlist_remove(&t->node);
+			sys_dlist_append(&wheel[t->dticks & WHEEL_MASK],
+					 &t->node);
+		}
+	}
+	overflow_recompute();
+}
+
+#else /* !CONFIG_TIMEOUT_WHEEL */
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -64,6 +217,8 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+#endif /* CONFIG_TIMEOUT_WHEEL */
+
 static int32_t elapsed(void)
 {
 	return announce_remaining == 0 ? z_clock_elapsed() : 0;
@@ -73,7 +228,12 @@ static int32_t next_timeout(void)
 {
 	struct _timeout *to = first();
 	int32_t ticks_elapsed = elapsed();
+#ifdef CONFIG_TIMEOUT_WHEEL
+	int32_t ret = to == NULL ? MAX_WAIT
+		: MAX(0, (int64_t)(to->dticks - curr_tick) - ticks_elapsed);
+#else
 	int32_t ret = to == NULL ? MAX_WAIT : MAX(0, to->dticks - ticks_elapsed);
+#endif
 
 #ifdef CONFIG_TIMESLICING
 	if (_current_cpu->slice_ticks && _current_cpu->slice_ticks < ret) {
@@ -105,16 +265,74 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	ticks = MAX(1, ticks);
 
 	LOCKED(&timeout_lock) {
+#ifdef CONFIG_TIMEOUT_WHEEL
+		if (!wheel_ready) {
+			wheel_init();
+		}
+
+		to->dticks = curr_tick + elapsed() + ticks;
+
+#ifdef CONFIG_TIMEOUT_SLACK
+		/* Defer onto an already-armed expiry within the slack
+		 * window, if any, so both share one hardware wakeup.
+		 * In-horizon buckets hold exactly one tick value, so a
+		 * head peek per candidate tick suffices.
+		 */
+		for (uint32_t d = 1; d <= to->slack && d <= WHEEL_MASK; d++) {
+			uint64_t tick = to->dticks + d;
+			sys_dnode_t *n;
+
+			if (tick > curr_tick + WHEEL_MASK) {
+				break;
+			}
+			n = sys_dlist_peek_head(&wheel[tick & WHEEL_MASK]);
+			if (n != NULL &&
+			    CONTAINER_OF(n, struct _timeout, node)->dticks ==
+			    tick) {
+				to->dticks = tick;
+				break;
+			}
+		}
+#endif
+
+		if (to->dticks <= curr_tick + WHEEL_MASK) {
+			sys_dlist_append(&wheel[to->dticks & WHEEL_MASK],
+					 &to->node);
+		} else {
+			sys_dlist_append(&overflow, &to->node);
+			if (!overflow_stale && to->dticks < overflow_min) {
+				overflow_min = to->dticks;
+				overflow_min_t = to;
+			}
+		}
+#else
 		struct _timeout *t;
+#ifdef CONFIG_TIMEOUT_SLACK
+		uint32_t slack = to->slack;
+#endif
 
 		to->dticks = ticks + elapsed();
 		for (t = first(); t != NULL; t = next(t)) {
 			__ASSERT(t->dticks >= 0, "");
 
 			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
+#ifdef CONFIG_TIMEOUT_SLACK
+				if ((uint64_t)(t->dticks - to->dticks) <=
+				    slack) {
+					/* Defer onto t's expiry so both
+					 * share one wakeup.  The slack
+					 * is spent: later neighbors
+					 * can't stretch it further.
+					 */
+					to->dticks = t->dticks;
+					slack = 0U;
+				} else
+#endif
+				{
+					t->dticks -= to->dticks;
+					sys_dlist_insert(&t->node, &to->node);
+					break;
+				}
 			}
 			to->dticks -= t->dticks;
 		}
@@ -122,6 +340,7 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 		if (t == NULL) {
 			sys_dlist_append(&timeout_list, &to->node);
 		}
+#endif
 
 		if (to == first()) {
 			z_clock_set_timeout(next_timeout(), false);
@@ -152,12 +371,16 @@ static k_ticks_t timeout_rem(struct _timeout *timeout)
 		return 0;
 	}
 
+#ifdef CONFIG_TIMEOUT_WHEEL
+	ticks = timeout->dticks - curr_tick;
+#else
 	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
 		ticks += t->dticks;
 		if (timeout == t) {
 			break;
 		}
 	}
+#endif
 
 	return ticks - elapsed();
 }
@@ -228,6 +451,26 @@ void z_clock_announce(int32_t ticks)
 
 	announce_remaining = ticks;
 
+#ifdef CONFIG_TIMEOUT_WHEEL
+	while (first() != NULL &&
+	       first()->dticks <= curr_tick + announce_remaining) {
+		struct _timeout *t = first();
+		int dt = t->dticks - curr_tick;
+
+		curr_tick += dt;
+		announce_remaining -= dt;
+		remove_timeout(t);
+		migrate_overflow();
+
+		k_spin_unlock(&timeout_lock, key);
+		t->fn(t);
+		key = k_spin_lock(&timeout_lock);
+	}
+
+	curr_tick += announce_remaining;
+	announce_remaining = 0;
+	migrate_overflow();
+#else
 	while (first() != NULL && first()->dticks <= announce_remaining) {
 		struct _timeout *t = first();
 		int dt = t->dticks;
@@ -248,6 +491,9 @@ void z_clock_announce(int32_t ticks)
 
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
+#endif
+
+	time_page_update(curr_tick);
 
 	z_clock_set_timeout(next_timeout(), false);
 
@@ -271,4 +271,12 @@ static inline void z_vrfy_k_timer_user_data_set(struct k_timer *timer,
 }
 #include <syscalls/k_timer_user_data_set_mrsh.c>
 
+static inline void z_vrfy_k_timer_slack_set(struct k_timer *timer,
+					    k_ticks_t slack)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(timer, K_OBJ_TIMER));
+	z_impl_k_timer_slack_set(timer, slack);
+}
+#include <syscalls/k_timer_slack_set_mrsh.c>
+
 #endif
@@ -145,6 +145,119 @@ static sys_dlist_t obj_list = SYS_DLIST_STATIC_INIT(&obj_list);
  * and obj_list.
  */
 
+#ifdef CONFIG_DYNAMIC_OBJECT_POOL
+/* Static pool of kernel object slots, handed out through a lock-free
+ * LIFO free list. The list head packs the index of the first free
+ * slot (biased by one, zero meaning empty) together with a
+ * modification tag in a single atomic_val_t, so a concurrent
+ * pop/push/pop sequence cannot trip the classic ABA problem on the
+ * compare-and-swap loops below.
+ */
+struct pool_obj {
+	struct z_object kobj;
+	/* Biased index of the next free slot while this slot is on the
+	 * free list
+	 */
+	uint16_t free_next;
+	/* Slot currently holds a live object */
+	uint8_t in_use;
+	uint8_t data[CONFIG_DYNAMIC_OBJECT_POOL_BLOCK_SIZE] __aligned(8);
+};
+
+static struct pool_obj obj_pool[CONFIG_DYNAMIC_OBJECT_POOL_COUNT];
+static atomic_t pool_free_head;
+
+#define POOL_HEAD_IDX(head)	((head) & 0xffff)
+#define POOL_HEAD_TAG(head)	(((head) >> 16) & 0xffff)
+#define POOL_HEAD_MAKE(idx, tag) \
+	((atomic_val_t)(((((tag) + 1) & 0xffff) << 16) | (idx)))
+
+static int obj_pool_init(struct device *unused)
+{
+	ARG_UNUSED(unused);
+
+	for (int i = 0; i < CONFIG_DYNAMIC_OBJECT_POOL_COUNT - 1; i++) {
+		obj_pool[i].free_next = (uint16_t)(i + 2);
+	}
+	obj_pool[CONFIG_DYNAMIC_OBJECT_POOL_COUNT - 1].free_next = 0U;
+	pool_free_head = POOL_HEAD_MAKE(1, 0);
+
+	return 0;
+}
+
+SYS_INIT(obj_pool_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+
+static struct z_object *pool_object_alloc(size_t size)
+{
+	struct pool_obj *slot;
+	atomic_val_t old, new;
+
+	if (size > CONFIG_DYNAMIC_OBJECT_POOL_BLOCK_SIZE) {
+		return NULL;
+	}
+
+	do {
+		old = atomic_get(&pool_free_head);
+		if (POOL_HEAD_IDX(old) == 0U) {
+			/* Pool exhausted; caller falls back to the
+			 * resource pool allocator
+			 */
+			return NULL;
+		}
+		slot = &obj_pool[POOL_HEAD_IDX(old) - 1];
+		new = POOL_HEAD_MAKE(slot->free_next, POOL_HEAD_TAG(old));
+	} while (!atomic_cas(&pool_free_head, old, new));
+
+	slot->kobj.name = &slot->data;
+	slot->kobj.type = K_OBJ_ANY;
+	slot->kobj.flags = 0;
+	(void)memset(slot->kobj.perms, 0, CONFIG_MAX_THREAD_BYTES);
+	slot->in_use = 1U;
+
+	return &slot->kobj;
+}
+
+/* Return the pool slot backing obj, or NULL if obj is not a live
+ * pool-backed kernel object. Constant time and lock-free: membership
+ * is an address range check against the static pool array.
+ */
+static struct pool_obj *pool_object_find(void *obj)
+{
+	struct pool_obj *slot = CONTAINER_OF(obj, struct pool_obj, data);
+	uintptr_t offset = (uintptr_t)obj - (uintptr_t)&obj_pool[0].data;
+
+	if (obj < (void *)&obj_pool[0].data ||
+	    obj > (void *)&obj_pool[CONFIG_DYNAMIC_OBJECT_POOL_COUNT - 1].data) {
+		return NULL;
+	}
+
+	if ((offset % sizeof(struct pool_obj)) != 0U || slot->in_use == 0U) {
+		return NULL;
+	}
+
+	return slot;
+}
+
+static void pool_object_release(struct pool_obj *slot)
+{
+	atomic_val_t old, new;
+	uint16_t idx = (uint16_t)(slot - obj_pool) + 1U;
+
+	/* Scrub permissions so iteration over free slots (see
+	 * z_object_wordlist_foreach()) never observes stale grants
+	 */
+	slot->kobj.flags = 0;
+	(void)memset(slot->kobj.perms, 0, CONFIG_MAX_THREAD_BYTES);
+	slot->in_use = 0U;
+
+	do {
+		old = atomic_get(&pool_free_head);
+		slot->free_next = (uint16_t)POOL_HEAD_IDX(old);
+		new = POOL_HEAD_MAKE(idx, POOL_HEAD_TAG(old));
+	} while (!atomic_cas(&pool_free_head, old, new));
+}
+#endif /* CONFIG_DYNAMIC_OBJECT_POOL */
+
 static size_t obj_size_get(enum k_objects otype)
 {
 	size_t ret;
@@ -259,6 +372,14 @@ struct z_object *z_dynamic_object_create(size_t size)
 {
 	struct dyn_obj *dyn_obj;
 
+#ifdef CONFIG_DYNAMIC_OBJECT_POOL
+	struct z_object *pooled = pool_object_alloc(size);
+
+	if (pooled != NULL) {
+		return pooled;
+	}
+#endif
+
 	dyn_obj = z_thread_malloc(sizeof(*dyn_obj) + size);
 	if (dyn_obj == NULL) {
 		LOG_ERR("could not allocate kernel object, out of memory");
@@ -341,6 +462,22 @@ void k_object_free(void *obj)
 	 * being used by some other thread
 	 */
 
+#ifdef CONFIG_DYNAMIC_OBJECT_POOL
+	struct pool_obj *slot = pool_object_find(obj);
+
+	if (slot != NULL) {
+		if (slot->kobj.type == K_OBJ_THREAD) {
+			k_spinlock_key_t pool_key =
+				k_spin_lock(&objfree_lock);
+
+			thread_idx_free(slot->kobj.data.thread_id);
+			k_spin_unlock(&objfree_lock, pool_key);
+		}
+		pool_object_release(slot);
+		return;
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&objfree_lock);
 
 	dyn_obj = dyn_object_find(obj);
@@ -368,6 +505,14 @@ struct z_object *z_object_find(void *obj)
 	if (ret == NULL) {
 		struct dyn_obj *dynamic_obj;
 
+#ifdef CONFIG_DYNAMIC_OBJECT_POOL
+		struct pool_obj *slot = pool_object_find(obj);
+
+		if (slot != NULL) {
+			return &slot->kobj;
+		}
+#endif
+
 		dynamic_obj = dyn_object_find(obj);
 		if (dynamic_obj != NULL) {
 			ret = &dynamic_obj->kobj;
@@ -383,6 +528,16 @@ void z_object_wordlist_foreach(_wordlist_cb_func_t func, void *context)
 
 	z_object_gperf_wordlist_foreach(func, context);
 
+#ifdef CONFIG_DYNAMIC_OBJECT_POOL
+	/* Free pool slots have scrubbed permission bits and flags, so
+	 * visiting every slot is harmless and avoids synchronizing
+	 * against the lock-free allocation path.
+	 */
+	for (int i = 0; i < CONFIG_DYNAMIC_OBJECT_POOL_COUNT; i++) {
+		func(&obj_pool[i].kobj, context);
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
 
 	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&obj_list, obj, next, obj_list) {
@@ -445,6 +600,15 @@ static void unref_check(struct z_object *ko, uintptr_t index)
 		break;
 	}
 
+#ifdef CONFIG_DYNAMIC_OBJECT_POOL
+	struct pool_obj *slot = pool_object_find(ko->name);
+
+	if (slot != NULL) {
+		pool_object_release(slot);
+		goto out;
+	}
+#endif
+
 	rb_remove(&obj_rb_tree, &dyn_obj->node);
 	sys_dlist_remove(&dyn_obj->obj_list);
 	k_free(dyn_obj);
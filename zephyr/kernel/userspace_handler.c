@@ -65,3 +65,49 @@ static inline void *z_vrfy_k_object_alloc(enum k_objects otype)
 	return z_impl_k_object_alloc(otype);
 }
 #include <syscalls/k_object_alloc_mrsh.c>
+
+#ifdef CONFIG_SYSCALL_BATCH
+int z_impl_k_syscall_batch(struct k_syscall_batch_entry *entries, size_t count)
+{
+	/* Supervisor mode callers can invoke the APIs directly and
+	 * gain nothing from batching.
+	 */
+	ARG_UNUSED(entries);
+	ARG_UNUSED(count);
+
+	return -ENOSYS;
+}
+
+static inline int z_vrfy_k_syscall_batch(struct k_syscall_batch_entry *entries,
+					 size_t count)
+{
+	struct k_syscall_batch_entry entry;
+	void *ssf = _current->syscall_frame;
+
+	for (size_t i = 0; i < count; i++) {
+		Z_OOPS(z_user_from_copy(&entry, &entries[i], sizeof(entry)));
+
+		/* Same policy as the arch trap entry code: out of range
+		 * IDs are dispatched to the bad-syscall handler.
+		 */
+		if (entry.call_id >= K_SYSCALL_LIMIT) {
+			entry.call_id = K_SYSCALL_BAD;
+		}
+
+		entry.ret = _k_syscall_table[entry.call_id](
+			entry.args[0], entry.args[1], entry.args[2],
+			entry.args[3], entry.args[4], entry.args[5], ssf);
+
+		/* Nested handlers update the saved frame pointer;
+		 * restore ours so later oopses are attributed right.
+		 */
+		_current->syscall_frame = ssf;
+
+		Z_OOPS(z_user_to_copy(&entries[i].ret, &entry.ret,
+				      sizeof(entry.ret)));
+	}
+
+	return 0;
+}
+#include <syscalls/k_syscall_batch_mrsh.c>
+#endif /* CONFIG_SYSCALL_BATCH */
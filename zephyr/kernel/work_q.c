@@ -36,6 +36,35 @@ void k_work_q_start(struct k_work_q *work_q, k_thread_stack_t *stack,
 	k_thread_name_set(&work_q->thread, WORKQUEUE_THREAD_NAME);
 }
 
+#ifdef CONFIG_WORK_POOL
+void k_work_pool_start(struct k_work_pool *pool, k_thread_stack_t *stacks,
+		       size_t stack_size, int prio, int num_workers)
+{
+	__ASSERT(num_workers >= 1 &&
+		 num_workers <= CONFIG_WORK_POOL_MAX_WORKERS,
+		 "invalid worker count %d", num_workers);
+
+	k_queue_init(&pool->work_q.queue);
+	pool->num_workers = num_workers;
+
+	/* All workers drain the one shared queue; k_queue_get() already
+	 * supports multiple pending consumers, so no stealing machinery
+	 * is needed beyond spreading the consumers.
+	 */
+	for (int i = 0; i < num_workers; i++) {
+		struct k_thread *thread = (i == 0) ? &pool->work_q.thread
+						   : &pool->workers[i - 1];
+		k_thread_stack_t *stack = (k_thread_stack_t *)
+			((char *)stacks + i * K_THREAD_STACK_LEN(stack_size));
+
+		(void)k_thread_create(thread, stack, stack_size, z_work_q_main,
+				      &pool->work_q, NULL, NULL, prio, 0,
+				      K_NO_WAIT);
+		k_thread_name_set(thread, "workpool");
+	}
+}
+#endif /* CONFIG_WORK_POOL */
+
 #ifdef CONFIG_SYS_CLOCK_EXISTS
 static void work_timeout(struct _timeout *t)
 {
@@ -51,7 +80,42 @@ void k_delayed_work_init(struct k_delayed_work *work, k_work_handler_t handler)
 	k_work_init(&work->work, handler);
 	z_init_timeout(&work->timeout);
 	work->work_q = NULL;
+#ifdef CONFIG_WORK_DELAY_COALESCE
+	work->granularity_ticks = 0U;
+#endif
+}
+
+#ifdef CONFIG_WORK_DELAY_COALESCE
+/* Round the expiration up to the item's granularity, anchored to
+ * system boot, so items sharing a granularity land on the same tick
+ * and a single clock event serves all of them.
+ */
+static k_timeout_t work_coalesce_delay(struct k_delayed_work *work,
+				       k_timeout_t delay)
+{
+	uint32_t granularity = work->granularity_ticks;
+	int64_t now, expiry;
+#ifdef CONFIG_LEGACY_TIMEOUT_API
+	k_ticks_t dticks = delay;
+#else
+	k_ticks_t dticks = delay.ticks;
+#endif
+
+	if ((granularity <= 1U) || (dticks == K_TICKS_FOREVER)) {
+		return delay;
+	}
+
+	now = z_tick_get();
+	expiry = ceiling_fraction(now + dticks, granularity) * granularity;
+	dticks = (k_ticks_t)(expiry - now);
+
+#ifdef CONFIG_LEGACY_TIMEOUT_API
+	return dticks;
+#else
+	return Z_TIMEOUT_TICKS(dticks);
+#endif
 }
+#endif /* CONFIG_WORK_DELAY_COALESCE */
 
 static int work_cancel(struct k_delayed_work *work)
 {
@@ -122,6 +186,10 @@ int k_delayed_work_submit_to_queue(struct k_work_q *work_q,
 	delay = _TICK_ALIGN + k_ms_to_ticks_ceil32(delay);
 #endif
 
+#ifdef CONFIG_WORK_DELAY_COALESCE
+	delay = work_coalesce_delay(work, delay);
+#endif
+
 	/* Add timeout */
 	z_add_timeout(&work->timeout, work_timeout, delay);
 
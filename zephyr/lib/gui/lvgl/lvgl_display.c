@@ -4,8 +4,78 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <zephyr.h>
 #include "lvgl_display.h"
 
+#ifdef CONFIG_LVGL_FLUSH_ASYNC
+/* LVGL issues at most one flush at a time and renders the next region
+ * into the second buffer while it waits for lv_disp_flush_ready(), so
+ * a single request and descriptor can back every call.
+ */
+static struct display_buffer_descriptor flush_desc;
+static struct display_write_req flush_req;
+
+static void lvgl_flush_complete(const struct device *dev, int result,
+				void *user_data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(result);
+
+	lv_disp_flush_ready(user_data);
+}
+#endif /* CONFIG_LVGL_FLUSH_ASYNC */
+
+void lvgl_flush_display(struct _disp_drv_t *disp_drv, uint16_t x, uint16_t y,
+		const struct display_buffer_descriptor *desc, void *buf)
+{
+	struct device *display_dev = (struct device *)disp_drv->user_data;
+
+#ifdef CONFIG_LVGL_FLUSH_ASYNC
+	flush_desc = *desc;
+	flush_req.dev = display_dev;
+	flush_req.x = x;
+	flush_req.y = y;
+	flush_req.desc = &flush_desc;
+	flush_req.buf = buf;
+	flush_req.callback = lvgl_flush_complete;
+	flush_req.user_data = disp_drv;
+
+	if (display_write_async(&flush_req) == 0) {
+		return;
+	}
+#endif
+
+	display_write(display_dev, x, y, desc, buf);
+	lv_disp_flush_ready(disp_drv);
+}
+
+#if CONFIG_LVGL_FLUSH_REGION_ALIGN > 1
+/* Aligned dirty regions overlap more often, so LVGL's invalidation
+ * logic joins adjacent small updates into one transfer while distant
+ * updates stay separate.
+ */
+void lvgl_rounder_cb_align(struct _disp_drv_t *disp_drv, lv_area_t *area)
+{
+	const lv_coord_t align = CONFIG_LVGL_FLUSH_REGION_ALIGN;
+
+	area->x1 -= area->x1 % align;
+	area->y1 -= area->y1 % align;
+	area->x2 += align - 1 - (area->x2 % align);
+	area->y2 += align - 1 - (area->y2 % align);
+
+	if (area->x2 > disp_drv->hor_res - 1) {
+		area->x2 = disp_drv->hor_res - 1;
+	}
+	if (area->y2 > disp_drv->ver_res - 1) {
+		area->y2 = disp_drv->ver_res - 1;
+	}
+}
+
+#define LVGL_ROUNDER_CB lvgl_rounder_cb_align
+#else
+#define LVGL_ROUNDER_CB NULL
+#endif /* CONFIG_LVGL_FLUSH_REGION_ALIGN > 1 */
+
 int set_lvgl_rendering_cb(lv_disp_drv_t *disp_drv)
 {
 	int err = 0;
@@ -17,7 +87,7 @@ int set_lvgl_rendering_cb(lv_disp_drv_t *disp_drv)
 	switch (cap.current_pixel_format) {
 	case PIXEL_FORMAT_ARGB_8888:
 		disp_drv->flush_cb = lvgl_flush_cb_32bit;
-		disp_drv->rounder_cb = NULL;
+		disp_drv->rounder_cb = LVGL_ROUNDER_CB;
 #ifdef CONFIG_LVGL_COLOR_DEPTH_32
 		disp_drv->set_px_cb = NULL;
 #else
@@ -26,13 +96,13 @@ int set_lvgl_rendering_cb(lv_disp_drv_t *disp_drv)
 		break;
 	case PIXEL_FORMAT_RGB_888:
 		disp_drv->flush_cb = lvgl_flush_cb_24bit;
-		disp_drv->rounder_cb = NULL;
+		disp_drv->rounder_cb = LVGL_ROUNDER_CB;
 		disp_drv->set_px_cb = lvgl_set_px_cb_24bit;
 		break;
 	case PIXEL_FORMAT_RGB_565:
 	case PIXEL_FORMAT_BGR_565:
 		disp_drv->flush_cb = lvgl_flush_cb_16bit;
-		disp_drv->rounder_cb = NULL;
+		disp_drv->rounder_cb = LVGL_ROUNDER_CB;
 #ifdef CONFIG_LVGL_COLOR_DEPTH_16
 		disp_drv->set_px_cb = NULL;
 #else
@@ -11,7 +11,6 @@
 void lvgl_flush_cb_32bit(struct _disp_drv_t *disp_drv,
 		const lv_area_t *area, lv_color_t *color_p)
 {
-	struct device *display_dev = (struct device *)disp_drv->user_data;
 	uint16_t w = area->x2 - area->x1 + 1;
 	uint16_t h = area->y2 - area->y1 + 1;
 	struct display_buffer_descriptor desc;
@@ -20,9 +19,8 @@ void lvgl_flush_cb_32bit(struct _disp_drv_t *disp_drv,
 	desc.width = w;
 	desc.pitch = w;
 	desc.height = h;
-	display_write(display_dev, area->x1, area->y1, &desc, (void *) color_p);
-
-	lv_disp_flush_ready(disp_drv);
+	lvgl_flush_display(disp_drv, area->x1, area->y1, &desc,
+			   (void *) color_p);
 }
 
 #ifndef CONFIG_LVGL_COLOR_DEPTH_32
@@ -281,6 +281,28 @@ void *memcpy(void *_MLIBC_RESTRICT d, const void *_MLIBC_RESTRICT s, size_t n)
 		mem_word_t *d_word = (mem_word_t *)d_byte;
 		const mem_word_t *s_word = (const mem_word_t *)s_byte;
 
+#ifdef CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_MEM
+		/* Copy four words per iteration. The compiler turns this
+		 * body into multiple-register transfers (LDM/STM on ARM)
+		 * or vector moves where available.
+		 */
+		while (n >= 4 * sizeof(mem_word_t)) {
+			mem_word_t w0 = s_word[0];
+			mem_word_t w1 = s_word[1];
+			mem_word_t w2 = s_word[2];
+			mem_word_t w3 = s_word[3];
+
+			d_word[0] = w0;
+			d_word[1] = w1;
+			d_word[2] = w2;
+			d_word[3] = w3;
+
+			d_word += 4;
+			s_word += 4;
+			n -= 4 * sizeof(mem_word_t);
+		}
+#endif
+
 		while (n >= sizeof(mem_word_t)) {
 			*(d_word++) = *(s_word++);
 			n -= sizeof(mem_word_t);
@@ -333,6 +355,19 @@ void *memset(void *buf, int c, size_t n)
 	c_word |= c_word << 32;
 #endif
 
+#ifdef CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_MEM
+	/* Fill four words per iteration, see memcpy() above */
+	while (n >= 4 * sizeof(mem_word_t)) {
+		d_word[0] = c_word;
+		d_word[1] = c_word;
+		d_word[2] = c_word;
+		d_word[3] = c_word;
+
+		d_word += 4;
+		n -= 4 * sizeof(mem_word_t);
+	}
+#endif
+
 	while (n >= sizeof(mem_word_t)) {
 		*(d_word++) = c_word;
 		n -= sizeof(mem_word_t);
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <init.h>
+#include <sys/async.h>
+
+static K_THREAD_STACK_DEFINE(async_exec_stack,
+			     CONFIG_ASYNC_EXECUTOR_STACK_SIZE);
+static struct k_work_q async_exec_q;
+
+static void async_task_run(struct k_work *work)
+{
+	struct k_work_poll *twork =
+		CONTAINER_OF(work, struct k_work_poll, work);
+	struct async_task *task =
+		CONTAINER_OF(twork, struct async_task, work);
+	int ret;
+
+	ret = task->step(task);
+	if (ret == ASYNC_TASK_WAIT) {
+		ret = k_work_poll_submit_to_queue(&async_exec_q, &task->work,
+						  task->events,
+						  task->num_events,
+						  task->timeout);
+		if (ret == 0) {
+			return;
+		}
+
+		/* The await could not be armed; complete with the error
+		 * so the task is not silently lost.
+		 */
+		task->label = 0;
+		task->result = ret;
+	}
+
+	if (task->done != NULL) {
+		task->done(task, task->result);
+	}
+}
+
+void async_task_init(struct async_task *task,
+		     async_task_step_t step,
+		     async_task_done_t done)
+{
+	k_work_poll_init(&task->work, async_task_run);
+	task->step = step;
+	task->done = done;
+	task->events = NULL;
+	task->num_events = 0;
+	task->timeout = K_FOREVER;
+	task->label = 0;
+	task->result = 0;
+}
+
+void async_task_submit(struct async_task *task)
+{
+	task->label = 0;
+	task->result = 0;
+
+	k_work_submit_to_queue(&async_exec_q, &task->work.work);
+}
+
+int async_task_cancel(struct async_task *task)
+{
+	return k_work_poll_cancel(&task->work);
+}
+
+static int async_exec_init(struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	k_work_q_start(&async_exec_q,
+		       async_exec_stack,
+		       K_THREAD_STACK_SIZEOF(async_exec_stack),
+		       CONFIG_ASYNC_EXECUTOR_PRIORITY);
+	k_thread_name_set(&async_exec_q.thread, "async_exec");
+
+	return 0;
+}
+
+SYS_INIT(async_exec_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -54,6 +54,23 @@ static const uint8_t base64_dec_map[128] = {
 
 #define BASE64_SIZE_T_MAX	((size_t) -1) /* SIZE_T_MAX is not standard */
 
+#ifdef CONFIG_BASE64_FAST
+/* True if the next four characters are plain value characters: no
+ * padding, whitespace or bytes outside the alphabet. Runs of these make
+ * up almost all of a base64 stream and can skip the per-character
+ * special-case checks.
+ */
+static bool base64_dec_plain4(const uint8_t *s)
+{
+	if (((s[0] | s[1] | s[2] | s[3]) & 0x80) != 0U) {
+		return false;
+	}
+
+	return (base64_dec_map[s[0]] | base64_dec_map[s[1]] |
+		base64_dec_map[s[2]] | base64_dec_map[s[3]]) < 64U;
+}
+#endif
+
 /*
  * Encode a buffer into base64 format
  */
@@ -61,7 +78,10 @@ int base64_encode(uint8_t *dst, size_t dlen, size_t *olen, const uint8_t *src,
 		  size_t slen)
 {
 	size_t i, n;
-	int C1, C2, C3;
+	int C1, C2;
+#ifndef CONFIG_BASE64_FAST
+	int C3;
+#endif
 	uint8_t *p;
 
 	if (slen == 0) {
@@ -85,6 +105,20 @@ int base64_encode(uint8_t *dst, size_t dlen, size_t *olen, const uint8_t *src,
 
 	n = (slen / 3) * 3;
 
+#ifdef CONFIG_BASE64_FAST
+	/* Build each 24-bit group in a register once and slice it, rather
+	 * than combining bits of neighbouring bytes per output character
+	 */
+	for (i = 0, p = dst; i < n; i += 3, src += 3) {
+		uint32_t t = ((uint32_t)src[0] << 16) |
+			     ((uint32_t)src[1] << 8) | src[2];
+
+		*p++ = base64_enc_map[(t >> 18) & 0x3F];
+		*p++ = base64_enc_map[(t >> 12) & 0x3F];
+		*p++ = base64_enc_map[(t >> 6) & 0x3F];
+		*p++ = base64_enc_map[t & 0x3F];
+	}
+#else
 	for (i = 0, p = dst; i < n; i += 3) {
 		C1 = *src++;
 		C2 = *src++;
@@ -95,6 +129,7 @@ int base64_encode(uint8_t *dst, size_t dlen, size_t *olen, const uint8_t *src,
 		*p++ = base64_enc_map[(((C2 & 15) << 2) + (C3 >> 6)) & 0x3F];
 		*p++ = base64_enc_map[C3 & 0x3F];
 	}
+#endif
 
 	if (i < slen) {
 		C1 = *src++;
@@ -130,6 +165,17 @@ int base64_decode(uint8_t *dst, size_t dlen, size_t *olen, const uint8_t *src,
 
 	/* First pass: check for validity and get output length */
 	for (i = n = j = 0U; i < slen; i++) {
+#ifdef CONFIG_BASE64_FAST
+		while (j == 0U && (slen - i) >= 4 &&
+		       base64_dec_plain4(&src[i])) {
+			n += 4U;
+			i += 4U;
+		}
+
+		if (i == slen) {
+			break;
+		}
+#endif
 		/* Skip spaces before checking for EOL */
 		x = 0U;
 		while (i < slen && src[i] == ' ') {
@@ -188,7 +234,28 @@ int base64_decode(uint8_t *dst, size_t dlen, size_t *olen, const uint8_t *src,
 	}
 
 	for (j = 3U, n = x = 0U, p = dst; i > 0; i--, src++) {
+#ifdef CONFIG_BASE64_FAST
+		/* Decode whole quartets of plain value characters in one
+		 * step; validity was established by the first pass
+		 */
+		while (n == 0U && i >= 4 && base64_dec_plain4(src)) {
+			x = ((uint32_t)base64_dec_map[src[0]] << 18) |
+			    ((uint32_t)base64_dec_map[src[1]] << 12) |
+			    ((uint32_t)base64_dec_map[src[2]] << 6) |
+			    base64_dec_map[src[3]];
+
+			*p++ = (unsigned char)(x >> 16);
+			*p++ = (unsigned char)(x >> 8);
+			*p++ = (unsigned char)(x);
+
+			src += 4;
+			i -= 4;
+		}
 
+		if (i == 0) {
+			break;
+		}
+#endif
 		if (*src == '\r' || *src == '\n' || *src == ' ') {
 			continue;
 		}
@@ -6,11 +6,108 @@
 
 #include <sys/crc.h>
 
+#define CRC32_IEEE_POLY 0xEDB88320
+
 uint32_t crc32_ieee(const uint8_t *data, size_t len)
 {
 	return crc32_ieee_update(0x0, data, len);
 }
 
+#if defined(CONFIG_CRC32_SLICE_TABLE)
+
+#if defined(CONFIG_CRC32_SLICE_BY_8)
+#define CRC32_SLICES 8
+#else
+#define CRC32_SLICES 4
+#endif
+
+static uint32_t crc32_table[CRC32_SLICES][256];
+static bool crc32_table_ready;
+
+/* Build the slicing tables once on first use. Table 0 is the classic
+ * byte-at-a-time table; table N shifts a byte N positions further
+ * through the polynomial so CRC32_SLICES bytes can be folded into the
+ * running CRC with one lookup each. Concurrent first callers race
+ * benignly: every CPU computes identical values and the ready flag is
+ * only an optimization.
+ */
+static void crc32_table_init(void)
+{
+	for (uint32_t i = 0; i < 256; i++) {
+		uint32_t crc = i;
+
+		for (uint8_t j = 0; j < 8; j++) {
+			crc = (crc >> 1) ^ (CRC32_IEEE_POLY & -(crc & 1));
+		}
+		crc32_table[0][i] = crc;
+	}
+
+	for (uint32_t s = 1; s < CRC32_SLICES; s++) {
+		for (uint32_t i = 0; i < 256; i++) {
+			uint32_t crc = crc32_table[s - 1][i];
+
+			crc32_table[s][i] = (crc >> 8) ^
+					    crc32_table[0][crc & 0xff];
+		}
+	}
+
+	crc32_table_ready = true;
+}
+
+uint32_t crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+	if (!crc32_table_ready) {
+		crc32_table_init();
+	}
+
+	crc = ~crc;
+
+#if defined(CONFIG_CRC32_SLICE_BY_8)
+	while (len >= 8) {
+		/* Byte-wise loads keep this endian-neutral; compilers
+		 * fold them into word loads on little-endian targets.
+		 */
+		uint32_t lo = ((uint32_t)data[0] | (uint32_t)data[1] << 8 |
+			       (uint32_t)data[2] << 16 |
+			       (uint32_t)data[3] << 24) ^ crc;
+		uint32_t hi = (uint32_t)data[4] | (uint32_t)data[5] << 8 |
+			      (uint32_t)data[6] << 16 | (uint32_t)data[7] << 24;
+
+		crc = crc32_table[7][lo & 0xff] ^
+		      crc32_table[6][(lo >> 8) & 0xff] ^
+		      crc32_table[5][(lo >> 16) & 0xff] ^
+		      crc32_table[4][lo >> 24] ^
+		      crc32_table[3][hi & 0xff] ^
+		      crc32_table[2][(hi >> 8) & 0xff] ^
+		      crc32_table[1][(hi >> 16) & 0xff] ^
+		      crc32_table[0][hi >> 24];
+		data += 8;
+		len -= 8;
+	}
+#else
+	while (len >= 4) {
+		uint32_t word = ((uint32_t)data[0] | (uint32_t)data[1] << 8 |
+				 (uint32_t)data[2] << 16 |
+				 (uint32_t)data[3] << 24) ^ crc;
+
+		crc = crc32_table[3][word & 0xff] ^
+		      crc32_table[2][(word >> 8) & 0xff] ^
+		      crc32_table[1][(word >> 16) & 0xff] ^
+		      crc32_table[0][word >> 24];
+		data += 4;
+		len -= 4;
+	}
+#endif
+
+	while (len-- > 0) {
+		crc = (crc >> 8) ^ crc32_table[0][(crc ^ *data++) & 0xff];
+	}
+
+	return (~crc);
+}
+
+#else /* !CONFIG_CRC32_SLICE_TABLE */
+
 uint32_t crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
 {
 	crc = ~crc;
@@ -18,9 +115,11 @@ uint32_t crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
 		crc = crc ^ data[i];
 
 		for (uint8_t j = 0; j < 8; j++) {
-			crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+			crc = (crc >> 1) ^ (CRC32_IEEE_POLY & -(crc & 1));
 		}
 	}
 
 	return (~crc);
 }
+
+#endif /* CONFIG_CRC32_SLICE_TABLE */
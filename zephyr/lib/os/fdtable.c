@@ -17,12 +17,14 @@
 #include <fcntl.h>
 #include <kernel.h>
 #include <sys/fdtable.h>
+#include <sys/math_extras.h>
 #include <sys/speculation.h>
 #include <syscall_handler.h>
 
 struct fd_entry {
 	void *obj;
 	const struct fd_op_vtable *vtable;
+	atomic_t refcount;
 };
 
 /* A few magic values for fd_entry::obj used in the code. */
@@ -42,26 +44,71 @@ static struct fd_entry fdtable[CONFIG_POSIX_MAX_FDS] = {
 	 * is unused and just should be !0 (random different values
 	 * are used to posisbly help with debugging).
 	 */
-	{FD_OBJ_STDIN,  &stdinout_fd_op_vtable},
-	{FD_OBJ_STDOUT, &stdinout_fd_op_vtable},
-	{FD_OBJ_STDERR, &stdinout_fd_op_vtable},
+	{FD_OBJ_STDIN,  &stdinout_fd_op_vtable, ATOMIC_INIT(1)},
+	{FD_OBJ_STDOUT, &stdinout_fd_op_vtable, ATOMIC_INIT(1)},
+	{FD_OBJ_STDERR, &stdinout_fd_op_vtable, ATOMIC_INIT(1)},
 #endif
 };
 
-static K_MUTEX_DEFINE(fdtable_lock);
+/* Bitmap of allocated descriptors; a set bit means the slot is taken.
+ * Allocation finds and claims a clear bit with a single CAS, so
+ * unrelated descriptors never contend on a shared lock.
+ */
+static atomic_t fd_used_map[1 + (CONFIG_POSIX_MAX_FDS - 1) / ATOMIC_BITS] = {
+#ifdef CONFIG_POSIX_API
+	ATOMIC_INIT(0x7), /* stdin/stdout/stderr */
+#endif
+};
 
-static int _find_fd_entry(void)
+static void fd_entry_release(int fd)
 {
-	int fd;
+	fdtable[fd].obj = NULL;
+	fdtable[fd].vtable = NULL;
+	atomic_clear_bit(fd_used_map, fd);
+}
 
-	for (fd = 0; fd < ARRAY_SIZE(fdtable); fd++) {
-		if (fdtable[fd].obj == NULL) {
-			return fd;
+#ifdef CONFIG_POSIX_API
+/* Take a reference on an entry so a concurrent close cannot recycle the
+ * slot while an operation dispatched through it is in flight. Fails if
+ * the entry holds no finalized object. Only the POSIX wrappers dispatch
+ * operations through the table, so only they need this.
+ */
+static int fd_entry_ref(int fd)
+{
+	atomic_val_t refs;
+
+	do {
+		refs = atomic_get(&fdtable[fd].refcount);
+		if (refs == 0) {
+			errno = EBADF;
+			return -1;
 		}
-	}
+	} while (!atomic_cas(&fdtable[fd].refcount, refs, refs + 1));
 
-	errno = ENFILE;
-	return -1;
+	return 0;
+}
+#endif /* CONFIG_POSIX_API */
+
+static void fd_entry_unref(int fd)
+{
+	atomic_val_t refs;
+
+	do {
+		refs = atomic_get(&fdtable[fd].refcount);
+		if (refs == 0) {
+			/* Reserved with z_reserve_fd() but never
+			 * finalized: release the slot directly
+			 */
+			if (fdtable[fd].obj == FD_OBJ_RESERVED) {
+				fd_entry_release(fd);
+			}
+			return;
+		}
+	} while (!atomic_cas(&fdtable[fd].refcount, refs, refs - 1));
+
+	if (refs == 1) {
+		fd_entry_release(fd);
+	}
 }
 
 static int _check_fd(int fd)
@@ -115,19 +162,34 @@ void *z_get_fd_obj_and_vtable(int fd, const struct fd_op_vtable **vtable)
 
 int z_reserve_fd(void)
 {
-	int fd;
+	int i;
 
-	(void)k_mutex_lock(&fdtable_lock, K_FOREVER);
+	for (i = 0; i < ARRAY_SIZE(fd_used_map); i++) {
+		atomic_val_t val = atomic_get(&fd_used_map[i]);
 
-	fd = _find_fd_entry();
-	if (fd >= 0) {
-		/* Mark entry as used, z_finalize_fd() will fill it in. */
-		fdtable[fd].obj = FD_OBJ_RESERVED;
-	}
+		while (val != (atomic_val_t)-1) {
+			int bit = u32_count_trailing_zeros(~(uint32_t)val);
+			int fd = i * ATOMIC_BITS + bit;
 
-	k_mutex_unlock(&fdtable_lock);
+			if (fd >= CONFIG_POSIX_MAX_FDS) {
+				break;
+			}
 
-	return fd;
+			if (atomic_cas(&fd_used_map[i], val,
+				       val | (atomic_val_t)BIT(bit))) {
+				/* Mark entry as used, z_finalize_fd()
+				 * will fill it in.
+				 */
+				fdtable[fd].obj = FD_OBJ_RESERVED;
+				return fd;
+			}
+
+			val = atomic_get(&fd_used_map[i]);
+		}
+	}
+
+	errno = ENFILE;
+	return -1;
 }
 
 void z_finalize_fd(int fd, void *obj, const struct fd_op_vtable *vtable)
@@ -145,12 +207,16 @@ void z_finalize_fd(int fd, void *obj, const struct fd_op_vtable *vtable)
 #endif
 	fdtable[fd].obj = obj;
 	fdtable[fd].vtable = vtable;
+	atomic_set(&fdtable[fd].refcount, 1);
 }
 
 void z_free_fd(int fd)
 {
-	/* Assumes fd was already bounds-checked. */
-	fdtable[fd].obj = NULL;
+	/* Assumes fd was already bounds-checked. Drops the base
+	 * reference; the slot is recycled once any operations still
+	 * dispatched through it have drained.
+	 */
+	fd_entry_unref(fd);
 }
 
 int z_alloc_fd(void *obj, const struct fd_op_vtable *vtable)
@@ -169,21 +235,31 @@ int z_alloc_fd(void *obj, const struct fd_op_vtable *vtable)
 
 ssize_t read(int fd, void *buf, size_t sz)
 {
-	if (_check_fd(fd) < 0) {
+	ssize_t res;
+
+	if (_check_fd(fd) < 0 || fd_entry_ref(fd) < 0) {
 		return -1;
 	}
 
-	return fdtable[fd].vtable->read(fdtable[fd].obj, buf, sz);
+	res = fdtable[fd].vtable->read(fdtable[fd].obj, buf, sz);
+	fd_entry_unref(fd);
+
+	return res;
 }
 FUNC_ALIAS(read, _read, ssize_t);
 
 ssize_t write(int fd, const void *buf, size_t sz)
 {
-	if (_check_fd(fd) < 0) {
+	ssize_t res;
+
+	if (_check_fd(fd) < 0 || fd_entry_ref(fd) < 0) {
 		return -1;
 	}
 
-	return fdtable[fd].vtable->write(fdtable[fd].obj, buf, sz);
+	res = fdtable[fd].vtable->write(fdtable[fd].obj, buf, sz);
+	fd_entry_unref(fd);
+
+	return res;
 }
 FUNC_ALIAS(write, _write, ssize_t);
 
@@ -191,11 +267,12 @@ int close(int fd)
 {
 	int res;
 
-	if (_check_fd(fd) < 0) {
+	if (_check_fd(fd) < 0 || fd_entry_ref(fd) < 0) {
 		return -1;
 	}
 
 	res = z_fdtable_call_ioctl(fdtable[fd].vtable, fdtable[fd].obj, ZFD_IOCTL_CLOSE);
+	fd_entry_unref(fd);
 	z_free_fd(fd);
 
 	return res;
@@ -204,21 +281,31 @@ FUNC_ALIAS(close, _close, int);
 
 int fsync(int fd)
 {
-	if (_check_fd(fd) < 0) {
+	int res;
+
+	if (_check_fd(fd) < 0 || fd_entry_ref(fd) < 0) {
 		return -1;
 	}
 
-	return z_fdtable_call_ioctl(fdtable[fd].vtable, fdtable[fd].obj, ZFD_IOCTL_FSYNC);
+	res = z_fdtable_call_ioctl(fdtable[fd].vtable, fdtable[fd].obj, ZFD_IOCTL_FSYNC);
+	fd_entry_unref(fd);
+
+	return res;
 }
 
 off_t lseek(int fd, off_t offset, int whence)
 {
-	if (_check_fd(fd) < 0) {
+	off_t res;
+
+	if (_check_fd(fd) < 0 || fd_entry_ref(fd) < 0) {
 		return -1;
 	}
 
-	return z_fdtable_call_ioctl(fdtable[fd].vtable, fdtable[fd].obj, ZFD_IOCTL_LSEEK,
+	res = z_fdtable_call_ioctl(fdtable[fd].vtable, fdtable[fd].obj, ZFD_IOCTL_LSEEK,
 			  offset, whence);
+	fd_entry_unref(fd);
+
+	return res;
 }
 FUNC_ALIAS(lseek, _lseek, off_t);
 
@@ -227,7 +314,7 @@ int ioctl(int fd, unsigned long request, ...)
 	va_list args;
 	int res;
 
-	if (_check_fd(fd) < 0) {
+	if (_check_fd(fd) < 0 || fd_entry_ref(fd) < 0) {
 		return -1;
 	}
 
@@ -235,6 +322,8 @@ int ioctl(int fd, unsigned long request, ...)
 	res = fdtable[fd].vtable->ioctl(fdtable[fd].obj, request, args);
 	va_end(args);
 
+	fd_entry_unref(fd);
+
 	return res;
 }
 
@@ -255,11 +344,17 @@ int fcntl(int fd, int cmd, ...)
 		return -1;
 	}
 
+	if (fd_entry_ref(fd) < 0) {
+		return -1;
+	}
+
 	/* The rest of commands are per-fd, handled by ioctl vmethod. */
 	va_start(args, cmd);
 	res = fdtable[fd].vtable->ioctl(fdtable[fd].obj, cmd, args);
 	va_end(args);
 
+	fd_entry_unref(fd);
+
 	return res;
 }
 
@@ -5,8 +5,33 @@
  */
 #include <sys/sys_heap.h>
 #include <kernel.h>
+#include <string.h>
 #include "heap.h"
 
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+static void stats_alloc(struct z_heap *h, chunkid_t c)
+{
+	h->allocated_bytes += chunk_size(h, c) * CHUNK_UNIT;
+	if (h->allocated_bytes > h->max_allocated_bytes) {
+		h->max_allocated_bytes = h->allocated_bytes;
+	}
+}
+
+static void stats_free(struct z_heap *h, chunkid_t c)
+{
+	h->allocated_bytes -= chunk_size(h, c) * CHUNK_UNIT;
+}
+
+static void stats_alloc_fail(struct z_heap *h)
+{
+	h->failed_allocs++;
+}
+#else
+static void stats_alloc(struct z_heap *h, chunkid_t c) {}
+static void stats_free(struct z_heap *h, chunkid_t c) {}
+static void stats_alloc_fail(struct z_heap *h) {}
+#endif
+
 static void *chunk_mem(struct z_heap *h, chunkid_t c)
 {
 	chunk_unit_t *buf = chunk_buf(h);
@@ -162,10 +187,21 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 		 "corrupted heap bounds (buffer overflow?) for memory at %p",
 		 mem);
 
+	stats_free(h, c);
 	set_chunk_used(h, c, false);
 	free_chunk(h, c);
 }
 
+size_t sys_heap_usable_size(struct sys_heap *heap, void *mem)
+{
+	struct z_heap *h = heap->heap;
+	chunkid_t c = mem_to_chunkid(h, mem);
+	chunk_unit_t *buf = chunk_buf(h);
+	uint8_t *end = (uint8_t *)&buf[c + chunk_size(h, c)];
+
+	return end - (uint8_t *)mem;
+}
+
 static chunkid_t alloc_chunk(struct z_heap *h, size_t sz)
 {
 	int bi = bucket_idx(h, sz);
@@ -230,6 +266,7 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	size_t chunk_sz = bytes_to_chunksz(h, bytes);
 	chunkid_t c = alloc_chunk(h, chunk_sz);
 	if (c == 0) {
+		stats_alloc_fail(h);
 		return NULL;
 	}
 
@@ -240,6 +277,7 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	}
 
 	set_chunk_used(h, c, true);
+	stats_alloc(h, c);
 	return chunk_mem(h, c);
 }
 
@@ -266,6 +304,7 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	chunkid_t c0 = alloc_chunk(h, padded_sz);
 
 	if (c0 == 0) {
+		stats_alloc_fail(h);
 		return NULL;
 	}
 
@@ -290,6 +329,7 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	}
 
 	set_chunk_used(h, c, true);
+	stats_alloc(h, c);
 	return mem;
 }
 
@@ -316,6 +356,12 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 	h->len = buf_sz;
 	h->avail_buckets = 0;
 
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->allocated_bytes = 0;
+	h->max_allocated_bytes = 0;
+	h->failed_allocs = 0;
+#endif
+
 	int nb_buckets = bucket_idx(h, buf_sz) + 1;
 	size_t chunk0_size = chunksz(sizeof(struct z_heap) +
 				     nb_buckets * sizeof(struct z_heap_bucket));
@@ -341,3 +387,36 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 
 	free_list_add(h, chunk0_size);
 }
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+void sys_heap_runtime_stats_get(struct sys_heap *heap,
+				struct sys_heap_runtime_stats *stats)
+{
+	struct z_heap *h = heap->heap;
+	chunkid_t c;
+
+	memset(stats, 0, sizeof(*stats));
+	stats->allocated_bytes = h->allocated_bytes;
+	stats->max_allocated_bytes = h->max_allocated_bytes;
+	stats->failed_allocs = h->failed_allocs;
+
+	for (c = right_chunk(h, 0);
+	     c < h->len - min_chunk_size(h); c = right_chunk(h, c)) {
+		size_t sz = chunk_size(h, c);
+
+		if (chunk_used(h, c)) {
+			continue;
+		}
+
+		stats->free_bytes += sz * CHUNK_UNIT;
+
+		size_t usable = sz * CHUNK_UNIT - chunk_header_bytes(h);
+
+		if (usable > stats->largest_free_bytes) {
+			stats->largest_free_bytes = usable;
+		}
+
+		stats->free_chunks[bucket_idx(h, sz)]++;
+	}
+}
+#endif
@@ -61,6 +61,12 @@ struct z_heap {
 	uint64_t chunk0_hdr_area;  /* matches the largest header */
 	uint32_t len;
 	uint32_t avail_buckets;
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	/* Chunk-granular accounting, in bytes including chunk headers */
+	size_t allocated_bytes;
+	size_t max_allocated_bytes;
+	uint32_t failed_allocs;
+#endif
 	struct z_heap_bucket buckets[0];
 };
 
@@ -936,3 +936,216 @@ ssize_t json_calc_encoded_len(const struct json_obj_descr *descr,
 
 	return total;
 }
+
+/* Incremental (SAX-style) tokenizer.  Unlike the pull lexer above, which
+ * walks a complete in-memory document, this state machine is fed one
+ * chunk at a time and keeps only the token in flight in a caller
+ * provided scratch buffer.
+ */
+enum json_stream_state {
+	JSON_STREAM_ANY,
+	JSON_STREAM_STRING,
+	JSON_STREAM_STRING_ESCAPE,
+	JSON_STREAM_STRING_UNICODE,
+	JSON_STREAM_NUMBER,
+	JSON_STREAM_LITERAL,
+	JSON_STREAM_ERROR,
+};
+
+static int stream_emit(struct json_stream *stream, enum json_tokens token,
+		       const char *value, size_t len)
+{
+	return stream->cb(token, value, len, stream->user_data);
+}
+
+static int stream_save(struct json_stream *stream, char chr)
+{
+	if (stream->scratch_len >= stream->scratch_size) {
+		return -ENOMEM;
+	}
+
+	stream->scratch[stream->scratch_len++] = chr;
+
+	return 0;
+}
+
+static const char *stream_literal(enum json_tokens token)
+{
+	switch (token) {
+	case JSON_TOK_TRUE:
+		return "true";
+	case JSON_TOK_FALSE:
+		return "false";
+	default:
+		return "null";
+	}
+}
+
+static int stream_consume(struct json_stream *stream, char chr)
+{
+	int ret;
+
+	switch (stream->state) {
+	case JSON_STREAM_ANY:
+		switch (chr) {
+		case '{':
+		case '}':
+		case '[':
+		case ']':
+		case ',':
+		case ':':
+			return stream_emit(stream, (enum json_tokens)chr,
+					   NULL, 0);
+		case '"':
+			stream->scratch_len = 0;
+			stream->state = JSON_STREAM_STRING;
+			return 0;
+		case 't':
+		case 'f':
+		case 'n':
+			stream->pending = chr;
+			stream->sub = 1;
+			stream->state = JSON_STREAM_LITERAL;
+			return 0;
+		default:
+			if (isspace((int)chr)) {
+				return 0;
+			}
+
+			if (isdigit((int)chr) || chr == '-') {
+				stream->scratch_len = 0;
+				stream->state = JSON_STREAM_NUMBER;
+				return stream_save(stream, chr);
+			}
+
+			return -EINVAL;
+		}
+	case JSON_STREAM_STRING:
+		if (chr == '"') {
+			stream->state = JSON_STREAM_ANY;
+			return stream_emit(stream, JSON_TOK_STRING,
+					   stream->scratch,
+					   stream->scratch_len);
+		}
+
+		if (chr == '\\') {
+			stream->state = JSON_STREAM_STRING_ESCAPE;
+		}
+
+		return stream_save(stream, chr);
+	case JSON_STREAM_STRING_ESCAPE:
+		switch (chr) {
+		case '"':
+		case '\\':
+		case '/':
+		case 'b':
+		case 'f':
+		case 'n':
+		case 'r':
+		case 't':
+			stream->state = JSON_STREAM_STRING;
+			return stream_save(stream, chr);
+		case 'u':
+			stream->sub = 4;
+			stream->state = JSON_STREAM_STRING_UNICODE;
+			return stream_save(stream, chr);
+		default:
+			return -EINVAL;
+		}
+	case JSON_STREAM_STRING_UNICODE:
+		if (!isxdigit((int)chr)) {
+			return -EINVAL;
+		}
+
+		if (--stream->sub == 0) {
+			stream->state = JSON_STREAM_STRING;
+		}
+
+		return stream_save(stream, chr);
+	case JSON_STREAM_NUMBER:
+		if (isdigit((int)chr) || chr == '.' || chr == '-' ||
+		    chr == '+' || chr == 'e' || chr == 'E') {
+			return stream_save(stream, chr);
+		}
+
+		/* Numbers have no terminator: emit on the first
+		 * non-number character, then let it start the next token
+		 */
+		stream->state = JSON_STREAM_ANY;
+		ret = stream_emit(stream, JSON_TOK_NUMBER, stream->scratch,
+				  stream->scratch_len);
+		if (ret < 0) {
+			return ret;
+		}
+
+		return stream_consume(stream, chr);
+	case JSON_STREAM_LITERAL: {
+		const char *literal = stream_literal(stream->pending);
+
+		if (chr != literal[stream->sub]) {
+			return -EINVAL;
+		}
+
+		if (literal[++stream->sub] == '\0') {
+			stream->state = JSON_STREAM_ANY;
+			return stream_emit(stream,
+					   (enum json_tokens)stream->pending,
+					   NULL, 0);
+		}
+
+		return 0;
+	}
+	default:
+		return -EINVAL;
+	}
+}
+
+void json_stream_init(struct json_stream *stream, json_stream_cb_t cb,
+		      void *user_data, char *scratch, size_t scratch_size)
+{
+	stream->cb = cb;
+	stream->user_data = user_data;
+	stream->scratch = scratch;
+	stream->scratch_size = scratch_size;
+	stream->scratch_len = 0;
+	stream->state = JSON_STREAM_ANY;
+	stream->pending = 0;
+	stream->sub = 0;
+}
+
+int json_stream_feed(struct json_stream *stream, const char *data, size_t len)
+{
+	int ret = 0;
+
+	for (size_t i = 0; i < len && ret == 0; i++) {
+		ret = stream_consume(stream, data[i]);
+	}
+
+	if (ret < 0) {
+		stream->state = JSON_STREAM_ERROR;
+	}
+
+	return ret;
+}
+
+int json_stream_finish(struct json_stream *stream)
+{
+	int ret;
+
+	switch (stream->state) {
+	case JSON_STREAM_ANY:
+		return 0;
+	case JSON_STREAM_NUMBER:
+		stream->state = JSON_STREAM_ANY;
+		ret = stream_emit(stream, JSON_TOK_NUMBER, stream->scratch,
+				  stream->scratch_len);
+		if (ret < 0) {
+			stream->state = JSON_STREAM_ERROR;
+		}
+
+		return ret;
+	default:
+		stream->state = JSON_STREAM_ERROR;
+		return -EINVAL;
+	}
+}
@@ -20,6 +20,9 @@
 #include <syscall_handler.h>
 #include <logging/log.h>
 #include <sys/types.h>
+#ifdef CONFIG_PRINTK_DEFERRED
+#include <sys/ring_buffer.h>
+#endif
 
 typedef int (*out_func_t)(int c, void *ctx);
 
@@ -46,6 +49,56 @@ typedef uint32_t printk_val_t;
 static struct k_spinlock lock;
 #endif
 
+/* Argument source for the formatter core.  In the normal case
+ * arguments come straight from the va_list.  With deferred printk the
+ * same parser is also used to capture arguments into a package of
+ * 64-bit slots at the call site (pkg_put) and to replay them from that
+ * package on the flush thread (pkg_get); the format string dictates the
+ * types on both sides, so no type tags need to be stored.
+ */
+struct pk_args {
+	va_list *ap;
+#ifdef CONFIG_PRINTK_DEFERRED
+	uint64_t *pkg_put;
+	const uint64_t *pkg_get;
+	int idx;
+	int max;
+	bool overflow;
+#endif
+};
+
+#ifdef CONFIG_PRINTK_DEFERRED
+static uint64_t pk_arg_save(struct pk_args *args, uint64_t val)
+{
+	if (args->pkg_put != NULL) {
+		if (args->idx < args->max) {
+			args->pkg_put[args->idx++] = val;
+		} else {
+			args->overflow = true;
+		}
+	}
+
+	return val;
+}
+
+#define PK_VA_ARG(args, type)						  \
+	((args)->pkg_get != NULL					  \
+	 ? (type)(args)->pkg_get[(args)->idx++]				  \
+	 : (type)pk_arg_save((args), (uint64_t)va_arg(*(args)->ap, type)))
+
+/* Pointer-valued variant: a separate uintptr_t round trip keeps the
+ * integer/pointer casts legal on 32 bit targets
+ */
+#define PK_VA_ARG_PTR(args, type)					  \
+	((args)->pkg_get != NULL					  \
+	 ? (type)(uintptr_t)(args)->pkg_get[(args)->idx++]		  \
+	 : (type)(uintptr_t)pk_arg_save((args),				  \
+			(uint64_t)(uintptr_t)va_arg(*(args)->ap, type)))
+#else
+#define PK_VA_ARG(args, type) va_arg(*(args)->ap, type)
+#define PK_VA_ARG_PTR(args, type) va_arg(*(args)->ap, type)
+#endif
+
 #ifdef CONFIG_PRINTK
 /**
  * @brief Default character output routine that does nothing
@@ -164,11 +217,12 @@ static bool negative(printk_val_t val)
  *
  * See printk() for description.
  * @param fmt Format string
- * @param ap Variable parameters
+ * @param args Argument source (va_list or captured package)
  *
  * @return N/A
  */
-void z_vprintk(out_func_t out, void *ctx, const char *fmt, va_list ap)
+static void z_vprintk_core(out_func_t out, void *ctx, const char *fmt,
+			   struct pk_args *args)
 {
 	int might_format = 0; /* 1 if encountered a '%' */
 	enum pad_type padding = PAD_NONE;
@@ -239,17 +293,18 @@ void z_vprintk(out_func_t out, void *ctx, const char *fmt, va_list ap)
 				printk_val_t d;
 
 				if (length_mod == 'z') {
-					d = va_arg(ap, ssize_t);
+					d = PK_VA_ARG(args, ssize_t);
 				} else if (length_mod == 'l') {
-					d = va_arg(ap, long);
+					d = PK_VA_ARG(args, long);
 				} else if (length_mod == 'L') {
-					long long lld = va_arg(ap, long long);
+					long long lld =
+						PK_VA_ARG(args, long long);
 					if (!ok64(out, ctx, lld)) {
 						break;
 					}
 					d = (printk_val_t) lld;
 				} else {
-					d = va_arg(ap, int);
+					d = PK_VA_ARG(args, int);
 				}
 
 				if (*fmt != 'u' && negative(d)) {
@@ -272,20 +327,22 @@ void z_vprintk(out_func_t out, void *ctx, const char *fmt, va_list ap)
 				printk_val_t x;
 
 				if (*fmt == 'p') {
-					x = (uintptr_t)va_arg(ap, void *);
+					x = (uintptr_t)PK_VA_ARG_PTR(args,
+								     void *);
 				} else if (length_mod == 'l') {
-					x = va_arg(ap, unsigned long);
+					x = PK_VA_ARG(args, unsigned long);
 				} else if (length_mod == 'L') {
-					x = va_arg(ap, unsigned long long);
+					x = PK_VA_ARG(args,
+						      unsigned long long);
 				} else {
-					x = va_arg(ap, unsigned int);
+					x = PK_VA_ARG(args, unsigned int);
 				}
 
 				print_hex(out, ctx, x, padding, min_width);
 				break;
 			}
 			case 's': {
-				char *s = va_arg(ap, char *);
+				char *s = PK_VA_ARG_PTR(args, char *);
 				char *start = s;
 
 				while (*s) {
@@ -301,7 +358,7 @@ void z_vprintk(out_func_t out, void *ctx, const char *fmt, va_list ap)
 				break;
 			}
 			case 'c': {
-				int c = va_arg(ap, int);
+				int c = PK_VA_ARG(args, int);
 
 				out(c, ctx);
 				break;
@@ -322,6 +379,21 @@ still_might_format:
 	}
 }
 
+void z_vprintk(out_func_t out, void *ctx, const char *fmt, va_list ap)
+{
+	va_list cp;
+
+	/* Taking the address of a va_list parameter is not portable,
+	 * so route through a local copy
+	 */
+	va_copy(cp, ap);
+
+	struct pk_args args = { .ap = &cp };
+
+	z_vprintk_core(out, ctx, fmt, &args);
+	va_end(cp);
+}
+
 #ifdef CONFIG_PRINTK
 #ifdef CONFIG_USERSPACE
 struct buf_out_context {
@@ -427,6 +499,122 @@ static inline void z_vrfy_k_str_out(char *c, size_t n)
 #include <syscalls/k_str_out_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_PRINTK_DEFERRED
+/* Maximum number of conversion arguments in one packaged message;
+ * anything longer falls back to synchronous formatting
+ */
+#define PK_PKG_MAX_ARGS 8
+/* Ring item size in 32-bit words: the format pointer plus each
+ * argument occupy a 64-bit slot
+ */
+#define PK_PKG_WORDS(nargs) (2 * ((nargs) + 1))
+
+RING_BUF_ITEM_DECLARE_SIZE(pk_ring, CONFIG_PRINTK_DEFERRED_BUFFER_SIZE);
+static struct k_spinlock pk_ring_lock;
+static uint32_t pk_dropped;
+static K_SEM_DEFINE(pk_flush_sem, 0, 1);
+
+/* LCOV_EXCL_START */
+static int pk_discard_out(int c, void *ctx)
+{
+	ARG_UNUSED(ctx);
+
+	return c;
+}
+/* LCOV_EXCL_STOP */
+
+/* Package a printk call into the ring buffer for later formatting.
+ * Returns false if the message cannot be packaged (too many
+ * arguments); a full ring drops the message instead, since falling
+ * back to synchronous output under load would reintroduce the latency
+ * this path exists to avoid.
+ */
+static bool printk_defer(const char *fmt, va_list ap)
+{
+	uint64_t pkg[1 + PK_PKG_MAX_ARGS];
+	struct pk_args args = { .pkg_put = &pkg[1],
+				.max = PK_PKG_MAX_ARGS };
+	k_spinlock_key_t key;
+	va_list cp;
+	int ret;
+
+	va_copy(cp, ap);
+	args.ap = &cp;
+	z_vprintk_core(pk_discard_out, NULL, fmt, &args);
+	va_end(cp);
+
+	if (args.overflow) {
+		return false;
+	}
+
+	pkg[0] = (uint64_t)(uintptr_t)fmt;
+
+	key = k_spin_lock(&pk_ring_lock);
+	ret = ring_buf_item_put(&pk_ring, (uint16_t)args.idx, 0,
+				(uint32_t *)pkg, PK_PKG_WORDS(args.idx));
+	if (ret != 0) {
+		pk_dropped++;
+	}
+	k_spin_unlock(&pk_ring_lock, key);
+
+	if (ret == 0) {
+		k_sem_give(&pk_flush_sem);
+	}
+
+	return true;
+}
+
+static void pk_flush_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&pk_flush_sem, K_FOREVER);
+
+		while (true) {
+			uint64_t pkg[1 + PK_PKG_MAX_ARGS];
+			uint32_t dropped;
+			uint16_t nargs;
+			uint8_t value;
+			uint8_t size32 = PK_PKG_WORDS(PK_PKG_MAX_ARGS);
+			k_spinlock_key_t key;
+			int ret;
+
+			key = k_spin_lock(&pk_ring_lock);
+			ret = ring_buf_item_get(&pk_ring, &nargs, &value,
+						(uint32_t *)pkg, &size32);
+			dropped = pk_dropped;
+			pk_dropped = 0;
+			k_spin_unlock(&pk_ring_lock, key);
+
+			if (dropped != 0U) {
+				char note[48];
+				int len = snprintk(note, sizeof(note),
+					"--- %u printk messages dropped ---\n",
+					dropped);
+
+				z_impl_k_str_out(note, len);
+			}
+
+			if (ret != 0) {
+				break;
+			}
+
+			struct pk_args args = { .pkg_get = &pkg[1] };
+			struct out_context octx = { 0 };
+
+			z_vprintk_core(char_out, &octx,
+				       (const char *)(uintptr_t)pkg[0], &args);
+		}
+	}
+}
+
+K_THREAD_DEFINE(pk_flush, CONFIG_PRINTK_DEFERRED_STACK_SIZE, pk_flush_thread,
+		NULL, NULL, NULL, K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0);
+#endif /* CONFIG_PRINTK_DEFERRED */
+
 /**
  * @brief Output a string
  *
@@ -458,7 +646,21 @@ void printk(const char *fmt, ...)
 	if (IS_ENABLED(CONFIG_LOG_PRINTK)) {
 		log_printk(fmt, ap);
 	} else {
+#ifdef CONFIG_PRINTK_DEFERRED
+		bool defer = true;
+
+#ifdef CONFIG_USERSPACE
+		/* The package ring lives in kernel memory; user mode
+		 * takes the buffered k_str_out() path instead
+		 */
+		defer = !_is_user_context();
+#endif
+		if (!defer || !printk_defer(fmt, ap)) {
+			vprintk(fmt, ap);
+		}
+#else
 		vprintk(fmt, ap);
+#endif
 	}
 	va_end(ap);
 }
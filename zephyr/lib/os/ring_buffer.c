@@ -217,3 +217,85 @@ uint32_t ring_buf_get(struct ring_buf *buf, uint8_t *data, uint32_t size)
 
 	return total_size;
 }
+
+/* Copy size bytes into the data area at the free-running index idx,
+ * splitting at the wrap point when necessary
+ */
+static void spsc_copy_in(struct ring_buf_spsc *buf, uint32_t idx,
+			 const uint8_t *data, uint32_t size)
+{
+	uint32_t off = idx & buf->mask;
+	uint32_t trail = MIN(size, buf->size - off);
+
+	memcpy(&buf->buf[off], data, trail);
+	memcpy(buf->buf, data + trail, size - trail);
+}
+
+static void spsc_copy_out(struct ring_buf_spsc *buf, uint32_t idx,
+			  uint8_t *data, uint32_t size)
+{
+	uint32_t off = idx & buf->mask;
+	uint32_t trail = MIN(size, buf->size - off);
+
+	memcpy(data, &buf->buf[off], trail);
+	memcpy(data + trail, buf->buf, size - trail);
+}
+
+uint32_t ring_buf_spsc_put(struct ring_buf_spsc *buf, const uint8_t *data,
+			   uint32_t size)
+{
+	uint32_t tail = (uint32_t)atomic_get(&buf->tail);
+	uint32_t space = buf->size - (tail - buf->cached_head);
+
+	if (space < size) {
+		/* Apparently full: refresh the snapshot of the
+		 * consumer's index, pulling its cache line across just
+		 * this once
+		 */
+		buf->cached_head = (uint32_t)atomic_get(&buf->head);
+		space = buf->size - (tail - buf->cached_head);
+		size = MIN(size, space);
+	}
+
+	if (size == 0U) {
+		return 0;
+	}
+
+	spsc_copy_in(buf, tail, data, size);
+
+	/* Atomic store publishes the payload writes above to the
+	 * consumer before the new tail becomes visible
+	 */
+	atomic_set(&buf->tail, (atomic_val_t)(tail + size));
+
+	return size;
+}
+
+uint32_t ring_buf_spsc_get(struct ring_buf_spsc *buf, uint8_t *data,
+			   uint32_t size)
+{
+	uint32_t head = (uint32_t)atomic_get(&buf->head);
+	uint32_t avail = buf->cached_tail - head;
+
+	if (avail < size) {
+		/* Apparently empty: refresh the snapshot of the
+		 * producer's index
+		 */
+		buf->cached_tail = (uint32_t)atomic_get(&buf->tail);
+		avail = buf->cached_tail - head;
+		size = MIN(size, avail);
+	}
+
+	if (size == 0U) {
+		return 0;
+	}
+
+	spsc_copy_out(buf, head, data, size);
+
+	/* Atomic store orders the payload reads above before the slot
+	 * is handed back to the producer
+	 */
+	atomic_set(&buf->head, (atomic_val_t)(head + size));
+
+	return size;
+}
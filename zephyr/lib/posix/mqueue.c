@@ -17,6 +17,7 @@ typedef struct mqueue_object {
 	struct k_msgq queue;
 	atomic_t ref_count;
 	char *name;
+	uint32_t name_hash;
 } mqueue_object;
 
 typedef struct mqueue_desc {
@@ -27,8 +28,21 @@ typedef struct mqueue_desc {
 
 K_SEM_DEFINE(mq_sem, 1, 1);
 
-/* Initialize the list */
-sys_slist_t mq_list = SYS_SLIST_STATIC_INIT(&mq_list);
+/* Queues are kept in hash buckets keyed on the queue name so name
+ * resolution in mq_open() does not walk every open queue.
+ */
+static sys_slist_t mq_buckets[CONFIG_MQUEUE_HASH_BUCKETS];
+
+static uint32_t mq_name_hash(const char *name)
+{
+	uint32_t hash = 5381U;
+
+	while (*name != '\0') {
+		hash = (hash * 33U) ^ (uint32_t)*name++;
+	}
+
+	return hash;
+}
 
 int64_t timespec_to_timeoutms(const struct timespec *abstime);
 static mqueue_object *find_in_list(const char *name);
@@ -146,11 +160,15 @@ mqd_t mq_open(const char *name, int oflags, ...)
 		}
 
 		(void)atomic_set(&msg_queue->ref_count, 1);
+		msg_queue->name_hash = mq_name_hash(name);
 		/* initialize zephyr message queue */
 		k_msgq_init(&msg_queue->queue, msg_queue->mem_buffer, msg_size,
 			    max_msgs);
 		k_sem_take(&mq_sem, K_FOREVER);
-		sys_slist_append(&mq_list, (sys_snode_t *)&(msg_queue->snode));
+		sys_slist_append(
+			&mq_buckets[msg_queue->name_hash %
+				    CONFIG_MQUEUE_HASH_BUCKETS],
+			(sys_snode_t *)&(msg_queue->snode));
 		k_sem_give(&mq_sem);
 
 	} else {
@@ -343,14 +361,16 @@ int mq_setattr(mqd_t mqdes, const struct mq_attr *mqstat,
 /* Internal functions */
 static mqueue_object *find_in_list(const char *name)
 {
+	uint32_t hash = mq_name_hash(name);
 	sys_snode_t *mq;
 	mqueue_object *msg_queue;
 
-	mq = mq_list.head;
+	mq = mq_buckets[hash % CONFIG_MQUEUE_HASH_BUCKETS].head;
 
 	while (mq != NULL) {
 		msg_queue = (mqueue_object *)mq;
-		if (strcmp(msg_queue->name, name) == 0) {
+		if (msg_queue->name_hash == hash &&
+		    strcmp(msg_queue->name, name) == 0) {
 			return msg_queue;
 		}
 
@@ -419,7 +439,10 @@ static void remove_mq(mqueue_object *msg_queue)
 {
 	if (atomic_cas(&msg_queue->ref_count, 0, 0)) {
 		k_sem_take(&mq_sem, K_FOREVER);
-		sys_slist_find_and_remove(&mq_list, (sys_snode_t *) msg_queue);
+		sys_slist_find_and_remove(
+			&mq_buckets[msg_queue->name_hash %
+				    CONFIG_MQUEUE_HASH_BUCKETS],
+			(sys_snode_t *) msg_queue);
 		k_sem_give(&mq_sem);
 
 		/* Free mq buffer and pbject */
@@ -11,6 +11,58 @@
 
 int64_t timespec_to_timeoutms(const struct timespec *abstime);
 
+#ifdef CONFIG_PTHREAD_FUTEX_FASTPATH
+/* Futex-backed condition variable: the futex value is a wakeup
+ * sequence counter sampled under the mutex; a signal between the
+ * mutex release and the futex wait changes the counter, so the wait
+ * returns immediately instead of missing the wakeup.
+ */
+static int cond_wait(pthread_cond_t *cv, pthread_mutex_t *mut,
+		     k_timeout_t timeout)
+{
+	atomic_val_t seq;
+	int ret;
+
+	__ASSERT(mut->lock_count == 1U, "");
+
+	seq = atomic_get(&cv->futex.val);
+	atomic_inc(&cv->waiters);
+
+	(void)pthread_mutex_unlock(mut);
+	ret = k_futex_wait(&cv->futex, seq, timeout);
+	atomic_dec(&cv->waiters);
+	(void)pthread_mutex_lock(mut);
+
+	return ret == -ETIMEDOUT ? ETIMEDOUT : 0;
+}
+
+int pthread_cond_signal(pthread_cond_t *cv)
+{
+	atomic_inc(&cv->futex.val);
+
+	/* Stay in user mode when nobody is waiting.  A concurrent
+	 * waiter that has not yet raised the count still holds the
+	 * mutex or has already sampled an older sequence number, so
+	 * no wakeup is lost.
+	 */
+	if (atomic_get(&cv->waiters) != 0) {
+		(void)k_futex_wake(&cv->futex, false);
+	}
+
+	return 0;
+}
+
+int pthread_cond_broadcast(pthread_cond_t *cv)
+{
+	atomic_inc(&cv->futex.val);
+
+	if (atomic_get(&cv->waiters) != 0) {
+		(void)k_futex_wake(&cv->futex, true);
+	}
+
+	return 0;
+}
+#else /* !CONFIG_PTHREAD_FUTEX_FASTPATH */
 static int cond_wait(pthread_cond_t *cv, pthread_mutex_t *mut,
 		     k_timeout_t timeout)
 {
@@ -69,6 +121,7 @@ int pthread_cond_broadcast(pthread_cond_t *cv)
 
 	return 0;
 }
+#endif /* !CONFIG_PTHREAD_FUTEX_FASTPATH */
 
 int pthread_cond_wait(pthread_cond_t *cv, pthread_mutex_t *mut)
 {
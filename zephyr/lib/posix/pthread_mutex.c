@@ -20,6 +20,57 @@ static const pthread_mutexattr_t def_attr = {
 	.type = PTHREAD_MUTEX_DEFAULT,
 };
 
+#ifdef CONFIG_PTHREAD_FUTEX_FASTPATH
+/* Futex-backed mutex: the futex value is 0 when unlocked, 1 when
+ * locked and 2 when locked with (possible) waiters.  The uncontended
+ * lock and unlock paths are a single atomic operation with no kernel
+ * entry; the kernel is involved only to block and wake waiters.
+ */
+static int acquire_mutex(pthread_mutex_t *m, k_timeout_t timeout)
+{
+	int rc;
+
+	if (atomic_cas(&m->futex.val, 0, 1)) {
+		m->owner = pthread_self();
+		m->lock_count = 1U;
+		return 0;
+	}
+
+	/* The owner field is only ever equal to pthread_self() when
+	 * written by this thread, so reading it without the lock held
+	 * can not produce a false positive.
+	 */
+	if (m->owner == pthread_self()) {
+		if (m->type == PTHREAD_MUTEX_RECURSIVE &&
+		    m->lock_count < MUTEX_MAX_REC_LOCK) {
+			m->lock_count++;
+			return 0;
+		} else if (m->type == PTHREAD_MUTEX_ERRORCHECK) {
+			return EDEADLK;
+		}
+
+		return EINVAL;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return EINVAL;
+	}
+
+	/* Mark the mutex contended and block until the handover from
+	 * an unlocking thread observes value 0.
+	 */
+	while (atomic_set(&m->futex.val, 2) != 0) {
+		rc = k_futex_wait(&m->futex, 2, timeout);
+		if (rc == -ETIMEDOUT) {
+			return ETIMEDOUT;
+		}
+	}
+
+	m->owner = pthread_self();
+	m->lock_count = 1U;
+	return 0;
+}
+#else /* !CONFIG_PTHREAD_FUTEX_FASTPATH */
 static int acquire_mutex(pthread_mutex_t *m, k_timeout_t timeout)
 {
 	int rc = 0, key = irq_lock();
@@ -57,6 +108,7 @@ static int acquire_mutex(pthread_mutex_t *m, k_timeout_t timeout)
 
 	return rc;
 }
+#endif /* !CONFIG_PTHREAD_FUTEX_FASTPATH */
 
 /**
  * @brief Lock POSIX mutex with non-blocking call.
@@ -98,7 +150,11 @@ int pthread_mutex_init(pthread_mutex_t *m,
 
 	m->type = mattr->type;
 
+#ifdef CONFIG_PTHREAD_FUTEX_FASTPATH
+	(void)atomic_set(&m->futex.val, 0);
+#else
 	z_waitq_init(&m->wait_q);
+#endif
 
 	return 0;
 }
@@ -119,6 +175,35 @@ int pthread_mutex_lock(pthread_mutex_t *m)
  *
  * See IEEE 1003.1
  */
+#ifdef CONFIG_PTHREAD_FUTEX_FASTPATH
+int pthread_mutex_unlock(pthread_mutex_t *m)
+{
+	if (m->owner != pthread_self()) {
+		return EPERM;
+	}
+
+	if (m->lock_count == 0U) {
+		return EINVAL;
+	}
+
+	m->lock_count--;
+
+	if (m->lock_count > 0U) {
+		return 0;
+	}
+
+	m->owner = NULL;
+
+	/* Enter the kernel for a wakeup only when a waiter marked the
+	 * mutex contended.
+	 */
+	if (atomic_set(&m->futex.val, 0) == 2) {
+		(void)k_futex_wake(&m->futex, false);
+	}
+
+	return 0;
+}
+#else /* !CONFIG_PTHREAD_FUTEX_FASTPATH */
 int pthread_mutex_unlock(pthread_mutex_t *m)
 {
 	unsigned int key = irq_lock();
@@ -153,6 +238,7 @@ int pthread_mutex_unlock(pthread_mutex_t *m)
 	irq_unlock(key);
 	return 0;
 }
+#endif /* !CONFIG_PTHREAD_FUTEX_FASTPATH */
 
 /**
  * @brief Destroy POSIX mutex.
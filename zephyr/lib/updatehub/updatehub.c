@@ -75,6 +75,112 @@ static struct update_info {
 
 static struct k_delayed_work updatehub_work_handle;
 
+#ifdef CONFIG_UPDATEHUB_DOWNLOAD_PIPELINE
+/* Download pipeline: received payloads are queued in RAM and hashed
+ * and programmed from a dedicated thread, so flash programming
+ * overlaps reception of the next blocks.
+ */
+struct pipeline_block {
+	void *fifo_reserved;
+	size_t len;
+	bool last;
+	uint8_t data[MAX_PAYLOAD_SIZE];
+};
+
+K_MEM_SLAB_DEFINE(pipeline_slab, sizeof(struct pipeline_block),
+		  CONFIG_UPDATEHUB_PIPELINE_BLOCK_COUNT, 4);
+K_FIFO_DEFINE(pipeline_fifo);
+static K_SEM_DEFINE(pipeline_drain_sem, 0, 1);
+static atomic_t pipeline_failed;
+static enum updatehub_response pipeline_error_code;
+
+static void pipeline_thread_fn(void *p1, void *p2, void *p3)
+{
+	struct pipeline_block *block;
+	bool last;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		block = k_fifo_get(&pipeline_fifo, K_FOREVER);
+
+		if (atomic_get(&pipeline_failed) == 0) {
+			if (tc_sha256_update(&ctx.sha256sum, block->data,
+					     block->len) < 1) {
+				LOG_ERR("Could not update sha256sum");
+				pipeline_error_code = UPDATEHUB_DOWNLOAD_ERROR;
+				atomic_set(&pipeline_failed, 1);
+			} else if (flash_img_buffered_write(&ctx.flash_ctx,
+							    block->data,
+							    block->len,
+							    block->last) < 0) {
+				LOG_ERR("Error to write on the flash");
+				pipeline_error_code = UPDATEHUB_INSTALL_ERROR;
+				atomic_set(&pipeline_failed, 1);
+			}
+		}
+
+		last = block->last;
+		k_mem_slab_free(&pipeline_slab, (void **)&block);
+
+		if (last) {
+			k_sem_give(&pipeline_drain_sem);
+		}
+	}
+}
+
+K_THREAD_DEFINE(pipeline_tid, CONFIG_UPDATEHUB_PIPELINE_STACK_SIZE,
+		pipeline_thread_fn, NULL, NULL, NULL,
+		K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0);
+
+static int pipeline_submit(const uint8_t *data, size_t len, bool last)
+{
+	struct pipeline_block *block;
+
+	if (atomic_get(&pipeline_failed) != 0) {
+		return -EIO;
+	}
+
+	/* Blocks when the ring is full, throttling reception to the
+	 * flash programming rate.
+	 */
+	(void)k_mem_slab_alloc(&pipeline_slab, (void **)&block, K_FOREVER);
+
+	memcpy(block->data, data, len);
+	block->len = len;
+	block->last = last;
+	k_fifo_put(&pipeline_fifo, block);
+
+	return 0;
+}
+
+static void pipeline_reset(void)
+{
+	struct pipeline_block *block;
+
+	while ((block = k_fifo_get(&pipeline_fifo, K_NO_WAIT)) != NULL) {
+		k_mem_slab_free(&pipeline_slab, (void **)&block);
+	}
+
+	k_sem_reset(&pipeline_drain_sem);
+	atomic_clear(&pipeline_failed);
+}
+
+/* Waits until every queued block has been written out. */
+static enum updatehub_response pipeline_finish(void)
+{
+	k_sem_take(&pipeline_drain_sem, K_FOREVER);
+
+	if (atomic_get(&pipeline_failed) != 0) {
+		return pipeline_error_code;
+	}
+
+	return UPDATEHUB_OK;
+}
+#endif /* CONFIG_UPDATEHUB_DOWNLOAD_PIPELINE */
+
 static int bin2hex_str(uint8_t *bin, size_t bin_len, char *str, size_t str_buf_len)
 {
 	if (bin == NULL || str == NULL) {
@@ -443,6 +549,14 @@ static void install_update_cb(void)
 	ctx.downloaded_size = ctx.downloaded_size +
 			      (response_packet.max_len - response_packet.offset);
 
+#ifdef CONFIG_UPDATEHUB_DOWNLOAD_PIPELINE
+	if (pipeline_submit(response_packet.data + response_packet.offset,
+			    response_packet.max_len - response_packet.offset,
+			    ctx.downloaded_size == ctx.block.total_size) < 0) {
+		ctx.code_status = pipeline_error_code;
+		goto cleanup;
+	}
+#else
 	if (tc_sha256_update(&ctx.sha256sum,
 			     response_packet.data + response_packet.offset,
 			     response_packet.max_len - response_packet.offset) < 1) {
@@ -459,6 +573,7 @@ static void install_update_cb(void)
 		ctx.code_status = UPDATEHUB_INSTALL_ERROR;
 		goto cleanup;
 	}
+#endif /* CONFIG_UPDATEHUB_DOWNLOAD_PIPELINE */
 
 	if (coap_update_from_block(&response_packet, &ctx.block) < 0) {
 		ctx.code_status = UPDATEHUB_DOWNLOAD_ERROR;
@@ -473,6 +588,14 @@ static void install_update_cb(void)
 		}
 
 		LOG_INF("Firmware downloaded successfully");
+
+#ifdef CONFIG_UPDATEHUB_DOWNLOAD_PIPELINE
+		ctx.code_status = pipeline_finish();
+		if (ctx.code_status != UPDATEHUB_OK) {
+			goto cleanup;
+		}
+#endif
+
 		if (!install_update_cb_sha256()) {
 			LOG_ERR("Firmware validation has failed");
 			ctx.code_status = UPDATEHUB_DOWNLOAD_ERROR;
@@ -488,6 +611,10 @@ cleanup:
 
 static enum updatehub_response install_update(void)
 {
+#ifdef CONFIG_UPDATEHUB_DOWNLOAD_RESUME
+	int reconnects = 0;
+#endif
+
 	if (boot_erase_img_bank(FLASH_AREA_ID(image_1)) != 0) {
 		LOG_ERR("Failed to init flash and erase second slot");
 		ctx.code_status = UPDATEHUB_FLASH_INIT_ERROR;
@@ -524,6 +651,10 @@ static enum updatehub_response install_update(void)
 	updatehub_blk_set(UPDATEHUB_BLK_INDEX, 0);
 	updatehub_blk_set(UPDATEHUB_BLK_TX_AVAILABLE, 1);
 
+#ifdef CONFIG_UPDATEHUB_DOWNLOAD_PIPELINE
+	pipeline_reset();
+#endif
+
 	while (ctx.downloaded_size != ctx.block.total_size) {
 		if (updatehub_blk_get(UPDATEHUB_BLK_TX_AVAILABLE)) {
 			if (send_request(COAP_TYPE_CON, COAP_METHOD_GET,
@@ -553,6 +684,29 @@ static enum updatehub_response install_update(void)
 		    CONFIG_UPDATEHUB_COAP_MAX_RETRY) {
 			updatehub_tmr_stop();
 
+#ifdef CONFIG_UPDATEHUB_DOWNLOAD_RESUME
+			/* All retries of this block went unanswered, so
+			 * assume the connection is gone and re-establish it.
+			 * The block context keeps the current offset and the
+			 * hash and flash state are untouched, so the transfer
+			 * continues where it stopped.
+			 */
+			if (reconnects < CONFIG_UPDATEHUB_RECONNECT_ATTEMPTS) {
+				reconnects++;
+
+				LOG_WRN("Connection lost, resuming at "
+					"offset %d", ctx.downloaded_size);
+				cleanup_connection();
+				if (!start_coap_client()) {
+					goto error;
+				}
+
+				updatehub_blk_set(UPDATEHUB_BLK_ATTEMPT, 0);
+				updatehub_blk_set(UPDATEHUB_BLK_TX_AVAILABLE, 1);
+				continue;
+			}
+#endif /* CONFIG_UPDATEHUB_DOWNLOAD_RESUME */
+
 			LOG_ERR("Could not get the packet");
 			ctx.code_status = UPDATEHUB_DOWNLOAD_ERROR;
 			goto cleanup;
@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2020 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Decode dictionary-based binary logs (CONFIG_LOG_DICTIONARY_OUTPUT).
+
+The device emits one record per message; strings are referenced by their
+address in the image and resolved here against the matching ELF file.
+
+Record layout (all multi-byte fields little-endian):
+
+  u8   sync       0xD7
+  u8   type       1 = standard, 2 = hexdump, 3 = raw string (printk)
+  u8   level
+  u8   domain_id
+  u16  source_id
+  u32  timestamp
+  u32  string address (format string, or hexdump caption)
+  u8   nargs      (0 for hexdump/raw string)
+  u16  str_mask   (bit n set: argument n's contents appended inline)
+  u32  arg[nargs]
+  -- standard: for each bit set in str_mask, in argument order:
+  u16  length, followed by that many bytes of string data
+  -- hexdump/raw string: chunked payload:
+  u16  length, followed by that many bytes; a length shorter than 32
+       (including zero) terminates the record
+
+Usage:
+  ./parse_log_dict.py zephyr.elf log.bin
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+from elftools.elf.elffile import ELFFile
+
+SYNC_BYTE = 0xD7
+MSG_TYPE_STD = 1
+MSG_TYPE_HEXDUMP = 2
+MSG_TYPE_RAW_STR = 3
+HEXDUMP_CHUNK = 32
+
+LEVELS = ["none", "err", "wrn", "inf", "dbg"]
+
+# %[flags][width][.precision][length]conversion
+CONVERSION_RE = re.compile(r"%[-+ #0]*[0-9*]*(?:\.[0-9*]+)?(?:hh|h|l|ll|z|j|t)?([diouxXcspn%])")
+
+
+class Image:
+    """Read-only view of the loadable sections of the ELF file."""
+
+    def __init__(self, elf_path):
+        self.sections = []
+        with open(elf_path, "rb") as f:
+            elf = ELFFile(f)
+            for section in elf.iter_sections():
+                # SHF_ALLOC sections with contents
+                if section["sh_flags"] & 0x2 and section["sh_type"] != "SHT_NOBITS":
+                    self.sections.append((section["sh_addr"],
+                                          section.data()))
+
+    def string_at(self, addr):
+        for base, data in self.sections:
+            if base <= addr < base + len(data):
+                end = data.find(b"\x00", addr - base)
+                if end < 0:
+                    end = len(data)
+                return data[addr - base:end].decode("latin-1")
+        return None
+
+
+def format_message(image, fmt, args, inline_strings):
+    """Render fmt with raw argument words, printf-style."""
+    out = []
+    pos = 0
+    arg_idx = 0
+    inline = list(inline_strings)
+
+    for match in CONVERSION_RE.finditer(fmt):
+        out.append(fmt[pos:match.start()])
+        pos = match.end()
+        conv = match.group(1)
+        if conv == "%":
+            out.append("%")
+            continue
+        if arg_idx >= len(args):
+            out.append(match.group(0))
+            continue
+        arg = args[arg_idx]
+        arg_idx += 1
+        if conv == "s":
+            if inline and inline[0][0] == arg_idx - 1:
+                out.append(inline.pop(0)[1])
+            else:
+                out.append(image.string_at(arg) or "<0x%08x>" % arg)
+        elif conv in "di":
+            # sign-extend 32-bit value
+            out.append(str(struct.unpack("<i", struct.pack("<I", arg))[0]))
+        elif conv == "c":
+            out.append(chr(arg & 0xFF))
+        elif conv == "p":
+            out.append("0x%08x" % arg)
+        else:
+            try:
+                out.append(("%" + match.group(0)[1:]) % arg)
+            except (TypeError, ValueError):
+                out.append(str(arg))
+
+    out.append(fmt[pos:])
+    return "".join(out)
+
+
+class Stream:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def left(self):
+        return len(self.data) - self.pos
+
+    def u8(self):
+        v = self.data[self.pos]
+        self.pos += 1
+        return v
+
+    def u16(self):
+        v = struct.unpack_from("<H", self.data, self.pos)[0]
+        self.pos += 2
+        return v
+
+    def u32(self):
+        v = struct.unpack_from("<I", self.data, self.pos)[0]
+        self.pos += 4
+        return v
+
+    def bytes(self, n):
+        v = self.data[self.pos:self.pos + n]
+        self.pos += n
+        return v
+
+
+def parse_stream(image, stream):
+    while stream.left() >= 16:
+        if stream.u8() != SYNC_BYTE:
+            continue
+
+        msg_type = stream.u8()
+        level = stream.u8()
+        stream.u8()  # domain_id
+        source_id = stream.u16()
+        timestamp = stream.u32()
+        str_addr = stream.u32()
+        nargs = stream.u8()
+        str_mask = stream.u16()
+
+        if msg_type == MSG_TYPE_STD:
+            args = [stream.u32() for _ in range(nargs)]
+            inline_strings = []
+            for i in range(nargs):
+                if str_mask & (1 << i):
+                    length = stream.u16()
+                    inline_strings.append(
+                        (i, stream.bytes(length).decode("latin-1")))
+            fmt = image.string_at(str_addr) or "<0x%08x>" % str_addr
+            text = format_message(image, fmt, args, inline_strings)
+            level_str = LEVELS[level] if level < len(LEVELS) else str(level)
+            print("[%10u] <%s> src=%u: %s"
+                  % (timestamp, level_str, source_id, text))
+        else:
+            payload = b""
+            while True:
+                length = stream.u16()
+                payload += stream.bytes(length)
+                if length < HEXDUMP_CHUNK:
+                    break
+            if msg_type == MSG_TYPE_RAW_STR:
+                sys.stdout.write(payload.decode("latin-1"))
+            else:
+                caption = image.string_at(str_addr) or ""
+                print("[%10u] src=%u: %s" % (timestamp, source_id, caption))
+                for off in range(0, len(payload), 16):
+                    chunk = payload[off:off + 16]
+                    hexpart = " ".join("%02x" % b for b in chunk)
+                    print("  %04x: %s" % (off, hexpart))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawTextHelpFormatter)
+    parser.add_argument("elf", help="ELF file the target is running")
+    parser.add_argument("log", help="captured binary log ('-' for stdin)")
+    args = parser.parse_args()
+
+    image = Image(args.elf)
+    if args.log == "-":
+        data = sys.stdin.buffer.read()
+    else:
+        with open(args.log, "rb") as f:
+            data = f.read()
+
+    parse_stream(image, Stream(data))
+
+
+if __name__ == "__main__":
+    main()
@@ -55,6 +55,14 @@ struct ticker_node {
 	uint16_t lazy_current;		 /* Current number of timeouts
 					  * skipped = slave latency
 					  */
+#if defined(CONFIG_BT_TICKER_CONFLICT_PRECALC)
+	uint8_t  resolve_valid;		 /* Precomputed collision verdict
+					  * below is current
+					  */
+	uint8_t  resolve_skip;		 /* Collision verdict precomputed
+					  * in job context
+					  */
+#endif /* CONFIG_BT_TICKER_CONFLICT_PRECALC */
 	union {
 		uint32_t remainder_periodic;  /* Sub-microsecond tick remainder
 					       * for each period
@@ -742,6 +750,66 @@ static uint8_t ticker_resolve_collision(struct ticker_node *nodes,
 
 	return 0U;
 }
+
+#if defined(CONFIG_BT_TICKER_CONFLICT_PRECALC)
+/**
+ * @brief Precompute collision verdicts for queued ticker nodes
+ *
+ * @details Runs in the lower priority job context after the ticker node
+ * list has been updated. The collision verdict of a node depends only on
+ * the nodes queued after it, and the list is mutated exclusively by the
+ * job, so the verdicts stay exact until the next job execution and the
+ * high priority worker can consume them instead of traversing the list
+ * for every expiring node.
+ *
+ * @param instance Pointer to ticker instance
+ * @internal
+ */
+static void ticker_job_resolve_precalc(struct ticker_instance *instance)
+{
+	struct ticker_node *node = &instance->nodes[0];
+	uint8_t id = instance->ticker_id_head;
+
+	while (id != TICKER_NULL) {
+		struct ticker_node *ticker = &node[id];
+
+		if (ticker->ticks_slot != 0U) {
+			ticker->resolve_skip =
+				ticker_resolve_collision(node, ticker);
+			ticker->resolve_valid = 1U;
+		}
+
+		id = ticker->next;
+	}
+}
+#endif /* CONFIG_BT_TICKER_CONFLICT_PRECALC */
+
+/**
+ * @brief Resolve ticker node collision in worker context
+ *
+ * @details Returns the collision verdict precomputed by the job if one
+ * is available, and falls back to resolving on the fly otherwise. The
+ * verdict is consumed so that a stale value is never used twice.
+ *
+ * @param nodes  Pointer to ticker node array
+ * @param ticker Pointer to ticker to resolve
+ *
+ * @return See ticker_resolve_collision
+ * @internal
+ */
+static uint8_t ticker_worker_resolve(struct ticker_node *nodes,
+				     struct ticker_node *ticker)
+{
+#if defined(CONFIG_BT_TICKER_CONFLICT_PRECALC)
+	if (ticker->resolve_valid) {
+		ticker->resolve_valid = 0U;
+
+		return ticker->resolve_skip;
+	}
+#endif /* CONFIG_BT_TICKER_CONFLICT_PRECALC */
+
+	return ticker_resolve_collision(nodes, ticker);
+}
 #endif /* !CONFIG_BT_TICKER_COMPATIBILITY_MODE */
 
 /**
@@ -830,7 +898,7 @@ void ticker_worker(void *param)
 		 * with other ticker nodes
 		 */
 		if (ticker->ticks_slot != 0U &&
-		   (slot_reserved || ticker_resolve_collision(node, ticker))) {
+		   (slot_reserved || ticker_worker_resolve(node, ticker))) {
 #if defined(CONFIG_BT_TICKER_EXT)
 			struct ticker_ext *ext_data = ticker->ext_data;
 
@@ -2324,6 +2392,13 @@ void ticker_job(void *param)
 		ticker_job_list_inquire(instance);
 	}
 
+#if defined(CONFIG_BT_TICKER_CONFLICT_PRECALC)
+	/* Precompute collision verdicts for the worker now that the node
+	 * list is stable until the next job execution
+	 */
+	ticker_job_resolve_precalc(instance);
+#endif /* CONFIG_BT_TICKER_CONFLICT_PRECALC */
+
 	/* Permit worker job to run */
 	instance->job_guard = 0U;
 
@@ -15,6 +15,59 @@
 #define LOG_MODULE_NAME bt_aes_ccm
 #include "common/log.h"
 
+#if defined(CONFIG_BT_HOST_CRYPTO_ACCEL)
+#include <crypto/cipher.h>
+
+#include "crypto.h"
+
+/* Run a complete CCM operation, including the MIC, on the crypto driver */
+static int ccm_hw_op(enum cipher_op op_type, const uint8_t key[16],
+		     uint8_t nonce[13], const uint8_t *in_msg, size_t msg_len,
+		     const uint8_t *aad, size_t aad_len, uint8_t *out_msg,
+		     uint8_t *tag, size_t mic_size)
+{
+	struct device *dev = bt_crypto_accel_dev();
+	struct cipher_ctx ctx = {
+		.key.bit_stream = (uint8_t *)key,
+		.keylen = 16,
+		.mode_params.ccm_info = {
+			.nonce_len = 13,
+			.tag_len = mic_size,
+		},
+		.flags = CAP_RAW_KEY | CAP_SEPARATE_IO_BUFS | CAP_SYNC_OPS,
+	};
+	struct cipher_pkt pkt = {
+		.in_buf = (uint8_t *)in_msg,
+		.in_len = msg_len,
+		.out_buf = out_msg,
+		.out_buf_max = msg_len + mic_size,
+	};
+	struct cipher_aead_pkt apkt = {
+		.ad = (uint8_t *)aad,
+		.ad_len = aad_len,
+		.tag = tag,
+		.pkt = &pkt,
+	};
+	int err;
+
+	if (!dev) {
+		return -ENODEV;
+	}
+
+	err = cipher_begin_session(dev, &ctx, CRYPTO_CIPHER_ALGO_AES,
+				   CRYPTO_CIPHER_MODE_CCM, op_type);
+	if (err) {
+		return err;
+	}
+
+	err = cipher_ccm_op(&ctx, &apkt, nonce);
+
+	cipher_free_session(dev, &ctx);
+
+	return err;
+}
+#endif /* CONFIG_BT_HOST_CRYPTO_ACCEL */
+
 static inline void xor16(uint8_t *dst, const uint8_t *a, const uint8_t *b)
 {
 	dst[0] = a[0] ^ b[0];
@@ -196,6 +249,14 @@ int bt_ccm_decrypt(const uint8_t key[16], uint8_t nonce[13], const uint8_t *enc_
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_BT_HOST_CRYPTO_ACCEL)
+	if (!ccm_hw_op(CRYPTO_CIPHER_OP_DECRYPT, key, nonce, enc_msg, msg_len,
+		       aad, aad_len, out_msg,
+		       (uint8_t *)(enc_msg + msg_len), mic_size)) {
+		return 0;
+	}
+#endif /* CONFIG_BT_HOST_CRYPTO_ACCEL */
+
 	ccm_crypt(key, nonce, enc_msg, out_msg, msg_len);
 
 	ccm_auth(key, nonce, out_msg, msg_len, aad, aad_len, mic, mic_size);
@@ -223,6 +284,13 @@ int bt_ccm_encrypt(const uint8_t key[16], uint8_t nonce[13], const uint8_t *msg,
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_BT_HOST_CRYPTO_ACCEL)
+	if (!ccm_hw_op(CRYPTO_CIPHER_OP_ENCRYPT, key, nonce, msg, msg_len,
+		       aad, aad_len, out_msg, mic, mic_size)) {
+		return 0;
+	}
+#endif /* CONFIG_BT_HOST_CRYPTO_ACCEL */
+
 	ccm_auth(key, nonce, out_msg, msg_len, aad, aad_len, mic, mic_size);
 
 	ccm_crypt(key, nonce, msg, out_msg, msg_len);
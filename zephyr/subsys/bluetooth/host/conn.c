@@ -1409,6 +1409,8 @@ static bool send_frag(struct bt_conn *conn, struct net_buf *buf, uint8_t flags,
 		goto fail;
 	}
 
+	atomic_inc(&conn->tx_in_flight);
+
 	return true;
 
 fail:
@@ -1577,7 +1579,34 @@ void bt_conn_process_tx(struct bt_conn *conn)
 	BT_ASSERT(buf);
 	if (!send_buf(conn, buf)) {
 		net_buf_unref(buf);
+		return;
+	}
+
+#if defined(CONFIG_BT_CONN_TX_BATCH)
+	/* Keep the controller buffer pool topped up while more packets are
+	 * queued and buffers are free, instead of paying a poll round trip
+	 * per packet. The loop never blocks on the packet semaphore and the
+	 * per-connection quota bounds how many free buffers one connection
+	 * may claim in a row, so other connections can interleave.
+	 */
+	while (k_sem_count_get(bt_conn_get_pkts(conn)) > 0) {
+		if (CONFIG_BT_CONN_TX_QUOTA > 0 &&
+		    atomic_get(&conn->tx_in_flight) >=
+		    CONFIG_BT_CONN_TX_QUOTA) {
+			break;
+		}
+
+		buf = net_buf_get(&conn->tx_queue, K_NO_WAIT);
+		if (!buf) {
+			break;
+		}
+
+		if (!send_buf(conn, buf)) {
+			net_buf_unref(buf);
+			break;
+		}
 	}
+#endif /* CONFIG_BT_CONN_TX_BATCH */
 }
 
 bool bt_conn_exists_le(uint8_t id, const bt_addr_le_t *peer)
@@ -1635,6 +1664,7 @@ static void process_unack_tx(struct bt_conn *conn)
 		if (conn->pending_no_cb) {
 			conn->pending_no_cb--;
 			irq_unlock(key);
+			atomic_dec(&conn->tx_in_flight);
 			k_sem_give(bt_conn_get_pkts(conn));
 			continue;
 		}
@@ -1655,8 +1685,12 @@ static void process_unack_tx(struct bt_conn *conn)
 
 		tx_free(tx);
 
+		atomic_dec(&conn->tx_in_flight);
 		k_sem_give(bt_conn_get_pkts(conn));
 	}
+
+	/* Everything pending has been returned */
+	atomic_set(&conn->tx_in_flight, 0);
 }
 
 void bt_conn_set_state(struct bt_conn *conn, bt_conn_state_t state)
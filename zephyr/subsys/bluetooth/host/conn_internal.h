@@ -136,6 +136,11 @@ struct bt_conn {
 	 */
 	uint32_t                   pending_no_cb;
 
+	/* Number of ACL fragments sent to the controller and not yet
+	 * acknowledged through Number of Completed Packets.
+	 */
+	atomic_t		tx_in_flight;
+
 	/* Completed TX for which we need to call the callback */
 	sys_slist_t		tx_complete;
 	struct k_work           tx_complete_work;
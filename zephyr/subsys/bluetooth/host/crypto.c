@@ -21,14 +21,87 @@
 #include <tinycrypt/aes.h>
 #include <tinycrypt/utils.h>
 
+#if defined(CONFIG_BT_HOST_CRYPTO_ACCEL)
+#include <crypto/cipher.h>
+#endif
+
 #define BT_DBG_ENABLED IS_ENABLED(CONFIG_BT_DEBUG_HCI_CORE)
 #define LOG_MODULE_NAME bt_crypto
 #include "common/log.h"
 
 #include "hci_core.h"
+#include "crypto.h"
 
 static struct tc_hmac_prng_struct prng;
 
+#if defined(CONFIG_BT_HOST_CRYPTO_ACCEL)
+/* Capabilities the host requires from a crypto driver to offload AES */
+#define BT_CRYPTO_HWCAPS (CAP_RAW_KEY | CAP_SEPARATE_IO_BUFS | CAP_SYNC_OPS)
+
+struct device *bt_crypto_accel_dev(void)
+{
+	static struct device *dev;
+	static bool probed;
+
+	if (probed) {
+		return dev;
+	}
+
+	probed = true;
+
+	dev = device_get_binding(CONFIG_BT_HOST_CRYPTO_DEV_NAME);
+	if (!dev) {
+		BT_WARN("Crypto device %s not found, using software AES",
+			CONFIG_BT_HOST_CRYPTO_DEV_NAME);
+		return NULL;
+	}
+
+	if ((cipher_query_hwcaps(dev) & BT_CRYPTO_HWCAPS) !=
+	    BT_CRYPTO_HWCAPS) {
+		BT_WARN("Crypto device %s lacks required capabilities, "
+			"using software AES", CONFIG_BT_HOST_CRYPTO_DEV_NAME);
+		dev = NULL;
+	}
+
+	return dev;
+}
+
+static int hw_encrypt_be(const uint8_t key[16], const uint8_t plaintext[16],
+			 uint8_t enc_data[16])
+{
+	struct device *dev = bt_crypto_accel_dev();
+	struct cipher_ctx ctx = {
+		.key.bit_stream = (uint8_t *)key,
+		.keylen = 16,
+		.flags = BT_CRYPTO_HWCAPS,
+	};
+	struct cipher_pkt pkt = {
+		.in_buf = (uint8_t *)plaintext,
+		.in_len = 16,
+		.out_buf = enc_data,
+		.out_buf_max = 16,
+	};
+	int err;
+
+	if (!dev) {
+		return -ENODEV;
+	}
+
+	err = cipher_begin_session(dev, &ctx, CRYPTO_CIPHER_ALGO_AES,
+				   CRYPTO_CIPHER_MODE_ECB,
+				   CRYPTO_CIPHER_OP_ENCRYPT);
+	if (err) {
+		return err;
+	}
+
+	err = cipher_block_op(&ctx, &pkt);
+
+	cipher_free_session(dev, &ctx);
+
+	return err;
+}
+#endif /* CONFIG_BT_HOST_CRYPTO_ACCEL */
+
 static int prng_reseed(struct tc_hmac_prng_struct *h)
 {
 	uint8_t seed[32];
@@ -124,6 +197,23 @@ int bt_encrypt_le(const uint8_t key[16], const uint8_t plaintext[16],
 	BT_DBG("key %s", bt_hex(key, 16));
 	BT_DBG("plaintext %s", bt_hex(plaintext, 16));
 
+#if defined(CONFIG_BT_HOST_CRYPTO_ACCEL)
+	{
+		uint8_t pt_be[16];
+
+		sys_memcpy_swap(tmp, key, 16);
+		sys_memcpy_swap(pt_be, plaintext, 16);
+
+		if (!hw_encrypt_be(tmp, pt_be, enc_data)) {
+			sys_mem_swap(enc_data, 16);
+
+			BT_DBG("enc_data %s", bt_hex(enc_data, 16));
+
+			return 0;
+		}
+	}
+#endif /* CONFIG_BT_HOST_CRYPTO_ACCEL */
+
 	sys_memcpy_swap(tmp, key, 16);
 
 	if (tc_aes128_set_encrypt_key(&s, tmp) == TC_CRYPTO_FAIL) {
@@ -151,6 +241,14 @@ int bt_encrypt_be(const uint8_t key[16], const uint8_t plaintext[16],
 	BT_DBG("key %s", bt_hex(key, 16));
 	BT_DBG("plaintext %s", bt_hex(plaintext, 16));
 
+#if defined(CONFIG_BT_HOST_CRYPTO_ACCEL)
+	if (!hw_encrypt_be(key, plaintext, enc_data)) {
+		BT_DBG("enc_data %s", bt_hex(enc_data, 16));
+
+		return 0;
+	}
+#endif /* CONFIG_BT_HOST_CRYPTO_ACCEL */
+
 	if (tc_aes128_set_encrypt_key(&s, key) == TC_CRYPTO_FAIL) {
 		return -EINVAL;
 	}
@@ -6,3 +6,8 @@
  */
 
 int prng_init(void);
+
+#if defined(CONFIG_BT_HOST_CRYPTO_ACCEL)
+/* Crypto driver used to offload AES operations, NULL if none is usable */
+struct device *bt_crypto_accel_dev(void);
+#endif
@@ -1361,7 +1361,29 @@ static void foreach_attr_type_dyndb(uint16_t start_handle, uint16_t end_handle,
 			}
 		}
 
-		for (i = 0; i < svc->attr_count; i++) {
+		i = 0;
+
+#if defined(CONFIG_BT_GATT_ATTR_LOOKUP)
+		{
+			/* Attributes are sorted by handle within a service
+			 * so binary search for the first one within the
+			 * requested range.
+			 */
+			size_t top = svc->attr_count;
+
+			while (i < top) {
+				size_t mid = (i + top) / 2;
+
+				if (svc->attrs[mid].handle < start_handle) {
+					i = mid + 1;
+				} else {
+					top = mid;
+				}
+			}
+		}
+#endif /* CONFIG_BT_GATT_ATTR_LOOKUP */
+
+		for (; i < svc->attr_count; i++) {
 			struct bt_gatt_attr *attr = &svc->attrs[i];
 
 			if (gatt_foreach_iter(attr,
@@ -1399,7 +1421,20 @@ void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 				continue;
 			}
 
-			for (i = 0; i < static_svc->attr_count; i++, handle++) {
+			i = 0;
+
+#if defined(CONFIG_BT_GATT_ATTR_LOOKUP)
+			/* Static handles are contiguous so the first
+			 * attribute within the range can be indexed directly.
+			 */
+			if (start_handle > handle) {
+				i = MIN((size_t)(start_handle - handle),
+					static_svc->attr_count);
+				handle += i;
+			}
+#endif /* CONFIG_BT_GATT_ATTR_LOOKUP */
+
+			for (; i < static_svc->attr_count; i++, handle++) {
 				struct bt_gatt_attr attr;
 
 				memcpy(&attr, &static_svc->attrs[i],
@@ -1969,26 +2004,13 @@ static uint8_t match_uuid(const struct bt_gatt_attr *attr, void *user_data)
 	return BT_GATT_ITER_STOP;
 }
 
-int bt_gatt_notify_cb(struct bt_conn *conn,
-		      struct bt_gatt_notify_params *params)
+/* Resolve the value handle a notification parameter block refers to */
+static int gatt_notify_resolve(struct bt_gatt_notify_params *params,
+			       uint16_t *out_handle)
 {
-	struct notify_data data;
-	const struct bt_gatt_attr *attr;
+	const struct bt_gatt_attr *attr = params->attr;
 	uint16_t handle;
 
-	__ASSERT(params, "invalid parameters\n");
-	__ASSERT(params->attr, "invalid parameters\n");
-
-	if (!atomic_test_bit(bt_dev.flags, BT_DEV_READY)) {
-		return -EAGAIN;
-	}
-
-	attr = params->attr;
-
-	if (conn && conn->state != BT_CONN_CONNECTED) {
-		return -ENOTCONN;
-	}
-
 	handle = attr->handle ? : find_static_attr(attr);
 	if (!handle) {
 		return -ENOENT;
@@ -2021,6 +2043,34 @@ int bt_gatt_notify_cb(struct bt_conn *conn,
 		handle = bt_gatt_attr_value_handle(attr);
 	}
 
+	*out_handle = handle;
+
+	return 0;
+}
+
+int bt_gatt_notify_cb(struct bt_conn *conn,
+		      struct bt_gatt_notify_params *params)
+{
+	struct notify_data data;
+	uint16_t handle;
+	int err;
+
+	__ASSERT(params, "invalid parameters\n");
+	__ASSERT(params->attr, "invalid parameters\n");
+
+	if (!atomic_test_bit(bt_dev.flags, BT_DEV_READY)) {
+		return -EAGAIN;
+	}
+
+	if (conn && conn->state != BT_CONN_CONNECTED) {
+		return -ENOTCONN;
+	}
+
+	err = gatt_notify_resolve(params, &handle);
+	if (err) {
+		return err;
+	}
+
 	if (conn) {
 		return gatt_notify(conn, handle, params);
 	}
@@ -2035,6 +2085,49 @@ int bt_gatt_notify_cb(struct bt_conn *conn,
 	return data.err;
 }
 
+int bt_gatt_notify_conns(struct bt_conn **conns, uint16_t num_conns,
+			 struct bt_gatt_notify_params *params)
+{
+	uint16_t handle;
+	int err, ret = 0;
+	uint16_t i;
+
+	__ASSERT(conns, "invalid parameters\n");
+	__ASSERT(num_conns, "invalid parameters\n");
+	__ASSERT(params, "invalid parameters\n");
+	__ASSERT(params->attr, "invalid parameters\n");
+
+	if (!atomic_test_bit(bt_dev.flags, BT_DEV_READY)) {
+		return -EAGAIN;
+	}
+
+	err = gatt_notify_resolve(params, &handle);
+	if (err) {
+		return err;
+	}
+
+	/* Fan the same parameter block out to every link. A failing link
+	 * does not prevent delivery to the remaining ones, only the first
+	 * error is reported.
+	 */
+	for (i = 0; i < num_conns; i++) {
+		if (!conns[i] || conns[i]->state != BT_CONN_CONNECTED) {
+			if (!ret) {
+				ret = -ENOTCONN;
+			}
+
+			continue;
+		}
+
+		err = gatt_notify(conns[i], handle, params);
+		if (err && !ret) {
+			ret = err;
+		}
+	}
+
+	return ret;
+}
+
 #if defined(CONFIG_BT_GATT_NOTIFY_MULTIPLE)
 int bt_gatt_notify_multiple(struct bt_conn *conn, uint16_t num_params,
 			    struct bt_gatt_notify_params *params)
@@ -3659,6 +3752,153 @@ int bt_gatt_read(struct bt_conn *conn, struct bt_gatt_read_params *params)
 	return gatt_send(conn, buf, gatt_read_rsp, params, NULL);
 }
 
+#if defined(CONFIG_BT_GATT_PEER_DB_HASH)
+static struct peer_db_hash {
+	uint8_t id;
+	bool valid;
+	bt_addr_le_t peer;
+	uint8_t hash[16];
+} peer_db_hash[CONFIG_BT_MAX_PAIRED];
+
+static struct peer_db_hash *find_peer_db_hash(uint8_t id,
+					      const bt_addr_le_t *addr)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(peer_db_hash); i++) {
+		struct peer_db_hash *entry = &peer_db_hash[i];
+
+		if (entry->valid && entry->id == id &&
+		    !bt_addr_le_cmp(addr, &entry->peer)) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+static struct peer_db_hash *alloc_peer_db_hash(uint8_t id,
+					       const bt_addr_le_t *addr)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(peer_db_hash); i++) {
+		struct peer_db_hash *entry = &peer_db_hash[i];
+
+		if (!entry->valid) {
+			entry->id = id;
+			entry->valid = true;
+			bt_addr_le_copy(&entry->peer, addr);
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+static void peer_db_hash_store(struct bt_conn *conn,
+			       struct peer_db_hash *entry)
+{
+	char key[BT_SETTINGS_KEY_MAX];
+	int err;
+
+	if (!bt_addr_le_is_bonded(conn->id, &conn->le.dst)) {
+		return;
+	}
+
+	if (conn->id) {
+		char id_str[4];
+
+		u8_to_dec(id_str, sizeof(id_str), conn->id);
+		bt_settings_encode_key(key, sizeof(key), "rdb",
+				       &conn->le.dst, id_str);
+	} else {
+		bt_settings_encode_key(key, sizeof(key), "rdb",
+				       &conn->le.dst, NULL);
+	}
+
+	err = settings_save_one(key, entry->hash, sizeof(entry->hash));
+	if (err) {
+		BT_ERR("Failed to store Database Hash (err %d)", err);
+		return;
+	}
+
+	BT_DBG("Stored Database Hash for %s (%s)",
+	       bt_addr_le_str(&conn->le.dst), log_strdup(key));
+}
+
+static uint8_t db_hash_read_cb(struct bt_conn *conn, uint8_t err,
+			       struct bt_gatt_read_params *read,
+			       const void *data, uint16_t length)
+{
+	struct bt_gatt_db_hash_params *params =
+		CONTAINER_OF(read, struct bt_gatt_db_hash_params, _read);
+	struct peer_db_hash *entry;
+	bool unchanged = false;
+
+	if (err) {
+		params->func(conn, err, false, params);
+		return BT_GATT_ITER_STOP;
+	}
+
+	if (data) {
+		uint16_t to_copy = MIN(length,
+				       sizeof(params->_hash) - params->_len);
+
+		memcpy(params->_hash + params->_len, data, to_copy);
+		params->_len += to_copy;
+
+		return BT_GATT_ITER_CONTINUE;
+	}
+
+	if (params->_len != sizeof(params->_hash)) {
+		params->func(conn, BT_ATT_ERR_INVALID_ATTRIBUTE_LEN, false,
+			     params);
+		return BT_GATT_ITER_STOP;
+	}
+
+	entry = find_peer_db_hash(conn->id, &conn->le.dst);
+	if (entry && !memcmp(entry->hash, params->_hash,
+			     sizeof(entry->hash))) {
+		unchanged = true;
+	} else {
+		if (!entry) {
+			entry = alloc_peer_db_hash(conn->id, &conn->le.dst);
+		}
+
+		if (entry) {
+			memcpy(entry->hash, params->_hash,
+			       sizeof(entry->hash));
+			peer_db_hash_store(conn, entry);
+		}
+	}
+
+	params->func(conn, 0, unchanged, params);
+
+	return BT_GATT_ITER_STOP;
+}
+
+int bt_gatt_db_hash_check(struct bt_conn *conn,
+			  struct bt_gatt_db_hash_params *params)
+{
+	__ASSERT(conn, "invalid parameters\n");
+	__ASSERT(params && params->func, "invalid parameters\n");
+
+	if (conn->state != BT_CONN_CONNECTED) {
+		return -ENOTCONN;
+	}
+
+	params->_len = 0U;
+	(void)memset(&params->_read, 0, sizeof(params->_read));
+	params->_read.func = db_hash_read_cb;
+	params->_read.by_uuid.uuid = BT_UUID_GATT_DB_HASH;
+	params->_read.by_uuid.start_handle = 0x0001;
+	params->_read.by_uuid.end_handle = 0xffff;
+
+	return bt_gatt_read(conn, &params->_read);
+}
+#endif /* CONFIG_BT_GATT_PEER_DB_HASH */
+
 static void gatt_write_rsp(struct bt_conn *conn, uint8_t err, const void *pdu,
 			   uint16_t length, void *user_data)
 {
@@ -4725,7 +4965,68 @@ static int cf_set(const char *name, size_t len_rd, settings_read_cb read_cb,
 }
 
 SETTINGS_STATIC_HANDLER_DEFINE(bt_cf, "bt/cf", NULL, cf_set, NULL, NULL);
+#endif /* CONFIG_BT_GATT_CACHING */
+
+#if defined(CONFIG_BT_GATT_PEER_DB_HASH)
+static int rdb_set(const char *name, size_t len_rd, settings_read_cb read_cb,
+		   void *cb_arg)
+{
+	struct peer_db_hash *entry;
+	bt_addr_le_t addr;
+	const char *next;
+	ssize_t len;
+	int err;
+	uint8_t id;
+
+	if (!name) {
+		BT_ERR("Insufficient number of arguments");
+		return -EINVAL;
+	}
+
+	err = bt_settings_decode_key(name, &addr);
+	if (err) {
+		BT_ERR("Unable to decode address %s", log_strdup(name));
+		return -EINVAL;
+	}
+
+	settings_name_next(name, &next);
+
+	if (!next) {
+		id = BT_ID_DEFAULT;
+	} else {
+		id = strtol(next, NULL, 10);
+	}
+
+	entry = find_peer_db_hash(id, &addr);
+	if (!entry && len_rd) {
+		entry = alloc_peer_db_hash(id, &addr);
+		if (!entry) {
+			BT_ERR("Unable to restore Database Hash: no entry left");
+			return -ENOMEM;
+		}
+	}
+
+	if (len_rd) {
+		len = read_cb(cb_arg, entry->hash, sizeof(entry->hash));
+		if (len < 0) {
+			BT_ERR("Failed to decode value (err %zd)", len);
+			return len;
+		}
+
+		BT_DBG("Restored Database Hash for %s", bt_addr_le_str(&addr));
+	} else if (entry) {
+		(void)memset(entry, 0, sizeof(*entry));
+
+		BT_DBG("Removed Database Hash for %s", bt_addr_le_str(&addr));
+	}
+
+	return 0;
+}
 
+SETTINGS_STATIC_HANDLER_DEFINE(bt_rdb, "bt/rdb", NULL, rdb_set, NULL, NULL);
+#endif /* CONFIG_BT_GATT_PEER_DB_HASH */
+
+#if defined(CONFIG_BT_GATT_CACHING)
 static uint8_t stored_hash[16];
 
 static int db_hash_set(const char *name, size_t len_rd,
@@ -4867,6 +5168,29 @@ static int bt_gatt_clear_cf(uint8_t id, const bt_addr_le_t *addr)
 
 }
 
+#if defined(CONFIG_BT_GATT_PEER_DB_HASH)
+static int bt_gatt_clear_peer_db_hash(uint8_t id, const bt_addr_le_t *addr)
+{
+	struct peer_db_hash *entry;
+	char key[BT_SETTINGS_KEY_MAX];
+
+	entry = find_peer_db_hash(id, addr);
+	if (entry) {
+		(void)memset(entry, 0, sizeof(*entry));
+	}
+
+	if (id) {
+		char id_str[4];
+
+		u8_to_dec(id_str, sizeof(id_str), id);
+		bt_settings_encode_key(key, sizeof(key), "rdb", addr, id_str);
+	} else {
+		bt_settings_encode_key(key, sizeof(key), "rdb", addr, NULL);
+	}
+
+	return settings_delete(key);
+}
+#endif /* CONFIG_BT_GATT_PEER_DB_HASH */
 
 static struct gatt_sub *find_gatt_sub(uint8_t id, const bt_addr_le_t *addr)
 {
@@ -4927,5 +5251,12 @@ int bt_gatt_clear(uint8_t id, const bt_addr_le_t *addr)
 		bt_gatt_clear_subscriptions(id, addr);
 	}
 
+#if defined(CONFIG_BT_GATT_PEER_DB_HASH)
+	err = bt_gatt_clear_peer_db_hash(id, addr);
+	if (err < 0) {
+		return err;
+	}
+#endif /* CONFIG_BT_GATT_PEER_DB_HASH */
+
 	return 0;
 }
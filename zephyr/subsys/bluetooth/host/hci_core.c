@@ -68,6 +68,17 @@ static K_THREAD_STACK_DEFINE(tx_thread_stack, CONFIG_BT_HCI_TX_STACK_SIZE);
 
 static void init_work(struct k_work *work);
 
+/* Maximum number of commands that may be outstanding towards the
+ * controller. Until the controller reports more credits through the
+ * Num_HCI_Command_Packets field only a single command is in flight,
+ * so the initial semaphore count stays at one in either case.
+ */
+#if defined(CONFIG_BT_HCI_CMD_PIPELINE)
+#define HCI_CMD_WINDOW CONFIG_BT_HCI_CMD_WINDOW
+#else
+#define HCI_CMD_WINDOW 1
+#endif
+
 struct bt_dev bt_dev = {
 	.init          = Z_WORK_INITIALIZER(init_work),
 	/* Give cmd_sem allowing to send first HCI_Reset cmd, the only
@@ -75,9 +86,12 @@ struct bt_dev bt_dev = {
 	 * initial Command Complete for NOP.
 	 */
 #if !defined(CONFIG_BT_WAIT_NOP)
-	.ncmd_sem      = Z_SEM_INITIALIZER(bt_dev.ncmd_sem, 1, 1),
+	.ncmd_sem      = Z_SEM_INITIALIZER(bt_dev.ncmd_sem, 1, HCI_CMD_WINDOW),
 #else
-	.ncmd_sem      = Z_SEM_INITIALIZER(bt_dev.ncmd_sem, 0, 1),
+	.ncmd_sem      = Z_SEM_INITIALIZER(bt_dev.ncmd_sem, 0, HCI_CMD_WINDOW),
+#endif
+#if defined(CONFIG_BT_HCI_CMD_PIPELINE)
+	.sent_cmd_queue = Z_FIFO_INITIALIZER(bt_dev.sent_cmd_queue),
 #endif
 	.cmd_tx_queue  = Z_FIFO_INITIALIZER(bt_dev.cmd_tx_queue),
 #if !defined(CONFIG_BT_RECV_IS_RX_THREAD)
@@ -1352,6 +1366,8 @@ static void hci_num_completed_packets(struct net_buf *buf)
 			struct bt_conn_tx *tx;
 			sys_snode_t *node;
 
+			atomic_dec(&conn->tx_in_flight);
+
 			key = irq_lock();
 
 			if (conn->pending_no_cb) {
@@ -4422,6 +4438,27 @@ static void hci_cmd_done(uint16_t opcode, uint8_t status, struct net_buf *buf)
 	}
 }
 
+/* Replenish command credits from the Num_HCI_Command_Packets field of a
+ * Command Complete/Status event.
+ */
+static void hci_cmd_credits(uint8_t ncmd)
+{
+#if defined(CONFIG_BT_HCI_CMD_PIPELINE)
+	/* The field reports how many commands the controller can accept
+	 * right now. Give up to that many credits; the semaphore limit
+	 * caps the total at the configured window, which must not exceed
+	 * the controller's actual command queue depth.
+	 */
+	while (ncmd--) {
+		k_sem_give(&bt_dev.ncmd_sem);
+	}
+#else
+	if (ncmd) {
+		k_sem_give(&bt_dev.ncmd_sem);
+	}
+#endif
+}
+
 static void hci_cmd_complete(struct net_buf *buf)
 {
 	struct bt_hci_evt_cmd_complete *evt;
@@ -4441,10 +4478,8 @@ static void hci_cmd_complete(struct net_buf *buf)
 
 	hci_cmd_done(opcode, status, buf);
 
-	/* Allow next command to be sent */
-	if (ncmd) {
-		k_sem_give(&bt_dev.ncmd_sem);
-	}
+	/* Allow next command(s) to be sent */
+	hci_cmd_credits(ncmd);
 }
 
 static void hci_cmd_status(struct net_buf *buf)
@@ -4461,10 +4496,8 @@ static void hci_cmd_status(struct net_buf *buf)
 
 	hci_cmd_done(opcode, evt->status, buf);
 
-	/* Allow next command to be sent */
-	if (ncmd) {
-		k_sem_give(&bt_dev.ncmd_sem);
-	}
+	/* Allow next command(s) to be sent */
+	hci_cmd_credits(ncmd);
 }
 
 #if defined(CONFIG_BT_OBSERVER)
@@ -5297,6 +5330,13 @@ static void send_cmd(void)
 	BT_DBG("calling sem_take_wait");
 	k_sem_take(&bt_dev.ncmd_sem, K_FOREVER);
 
+#if defined(CONFIG_BT_HCI_CMD_PIPELINE)
+	/* Track the command for the matching completion event. The
+	 * controller completes commands in submission order, so a FIFO
+	 * is sufficient even with several commands in flight.
+	 */
+	net_buf_put(&bt_dev.sent_cmd_queue, net_buf_ref(buf));
+#else
 	/* Clear out any existing sent command */
 	if (bt_dev.sent_cmd) {
 		BT_ERR("Uncleared pending sent_cmd");
@@ -5305,6 +5345,7 @@ static void send_cmd(void)
 	}
 
 	bt_dev.sent_cmd = net_buf_ref(buf);
+#endif
 
 	BT_DBG("Sending command 0x%04x (buf %p) to driver",
 	       cmd(buf)->opcode, buf);
@@ -5314,8 +5355,15 @@ static void send_cmd(void)
 		BT_ERR("Unable to send to driver (err %d)", err);
 		k_sem_give(&bt_dev.ncmd_sem);
 		hci_cmd_done(cmd(buf)->opcode, BT_HCI_ERR_UNSPECIFIED, buf);
+#if defined(CONFIG_BT_HCI_CMD_PIPELINE)
+		/* No completion event will arrive for this command */
+		if (k_queue_remove(&bt_dev.sent_cmd_queue._queue, buf)) {
+			net_buf_unref(buf);
+		}
+#else
 		net_buf_unref(bt_dev.sent_cmd);
 		bt_dev.sent_cmd = NULL;
+#endif
 		net_buf_unref(buf);
 	}
 }
@@ -8475,12 +8523,20 @@ struct net_buf *bt_buf_get_rx(enum bt_buf_type type, k_timeout_t timeout)
 struct net_buf *bt_buf_get_cmd_complete(k_timeout_t timeout)
 {
 	struct net_buf *buf;
+
+#if defined(CONFIG_BT_HCI_CMD_PIPELINE)
+	/* The oldest outstanding command is the one this completion
+	 * event refers to; its buffer is reused for the event.
+	 */
+	buf = net_buf_get(&bt_dev.sent_cmd_queue, K_NO_WAIT);
+#else
 	unsigned int key;
 
 	key = irq_lock();
 	buf = bt_dev.sent_cmd;
 	bt_dev.sent_cmd = NULL;
 	irq_unlock(key);
+#endif
 
 	BT_DBG("sent_cmd %p", buf);
 
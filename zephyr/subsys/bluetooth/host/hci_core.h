@@ -220,8 +220,17 @@ struct bt_dev {
 	/* Number of commands controller can accept */
 	struct k_sem		ncmd_sem;
 
+#if defined(CONFIG_BT_HCI_CMD_PIPELINE)
+	/* Sent HCI commands awaiting Command Complete/Status, in
+	 * submission order. The controller completes commands in the
+	 * same order, so the head is always the command that the next
+	 * completion event refers to.
+	 */
+	struct k_fifo		sent_cmd_queue;
+#else
 	/* Last sent HCI command */
 	struct net_buf		*sent_cmd;
+#endif
 
 #if !defined(CONFIG_BT_RECV_IS_RX_THREAD)
 	/* Queue for incoming HCI events & ACL data */
@@ -31,6 +31,52 @@
 
 static struct bt_keys key_pool[CONFIG_BT_MAX_PAIRED];
 
+#if defined(CONFIG_BT_KEYS_RPA_FAIL_CACHE)
+/* Recently seen RPAs that did not resolve against any stored IRK.
+ * Without this, a scan storm from unknown devices re-runs AES against
+ * every stored IRK for each advertising report.
+ */
+static struct rpa_fail_entry {
+	bt_addr_t rpa;
+	uint8_t id;
+	bool valid;
+} rpa_fail_cache[CONFIG_BT_KEYS_RPA_FAIL_CACHE_SIZE];
+static int rpa_fail_next;
+
+static bool rpa_fail_cached(uint8_t id, const bt_addr_t *rpa)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(rpa_fail_cache); i++) {
+		if (rpa_fail_cache[i].valid &&
+		    rpa_fail_cache[i].id == id &&
+		    !bt_addr_cmp(&rpa_fail_cache[i].rpa, rpa)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void rpa_fail_insert(uint8_t id, const bt_addr_t *rpa)
+{
+	rpa_fail_cache[rpa_fail_next].id = id;
+	bt_addr_copy(&rpa_fail_cache[rpa_fail_next].rpa, rpa);
+	rpa_fail_cache[rpa_fail_next].valid = true;
+
+	rpa_fail_next = (rpa_fail_next + 1) % ARRAY_SIZE(rpa_fail_cache);
+}
+
+/* Flush whenever an IRK is added: a cached miss may now resolve */
+static void rpa_fail_flush(void)
+{
+	(void)memset(rpa_fail_cache, 0, sizeof(rpa_fail_cache));
+	rpa_fail_next = 0;
+}
+#else
+#define rpa_fail_flush()
+#endif /* CONFIG_BT_KEYS_RPA_FAIL_CACHE */
+
 #define BT_KEYS_STORAGE_LEN_COMPAT (BT_KEYS_STORAGE_LEN - sizeof(uint32_t))
 
 #if IS_ENABLED(CONFIG_BT_KEYS_OVERWRITE_OLDEST)
@@ -189,6 +235,13 @@ struct bt_keys *bt_keys_find_irk(uint8_t id, const bt_addr_le_t *addr)
 		}
 	}
 
+#if defined(CONFIG_BT_KEYS_RPA_FAIL_CACHE)
+	if (rpa_fail_cached(id, &addr->a)) {
+		BT_DBG("cached unresolvable RPA %s", bt_addr_le_str(addr));
+		return NULL;
+	}
+#endif /* CONFIG_BT_KEYS_RPA_FAIL_CACHE */
+
 	for (i = 0; i < ARRAY_SIZE(key_pool); i++) {
 		if (!(key_pool[i].keys & BT_KEYS_IRK)) {
 			continue;
@@ -211,6 +264,10 @@ struct bt_keys *bt_keys_find_irk(uint8_t id, const bt_addr_le_t *addr)
 
 	BT_DBG("No IRK for %s", bt_addr_le_str(addr));
 
+#if defined(CONFIG_BT_KEYS_RPA_FAIL_CACHE)
+	rpa_fail_insert(id, &addr->a);
+#endif /* CONFIG_BT_KEYS_RPA_FAIL_CACHE */
+
 	return NULL;
 }
 
@@ -233,6 +290,10 @@ struct bt_keys *bt_keys_find_addr(uint8_t id, const bt_addr_le_t *addr)
 void bt_keys_add_type(struct bt_keys *keys, int type)
 {
 	keys->keys |= type;
+
+	if (type & BT_KEYS_IRK) {
+		rpa_fail_flush();
+	}
 }
 
 void bt_keys_clear(struct bt_keys *keys)
@@ -374,6 +435,9 @@ static int keys_set(const char *name, size_t len_rd, settings_read_cb read_cb,
 		memcpy(keys->storage_start, val, len);
 	}
 
+	/* Restored keys may include an IRK, invalidate cached misses */
+	rpa_fail_flush();
+
 	BT_DBG("Successfully restored keys for %s", bt_addr_le_str(&addr));
 #if IS_ENABLED(CONFIG_BT_KEYS_OVERWRITE_OLDEST)
 	if (aging_counter_val < keys->aging_counter) {
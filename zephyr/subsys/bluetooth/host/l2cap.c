@@ -899,6 +899,8 @@ static void l2cap_chan_destroy(struct bt_l2cap_chan *chan)
 		ch->_sdu = NULL;
 		ch->_sdu_len = 0U;
 	}
+
+	ch->pending_rx_credits = 0U;
 }
 
 static uint16_t le_err_to_result(int err)
@@ -2004,6 +2006,29 @@ static void l2cap_chan_send_credits(struct bt_l2cap_le_chan *chan,
 	BT_DBG("chan %p credits %u", chan, atomic_get(&chan->rx.credits));
 }
 
+static void l2cap_chan_return_credits(struct bt_l2cap_le_chan *chan,
+				      struct net_buf *buf, uint16_t credits)
+{
+#if defined(CONFIG_BT_L2CAP_CREDIT_BATCH)
+	uint16_t pending = chan->pending_rx_credits + credits;
+
+	/* Accumulate single credit returns and only generate a signaling
+	 * PDU once the watermark is crossed, unless the remote is about
+	 * to run out of credits.
+	 */
+	if (pending < MAX(chan->rx.init_credits / 2, 1) &&
+	    atomic_get(&chan->rx.credits) > 0) {
+		chan->pending_rx_credits = pending;
+		return;
+	}
+
+	chan->pending_rx_credits = 0U;
+	credits = pending;
+#endif /* CONFIG_BT_L2CAP_CREDIT_BATCH */
+
+	l2cap_chan_send_credits(chan, buf, credits);
+}
+
 static void l2cap_chan_update_credits(struct bt_l2cap_le_chan *chan,
 				      struct net_buf *buf)
 {
@@ -2052,6 +2077,7 @@ int bt_l2cap_chan_recv_complete(struct bt_l2cap_chan *chan, struct net_buf *buf)
 	return 0;
 }
 
+#if !defined(CONFIG_BT_L2CAP_RECV_FRAG_CHAIN)
 static struct net_buf *l2cap_alloc_frag(k_timeout_t timeout, void *user_data)
 {
 	struct bt_l2cap_le_chan *chan = user_data;
@@ -2066,6 +2092,7 @@ static struct net_buf *l2cap_alloc_frag(k_timeout_t timeout, void *user_data)
 
 	return frag;
 }
+#endif /* !CONFIG_BT_L2CAP_RECV_FRAG_CHAIN */
 
 static void l2cap_chan_le_recv_sdu(struct bt_l2cap_le_chan *chan,
 				   struct net_buf *buf, uint16_t seg)
@@ -2113,8 +2140,16 @@ static void l2cap_chan_le_recv_seg(struct bt_l2cap_le_chan *chan,
 	BT_DBG("chan %p seg %d len %zu", chan, seg, net_buf_frags_len(buf));
 
 	/* Append received segment to SDU */
+#if defined(CONFIG_BT_L2CAP_RECV_FRAG_CHAIN)
+	/* Chain the PDU buffer instead of copying its payload. The extra
+	 * reference is dropped when the SDU chain is unreferenced.
+	 */
+	net_buf_frag_add(chan->_sdu, net_buf_ref(buf));
+	len = buf->len;
+#else
 	len = net_buf_append_bytes(chan->_sdu, buf->len, buf->data, K_NO_WAIT,
 				   l2cap_alloc_frag, chan);
+#endif /* CONFIG_BT_L2CAP_RECV_FRAG_CHAIN */
 	if (len != buf->len) {
 		BT_ERR("Unable to store SDU");
 		bt_l2cap_chan_disconnect(&chan->chan);
@@ -2190,7 +2225,7 @@ static void l2cap_chan_le_recv(struct bt_l2cap_le_chan *chan,
 		return;
 	}
 
-	l2cap_chan_send_credits(chan, buf, 1);
+	l2cap_chan_return_credits(chan, buf, 1);
 }
 
 static void l2cap_chan_recv_queue(struct bt_l2cap_le_chan *chan,
@@ -25,6 +25,14 @@
 
 #include <bluetooth/buf.h>
 
+#if defined(CONFIG_BT_MONITOR_RTT)
+#include <SEGGER_RTT.h>
+#endif
+
+#if defined(CONFIG_BT_MONITOR_DEFERRED)
+#include <sys/ring_buffer.h>
+#endif
+
 #include "monitor.h"
 
 /* This is the same default priority as for other console handlers,
@@ -45,7 +53,17 @@
 /* Maximum (string) length of a log message */
 #define MONITOR_MSG_MAX 128
 
+/* Worst-case space needed for one encoded packet beyond its payload,
+ * used to reserve output room before the drop counters get folded
+ * into the header.  A packet refused at that point keeps its counters
+ * pending for the next packet that fits, which btmon then renders as
+ * a gap in the trace.
+ */
+#define MONITOR_PKT_OVERHEAD (BT_MONITOR_BASE_HDR_LEN + BT_MONITOR_EXT_HDR_MAX)
+
+#if !defined(CONFIG_BT_MONITOR_RTT)
 static struct device *monitor_dev;
+#endif
 
 enum {
 	BT_LOG_BUSY,
@@ -69,6 +87,87 @@ static struct {
 extern int z_prf(int (*func)(), void *dest,
 		const char *format, va_list vargs);
 
+#if defined(CONFIG_BT_MONITOR_RTT)
+
+static uint8_t rtt_up_buf[CONFIG_BT_MONITOR_RTT_BUFFER_SIZE];
+
+/* The RTT up-buffer is itself a lock-free ring drained by the debug
+ * probe, so committing a packet is a bounded memcpy and never waits
+ * on the host.  Writers are serialized by the BT_LOG_BUSY flag and
+ * the probe only ever frees space, so the room check below cannot be
+ * invalidated before the writes complete.
+ */
+static bool monitor_room(size_t len)
+{
+	return SEGGER_RTT_GetAvailWriteSpace(CONFIG_BT_MONITOR_RTT_BUFFER) >=
+	       len;
+}
+
+static void monitor_send(const void *data, size_t len)
+{
+	SEGGER_RTT_WriteSkipNoLock(CONFIG_BT_MONITOR_RTT_BUFFER, data, len);
+}
+
+#elif defined(CONFIG_BT_MONITOR_DEFERRED)
+
+/* Writer thread parameters, kept as plain defines for the same
+ * reason as MONITOR_INIT_PRIORITY above.
+ */
+#define MONITOR_TX_STACK_SIZE 512
+
+RING_BUF_DECLARE(monitor_rb, CONFIG_BT_MONITOR_DEFERRED_BUF_SIZE);
+static K_SEM_DEFINE(monitor_sem, 0, 1);
+
+static bool monitor_room(size_t len)
+{
+	return ring_buf_space_get(&monitor_rb) >= len;
+}
+
+/* Producers are serialized by the BT_LOG_BUSY flag and the single
+ * writer thread below is the only consumer, which is the concurrency
+ * model the ring buffer supports without locking.  Packets are
+ * committed whole or not at all (see monitor_room()), so the UART
+ * never backpressures the caller.
+ */
+static void monitor_send(const void *data, size_t len)
+{
+	ring_buf_put(&monitor_rb, data, len);
+	k_sem_give(&monitor_sem);
+}
+
+static void monitor_tx_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		uint8_t buf[32];
+		uint32_t len;
+
+		k_sem_take(&monitor_sem, K_FOREVER);
+
+		while ((len = ring_buf_get(&monitor_rb, buf,
+					   sizeof(buf))) > 0) {
+			for (uint32_t i = 0; i < len; i++) {
+				uart_poll_out(monitor_dev, buf[i]);
+			}
+		}
+	}
+}
+
+K_THREAD_DEFINE(bt_monitor_tx, MONITOR_TX_STACK_SIZE, monitor_tx_thread,
+		NULL, NULL, NULL, K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0);
+
+#else /* Synchronous UART output */
+
+static bool monitor_room(size_t len)
+{
+	ARG_UNUSED(len);
+
+	return true;
+}
+
 static void monitor_send(const void *data, size_t len)
 {
 	const uint8_t *buf = data;
@@ -78,6 +177,8 @@ static void monitor_send(const void *data, size_t len)
 	}
 }
 
+#endif /* CONFIG_BT_MONITOR_RTT */
+
 static void encode_drops(struct bt_monitor_hdr *hdr, uint8_t type,
 			 atomic_t *val)
 {
@@ -160,6 +261,12 @@ void bt_monitor_send(uint16_t opcode, const void *data, size_t len)
 		return;
 	}
 
+	if (!monitor_room(MONITOR_PKT_OVERHEAD + len)) {
+		drop_add(opcode);
+		atomic_clear_bit(&flags, BT_LOG_BUSY);
+		return;
+	}
+
 	encode_hdr(&hdr, monitor_ts_get(), opcode, len);
 
 	monitor_send(&hdr, BT_MONITOR_BASE_HDR_LEN + hdr.hdr_len);
@@ -212,7 +319,8 @@ extern void __printk_hook_install(int (*fn)(int));
 extern void __stdout_hook_install(int (*fn)(int));
 #endif /* !CONFIG_UART_CONSOLE */
 
-#if defined(CONFIG_HAS_DTS) && !defined(CONFIG_BT_MONITOR_ON_DEV_NAME)
+#if defined(CONFIG_HAS_DTS) && !defined(CONFIG_BT_MONITOR_ON_DEV_NAME) && \
+	!defined(CONFIG_BT_MONITOR_RTT)
 #define CONFIG_BT_MONITOR_ON_DEV_NAME CONFIG_UART_CONSOLE_ON_DEV_NAME
 #endif
 
@@ -285,6 +393,14 @@ static void monitor_log_put(const struct log_backend *const backend,
 		return;
 	}
 
+	if (!monitor_room(MONITOR_PKT_OVERHEAD + sizeof(log) + sizeof(id) +
+			  ctx.total_len + 1)) {
+		drop_add(BT_MONITOR_USER_LOGGING);
+		log_msg_put(msg);
+		atomic_clear_bit(&flags, BT_LOG_BUSY);
+		return;
+	}
+
 	encode_hdr(&hdr, msg->hdr.timestamp, BT_MONITOR_USER_LOGGING,
 		   sizeof(log) + sizeof(id) + ctx.total_len + 1);
 
@@ -299,7 +415,7 @@ static void monitor_log_put(const struct log_backend *const backend,
 	monitor_send(ctx.msg, ctx.total_len);
 
 	/* Terminate the string with null */
-	uart_poll_out(monitor_dev, '\0');
+	monitor_send("", 1);
 
 	atomic_clear_bit(&flags, BT_LOG_BUSY);
 }
@@ -326,6 +442,11 @@ static int bt_monitor_init(struct device *d)
 {
 	ARG_UNUSED(d);
 
+#if defined(CONFIG_BT_MONITOR_RTT)
+	SEGGER_RTT_ConfigUpBuffer(CONFIG_BT_MONITOR_RTT_BUFFER, "btmonitor",
+				  rtt_up_buf, sizeof(rtt_up_buf),
+				  SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+#else
 	monitor_dev = device_get_binding(CONFIG_BT_MONITOR_ON_DEV_NAME);
 
 	__ASSERT_NO_MSG(monitor_dev);
@@ -334,6 +455,7 @@ static int bt_monitor_init(struct device *d)
 	uart_irq_rx_disable(monitor_dev);
 	uart_irq_tx_disable(monitor_dev);
 #endif
+#endif /* CONFIG_BT_MONITOR_RTT */
 
 #if !defined(CONFIG_UART_CONSOLE) && !defined(CONFIG_LOG_PRINTK)
 	__printk_hook_install(monitor_console_out);
@@ -553,12 +553,19 @@ int isotp_bind(struct isotp_recv_ctx *ctx, struct device *can_dev,
 	       const struct isotp_fc_opts *opts,
 	       k_timeout_t timeout)
 {
+	static const struct isotp_fc_opts default_opts = {
+		.bs = CONFIG_ISOTP_FC_DEFAULT_BS,
+		.stmin = CONFIG_ISOTP_FC_DEFAULT_STMIN
+	};
 	int ret;
 
 	__ASSERT(ctx, "ctx is NULL");
 	__ASSERT(can_dev, "CAN device is NULL");
 	__ASSERT(rx_addr && rx_addr, "RX or TX addr is NULL");
-	__ASSERT(opts, "OPTS is NULL");
+
+	if (opts == NULL) {
+		opts = &default_opts;
+	}
 
 	ctx->can_dev = can_dev;
 	ctx->rx_addr = *rx_addr;
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <device.h>
+#include <init.h>
+#include <debug/boot_timing.h>
+
+/* Boot report storage. Filled strictly sequentially from
+ * z_sys_init_run_level(), which runs single threaded (pre-kernel in
+ * the init context, later levels from the main thread before
+ * application code starts), so no locking is needed on the write
+ * path. Reads happen after boot, when the table no longer changes.
+ */
+static struct boot_init_record records[CONFIG_BOOT_INIT_TIMING_MAX_RECORDS];
+static uint32_t record_count;
+static uint32_t dropped_count;
+
+void z_boot_timing_record(const struct init_entry *entry, int32_t level,
+			  uint32_t cycles)
+{
+	struct boot_init_record *rec;
+
+	if (record_count >= ARRAY_SIZE(records)) {
+		dropped_count++;
+		return;
+	}
+
+	rec = &records[record_count++];
+	rec->name = entry->dev != NULL ? entry->dev->name : NULL;
+	rec->init_fn = (const void *)entry->init;
+	rec->level = (uint8_t)level;
+	rec->cycles = cycles;
+}
+
+void boot_timing_foreach(boot_timing_cb_t cb, void *user_data)
+{
+	for (uint32_t i = 0; i < record_count; i++) {
+		cb(&records[i], user_data);
+	}
+}
+
+uint32_t boot_timing_level_cycles(int level)
+{
+	uint32_t total = 0U;
+
+	for (uint32_t i = 0; i < record_count; i++) {
+		if (records[i].level == level) {
+			total += records[i].cycles;
+		}
+	}
+
+	return total;
+}
+
+uint32_t boot_timing_dropped(void)
+{
+	return dropped_count;
+}
+
+#ifdef CONFIG_SHELL
+#include <shell/shell.h>
+
+static const char *level_name(uint8_t level)
+{
+	switch (level) {
+	case _SYS_INIT_LEVEL_PRE_KERNEL_1:
+		return "PRE_KERNEL_1";
+	case _SYS_INIT_LEVEL_PRE_KERNEL_2:
+		return "PRE_KERNEL_2";
+	case _SYS_INIT_LEVEL_POST_KERNEL:
+		return "POST_KERNEL";
+	case _SYS_INIT_LEVEL_APPLICATION:
+		return "APPLICATION";
+#ifdef CONFIG_SMP
+	case _SYS_INIT_LEVEL_SMP:
+		return "SMP";
+#endif
+	default:
+		return "?";
+	}
+}
+
+static int cmd_boot_timing_show(const struct shell *shell, size_t argc,
+				char **argv)
+{
+	uint8_t cur_level = UINT8_MAX;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	for (uint32_t i = 0; i < record_count; i++) {
+		const struct boot_init_record *rec = &records[i];
+
+		if (rec->level != cur_level) {
+			cur_level = rec->level;
+			shell_print(shell, "%s: %u cycles total",
+				    level_name(cur_level),
+				    boot_timing_level_cycles(cur_level));
+		}
+
+		if (rec->name != NULL) {
+			shell_print(shell, "  %-24s %10u cycles",
+				    rec->name, rec->cycles);
+		} else {
+			shell_print(shell, "  sys_init@%p %10u cycles",
+				    rec->init_fn, rec->cycles);
+		}
+	}
+
+	if (dropped_count != 0U) {
+		shell_print(shell, "%u entries dropped, increase "
+			    "CONFIG_BOOT_INIT_TIMING_MAX_RECORDS",
+			    dropped_count);
+	}
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_boot_timing,
+	SHELL_CMD(show, NULL, "Show per-init-function boot time breakdown.",
+		  cmd_boot_timing_show),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(boot_timing, &sub_boot_timing,
+		   "Boot time breakdown commands", NULL);
+#endif /* CONFIG_SHELL */
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <string.h>
+#include <sys/printk.h>
+#include <storage/flash_map.h>
+#include <debug/coredump.h>
+
+#if !FLASH_AREA_LABEL_EXISTS(coredump_partition)
+#error "CONFIG_DEBUG_COREDUMP requires a fixed-partitions node labeled " \
+	"coredump-partition in the devicetree"
+#endif
+
+#define COREDUMP_AREA_ID FLASH_AREA_ID(coredump_partition)
+
+/* Writes are staged through this buffer so arbitrary capture lengths
+ * meet the flash write-block alignment; the final flush pads with the
+ * erased-flash value. 32 bytes covers every in-tree write block size.
+ */
+#define COREDUMP_WRITE_BLOCK 32
+
+static uint8_t wbuf[COREDUMP_WRITE_BLOCK];
+static size_t wbuf_fill;
+static off_t wr_off;
+
+static int dump_flush(const struct flash_area *fa)
+{
+	int err;
+
+	if (wbuf_fill == 0) {
+		return 0;
+	}
+
+	(void)memset(&wbuf[wbuf_fill], 0xff, sizeof(wbuf) - wbuf_fill);
+
+	err = flash_area_write(fa, wr_off, wbuf, sizeof(wbuf));
+	wr_off += sizeof(wbuf);
+	wbuf_fill = 0;
+
+	return err;
+}
+
+static int dump_write(const struct flash_area *fa, const void *data,
+		      size_t len)
+{
+	const uint8_t *src = data;
+	int err;
+
+	while (len > 0) {
+		size_t chunk = MIN(len, sizeof(wbuf) - wbuf_fill);
+
+		(void)memcpy(&wbuf[wbuf_fill], src, chunk);
+		wbuf_fill += chunk;
+		src += chunk;
+		len -= chunk;
+
+		if (wbuf_fill == sizeof(wbuf)) {
+			err = dump_flush(fa);
+			if (err != 0) {
+				return err;
+			}
+		}
+	}
+
+	return 0;
+}
+
+void coredump(unsigned int reason, const z_arch_esf_t *esf,
+	      struct k_thread *thread)
+{
+	const struct flash_area *fa;
+	struct coredump_hdr hdr;
+	size_t limit;
+	int err;
+
+	err = flash_area_open(COREDUMP_AREA_ID, &fa);
+	if (err != 0) {
+		return;
+	}
+
+	if (fa->fa_size <= sizeof(hdr)) {
+		return;
+	}
+
+	limit = fa->fa_size - sizeof(hdr);
+
+	(void)memset(&hdr, 0, sizeof(hdr));
+	hdr.magic = COREDUMP_MAGIC;
+	hdr.version = COREDUMP_VERSION;
+	hdr.reason = (uint16_t)reason;
+	hdr.thread_addr = (uint32_t)(uintptr_t)thread;
+
+	if (esf != NULL) {
+		hdr.esf_len = MIN(sizeof(z_arch_esf_t), limit);
+		limit -= hdr.esf_len;
+	}
+
+#if defined(CONFIG_THREAD_STACK_INFO)
+	hdr.stack_start = (uint32_t)thread->stack_info.start;
+	hdr.stack_len = MIN(thread->stack_info.size, limit);
+#endif
+
+#if defined(CONFIG_THREAD_NAME)
+	{
+		const char *name = k_thread_name_get(thread);
+
+		if (name != NULL) {
+			strncpy(hdr.thread_name, name,
+				sizeof(hdr.thread_name) - 1);
+		}
+	}
+#endif
+
+	/* The partition must be sized so that this erase plus the
+	 * writes below complete within the watchdog window.
+	 */
+	err = flash_area_erase(fa, 0, fa->fa_size);
+	if (err != 0) {
+		printk("Core dump: erase failed (%d)\n", err);
+		return;
+	}
+
+	wbuf_fill = 0;
+	wr_off = 0;
+
+	err = dump_write(fa, &hdr, sizeof(hdr));
+	if ((err == 0) && (hdr.esf_len > 0)) {
+		err = dump_write(fa, esf, hdr.esf_len);
+	}
+
+	if ((err == 0) && (hdr.stack_len > 0)) {
+		err = dump_write(fa, (const void *)(uintptr_t)hdr.stack_start,
+				 hdr.stack_len);
+	}
+
+	if (err == 0) {
+		err = dump_flush(fa);
+	}
+
+	if (err != 0) {
+		printk("Core dump: write failed (%d)\n", err);
+		return;
+	}
+
+	printk("Core dump: %u bytes saved\n",
+	       (unsigned int)(sizeof(hdr) + hdr.esf_len + hdr.stack_len));
+}
+
+int coredump_stored_size(size_t *size)
+{
+	const struct flash_area *fa;
+	struct coredump_hdr hdr;
+	int err;
+
+	err = flash_area_open(COREDUMP_AREA_ID, &fa);
+	if (err != 0) {
+		return err;
+	}
+
+	err = flash_area_read(fa, 0, &hdr, sizeof(hdr));
+	if (err != 0) {
+		return err;
+	}
+
+	if ((hdr.magic != COREDUMP_MAGIC) ||
+	    (hdr.version != COREDUMP_VERSION)) {
+		return -ENOENT;
+	}
+
+	if (size != NULL) {
+		*size = sizeof(hdr) + hdr.esf_len + hdr.stack_len;
+	}
+
+	return 0;
+}
+
+int coredump_read(off_t off, void *dst, size_t len)
+{
+	const struct flash_area *fa;
+	int err;
+
+	err = flash_area_open(COREDUMP_AREA_ID, &fa);
+	if (err != 0) {
+		return err;
+	}
+
+	return flash_area_read(fa, off, dst, len);
+}
+
+int coredump_erase(void)
+{
+	const struct flash_area *fa;
+	int err;
+
+	err = flash_area_open(COREDUMP_AREA_ID, &fa);
+	if (err != 0) {
+		return err;
+	}
+
+	return flash_area_erase(fa, 0, fa->fa_size);
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <sys/ring_buffer.h>
+#include <debug/prof_sampler.h>
+#include <arch/arm/aarch32/cortex_m/cmsis.h>
+
+/* Sampling profiler: a periodic timer captures the interrupted PC and
+ * the current thread into a ring buffer, like the tracing subsystem's
+ * stream buffers but with a fixed 8-byte record so the reader never
+ * has to resynchronize. The expiry function runs inside the system
+ * clock interrupt, so on Cortex-M the preempted thread's exception
+ * frame is still on PSP and its stacked PC can be read directly;
+ * RETTOBASE distinguishes that case from having preempted another
+ * ISR, which is recorded with the PROF_SAMPLE_PC_IN_IRQ marker since
+ * the outer frame location is not known from here.
+ *
+ * The buffer size is kept a multiple of the record size and only
+ * whole records are ever committed, so claimed regions stay record
+ * aligned across wraparound.
+ */
+
+BUILD_ASSERT(CONFIG_PROF_SAMPLER_BUFFER_SIZE % PROF_SAMPLE_SIZE == 0);
+
+static struct ring_buf sample_buf;
+static uint8_t sample_data[CONFIG_PROF_SAMPLER_BUFFER_SIZE];
+
+static uint32_t sample_count;
+static uint32_t dropped_count;
+
+static void prof_sample(struct k_timer *timer)
+{
+	uint32_t *rec;
+	uint8_t *data;
+
+	ARG_UNUSED(timer);
+
+	if (ring_buf_put_claim(&sample_buf, &data,
+			       PROF_SAMPLE_SIZE) < PROF_SAMPLE_SIZE) {
+		(void)ring_buf_put_finish(&sample_buf, 0);
+		dropped_count++;
+		return;
+	}
+
+	rec = (uint32_t *)data;
+
+	if ((SCB->ICSR & SCB_ICSR_RETTOBASE_Msk) != 0) {
+		/* Only the clock interrupt is active: the frame on PSP
+		 * belongs to the interrupted thread.
+		 */
+		rec[0] = ((uint32_t *)__get_PSP())[6];
+	} else {
+		rec[0] = PROF_SAMPLE_PC_IN_IRQ;
+	}
+	rec[1] = (uint32_t)k_current_get();
+
+	(void)ring_buf_put_finish(&sample_buf, PROF_SAMPLE_SIZE);
+	sample_count++;
+}
+
+static K_TIMER_DEFINE(sample_timer, prof_sample, NULL);
+
+void prof_sampler_start(void)
+{
+	k_timer_start(&sample_timer,
+		      K_USEC(CONFIG_PROF_SAMPLER_PERIOD_US),
+		      K_USEC(CONFIG_PROF_SAMPLER_PERIOD_US));
+}
+
+void prof_sampler_stop(void)
+{
+	k_timer_stop(&sample_timer);
+}
+
+size_t prof_sampler_read(uint8_t *buf, size_t len)
+{
+	len -= len % PROF_SAMPLE_SIZE;
+
+	return ring_buf_get(&sample_buf, buf, len);
+}
+
+uint32_t prof_sampler_samples(void)
+{
+	return sample_count;
+}
+
+uint32_t prof_sampler_dropped(void)
+{
+	return dropped_count;
+}
+
+static int prof_sampler_init(struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	ring_buf_init(&sample_buf, sizeof(sample_data), sample_data);
+
+	return 0;
+}
+
+SYS_INIT(prof_sampler_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+#ifdef CONFIG_SHELL
+#include <shell/shell.h>
+
+static int cmd_prof_start(const struct shell *shell, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	prof_sampler_start();
+	shell_print(shell, "sampling every %d us",
+		    CONFIG_PROF_SAMPLER_PERIOD_US);
+
+	return 0;
+}
+
+static int cmd_prof_stop(const struct shell *shell, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	prof_sampler_stop();
+	shell_print(shell, "sampling stopped");
+
+	return 0;
+}
+
+static int cmd_prof_stats(const struct shell *shell, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(shell, "%u samples, %u dropped, %u bytes free",
+		    sample_count, dropped_count,
+		    ring_buf_space_get(&sample_buf));
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_prof,
+	SHELL_CMD(start, NULL, "Start periodic PC sampling.", cmd_prof_start),
+	SHELL_CMD(stop, NULL, "Stop periodic PC sampling.", cmd_prof_stop),
+	SHELL_CMD(stats, NULL, "Show sample and drop counts.",
+		  cmd_prof_stats),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(prof, &sub_prof, "Sampling profiler commands", NULL);
+#endif /* CONFIG_SHELL */
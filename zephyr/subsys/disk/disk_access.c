@@ -60,6 +60,10 @@ int disk_access_init(const char *pdrv)
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->init != NULL)) {
+#if defined(CONFIG_DISK_ACCESS_READ_AHEAD)
+		/* The media may have been replaced */
+		read_ahead_drop(disk);
+#endif
 		rc = disk->ops->init(disk);
 	}
 
@@ -79,6 +83,100 @@ int disk_access_status(const char *pdrv)
 	return rc;
 }
 
+#if defined(CONFIG_DISK_ACCESS_READ_AHEAD)
+#define READ_AHEAD_SECTORS CONFIG_DISK_ACCESS_READ_AHEAD_SECTORS
+#define READ_AHEAD_SECTOR_SIZE CONFIG_DISK_ACCESS_READ_AHEAD_SECTOR_SIZE
+
+/* Read-ahead buffer, shared by all disks. A single sequential stream
+ * is tracked at a time; sequential reads fetch READ_AHEAD_SECTORS in
+ * one transaction and the following reads are served from RAM.
+ */
+static struct {
+	struct disk_info *disk;	/* disk the buffer holds data of */
+	uint32_t sector;	/* first buffered sector */
+	uint32_t count;		/* number of buffered sectors */
+	uint32_t next_sector;	/* expected next sequential access */
+	uint8_t buf[READ_AHEAD_SECTORS * READ_AHEAD_SECTOR_SIZE];
+} read_ahead;
+
+static K_MUTEX_DEFINE(read_ahead_mutex);
+
+static void read_ahead_drop(struct disk_info *disk)
+{
+	k_mutex_lock(&read_ahead_mutex, K_FOREVER);
+	if (read_ahead.disk == disk) {
+		read_ahead.disk = NULL;
+		read_ahead.count = 0U;
+	}
+	k_mutex_unlock(&read_ahead_mutex);
+}
+
+static int read_ahead_read(struct disk_info *disk, uint8_t *data_buf,
+			   uint32_t start_sector, uint32_t num_sector)
+{
+	uint32_t sector_size = 0U;
+	uint32_t sector_count = 0U;
+	uint32_t fetch;
+	bool sequential;
+	int rc;
+
+	k_mutex_lock(&read_ahead_mutex, K_FOREVER);
+
+	if ((read_ahead.disk == disk) &&
+	    (start_sector >= read_ahead.sector) &&
+	    ((start_sector + num_sector) <=
+	     (read_ahead.sector + read_ahead.count))) {
+		memcpy(data_buf,
+		       &read_ahead.buf[(start_sector - read_ahead.sector) *
+				       READ_AHEAD_SECTOR_SIZE],
+		       num_sector * READ_AHEAD_SECTOR_SIZE);
+		read_ahead.next_sector = start_sector + num_sector;
+		k_mutex_unlock(&read_ahead_mutex);
+		return 0;
+	}
+
+	sequential = (read_ahead.disk == disk) &&
+		     (start_sector == read_ahead.next_sector);
+	read_ahead.disk = disk;
+	read_ahead.count = 0U;
+	read_ahead.next_sector = start_sector + num_sector;
+
+	if (!sequential || (num_sector >= READ_AHEAD_SECTORS) ||
+	    (disk->ops->ioctl == NULL) ||
+	    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_SIZE,
+			      &sector_size) < 0) ||
+	    (sector_size != READ_AHEAD_SECTOR_SIZE) ||
+	    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_COUNT,
+			      &sector_count) < 0)) {
+		k_mutex_unlock(&read_ahead_mutex);
+		return disk->ops->read(disk, data_buf, start_sector,
+				       num_sector);
+	}
+
+	fetch = MIN(READ_AHEAD_SECTORS, sector_count - start_sector);
+	if (fetch <= num_sector) {
+		k_mutex_unlock(&read_ahead_mutex);
+		return disk->ops->read(disk, data_buf, start_sector,
+				       num_sector);
+	}
+
+	rc = disk->ops->read(disk, read_ahead.buf, start_sector, fetch);
+	if (rc != 0) {
+		k_mutex_unlock(&read_ahead_mutex);
+		return rc;
+	}
+
+	read_ahead.sector = start_sector;
+	read_ahead.count = fetch;
+	memcpy(data_buf, read_ahead.buf,
+	       num_sector * READ_AHEAD_SECTOR_SIZE);
+
+	k_mutex_unlock(&read_ahead_mutex);
+
+	return 0;
+}
+#endif /* CONFIG_DISK_ACCESS_READ_AHEAD */
+
 int disk_access_read(const char *pdrv, uint8_t *data_buf,
 		     uint32_t start_sector, uint32_t num_sector)
 {
@@ -87,7 +185,11 @@ int disk_access_read(const char *pdrv, uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->read != NULL)) {
+#if defined(CONFIG_DISK_ACCESS_READ_AHEAD)
+		rc = read_ahead_read(disk, data_buf, start_sector, num_sector);
+#else
 		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+#endif
 	}
 
 	return rc;
@@ -101,6 +203,10 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->write != NULL)) {
+#if defined(CONFIG_DISK_ACCESS_READ_AHEAD)
+		/* The buffered sectors may be overwritten */
+		read_ahead_drop(disk);
+#endif
 		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
 	}
 
@@ -120,6 +226,84 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 	return rc;
 }
 
+#if defined(CONFIG_DISK_ACCESS_ASYNC)
+
+static K_FIFO_DEFINE(disk_async_fifo);
+
+static int disk_async_execute(struct disk_access_request *req)
+{
+	struct disk_info *disk = req->disk;
+
+	switch (req->op) {
+	case DISK_ACCESS_OP_READ:
+		if (disk->ops->read == NULL) {
+			return -EINVAL;
+		}
+#if defined(CONFIG_DISK_ACCESS_READ_AHEAD)
+		return read_ahead_read(disk, req->data_buf,
+				       req->start_sector, req->num_sector);
+#else
+		return disk->ops->read(disk, req->data_buf,
+				       req->start_sector, req->num_sector);
+#endif
+	case DISK_ACCESS_OP_WRITE:
+		if (disk->ops->write == NULL) {
+			return -EINVAL;
+		}
+#if defined(CONFIG_DISK_ACCESS_READ_AHEAD)
+		/* The buffered sectors may be overwritten */
+		read_ahead_drop(disk);
+#endif
+		return disk->ops->write(disk, req->data_buf,
+					req->start_sector, req->num_sector);
+	case DISK_ACCESS_OP_SYNC:
+		if (disk->ops->ioctl == NULL) {
+			return -EINVAL;
+		}
+		return disk->ops->ioctl(disk, DISK_IOCTL_CTRL_SYNC, NULL);
+	default:
+		return -EINVAL;
+	}
+}
+
+static void disk_async_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		struct disk_access_request *req;
+		int rc;
+
+		req = k_fifo_get(&disk_async_fifo, K_FOREVER);
+		rc = disk_async_execute(req);
+		if (req->cb != NULL) {
+			req->cb(req, rc);
+		}
+	}
+}
+
+K_THREAD_DEFINE(disk_async, CONFIG_DISK_ACCESS_ASYNC_STACK_SIZE,
+		disk_async_thread, NULL, NULL, NULL,
+		CONFIG_DISK_ACCESS_ASYNC_THREAD_PRIORITY, 0, 0);
+
+int disk_access_submit(const char *pdrv, struct disk_access_request *req)
+{
+	struct disk_info *disk = disk_access_get_di(pdrv);
+
+	if ((disk == NULL) || (disk->ops == NULL)) {
+		return -EINVAL;
+	}
+
+	req->disk = disk;
+	k_fifo_put(&disk_async_fifo, req);
+
+	return 0;
+}
+
+#endif /* CONFIG_DISK_ACCESS_ASYNC */
+
 int disk_access_register(struct disk_info *disk)
 {
 	int rc = 0;
@@ -420,15 +420,15 @@ static int sdhc_spi_rx_block(struct sdhc_spi_data *data,
 	return 0;
 }
 
-/* Transmits a SDHC data block */
+/* Transmits a SDHC data block with the given start token */
 static int sdhc_spi_tx_block(struct sdhc_spi_data *data,
-	uint8_t *send, int len)
+	uint8_t *send, int len, uint8_t token)
 {
 	uint8_t buf[SDHC_CRC16_SIZE];
 	int err;
 
 	/* Start the block */
-	buf[0] = SDHC_TOKEN_SINGLE;
+	buf[0] = token;
 	err = sdhc_spi_tx(data, buf, 1);
 	if (err != 0) {
 		return err;
@@ -703,6 +703,62 @@ error:
 	return err;
 }
 
+/* Writes multiple blocks in one write transaction (CMD25) */
+static int sdhc_spi_write_multi(struct sdhc_spi_data *data,
+	const uint8_t *buf, uint32_t sector, uint32_t count)
+{
+	int err;
+	uint32_t addr;
+	uint8_t token;
+
+	/* Translate sector number to data address.
+	 * SDSC cards use byte addressing, SDHC cards use block addressing.
+	 */
+	if (data->high_capacity) {
+		addr = sector;
+	} else {
+		addr = sector * SDMMC_DEFAULT_BLOCK_SIZE;
+	}
+
+	err = sdhc_spi_cmd_r1(data, SDHC_WRITE_MULTIPLE_BLOCK, addr);
+	if (err < 0) {
+		return err;
+	}
+
+	for (; count != 0U; count--) {
+		err = sdhc_spi_tx_block(data, (uint8_t *)buf,
+			SDMMC_DEFAULT_BLOCK_SIZE, SDHC_TOKEN_MULTI_WRITE);
+		if (err != 0) {
+			return err;
+		}
+
+		/* Wait for the card to finish programming */
+		err = sdhc_spi_skip_until_ready(data);
+		if (err != 0) {
+			return err;
+		}
+
+		buf += SDMMC_DEFAULT_BLOCK_SIZE;
+	}
+
+	/* Stop the transmission */
+	token = SDHC_TOKEN_STOP_TRAN;
+	err = sdhc_spi_tx(data, &token, 1);
+	if (err != 0) {
+		return err;
+	}
+
+	/* One byte gap before the card signals busy */
+	sdhc_spi_rx_u8(data);
+
+	err = sdhc_spi_skip_until_ready(data);
+	if (err != 0) {
+		return err;
+	}
+
+	return sdhc_spi_cmd_r2(data, SDHC_SEND_STATUS, 0);
+}
+
 static int sdhc_spi_write(struct sdhc_spi_data *data,
 	const uint8_t *buf, uint32_t sector, uint32_t count)
 {
@@ -716,6 +772,12 @@ static int sdhc_spi_write(struct sdhc_spi_data *data,
 
 	sdhc_spi_set_cs(data, 0);
 
+	if (count > 1U) {
+		/* Stream the blocks instead of one command per sector */
+		err = sdhc_spi_write_multi(data, buf, sector, count);
+		goto error;
+	}
+
 	/* Write the blocks one-by-one */
 	for (; count != 0U; count--) {
 		/* Translate sector number to data address.
@@ -733,7 +795,7 @@ static int sdhc_spi_write(struct sdhc_spi_data *data,
 		}
 
 		err = sdhc_spi_tx_block(data, (uint8_t *)buf,
-			SDMMC_DEFAULT_BLOCK_SIZE);
+			SDMMC_DEFAULT_BLOCK_SIZE, SDHC_TOKEN_SINGLE);
 		if (err != 0) {
 			goto error;
 		}
@@ -59,10 +59,45 @@ struct char_framebuffer {
 
 	/** Invertedj*/
 	bool inverted;
+
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING
+	/** First modified tile row, 0xffff if the buffer is clean */
+	uint16_t dirty_min;
+
+	/** Last modified tile row */
+	uint16_t dirty_max;
+#endif
 };
 
 static struct char_framebuffer char_fb;
 
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING
+static void cfb_mark_dirty(struct char_framebuffer *fb,
+			   uint16_t first_row, uint16_t last_row)
+{
+	uint16_t max_row = fb->y_res / fb->ppt - 1U;
+
+	fb->dirty_min = MIN(fb->dirty_min, first_row);
+	fb->dirty_max = MAX(fb->dirty_max, MIN(last_row, max_row));
+}
+
+static void cfb_mark_all_dirty(struct char_framebuffer *fb)
+{
+	fb->dirty_min = 0U;
+	fb->dirty_max = fb->y_res / fb->ppt - 1U;
+}
+
+static void cfb_mark_clean(struct char_framebuffer *fb)
+{
+	fb->dirty_min = 0xffff;
+	fb->dirty_max = 0U;
+}
+#else
+#define cfb_mark_dirty(fb, first_row, last_row)
+#define cfb_mark_all_dirty(fb)
+#define cfb_mark_clean(fb)
+#endif /* CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING */
+
 static inline uint8_t *get_glyph_ptr(const struct cfb_font *fptr, char c)
 {
 	if (fptr->caps & CFB_FONT_MONO_VPACKED) {
@@ -74,6 +109,48 @@ static inline uint8_t *get_glyph_ptr(const struct cfb_font *fptr, char c)
 	return NULL;
 }
 
+#if CONFIG_CHARACTER_FRAMEBUFFER_GLYPH_CACHE_SIZE > 0
+struct glyph_cache_entry {
+	char c;
+	uint8_t font_idx;
+	bool valid;
+	uint8_t data[CONFIG_CHARACTER_FRAMEBUFFER_GLYPH_CACHE_GLYPH_BYTES];
+};
+
+static struct glyph_cache_entry
+	glyph_cache[CONFIG_CHARACTER_FRAMEBUFFER_GLYPH_CACHE_SIZE];
+
+/*
+ * Returns the glyph with the bit order already adjusted to the display,
+ * rendering it into the direct-mapped cache on a miss. Returns NULL for
+ * glyphs exceeding the per-entry byte budget.
+ */
+static const uint8_t *get_cached_glyph(const struct cfb_font *fptr,
+				       uint8_t font_idx, char c,
+				       const uint8_t *glyph_ptr)
+{
+	size_t len = fptr->width * fptr->height / 8U;
+	struct glyph_cache_entry *entry =
+		&glyph_cache[(uint8_t)c %
+			     CONFIG_CHARACTER_FRAMEBUFFER_GLYPH_CACHE_SIZE];
+
+	if (len > sizeof(entry->data)) {
+		return NULL;
+	}
+
+	if (!entry->valid || entry->c != c || entry->font_idx != font_idx) {
+		for (size_t i = 0; i < len; i++) {
+			entry->data[i] = byte_reverse(glyph_ptr[i]);
+		}
+		entry->c = c;
+		entry->font_idx = font_idx;
+		entry->valid = true;
+	}
+
+	return entry->data;
+}
+#endif /* CONFIG_CHARACTER_FRAMEBUFFER_GLYPH_CACHE_SIZE > 0 */
+
 /*
  * Draw the monochrome character in the monochrome tiled framebuffer,
  * a byte is interpreted as 8 pixels ordered vertically among each other.
@@ -95,6 +172,20 @@ static uint8_t draw_char_vtmono(const struct char_framebuffer *fb,
 		return 0;
 	}
 
+#if CONFIG_CHARACTER_FRAMEBUFFER_GLYPH_CACHE_SIZE > 0
+	if (need_reverse) {
+		const uint8_t *cached = get_cached_glyph(fptr, fb->font_idx,
+							 c, glyph_ptr);
+
+		if (cached != NULL) {
+			glyph_ptr = (uint8_t *)cached;
+			need_reverse = false;
+		}
+	}
+#endif
+
+	cfb_mark_dirty(&char_fb, y / 8U, (y + fptr->height - 1U) / 8U);
+
 	for (size_t g_x = 0; g_x < fptr->width; g_x++) {
 		uint32_t y_segment = y / 8U;
 
@@ -173,6 +264,7 @@ int cfb_framebuffer_clear(struct device *dev, bool clear_display)
 	desc.height = fb->y_res;
 	desc.pitch = fb->x_res;
 	memset(fb->buf, 0, fb->size);
+	cfb_mark_all_dirty(fb);
 
 	return 0;
 }
@@ -187,6 +279,7 @@ int cfb_framebuffer_invert(struct device *dev)
 	}
 
 	fb->inverted = !fb->inverted;
+	cfb_mark_all_dirty(fb);
 
 	return 0;
 }
@@ -194,22 +287,49 @@ int cfb_framebuffer_invert(struct device *dev)
 int cfb_framebuffer_finalize(struct device *dev)
 {
 	const struct display_driver_api *api = dev->driver_api;
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
 	struct display_buffer_descriptor desc;
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING
+	int err;
+#endif
 
 	if (!fb || !fb->buf) {
 		return -1;
 	}
 
+	if (!(fb->pixel_format & PIXEL_FORMAT_MONO10) != !(fb->inverted)) {
+		cfb_invert(fb);
+		cfb_mark_all_dirty(fb);
+	}
+
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING
+	if (fb->screen_info & SCREEN_INFO_MONO_VTILED) {
+		if (fb->dirty_min > fb->dirty_max) {
+			/* Nothing changed since the last transfer. */
+			return 0;
+		}
+
+		desc.buf_size = (fb->dirty_max - fb->dirty_min + 1U) *
+				fb->x_res;
+		desc.width = fb->x_res;
+		desc.height = (fb->dirty_max - fb->dirty_min + 1U) * fb->ppt;
+		desc.pitch = fb->x_res;
+
+		err = api->write(dev, 0, fb->dirty_min * fb->ppt, &desc,
+				 fb->buf + fb->dirty_min * fb->x_res);
+		if (err == 0) {
+			cfb_mark_clean(fb);
+		}
+
+		return err;
+	}
+#endif /* CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING */
+
 	desc.buf_size = fb->size;
 	desc.width = fb->x_res;
 	desc.height = fb->y_res;
 	desc.pitch = fb->x_res;
 
-	if (!(fb->pixel_format & PIXEL_FORMAT_MONO10) != !(fb->inverted)) {
-		cfb_invert(fb);
-	}
-
 	return api->write(dev, 0, 0, &desc, fb->buf);
 }
 
@@ -312,6 +432,7 @@ int cfb_framebuffer_init(struct device *dev)
 	}
 
 	memset(fb->buf, 0, fb->size);
+	cfb_mark_all_dirty(fb);
 
 	return 0;
 }
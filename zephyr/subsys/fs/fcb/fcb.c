@@ -89,6 +89,32 @@ fcb_erase_sector(const struct fcb *fcb, const struct flash_sector *sector)
 	return 0;
 }
 
+#if defined(CONFIG_FCB_SECTOR_CACHE)
+struct fcb_sector_cache *
+fcb_cache_get(struct fcb *fcb, struct flash_sector *sector)
+{
+	return &fcb->f_cache[sector - fcb->f_sectors];
+}
+
+void
+fcb_cache_sector_reset(struct fcb *fcb, struct flash_sector *sector)
+{
+	struct fcb_sector_cache *cache = fcb_cache_get(fcb, sector);
+
+	cache->fsc_cnt = 0U;
+	cache->fsc_last_off = 0U;
+}
+
+void
+fcb_cache_entry_add(struct fcb *fcb, struct fcb_entry *loc)
+{
+	struct fcb_sector_cache *cache = fcb_cache_get(fcb, loc->fe_sector);
+
+	cache->fsc_cnt++;
+	cache->fsc_last_off = loc->fe_elem_off;
+}
+#endif
+
 int
 fcb_init(int f_area_id, struct fcb *fcb)
 {
@@ -104,6 +130,12 @@ fcb_init(int f_area_id, struct fcb *fcb)
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_FCB_SECTOR_CACHE)
+	if (fcb->f_sector_cnt > CONFIG_FCB_SECTOR_CACHE_SECTORS) {
+		return -EINVAL;
+	}
+#endif
+
 	rc = flash_area_open(f_area_id, &fcb->fap);
 	if (rc != 0) {
 		return -EINVAL;
@@ -164,6 +196,18 @@ fcb_init(int f_area_id, struct fcb *fcb)
 			break;
 		}
 	}
+
+#if defined(CONFIG_FCB_SECTOR_CACHE)
+	if (rc == 0) {
+		struct fcb_entry loc;
+
+		(void)memset(fcb->f_cache, 0, sizeof(fcb->f_cache));
+		(void)memset(&loc, 0, sizeof(loc));
+		while (fcb_getnext_nolock(fcb, &loc) == 0) {
+			fcb_cache_entry_add(fcb, &loc);
+		}
+	}
+#endif
 	k_mutex_init(&fcb->f_mtx);
 	return rc;
 }
@@ -246,6 +290,9 @@ fcb_sector_hdr_init(struct fcb *fcb, struct flash_sector *sector, uint16_t id)
 	if (rc != 0) {
 		return -EIO;
 	}
+#if defined(CONFIG_FCB_SECTOR_CACHE)
+	fcb_cache_sector_reset(fcb, sector);
+#endif
 	return 0;
 }
 
@@ -291,12 +338,55 @@ fcb_offset_last_n(struct fcb *fcb, uint8_t entries,
 	struct fcb_entry loc;
 	int i;
 	int rc;
+#if defined(CONFIG_FCB_SECTOR_CACHE)
+	struct flash_sector *sector;
+	uint16_t cnt;
+	uint16_t left;
+#endif
 
 	/* assure a minimum amount of entries */
 	if (!entries) {
 		entries = 1U;
 	}
 
+#if defined(CONFIG_FCB_SECTOR_CACHE)
+	rc = k_mutex_lock(&fcb->f_mtx, K_FOREVER);
+	if (rc) {
+		return -EINVAL;
+	}
+
+	/*
+	 * Walk the per-sector entry counts back from the active sector to
+	 * find the sector holding the wanted entry, then scan only within
+	 * that sector.
+	 */
+	sector = fcb->f_active.fe_sector;
+	left = entries;
+	while (1) {
+		cnt = fcb_cache_get(fcb, sector)->fsc_cnt;
+		if (cnt >= left || sector == fcb->f_oldest) {
+			break;
+		}
+		left -= cnt;
+		sector = fcb_getprev_sector(fcb, sector);
+	}
+
+	(void)memset(&loc, 0, sizeof(loc));
+	loc.fe_sector = sector;
+	i = (cnt > left) ? (cnt - left) : 0;
+	do {
+		rc = fcb_getnext_nolock(fcb, &loc);
+		if (rc) {
+			k_mutex_unlock(&fcb->f_mtx);
+			return -ENOENT;
+		}
+	} while (i--);
+
+	*last_n_entry = loc;
+	k_mutex_unlock(&fcb->f_mtx);
+
+	return 0;
+#else
 	i = 0;
 	(void)memset(&loc, 0, sizeof(loc));
 	while (!fcb_getnext(fcb, &loc)) {
@@ -319,6 +409,7 @@ fcb_offset_last_n(struct fcb *fcb, uint8_t entries,
 	}
 
 	return (i == 0) ? -ENOENT : 0;
+#endif
 }
 
 /**
@@ -133,5 +133,8 @@ fcb_append_finish(struct fcb *fcb, struct fcb_entry *loc)
 	if (rc) {
 		return -EIO;
 	}
+#if defined(CONFIG_FCB_SECTOR_CACHE)
+	fcb_cache_entry_add(fcb, loc);
+#endif
 	return 0;
 }
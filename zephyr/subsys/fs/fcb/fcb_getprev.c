@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+
+#include <fs/fcb.h>
+#include "fcb_priv.h"
+
+struct flash_sector *
+fcb_getprev_sector(struct fcb *fcb, struct flash_sector *sector)
+{
+	if (sector == &fcb->f_sectors[0]) {
+		sector = &fcb->f_sectors[fcb->f_sector_cnt];
+	}
+	return sector - 1;
+}
+
+/*
+ * Find the valid entry preceding offset stop_off in the given sector, or
+ * the last valid entry of the sector when stop_off is 0. Since entries
+ * only carry a length prefix there are no back links to follow; the sector
+ * is scanned forward from its first entry. Returns -ENOTSUP when the
+ * sector holds no matching entry.
+ */
+static int
+fcb_prev_in_sector(struct fcb *fcb, struct flash_sector *sector,
+		   uint32_t stop_off, struct fcb_entry *loc)
+{
+	struct fcb_entry walk;
+	struct fcb_entry prev;
+	int rc;
+
+#if defined(CONFIG_FCB_SECTOR_CACHE)
+	struct fcb_sector_cache *cache = fcb_cache_get(fcb, sector);
+
+	if (cache->fsc_cnt == 0U) {
+		return -ENOTSUP;
+	}
+	if (stop_off == 0U) {
+		/* The offset of the newest entry is cached, no scan
+		 * needed.
+		 */
+		walk.fe_sector = sector;
+		walk.fe_elem_off = cache->fsc_last_off;
+		rc = fcb_elem_info(fcb, &walk);
+		if (rc == 0) {
+			*loc = walk;
+			return 0;
+		}
+	}
+#endif
+	prev.fe_sector = NULL;
+	walk.fe_sector = sector;
+	walk.fe_elem_off = sizeof(struct fcb_disk_area);
+	while (1) {
+		rc = fcb_elem_info(fcb, &walk);
+		if (rc != 0 && rc != -EBADMSG) {
+			break;
+		}
+		if (stop_off != 0U && walk.fe_elem_off >= stop_off) {
+			break;
+		}
+		if (rc == 0) {
+			prev = walk;
+		}
+		walk.fe_elem_off = walk.fe_data_off +
+		  fcb_len_in_flash(fcb, walk.fe_data_len) +
+		  fcb_len_in_flash(fcb, FCB_CRC_SZ);
+	}
+	if (prev.fe_sector == NULL) {
+		return -ENOTSUP;
+	}
+	*loc = prev;
+	return 0;
+}
+
+int
+fcb_getprev_nolock(struct fcb *fcb, struct fcb_entry *loc)
+{
+	struct flash_sector *sector;
+	uint32_t stop_off;
+	int rc;
+
+	if (loc->fe_sector == NULL) {
+		/*
+		 * Find the newest one we have in flash.
+		 */
+		sector = fcb->f_active.fe_sector;
+		stop_off = 0U;
+	} else if (loc->fe_elem_off > sizeof(struct fcb_disk_area)) {
+		sector = loc->fe_sector;
+		stop_off = loc->fe_elem_off;
+	} else {
+		/*
+		 * First entry of the sector, continue in the sector before
+		 * it.
+		 */
+		if (loc->fe_sector == fcb->f_oldest) {
+			return -ENOTSUP;
+		}
+		sector = fcb_getprev_sector(fcb, loc->fe_sector);
+		stop_off = 0U;
+	}
+
+	while (1) {
+		rc = fcb_prev_in_sector(fcb, sector, stop_off, loc);
+		if (rc == 0) {
+			return 0;
+		}
+		if (sector == fcb->f_oldest) {
+			return -ENOTSUP;
+		}
+		sector = fcb_getprev_sector(fcb, sector);
+		stop_off = 0U;
+	}
+}
+
+int
+fcb_getprev(struct fcb *fcb, struct fcb_entry *loc)
+{
+	int rc;
+
+	rc = k_mutex_lock(&fcb->f_mtx, K_FOREVER);
+	if (rc) {
+		return -EINVAL;
+	}
+	rc = fcb_getprev_nolock(fcb, loc);
+	k_mutex_unlock(&fcb->f_mtx);
+
+	return rc;
+}
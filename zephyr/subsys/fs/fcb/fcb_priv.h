@@ -44,6 +44,17 @@ struct flash_sector *fcb_getnext_sector(struct fcb *fcb,
 					struct flash_sector *sector);
 int fcb_getnext_nolock(struct fcb *fcb, struct fcb_entry *loc);
 
+struct flash_sector *fcb_getprev_sector(struct fcb *fcb,
+					struct flash_sector *sector);
+int fcb_getprev_nolock(struct fcb *fcb, struct fcb_entry *loc);
+
+#if defined(CONFIG_FCB_SECTOR_CACHE)
+struct fcb_sector_cache *fcb_cache_get(struct fcb *fcb,
+				       struct flash_sector *sector);
+void fcb_cache_sector_reset(struct fcb *fcb, struct flash_sector *sector);
+void fcb_cache_entry_add(struct fcb *fcb, struct fcb_entry *loc);
+#endif
+
 int fcb_elem_info(struct fcb *fcb, struct fcb_entry *loc);
 int fcb_elem_crc8(struct fcb *fcb, struct fcb_entry *loc, uint8_t *crc8p);
 
@@ -26,6 +26,72 @@ static struct k_mutex mutex;
 /* file system map table */
 static struct fs_file_system_t *fs_map[FS_TYPE_END];
 
+#if defined(CONFIG_FS_MNT_POINT_CACHE)
+/* Cache of recently resolved path to mount point mappings, so that
+ * repeated accesses of hot paths skip the linear scan over the mount
+ * list. All access happens under "mutex". The mapping only changes
+ * when the mount list does, hence the cache is flushed on mount and
+ * unmount.
+ */
+struct mnt_point_cache_entry {
+	struct fs_mount_t *mp;	/* NULL when unused */
+	uint32_t used;		/* LRU stamp, higher is more recent */
+	char path[CONFIG_FS_MNT_POINT_CACHE_PATH_LEN];
+};
+
+static struct mnt_point_cache_entry
+	mnt_point_cache[CONFIG_FS_MNT_POINT_CACHE_SIZE];
+static uint32_t mnt_point_cache_tick;
+
+static struct fs_mount_t *mnt_point_cache_find(const char *name)
+{
+	struct mnt_point_cache_entry *entry;
+
+	for (entry = mnt_point_cache;
+	     entry < &mnt_point_cache[ARRAY_SIZE(mnt_point_cache)]; entry++) {
+		if ((entry->mp != NULL) &&
+		    (strcmp(entry->path, name) == 0)) {
+			entry->used = ++mnt_point_cache_tick;
+			return entry->mp;
+		}
+	}
+	return NULL;
+}
+
+static void mnt_point_cache_add(const char *name, struct fs_mount_t *mp)
+{
+	struct mnt_point_cache_entry *entry = mnt_point_cache;
+	struct mnt_point_cache_entry *iter = mnt_point_cache;
+
+	if (strlen(name) >= sizeof(entry->path)) {
+		return;
+	}
+
+	/* Replace the least recently used entry; unused entries have
+	 * the oldest stamps and are taken first.
+	 */
+	while (++iter < &mnt_point_cache[ARRAY_SIZE(mnt_point_cache)]) {
+		if ((mnt_point_cache_tick - iter->used) >
+		    (mnt_point_cache_tick - entry->used)) {
+			entry = iter;
+		}
+	}
+	strcpy(entry->path, name);
+	entry->mp = mp;
+	entry->used = ++mnt_point_cache_tick;
+}
+
+static void mnt_point_cache_flush(void)
+{
+	struct mnt_point_cache_entry *entry;
+
+	for (entry = mnt_point_cache;
+	     entry < &mnt_point_cache[ARRAY_SIZE(mnt_point_cache)]; entry++) {
+		entry->mp = NULL;
+	}
+}
+#endif /* CONFIG_FS_MNT_POINT_CACHE */
+
 static int fs_get_mnt_point(struct fs_mount_t **mnt_pntp,
 			    const char *name, size_t *match_len)
 {
@@ -35,6 +101,19 @@ static int fs_get_mnt_point(struct fs_mount_t **mnt_pntp,
 	sys_dnode_t *node;
 
 	k_mutex_lock(&mutex, K_FOREVER);
+
+#if defined(CONFIG_FS_MNT_POINT_CACHE)
+	mnt_p = mnt_point_cache_find(name);
+	if (mnt_p != NULL) {
+		k_mutex_unlock(&mutex);
+		*mnt_pntp = mnt_p;
+		if (match_len)
+			*match_len = mnt_p->mountp_len;
+
+		return 0;
+	}
+#endif
+
 	SYS_DLIST_FOR_EACH_NODE(&fs_mnt_list, node) {
 		itr = CONTAINER_OF(node, struct fs_mount_t, node);
 		len = itr->mountp_len;
@@ -62,6 +141,12 @@ static int fs_get_mnt_point(struct fs_mount_t **mnt_pntp,
 			longest_match = len;
 		}
 	}
+
+#if defined(CONFIG_FS_MNT_POINT_CACHE)
+	if (mnt_p != NULL) {
+		mnt_point_cache_add(name, mnt_p);
+	}
+#endif
 	k_mutex_unlock(&mutex);
 
 	if (mnt_p == NULL) {
@@ -588,6 +673,10 @@ int fs_mount(struct fs_mount_t *mp)
 
 	/*  append to the mount list */
 	sys_dlist_append(&fs_mnt_list, &mp->node);
+#if defined(CONFIG_FS_MNT_POINT_CACHE)
+	/* Cached paths may now resolve to the new mount point */
+	mnt_point_cache_flush();
+#endif
 	LOG_DBG("fs mounted at %s", log_strdup(mp->mnt_point));
 
 mount_err:
@@ -624,6 +713,9 @@ int fs_unmount(struct fs_mount_t *mp)
 
 	/* remove mount node from the list */
 	sys_dlist_remove(&mp->node);
+#if defined(CONFIG_FS_MNT_POINT_CACHE)
+	mnt_point_cache_flush();
+#endif
 	LOG_DBG("fs unmounted from %s", log_strdup(mp->mnt_point));
 
 unmount_err:
@@ -132,13 +132,147 @@ static int errno_to_lfs(int error)
 }
 
 
+#if defined(CONFIG_FS_LITTLEFS_BLOCK_CACHE)
+/* Write-through LRU cache over the flash areas backing littlefs
+ * instances, shared by all mounts. Directory traversal and file open
+ * re-read the same metadata blocks many times; serving those reads from
+ * RAM avoids repeated flash transfers.
+ */
+#define BLOCK_CACHE_LINE_SIZE CONFIG_FS_LITTLEFS_BLOCK_CACHE_LINE_SIZE
+
+struct block_cache_line {
+	const struct flash_area *fa;	/* backing area, NULL when invalid */
+	size_t offset;		/* line-aligned offset within the area */
+	uint32_t used;		/* LRU stamp, higher is more recent */
+	uint8_t data[BLOCK_CACHE_LINE_SIZE];
+};
+
+static struct block_cache_line block_cache[CONFIG_FS_LITTLEFS_BLOCK_CACHE_LINES];
+static uint32_t block_cache_tick;
+static K_MUTEX_DEFINE(block_cache_mutex);
+
+static struct block_cache_line *block_cache_find(const struct flash_area *fa,
+						 size_t offset)
+{
+	struct block_cache_line *line;
+
+	for (line = block_cache; line < &block_cache[ARRAY_SIZE(block_cache)];
+	     line++) {
+		if ((line->fa == fa) && (line->offset == offset)) {
+			return line;
+		}
+	}
+	return NULL;
+}
+
+static int block_cache_read(const struct flash_area *fa, size_t offset,
+			    void *buffer, size_t size)
+{
+	uint8_t *dst = buffer;
+	int rc = 0;
+
+	k_mutex_lock(&block_cache_mutex, K_FOREVER);
+	while (size > 0) {
+		size_t aligned = ROUND_DOWN(offset, BLOCK_CACHE_LINE_SIZE);
+		size_t skip = offset - aligned;
+		size_t chunk = MIN(size, BLOCK_CACHE_LINE_SIZE - skip);
+		struct block_cache_line *line = block_cache_find(fa, aligned);
+
+		if (line == NULL) {
+			struct block_cache_line *iter = block_cache;
+
+			/* Fill the least recently used line. Invalid
+			 * lines have the oldest stamps and are taken
+			 * first.
+			 */
+			line = block_cache;
+			while (++iter < &block_cache[ARRAY_SIZE(block_cache)]) {
+				if ((block_cache_tick - iter->used) >
+				    (block_cache_tick - line->used)) {
+					line = iter;
+				}
+			}
+			rc = flash_area_read(fa, aligned, line->data,
+					     BLOCK_CACHE_LINE_SIZE);
+			if (rc < 0) {
+				line->fa = NULL;
+				break;
+			}
+			line->fa = fa;
+			line->offset = aligned;
+		}
+		line->used = ++block_cache_tick;
+		memcpy(dst, &line->data[skip], chunk);
+		dst += chunk;
+		offset += chunk;
+		size -= chunk;
+	}
+	k_mutex_unlock(&block_cache_mutex);
+
+	return rc;
+}
+
+/* Write-through: refresh the cached lines a programmed range overlaps.
+ * littlefs only programs erased flash, so the programmed contents are
+ * the resulting contents.
+ */
+static void block_cache_update(const struct flash_area *fa, size_t offset,
+			       const void *buffer, size_t size)
+{
+	const uint8_t *src = buffer;
+
+	k_mutex_lock(&block_cache_mutex, K_FOREVER);
+	while (size > 0) {
+		size_t aligned = ROUND_DOWN(offset, BLOCK_CACHE_LINE_SIZE);
+		size_t skip = offset - aligned;
+		size_t chunk = MIN(size, BLOCK_CACHE_LINE_SIZE - skip);
+		struct block_cache_line *line = block_cache_find(fa, aligned);
+
+		if (line != NULL) {
+			memcpy(&line->data[skip], src, chunk);
+		}
+		src += chunk;
+		offset += chunk;
+		size -= chunk;
+	}
+	k_mutex_unlock(&block_cache_mutex);
+}
+
+/* Drop the cached lines overlapping the given range, or all lines of
+ * the area when size is 0.
+ */
+static void block_cache_invalidate(const struct flash_area *fa, size_t offset,
+				   size_t size)
+{
+	struct block_cache_line *line;
+
+	k_mutex_lock(&block_cache_mutex, K_FOREVER);
+	for (line = block_cache; line < &block_cache[ARRAY_SIZE(block_cache)];
+	     line++) {
+		if (line->fa != fa) {
+			continue;
+		}
+		if ((size == 0U) ||
+		    ((line->offset < offset + size) &&
+		     (line->offset + BLOCK_CACHE_LINE_SIZE > offset))) {
+			line->fa = NULL;
+		}
+	}
+	k_mutex_unlock(&block_cache_mutex);
+}
+#endif /* CONFIG_FS_LITTLEFS_BLOCK_CACHE */
+
 static int lfs_api_read(const struct lfs_config *c, lfs_block_t block,
 			lfs_off_t off, void *buffer, lfs_size_t size)
 {
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size + off;
 
+#if defined(CONFIG_FS_LITTLEFS_BLOCK_CACHE)
+	int rc = block_cache_read(fa, offset, buffer, size);
+#else
 	int rc = flash_area_read(fa, offset, buffer, size);
+#endif
 
 	return errno_to_lfs(rc);
 }
@@ -151,6 +285,12 @@ static int lfs_api_prog(const struct lfs_config *c, lfs_block_t block,
 
 	int rc = flash_area_write(fa, offset, buffer, size);
 
+#if defined(CONFIG_FS_LITTLEFS_BLOCK_CACHE)
+	if (rc == 0) {
+		block_cache_update(fa, offset, buffer, size);
+	}
+#endif
+
 	return errno_to_lfs(rc);
 }
 
@@ -161,6 +301,12 @@ static int lfs_api_erase(const struct lfs_config *c, lfs_block_t block)
 
 	int rc = flash_area_erase(fa, offset, c->block_size);
 
+#if defined(CONFIG_FS_LITTLEFS_BLOCK_CACHE)
+	if (rc == 0) {
+		block_cache_invalidate(fa, offset, c->block_size);
+	}
+#endif
+
 	return errno_to_lfs(rc);
 }
 
@@ -659,6 +805,13 @@ static int littlefs_mount(struct fs_mount_t *mountp)
 		 "erase size must be multiple of write size");
 	__ASSERT((block_size % cache_size) == 0,
 		 "cache size incompatible with block size");
+#if defined(CONFIG_FS_LITTLEFS_BLOCK_CACHE)
+	__ASSERT((block_size % BLOCK_CACHE_LINE_SIZE) == 0,
+		 "block cache line size incompatible with block size");
+
+	/* The area may have been modified while unmounted. */
+	block_cache_invalidate(fs->area, 0, 0);
+#endif
 
 	/* Set the validated/defaulted values. */
 	lcp->context = (void *)fs->area;
@@ -711,6 +864,9 @@ static int littlefs_unmount(struct fs_mount_t *mountp)
 	fs_lock(fs);
 
 	lfs_unmount(&fs->lfs);
+#if defined(CONFIG_FS_LITTLEFS_BLOCK_CACHE)
+	block_cache_invalidate(fs->area, 0, 0);
+#endif
 	flash_area_close(fs->area);
 	fs->area = NULL;
 
@@ -29,6 +29,46 @@ static inline size_t nvs_al_size(struct nvs_fs *fs, size_t len)
 }
 /* end basic routines */
 
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+
+#define NVS_LOOKUP_CACHE_NO_ADDR 0xFFFFFFFF
+
+static inline size_t nvs_lookup_cache_pos(uint16_t id)
+{
+	return id % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+}
+
+static void nvs_lookup_cache_invalidate(struct nvs_fs *fs)
+{
+	uint32_t *cache = fs->lookup_cache;
+	uint32_t *const cache_end = cache + CONFIG_NVS_LOOKUP_CACHE_SIZE;
+
+	while (cache < cache_end) {
+		*cache++ = NVS_LOOKUP_CACHE_NO_ADDR;
+	}
+}
+
+/* Invalidate cache entries pointing into a sector that is about to be
+ * erased.
+ */
+static void nvs_lookup_cache_invalidate_sector(struct nvs_fs *fs,
+					       uint32_t sect_addr)
+{
+	uint32_t *cache = fs->lookup_cache;
+	uint32_t *const cache_end = cache + CONFIG_NVS_LOOKUP_CACHE_SIZE;
+
+	while (cache < cache_end) {
+		if ((*cache != NVS_LOOKUP_CACHE_NO_ADDR) &&
+		    ((*cache & ADDR_SECT_MASK) ==
+		     (sect_addr & ADDR_SECT_MASK))) {
+			*cache = NVS_LOOKUP_CACHE_NO_ADDR;
+		}
+		cache++;
+	}
+}
+
+#endif /* CONFIG_NVS_LOOKUP_CACHE */
+
 /* flash routines */
 /* basic aligned flash write to nvs address */
 static int nvs_flash_al_wrt(struct nvs_fs *fs, uint32_t addr, const void *data,
@@ -303,6 +343,9 @@ static int nvs_flash_wrt_entry(struct nvs_fs *fs, uint16_t id, const void *data,
 	int rc;
 	struct nvs_ate entry;
 	size_t ate_size;
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+	uint32_t ate_addr = fs->ate_wra;
+#endif
 
 	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
 
@@ -322,6 +365,10 @@ static int nvs_flash_wrt_entry(struct nvs_fs *fs, uint16_t id, const void *data,
 		return rc;
 	}
 
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+	fs->lookup_cache[nvs_lookup_cache_pos(id)] = ate_addr;
+#endif
+
 	return 0;
 }
 /* end of flash routines */
@@ -428,6 +475,46 @@ static int nvs_prev_ate(struct nvs_fs *fs, uint32_t *addr, struct nvs_ate *ate)
 	return nvs_recover_last_ate(fs, addr);
 }
 
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+/* Build the lookup cache by walking the allocation table from newest to
+ * oldest entry. The first (newest) valid entry found for an id wins, so
+ * older copies and hash collisions with older ids are skipped.
+ */
+static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
+{
+	int rc;
+	uint32_t addr, ate_addr;
+	uint32_t *cache_entry;
+	struct nvs_ate ate;
+
+	nvs_lookup_cache_invalidate(fs);
+
+	addr = fs->ate_wra;
+
+	while (true) {
+		ate_addr = addr;
+		rc = nvs_prev_ate(fs, &addr, &ate);
+		if (rc) {
+			return rc;
+		}
+
+		if ((ate.id != 0xFFFF) && (!nvs_ate_crc8_check(&ate))) {
+			cache_entry =
+			  &fs->lookup_cache[nvs_lookup_cache_pos(ate.id)];
+			if (*cache_entry == NVS_LOOKUP_CACHE_NO_ADDR) {
+				*cache_entry = ate_addr;
+			}
+		}
+
+		if (addr == fs->ate_wra) {
+			break;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NVS_LOOKUP_CACHE */
+
 static void nvs_sector_advance(struct nvs_fs *fs, uint32_t *addr)
 {
 	*addr += (1 << ADDR_SECT_SHIFT);
@@ -493,6 +580,9 @@ static int nvs_gc(struct nvs_fs *fs)
 
 	rc = nvs_ate_cmp_const(&close_ate, fs->flash_parameters->erase_value);
 	if (!rc) {
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+		nvs_lookup_cache_invalidate_sector(fs, sec_addr);
+#endif
 		rc = nvs_flash_erase_sector(fs, sec_addr);
 		if (rc) {
 			return rc;
@@ -559,6 +649,12 @@ static int nvs_gc(struct nvs_fs *fs)
 				return rc;
 			}
 
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+			/* the moved entry is the newest copy of its id */
+			fs->lookup_cache[nvs_lookup_cache_pos(gc_ate.id)] =
+				fs->ate_wra;
+#endif
+
 			rc = nvs_flash_ate_wrt(fs, &gc_ate);
 			if (rc) {
 				return rc;
@@ -566,6 +662,9 @@ static int nvs_gc(struct nvs_fs *fs)
 		}
 	} while (gc_prev_addr != stop_addr);
 
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+	nvs_lookup_cache_invalidate_sector(fs, sec_addr);
+#endif
 	rc = nvs_flash_erase_sector(fs, sec_addr);
 	if (rc) {
 		return rc;
@@ -573,6 +672,39 @@ static int nvs_gc(struct nvs_fs *fs)
 	return 0;
 }
 
+#if defined(CONFIG_NVS_GC_BACKGROUND)
+static bool nvs_gc_watermark_reached(struct nvs_fs *fs)
+{
+	uint32_t free_space = fs->ate_wra - fs->data_wra;
+
+	return free_space < (((uint32_t)fs->sector_size *
+			      CONFIG_NVS_GC_WATERMARK) / 100);
+}
+
+static void nvs_gc_work_handler(struct k_work *work)
+{
+	struct nvs_fs *fs = CONTAINER_OF(work, struct nvs_fs, gc_work);
+	int rc;
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
+	/* recheck under the lock, a write may have closed the sector and
+	 * collected the next one already
+	 */
+	if (nvs_gc_watermark_reached(fs)) {
+		rc = nvs_sector_close(fs);
+		if (!rc) {
+			rc = nvs_gc(fs);
+		}
+		if (rc) {
+			LOG_ERR("Background gc failed (%d)", rc);
+		}
+	}
+
+	k_mutex_unlock(&fs->nvs_lock);
+}
+#endif /* CONFIG_NVS_GC_BACKGROUND */
+
 static int nvs_startup(struct nvs_fs *fs)
 {
 	int rc;
@@ -730,6 +862,10 @@ int nvs_clear(struct nvs_fs *fs)
 			return rc;
 		}
 	}
+
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+	nvs_lookup_cache_invalidate(fs);
+#endif
 	return 0;
 }
 
@@ -741,6 +877,9 @@ int nvs_init(struct nvs_fs *fs, const char *dev_name)
 	size_t write_block_size;
 
 	k_mutex_init(&fs->nvs_lock);
+#if defined(CONFIG_NVS_GC_BACKGROUND)
+	k_work_init(&fs->gc_work, nvs_gc_work_handler);
+#endif
 
 	fs->flash_device = device_get_binding(dev_name);
 	if (!fs->flash_device) {
@@ -784,6 +923,13 @@ int nvs_init(struct nvs_fs *fs, const char *dev_name)
 		return rc;
 	}
 
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+	rc = nvs_lookup_cache_rebuild(fs);
+	if (rc) {
+		return rc;
+	}
+#endif
+
 	/* nvs is ready for use */
 	fs->ready = true;
 
@@ -828,7 +974,25 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 	wlk_addr = fs->ate_wra;
 	rd_addr = wlk_addr;
 
-	while (1) {
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+	if (wlk_addr != NVS_LOOKUP_CACHE_NO_ADDR) {
+		rc = nvs_flash_ate_rd(fs, wlk_addr, &wlk_ate);
+		if (rc) {
+			return rc;
+		}
+		if ((wlk_ate.id == id) && (!nvs_ate_crc8_check(&wlk_ate))) {
+			prev_found = true;
+			rd_addr = wlk_addr;
+		}
+	}
+
+	if (!prev_found) {
+		wlk_addr = fs->ate_wra;
+	}
+#endif
+
+	while (!prev_found) {
 		rd_addr = wlk_addr;
 		rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
 		if (rc) {
@@ -913,6 +1077,12 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 	rc = len;
 end:
 	k_mutex_unlock(&fs->nvs_lock);
+
+#if defined(CONFIG_NVS_GC_BACKGROUND)
+	if ((rc >= 0) && nvs_gc_watermark_reached(fs)) {
+		k_work_submit(&fs->gc_work);
+	}
+#endif
 	return rc;
 }
 
@@ -941,6 +1111,35 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+	/* The cache only holds the most recent entry of an id */
+	if (cnt == 0U) {
+		wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+		if (wlk_addr != NVS_LOOKUP_CACHE_NO_ADDR) {
+			rc = nvs_flash_ate_rd(fs, wlk_addr, &wlk_ate);
+			if (rc) {
+				goto err;
+			}
+			if ((wlk_ate.id == id) &&
+			    (!nvs_ate_crc8_check(&wlk_ate))) {
+				if (wlk_ate.len == 0U) {
+					return -ENOENT;
+				}
+
+				rd_addr = wlk_addr & ADDR_SECT_MASK;
+				rd_addr += wlk_ate.offset;
+				rc = nvs_flash_rd(fs, rd_addr, data,
+						  MIN(len, wlk_ate.len));
+				if (rc) {
+					goto err;
+				}
+
+				return wlk_ate.len;
+			}
+		}
+	}
+#endif
+
 	cnt_his = 0U;
 
 	wlk_addr = fs->ate_wra;
@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <device.h>
+#include <drivers/uart.h>
+#include <spinlock.h>
+#include <syscall_handler.h>
+#include <sys/io_ring.h>
+
+BUILD_ASSERT((CONFIG_IO_RING_ENTRIES & (CONFIG_IO_RING_ENTRIES - 1)) == 0,
+	     "CONFIG_IO_RING_ENTRIES must be a power of two");
+
+#define RING_MASK (CONFIG_IO_RING_ENTRIES - 1)
+
+struct io_ring {
+	struct k_io_ring_shared *shared;
+	struct device *dev;
+	uint8_t *buf;
+	size_t buf_size;
+	struct k_thread *owner;
+	struct k_sem cq_sem;
+	/* Set while the dispatcher is draining this ring; a busy slot
+	 * is not handed out again until the dispatcher has let go.
+	 */
+	bool busy;
+};
+
+static struct io_ring rings[CONFIG_IO_RING_MAX_RINGS];
+static struct k_spinlock ring_lock;
+
+/* Kicked by k_io_ring_submit()/k_io_ring_wait(); one kick covers all
+ * submissions posted before it.
+ */
+static K_SEM_DEFINE(work_sem, 0, 1);
+
+static struct io_ring *find_ring(struct k_io_ring_shared *shared)
+{
+	for (int i = 0; i < CONFIG_IO_RING_MAX_RINGS; i++) {
+		if (rings[i].shared == shared) {
+			return &rings[i];
+		}
+	}
+
+	return NULL;
+}
+
+static int32_t execute_sqe(struct io_ring *ring,
+			   const struct k_io_ring_sqe *sqe)
+{
+	uint8_t *data;
+	uint32_t i;
+
+	if (sqe->opcode == K_IO_RING_OP_NOP) {
+		return 0;
+	}
+
+	/* The buffer region was validated at registration; here only
+	 * the offset arithmetic needs checking.
+	 */
+	if (sqe->buf_offset > ring->buf_size ||
+	    sqe->len > ring->buf_size - sqe->buf_offset) {
+		return -EINVAL;
+	}
+
+	data = ring->buf + sqe->buf_offset;
+
+	switch (sqe->opcode) {
+	case K_IO_RING_OP_TX:
+		for (i = 0; i < sqe->len; i++) {
+			uart_poll_out(ring->dev, data[i]);
+		}
+		return i;
+	case K_IO_RING_OP_RX:
+		for (i = 0; i < sqe->len; i++) {
+			if (uart_poll_in(ring->dev, &data[i]) != 0) {
+				break;
+			}
+		}
+		return i;
+	default:
+		return -ENOTSUP;
+	}
+}
+
+/* Process pending submissions.  Stops when the completion ring is
+ * full: the ring is parked, without polling, until the next kick,
+ * which the owner sends with k_io_ring_submit() or k_io_ring_wait()
+ * after reaping entries.
+ *
+ * The shared pointer is re-checked under the ring lock around every
+ * entry, so once k_io_ring_unregister() or an owner abort clears it
+ * the dispatcher lets go of the ring after at most the operation
+ * already in flight.
+ */
+static void ring_drain(struct io_ring *ring)
+{
+	for (;;) {
+		struct k_io_ring_shared *sh;
+		struct k_io_ring_sqe sqe;
+		struct k_io_ring_cqe *cqe;
+		k_spinlock_key_t key;
+		int32_t result;
+
+		key = k_spin_lock(&ring_lock);
+
+		sh = ring->shared;
+		if (sh == NULL || sh->sq_head == sh->sq_tail ||
+		    (sh->cq_tail - sh->cq_head) >= CONFIG_IO_RING_ENTRIES) {
+			k_spin_unlock(&ring_lock, key);
+			return;
+		}
+
+		/* Snapshot the entry; the slot is reusable once
+		 * sq_head moves.
+		 */
+		sqe = sh->sqes[sh->sq_head & RING_MASK];
+		compiler_barrier();
+		sh->sq_head++;
+
+		k_spin_unlock(&ring_lock, key);
+
+		result = execute_sqe(ring, &sqe);
+
+		key = k_spin_lock(&ring_lock);
+
+		if (ring->shared != sh) {
+			/* Torn down while the operation ran; the
+			 * completion goes down with the ring.
+			 */
+			k_spin_unlock(&ring_lock, key);
+			return;
+		}
+
+		cqe = &sh->cqes[sh->cq_tail & RING_MASK];
+		cqe->result = result;
+		cqe->user_data = sqe.user_data;
+
+		/* Publish the completion before moving the index */
+		compiler_barrier();
+		sh->cq_tail++;
+
+		k_spin_unlock(&ring_lock, key);
+
+		k_sem_give(&ring->cq_sem);
+	}
+}
+
+static void io_ring_thread_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		k_sem_take(&work_sem, K_FOREVER);
+
+		for (int i = 0; i < CONFIG_IO_RING_MAX_RINGS; i++) {
+			k_spinlock_key_t key = k_spin_lock(&ring_lock);
+
+			if (rings[i].shared == NULL) {
+				k_spin_unlock(&ring_lock, key);
+				continue;
+			}
+
+			rings[i].busy = true;
+			k_spin_unlock(&ring_lock, key);
+
+			ring_drain(&rings[i]);
+
+			key = k_spin_lock(&ring_lock);
+			rings[i].busy = false;
+			k_spin_unlock(&ring_lock, key);
+		}
+	}
+}
+
+K_THREAD_DEFINE(io_ring_thread, CONFIG_IO_RING_STACK_SIZE,
+		io_ring_thread_fn, NULL, NULL, NULL,
+		K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0);
+
+int z_impl_k_io_ring_register(struct k_io_ring_shared *shared,
+			      struct device *dev, void *buf, size_t buf_size)
+{
+	struct io_ring *ring = NULL;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&ring_lock);
+
+	if (find_ring(shared) != NULL) {
+		k_spin_unlock(&ring_lock, key);
+		return -EEXIST;
+	}
+
+	/* A torn-down slot stays busy until the dispatcher has let
+	 * go of it, so it must not be handed out again yet.
+	 */
+	for (int i = 0; i < CONFIG_IO_RING_MAX_RINGS; i++) {
+		if (rings[i].shared == NULL && !rings[i].busy) {
+			ring = &rings[i];
+			break;
+		}
+	}
+
+	if (ring == NULL) {
+		k_spin_unlock(&ring_lock, key);
+		return -ENOMEM;
+	}
+
+	ring->dev = dev;
+	ring->buf = buf;
+	ring->buf_size = buf_size;
+	ring->owner = _current;
+	k_sem_init(&ring->cq_sem, 0, 1);
+
+	/* Publish last; the dispatcher skips rings with no shared area */
+	compiler_barrier();
+	ring->shared = shared;
+
+	k_spin_unlock(&ring_lock, key);
+
+	return 0;
+}
+
+int z_impl_k_io_ring_unregister(struct k_io_ring_shared *shared)
+{
+	struct io_ring *ring;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&ring_lock);
+
+	ring = find_ring(shared);
+	if (ring == NULL || ring->owner != _current) {
+		k_spin_unlock(&ring_lock, key);
+		return -EINVAL;
+	}
+
+	/* The dispatcher starts no new work once this is cleared */
+	ring->shared = NULL;
+	ring->owner = NULL;
+
+	/* Wait out an operation already in flight so the caller may
+	 * reuse the ring memory on return.  The dispatcher re-checks
+	 * the shared pointer around every entry, so this is bounded
+	 * by a single I/O operation.
+	 */
+	while (ring->busy) {
+		k_spin_unlock(&ring_lock, key);
+		k_sleep(K_MSEC(1));
+		key = k_spin_lock(&ring_lock);
+	}
+
+	k_spin_unlock(&ring_lock, key);
+
+	return 0;
+}
+
+/* Invoked from z_thread_single_abort().  May run in interrupt
+ * context, so an operation in flight cannot be waited out here:
+ * clearing the shared pointer makes the dispatcher let go of the
+ * ring on its own, and the busy flag keeps the slot unavailable
+ * until it has.  The device and buffer pointers are left intact for
+ * that last operation.
+ */
+void z_io_ring_thread_abort(struct k_thread *thread)
+{
+	k_spinlock_key_t key = k_spin_lock(&ring_lock);
+
+	for (int i = 0; i < CONFIG_IO_RING_MAX_RINGS; i++) {
+		if (rings[i].shared != NULL && rings[i].owner == thread) {
+			rings[i].shared = NULL;
+			rings[i].owner = NULL;
+		}
+	}
+
+	k_spin_unlock(&ring_lock, key);
+}
+
+int z_impl_k_io_ring_submit(struct k_io_ring_shared *shared)
+{
+	struct io_ring *ring = find_ring(shared);
+
+	if (ring == NULL || ring->owner != _current) {
+		return -EINVAL;
+	}
+
+	k_sem_give(&work_sem);
+
+	return 0;
+}
+
+int z_impl_k_io_ring_wait(struct k_io_ring_shared *shared,
+			  k_timeout_t timeout)
+{
+	struct io_ring *ring = find_ring(shared);
+
+	if (ring == NULL || ring->owner != _current) {
+		return -EINVAL;
+	}
+
+	/* Make sure anything already posted gets processed */
+	k_sem_give(&work_sem);
+
+	if (shared->cq_head != shared->cq_tail) {
+		return 0;
+	}
+
+	if (k_sem_take(&ring->cq_sem, timeout) != 0) {
+		return -EAGAIN;
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_io_ring_register(struct k_io_ring_shared *shared,
+					    struct device *dev,
+					    void *buf, size_t buf_size)
+{
+	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(shared, sizeof(*shared)));
+	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(buf, buf_size));
+	Z_OOPS(Z_SYSCALL_OBJ(dev, K_OBJ_DRIVER_UART));
+
+	return z_impl_k_io_ring_register(shared, dev, buf, buf_size);
+}
+#include <syscalls/k_io_ring_register_mrsh.c>
+
+static inline int z_vrfy_k_io_ring_unregister(struct k_io_ring_shared *shared)
+{
+	/* The shared area was validated at registration; the owner
+	 * check in the implementation rejects foreign pointers.
+	 */
+	return z_impl_k_io_ring_unregister(shared);
+}
+#include <syscalls/k_io_ring_unregister_mrsh.c>
+
+static inline int z_vrfy_k_io_ring_submit(struct k_io_ring_shared *shared)
+{
+	/* The shared area was validated at registration; the owner
+	 * check in the implementation rejects foreign pointers.
+	 */
+	return z_impl_k_io_ring_submit(shared);
+}
+#include <syscalls/k_io_ring_submit_mrsh.c>
+
+static inline int z_vrfy_k_io_ring_wait(struct k_io_ring_shared *shared,
+					k_timeout_t timeout)
+{
+	return z_impl_k_io_ring_wait(shared, timeout);
+}
+#include <syscalls/k_io_ring_wait_mrsh.c>
+#endif /* CONFIG_USERSPACE */
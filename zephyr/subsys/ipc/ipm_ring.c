@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <drivers/ipm.h>
+#include <ipc/ipm_ring.h>
+
+/* Free-running head/tail indices rely on the slot count being a
+ * power of two for cheap wrapping.
+ */
+BUILD_ASSERT((CONFIG_IPM_RING_SLOTS & (CONFIG_IPM_RING_SLOTS - 1)) == 0,
+	     "IPM_RING_SLOTS must be a power of two");
+BUILD_ASSERT((CONFIG_IPM_RING_SLOT_SIZE % sizeof(uint32_t)) == 0,
+	     "IPM_RING_SLOT_SIZE must be a multiple of 4");
+
+static inline uint8_t *slot_get(struct ipm_ring_shm *shm, uint32_t idx)
+{
+	idx &= (CONFIG_IPM_RING_SLOTS - 1);
+
+	return &shm->slots[idx * CONFIG_IPM_RING_SLOT_SIZE];
+}
+
+int ipm_ring_send(struct ipm_ring *ring, const void *data, size_t len)
+{
+	struct ipm_ring_shm *shm = ring->tx;
+	uint32_t tail = (uint32_t)atomic_get(&shm->tail);
+	uint8_t *slot;
+
+	if (len > IPM_RING_MAX_PAYLOAD) {
+		return -EMSGSIZE;
+	}
+
+	if ((tail - (uint32_t)atomic_get(&shm->head)) >=
+	    CONFIG_IPM_RING_SLOTS) {
+		return -ENOMEM;
+	}
+
+	slot = slot_get(shm, tail);
+	*(uint32_t *)slot = (uint32_t)len;
+	memcpy(&slot[IPM_RING_SLOT_HDR_SIZE], data, len);
+
+	/* Publish the slot.  The sequentially consistent index
+	 * accesses order the payload writes before the tail update
+	 * and the head read below after it, so either the consumer
+	 * sees the new tail before going idle or the head it left
+	 * behind equals our pre-publish tail and we ring the bell.
+	 */
+	atomic_set(&shm->tail, tail + 1);
+
+	if ((uint32_t)atomic_get(&shm->head) == tail) {
+		return ipm_send(ring->ipm, 0, 0, NULL, 0);
+	}
+
+	return 0;
+}
+
+static void ipm_ring_isr(struct device *ipmdev, void *user_data,
+			 uint32_t id, volatile void *data)
+{
+	struct ipm_ring *ring = user_data;
+	struct ipm_ring_shm *shm = ring->rx;
+	uint32_t head = (uint32_t)atomic_get(&shm->head);
+
+	ARG_UNUSED(ipmdev);
+	ARG_UNUSED(id);
+	ARG_UNUSED(data);
+
+	/* Drain everything published so far; messages that arrive
+	 * while draining are picked up by the re-check, not by
+	 * another doorbell.
+	 */
+	while (head != (uint32_t)atomic_get(&shm->tail)) {
+		uint8_t *slot = slot_get(shm, head);
+		uint32_t len = *(uint32_t *)slot;
+
+		ring->cb(&slot[IPM_RING_SLOT_HDR_SIZE], len, ring->user_data);
+
+		head++;
+		atomic_set(&shm->head, head);
+	}
+}
+
+int ipm_ring_init(struct ipm_ring *ring, struct device *ipm,
+		  void *tx_shm, void *rx_shm,
+		  ipm_ring_recv_cb_t cb, void *user_data)
+{
+	if (ipm == NULL || tx_shm == NULL || rx_shm == NULL || cb == NULL) {
+		return -EINVAL;
+	}
+
+	ring->tx = tx_shm;
+	ring->rx = rx_shm;
+	ring->ipm = ipm;
+	ring->cb = cb;
+	ring->user_data = user_data;
+
+	/* Each side owns its TX indices; the peer zeroes the other
+	 * ring when it comes up.
+	 */
+	atomic_set(&ring->tx->head, 0);
+	atomic_set(&ring->tx->tail, 0);
+
+	ipm_register_callback(ipm, ipm_ring_isr, ring);
+
+	return ipm_set_enabled(ipm, 1);
+}
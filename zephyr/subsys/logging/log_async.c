@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <sys/atomic.h>
+#include <logging/log_core.h>
+#include "log_async.h"
+
+/* Per-backend drain context. The processing thread is the only producer
+ * and the drain thread the only consumer, so plain ring indices with an
+ * atomic fill counter suffice.
+ */
+struct log_async_ctx {
+	const struct log_backend *backend;
+	struct log_msg *ring[CONFIG_LOG_ASYNC_QUEUE_SIZE];
+	uint32_t wr;
+	uint32_t rd;
+	atomic_t cnt;
+	atomic_t dropped;
+	struct k_sem sem;
+	struct k_thread thread;
+};
+
+static struct log_async_ctx async_ctx[CONFIG_LOG_ASYNC_MAX_BACKENDS];
+static int async_cnt;
+static bool async_panic;
+
+static K_THREAD_STACK_ARRAY_DEFINE(async_stacks,
+				   CONFIG_LOG_ASYNC_MAX_BACKENDS,
+				   CONFIG_LOG_ASYNC_THREAD_STACK_SIZE);
+
+static void drain_one(struct log_async_ctx *ctx)
+{
+	struct log_msg *msg;
+
+	msg = ctx->ring[ctx->rd % CONFIG_LOG_ASYNC_QUEUE_SIZE];
+	ctx->rd++;
+	atomic_dec(&ctx->cnt);
+
+	log_backend_put(ctx->backend, msg);
+	log_msg_put(msg);
+}
+
+static void log_async_thread_func(void *p1, void *p2, void *p3)
+{
+	struct log_async_ctx *ctx = p1;
+	uint32_t dropped;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&ctx->sem, K_FOREVER);
+		drain_one(ctx);
+
+		dropped = atomic_set(&ctx->dropped, 0);
+		if (dropped != 0U) {
+			log_backend_dropped(ctx->backend, dropped);
+		}
+	}
+}
+
+void log_async_init(void)
+{
+	struct log_async_ctx *ctx;
+	int i;
+
+	async_cnt = MIN(log_backend_count_get(),
+			CONFIG_LOG_ASYNC_MAX_BACKENDS);
+
+	for (i = 0; i < async_cnt; i++) {
+		ctx = &async_ctx[i];
+
+		ctx->backend = log_backend_get(i);
+		k_sem_init(&ctx->sem, 0, CONFIG_LOG_ASYNC_QUEUE_SIZE);
+		k_thread_create(&ctx->thread, async_stacks[i],
+				K_THREAD_STACK_SIZEOF(async_stacks[i]),
+				log_async_thread_func, ctx, NULL, NULL,
+				K_LOWEST_APPLICATION_THREAD_PRIO, 0,
+				K_NO_WAIT);
+		k_thread_name_set(&ctx->thread, "log_drain");
+	}
+}
+
+bool log_async_put(const struct log_backend *backend, struct log_msg *msg)
+{
+	struct log_async_ctx *ctx = NULL;
+	int i;
+
+	if (async_panic) {
+		return false;
+	}
+
+	for (i = 0; i < async_cnt; i++) {
+		if (async_ctx[i].backend == backend) {
+			ctx = &async_ctx[i];
+			break;
+		}
+	}
+
+	if (ctx == NULL) {
+		return false;
+	}
+
+	if (atomic_get(&ctx->cnt) >= CONFIG_LOG_ASYNC_QUEUE_SIZE) {
+		/* This backend is behind; drop for it alone. */
+		atomic_inc(&ctx->dropped);
+		return true;
+	}
+
+	log_msg_get(msg);
+	ctx->ring[ctx->wr % CONFIG_LOG_ASYNC_QUEUE_SIZE] = msg;
+	ctx->wr++;
+	atomic_inc(&ctx->cnt);
+	k_sem_give(&ctx->sem);
+
+	return true;
+}
+
+void log_async_panic(void)
+{
+	struct log_async_ctx *ctx;
+	int i;
+
+	async_panic = true;
+
+	for (i = 0; i < async_cnt; i++) {
+		ctx = &async_ctx[i];
+
+		while (atomic_get(&ctx->cnt) > 0) {
+			(void)k_sem_take(&ctx->sem, K_NO_WAIT);
+			drain_one(ctx);
+		}
+	}
+}
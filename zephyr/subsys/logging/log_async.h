@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef LOG_ASYNC_H_
+#define LOG_ASYNC_H_
+
+#include <logging/log_backend.h>
+#include <logging/log_msg.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Start the per-backend drain threads.
+ *
+ * Called once the kernel is up; backends registered at that point get a
+ * queue and a drain thread, up to CONFIG_LOG_ASYNC_MAX_BACKENDS.
+ */
+void log_async_init(void);
+
+/** @brief Queue a message towards a backend's drain thread.
+ *
+ * Takes a reference on the message when it is queued. When the
+ * backend's queue is full the message is dropped for that backend and
+ * accounted for in its dropped-message notification.
+ *
+ * @param backend Backend.
+ * @param msg     Message.
+ *
+ * @return true if the message was queued (or dropped) for an
+ *	   asynchronously handled backend, false if the caller must
+ *	   process the backend synchronously.
+ */
+bool log_async_put(const struct log_backend *backend, struct log_msg *msg);
+
+/** @brief Flush all queues synchronously and stop accepting messages.
+ *
+ * Called on panic, when the drain threads can no longer run.
+ */
+void log_async_panic(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_ASYNC_H_ */
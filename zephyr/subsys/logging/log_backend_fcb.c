@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <logging/log_backend.h>
+#include <logging/log_core.h>
+#include <logging/log_msg.h>
+#include <logging/log_output.h>
+#include <fs/fcb.h>
+#include <storage/flash_map.h>
+#include <string.h>
+
+#define LOG_FCB_FLASH_AREA_ID FLASH_AREA_ID(log_storage)
+
+/*
+ * Formatted messages accumulate in RAM and are appended to the flash
+ * circular buffer as one entry per full batch buffer, so flash sees a
+ * few large aligned writes instead of one program operation per
+ * message. On panic the partial batch is flushed synchronously and
+ * every subsequent message is flushed as it arrives.
+ */
+static struct flash_sector log_fcb_sectors[CONFIG_LOG_BACKEND_FCB_NUM_SECTORS];
+static struct fcb log_fcb = {
+	.f_magic = CONFIG_LOG_BACKEND_FCB_MAGIC,
+	.f_sectors = log_fcb_sectors,
+};
+
+static uint8_t batch_buf[CONFIG_LOG_BACKEND_FCB_BUF_SIZE];
+static uint16_t batch_len;
+static bool in_panic;
+static bool backend_ok;
+
+static int log_fcb_flush(void)
+{
+	struct fcb_entry loc;
+	uint16_t wlen;
+	uint8_t pad[32];
+	uint8_t align;
+	int rc;
+	int i;
+
+	if (batch_len == 0U) {
+		return 0;
+	}
+
+	rc = -ENOSPC;
+	for (i = 0; i < log_fcb.f_sector_cnt; i++) {
+		rc = fcb_append(&log_fcb, batch_len, &loc);
+		if (rc != -ENOSPC) {
+			break;
+		}
+
+		/* Reclaim the sector holding the oldest entries. */
+		rc = fcb_rotate(&log_fcb);
+		if (rc != 0) {
+			return rc;
+		}
+	}
+	if (rc != 0) {
+		return rc;
+	}
+
+	/* Writes must be aligned; pad the tail with erased bytes. The
+	 * entry length stays batch_len so readers see no padding.
+	 */
+	align = log_fcb.f_align;
+	wlen = batch_len & ~((uint16_t)align - 1U);
+	if (wlen > 0U) {
+		rc = flash_area_write(log_fcb.fap,
+				      FCB_ENTRY_FA_DATA_OFF(loc),
+				      batch_buf, wlen);
+		if (rc != 0) {
+			return rc;
+		}
+	}
+
+	if (wlen < batch_len) {
+		__ASSERT_NO_MSG(align <= sizeof(pad));
+		(void)memset(pad, 0xff, sizeof(pad));
+		(void)memcpy(pad, &batch_buf[wlen], batch_len - wlen);
+		rc = flash_area_write(log_fcb.fap,
+				      FCB_ENTRY_FA_DATA_OFF(loc) + wlen,
+				      pad, align);
+		if (rc != 0) {
+			return rc;
+		}
+	}
+
+	rc = fcb_append_finish(&log_fcb, &loc);
+	if (rc == 0) {
+		batch_len = 0U;
+	}
+
+	return rc;
+}
+
+static int char_out(uint8_t *data, size_t length, void *ctx)
+{
+	size_t chunk;
+
+	ARG_UNUSED(ctx);
+
+	if (!backend_ok) {
+		return length;
+	}
+
+	for (size_t i = 0; i < length; i += chunk) {
+		chunk = MIN(length - i, sizeof(batch_buf) - batch_len);
+		(void)memcpy(&batch_buf[batch_len], &data[i], chunk);
+		batch_len += chunk;
+
+		if (batch_len == sizeof(batch_buf)) {
+			if (log_fcb_flush() != 0) {
+				/* Flash is inaccessible; stop writing. */
+				backend_ok = false;
+				return length;
+			}
+		}
+	}
+
+	return length;
+}
+
+static uint8_t fcb_out_buf[64];
+
+LOG_OUTPUT_DEFINE(log_output_fcb, char_out, fcb_out_buf, sizeof(fcb_out_buf));
+
+static void put(const struct log_backend *const backend,
+		struct log_msg *msg)
+{
+	uint32_t flags = LOG_OUTPUT_FLAG_LEVEL | LOG_OUTPUT_FLAG_TIMESTAMP;
+
+	log_msg_get(msg);
+
+	if (IS_ENABLED(CONFIG_LOG_BACKEND_FORMAT_TIMESTAMP)) {
+		flags |= LOG_OUTPUT_FLAG_FORMAT_TIMESTAMP;
+	}
+
+	log_output_msg_process(&log_output_fcb, msg, flags);
+
+	if (in_panic) {
+		(void)log_fcb_flush();
+	}
+
+	log_msg_put(msg);
+}
+
+static void log_backend_fcb_init(void)
+{
+	uint32_t cnt = ARRAY_SIZE(log_fcb_sectors);
+	int rc;
+
+	rc = flash_area_get_sectors(LOG_FCB_FLASH_AREA_ID, &cnt,
+				    log_fcb_sectors);
+	if (rc != 0 && rc != -ENOMEM) {
+		return;
+	}
+
+	log_fcb.f_sector_cnt = cnt;
+
+	rc = fcb_init(LOG_FCB_FLASH_AREA_ID, &log_fcb);
+	if (rc != 0) {
+		/* Area held something else; start over. */
+		rc = flash_area_erase(log_fcb.fap, 0, log_fcb.fap->fa_size);
+		if (rc == 0) {
+			rc = fcb_init(LOG_FCB_FLASH_AREA_ID, &log_fcb);
+		}
+	}
+
+	backend_ok = (rc == 0);
+}
+
+static void panic(struct log_backend const *const backend)
+{
+	in_panic = true;
+	log_output_flush(&log_output_fcb);
+	(void)log_fcb_flush();
+}
+
+static void dropped(const struct log_backend *const backend, uint32_t cnt)
+{
+	ARG_UNUSED(backend);
+
+	log_output_dropped_process(&log_output_fcb, cnt);
+}
+
+static void sync_string(const struct log_backend *const backend,
+			struct log_msg_ids src_level, uint32_t timestamp,
+			const char *fmt, va_list ap)
+{
+	uint32_t flags = LOG_OUTPUT_FLAG_LEVEL | LOG_OUTPUT_FLAG_TIMESTAMP;
+	uint32_t key;
+
+	if (IS_ENABLED(CONFIG_LOG_BACKEND_FORMAT_TIMESTAMP)) {
+		flags |= LOG_OUTPUT_FLAG_FORMAT_TIMESTAMP;
+	}
+
+	key = irq_lock();
+	log_output_string(&log_output_fcb, src_level,
+			  timestamp, fmt, ap, flags);
+	irq_unlock(key);
+}
+
+static void sync_hexdump(const struct log_backend *const backend,
+			 struct log_msg_ids src_level, uint32_t timestamp,
+			 const char *metadata, const uint8_t *data,
+			 uint32_t length)
+{
+	uint32_t flags = LOG_OUTPUT_FLAG_LEVEL | LOG_OUTPUT_FLAG_TIMESTAMP;
+	uint32_t key;
+
+	if (IS_ENABLED(CONFIG_LOG_BACKEND_FORMAT_TIMESTAMP)) {
+		flags |= LOG_OUTPUT_FLAG_FORMAT_TIMESTAMP;
+	}
+
+	key = irq_lock();
+	log_output_hexdump(&log_output_fcb, src_level, timestamp,
+			   metadata, data, length, flags);
+	irq_unlock(key);
+}
+
+const struct log_backend_api log_backend_fcb_api = {
+	.put = IS_ENABLED(CONFIG_LOG_IMMEDIATE) ? NULL : put,
+	.put_sync_string = IS_ENABLED(CONFIG_LOG_IMMEDIATE) ?
+			sync_string : NULL,
+	.put_sync_hexdump = IS_ENABLED(CONFIG_LOG_IMMEDIATE) ?
+			sync_hexdump : NULL,
+	.panic = panic,
+	.init = log_backend_fcb_init,
+	.dropped = IS_ENABLED(CONFIG_LOG_IMMEDIATE) ? NULL : dropped,
+};
+
+LOG_BACKEND_DEFINE(log_backend_fcb, log_backend_fcb_api, true);
@@ -34,6 +34,10 @@ static void put(const struct log_backend *const backend,
 	uint32_t flag = IS_ENABLED(CONFIG_LOG_BACKEND_UART_SYST_ENABLE) ?
 		LOG_OUTPUT_FLAG_FORMAT_SYST : 0;
 
+	if (IS_ENABLED(CONFIG_LOG_BACKEND_UART_DICTIONARY_ENABLE)) {
+		flag |= LOG_OUTPUT_FLAG_FORMAT_DICT;
+	}
+
 	log_backend_std_put(&log_output_uart, flag, msg);
 }
 
@@ -5,6 +5,9 @@
  */
 #include <logging/log_msg.h>
 #include "log_list.h"
+#if defined(CONFIG_LOG_ASYNC_BACKENDS)
+#include "log_async.h"
+#endif
 #include <logging/log.h>
 #include <logging/log_backend.h>
 #include <logging/log_ctrl.h>
@@ -43,6 +46,14 @@ LOG_MODULE_REGISTER(log);
 #define CONFIG_LOG_STRDUP_BUF_COUNT 0
 #endif
 
+#ifndef CONFIG_LOG_STRDUP_SMALL_MAX_STRING
+#define CONFIG_LOG_STRDUP_SMALL_MAX_STRING 0
+#endif
+
+#ifndef CONFIG_LOG_STRDUP_SMALL_BUF_COUNT
+#define CONFIG_LOG_STRDUP_SMALL_BUF_COUNT 0
+#endif
+
 struct log_strdup_buf {
 	atomic_t refcount;
 	char buf[CONFIG_LOG_STRDUP_MAX_STRING + 1]; /* for termination */
@@ -51,6 +62,16 @@ struct log_strdup_buf {
 #define LOG_STRDUP_POOL_BUFFER_SIZE \
 	(sizeof(struct log_strdup_buf) * CONFIG_LOG_STRDUP_BUF_COUNT)
 
+#if CONFIG_LOG_STRDUP_SMALL_BUF_COUNT > 0
+struct log_strdup_small_buf {
+	atomic_t refcount;
+	char buf[CONFIG_LOG_STRDUP_SMALL_MAX_STRING + 1]; /* for termination */
+};
+
+#define LOG_STRDUP_SMALL_POOL_BUFFER_SIZE \
+	(sizeof(struct log_strdup_small_buf) * CONFIG_LOG_STRDUP_SMALL_BUF_COUNT)
+#endif
+
 K_SEM_DEFINE(log_process_thread_sem, 0, 1);
 
 static const char *log_strdup_fail_msg = "<log_strdup alloc failed>";
@@ -58,6 +79,12 @@ struct k_mem_slab log_strdup_pool;
 static uint8_t __noinit __aligned(sizeof(void *))
 		log_strdup_pool_buf[LOG_STRDUP_POOL_BUFFER_SIZE];
 
+#if CONFIG_LOG_STRDUP_SMALL_BUF_COUNT > 0
+struct k_mem_slab log_strdup_small_pool;
+static uint8_t __noinit __aligned(sizeof(void *))
+		log_strdup_small_pool_buf[LOG_STRDUP_SMALL_POOL_BUFFER_SIZE];
+#endif
+
 static struct log_list_t list;
 static atomic_t initialized;
 static bool panic_mode;
@@ -191,11 +218,15 @@ static inline void msg_finalize(struct log_msg *msg,
 
 	atomic_inc(&buffered_cnt);
 
+#if defined(CONFIG_LOG_MPSC_QUEUE)
+	log_list_add_tail(&list, msg);
+#else
 	key = irq_lock();
 
 	log_list_add_tail(&list, msg);
 
 	irq_unlock(key);
+#endif
 
 	if (panic_mode) {
 		key = irq_lock();
@@ -480,6 +511,13 @@ void log_core_init(void)
 		k_mem_slab_init(&log_strdup_pool, log_strdup_pool_buf,
 					sizeof(struct log_strdup_buf),
 					CONFIG_LOG_STRDUP_BUF_COUNT);
+
+#if CONFIG_LOG_STRDUP_SMALL_BUF_COUNT > 0
+		k_mem_slab_init(&log_strdup_small_pool,
+					log_strdup_small_pool_buf,
+					sizeof(struct log_strdup_small_buf),
+					CONFIG_LOG_STRDUP_SMALL_BUF_COUNT);
+#endif
 	}
 
 	/* Set default timestamp. */
@@ -598,6 +636,10 @@ void z_impl_log_panic(void)
 		}
 	}
 
+#if defined(CONFIG_LOG_ASYNC_BACKENDS)
+	log_async_panic();
+#endif
+
 	if (!IS_ENABLED(CONFIG_LOG_IMMEDIATE)) {
 		/* Flush */
 		while (log_process(false) == true) {
@@ -649,6 +691,12 @@ static void msg_process(struct log_msg *msg, bool bypass)
 
 			if (log_backend_is_active(backend) &&
 			    msg_filter_check(backend, msg)) {
+#if defined(CONFIG_LOG_ASYNC_BACKENDS)
+				if (!panic_mode &&
+				    log_async_put(backend, msg)) {
+					continue;
+				}
+#endif
 				log_backend_put(backend, msg);
 			}
 		}
@@ -874,9 +922,60 @@ uint32_t log_filter_get(struct log_backend const *const backend,
 	}
 }
 
+static void log_strdup_profiling_update(size_t slen)
+{
+	uint32_t in_use;
+
+	if (!IS_ENABLED(CONFIG_LOG_STRDUP_POOL_PROFILING)) {
+		return;
+	}
+
+	/* Maximum trackers are best effort, a concurrent update may be
+	 * missed but no lock is taken on the allocation path.
+	 */
+	in_use = atomic_inc((atomic_t *)&log_strdup_in_use) + 1;
+	if (in_use > log_strdup_max) {
+		log_strdup_max = in_use;
+	}
+
+	if (slen > log_strdup_longest) {
+		log_strdup_longest = slen;
+	}
+}
+
+#if CONFIG_LOG_STRDUP_SMALL_BUF_COUNT > 0
+static char *log_strdup_small(const char *str, size_t slen)
+{
+	struct log_strdup_small_buf *dup;
+	int err;
+
+	err = k_mem_slab_alloc(&log_strdup_small_pool, (void **)&dup,
+			       K_NO_WAIT);
+	if (err != 0) {
+		return NULL;
+	}
+
+	/* Set 'allocated' flag. */
+	(void)atomic_set(&dup->refcount, 1);
+
+	if (slen <= CONFIG_LOG_STRDUP_SMALL_MAX_STRING) {
+		memcpy(dup->buf, str, slen + 1);
+	} else {
+		memcpy(dup->buf, str, sizeof(dup->buf) - 2);
+		dup->buf[sizeof(dup->buf) - 2] = '~';
+		dup->buf[sizeof(dup->buf) - 1] = '\0';
+	}
+
+	log_strdup_profiling_update(slen);
+
+	return dup->buf;
+}
+#endif /* CONFIG_LOG_STRDUP_SMALL_BUF_COUNT > 0 */
+
 char *log_strdup(const char *str)
 {
 	struct log_strdup_buf *dup;
+	size_t slen;
 	int err;
 
 	if (IS_ENABLED(CONFIG_LOG_IMMEDIATE) ||
@@ -884,24 +983,38 @@ char *log_strdup(const char *str)
 		return (char *)str;
 	}
 
+	slen = strlen(str);
+
+#if CONFIG_LOG_STRDUP_SMALL_BUF_COUNT > 0
+	/* Capture short strings from the dedicated small buffer pool so
+	 * that they do not use up the full-size buffers.
+	 */
+	if (slen <= CONFIG_LOG_STRDUP_SMALL_MAX_STRING) {
+		char *copy = log_strdup_small(str, slen);
+
+		if (copy) {
+			return copy;
+		}
+		/* Small pool exhausted, fall back to the regular pool */
+	}
+#endif
+
 	err = k_mem_slab_alloc(&log_strdup_pool, (void **)&dup, K_NO_WAIT);
 	if (err != 0) {
+#if CONFIG_LOG_STRDUP_SMALL_BUF_COUNT > 0
+		/* A truncated capture from the small pool is still more
+		 * useful than the allocation failure marker.
+		 */
+		char *copy = log_strdup_small(str, slen);
+
+		if (copy) {
+			return copy;
+		}
+#endif
 		/* failed to allocate */
 		return (char *)log_strdup_fail_msg;
 	}
 
-	if (IS_ENABLED(CONFIG_LOG_STRDUP_POOL_PROFILING)) {
-		size_t slen = strlen(str);
-		struct k_spinlock lock;
-		k_spinlock_key_t key;
-
-		key = k_spin_lock(&lock);
-		log_strdup_in_use++;
-		log_strdup_max = MAX(log_strdup_in_use, log_strdup_max);
-		log_strdup_longest = MAX(slen, log_strdup_longest);
-		k_spin_unlock(&lock, key);
-	}
-
 	/* Set 'allocated' flag. */
 	(void)atomic_set(&dup->refcount, 1);
 
@@ -909,6 +1022,8 @@ char *log_strdup(const char *str)
 	dup->buf[sizeof(dup->buf) - 2] = '~';
 	dup->buf[sizeof(dup->buf) - 1] = '\0';
 
+	log_strdup_profiling_update(slen);
+
 	return dup->buf;
 }
 
@@ -926,12 +1041,33 @@ uint32_t log_get_strdup_longest_string(void)
 
 bool log_is_strdup(const void *buf)
 {
+#if CONFIG_LOG_STRDUP_SMALL_BUF_COUNT > 0
+	if (PART_OF_ARRAY(log_strdup_small_pool_buf, (uint8_t *)buf)) {
+		return true;
+	}
+#endif
 	return PART_OF_ARRAY(log_strdup_pool_buf, (uint8_t *)buf);
 
 }
 
 void log_free(void *str)
 {
+#if CONFIG_LOG_STRDUP_SMALL_BUF_COUNT > 0
+	if (PART_OF_ARRAY(log_strdup_small_pool_buf, (uint8_t *)str)) {
+		struct log_strdup_small_buf *dup =
+			CONTAINER_OF(str, struct log_strdup_small_buf, buf);
+
+		if (atomic_dec(&dup->refcount) == 1) {
+			k_mem_slab_free(&log_strdup_small_pool,
+					(void **)&dup);
+			if (IS_ENABLED(CONFIG_LOG_STRDUP_POOL_PROFILING)) {
+				atomic_dec((atomic_t *)&log_strdup_in_use);
+			}
+		}
+
+		return;
+	}
+#endif
 	struct log_strdup_buf *dup = CONTAINER_OF(str, struct log_strdup_buf,
 						  buf);
 
@@ -1189,6 +1325,10 @@ static int enable_logger(struct device *arg)
 {
 	ARG_UNUSED(arg);
 
+#if defined(CONFIG_LOG_ASYNC_BACKENDS)
+	log_async_init();
+#endif
+
 	if (IS_ENABLED(CONFIG_LOG_PROCESS_THREAD)) {
 		k_timer_init(&log_process_thread_timer,
 				log_process_thread_timer_expiry_fn, NULL);
@@ -6,6 +6,94 @@
 
 #include "log_list.h"
 
+#ifdef CONFIG_LOG_MPSC_QUEUE
+
+#include <sys/atomic.h>
+
+/* Lock-free intrusive multi-producer, single-consumer queue (D. Vyukov).
+ * Producers push with a single atomic exchange on list->tail and then
+ * link the previous node; the consumer follows the next pointers from
+ * list->head. The stub node embedded in the list keeps the queue
+ * non-empty so producers never race the consumer on an empty/non-empty
+ * transition. In the window between a producer's exchange and its link
+ * write the newest message is not yet visible; the consumer then reports
+ * an empty queue and picks the message up on a later call.
+ */
+
+static void mpsc_push(struct log_list_t *list, struct log_msg *msg)
+{
+	struct log_msg *prev;
+
+	atomic_ptr_set((atomic_ptr_t *)&msg->next, NULL);
+	prev = atomic_ptr_set((atomic_ptr_t *)&list->tail, msg);
+	atomic_ptr_set((atomic_ptr_t *)&prev->next, msg);
+}
+
+void log_list_init(struct log_list_t *list)
+{
+	list->stub.next = NULL;
+	list->head = &list->stub;
+	list->tail = &list->stub;
+}
+
+void log_list_add_tail(struct log_list_t *list, struct log_msg *msg)
+{
+	mpsc_push(list, msg);
+}
+
+struct log_msg *log_list_head_get(struct log_list_t *list)
+{
+	struct log_msg *head = list->head;
+	struct log_msg *next = atomic_ptr_get((atomic_ptr_t *)&head->next);
+
+	if (head == &list->stub) {
+		if (next == NULL) {
+			return NULL;
+		}
+		list->head = next;
+		head = next;
+		next = atomic_ptr_get((atomic_ptr_t *)&head->next);
+	}
+
+	if (next != NULL) {
+		list->head = next;
+		return head;
+	}
+
+	if (head != atomic_ptr_get((atomic_ptr_t *)&list->tail)) {
+		/* A producer is between its exchange and its link write;
+		 * the message becomes visible once the link is stored.
+		 */
+		return NULL;
+	}
+
+	/* Single message left; re-insert the stub behind it so the head
+	 * can be unlinked.
+	 */
+	mpsc_push(list, &list->stub);
+
+	next = atomic_ptr_get((atomic_ptr_t *)&head->next);
+	if (next != NULL) {
+		list->head = next;
+		return head;
+	}
+
+	return NULL;
+}
+
+struct log_msg *log_list_head_peek(struct log_list_t *list)
+{
+	struct log_msg *head = list->head;
+
+	if (head != &list->stub) {
+		return head;
+	}
+
+	return atomic_ptr_get((atomic_ptr_t *)&head->next);
+}
+
+#else /* CONFIG_LOG_MPSC_QUEUE */
+
 void log_list_init(struct log_list_t *list)
 {
 	list->tail = NULL;
@@ -39,3 +127,5 @@ struct log_msg *log_list_head_get(struct log_list_t *list)
 
 	return msg;
 }
+
+#endif /* CONFIG_LOG_MPSC_QUEUE */
@@ -16,6 +16,12 @@ extern "C" {
 struct log_list_t {
 	struct log_msg *head;
 	struct log_msg *tail;
+#ifdef CONFIG_LOG_MPSC_QUEUE
+	/* Dummy node for the lock-free queue; head and tail never go back
+	 * to NULL, they point at the stub when the queue is empty.
+	 */
+	struct log_msg stub;
+#endif
 };
 
 /** @brief Initialize log list instance.
@@ -57,6 +57,8 @@ extern void log_output_string_syst_process(const struct log_output *log_output,
 extern void log_output_hexdump_syst_process(const struct log_output *log_output,
 				struct log_msg_ids src_level,
 				const uint8_t *data, uint32_t length, uint32_t flag);
+extern void log_output_msg_dict_process(const struct log_output *log_output,
+				struct log_msg *msg, uint32_t flags);
 
 /* The RFC 5424 allows very flexible mapping and suggest the value 0 being the
  * highest severity and 7 to be the lowest (debugging level) severity.
@@ -532,6 +534,12 @@ void log_output_msg_process(const struct log_output *log_output,
 	bool raw_string = (level == LOG_LEVEL_INTERNAL_RAW_STRING);
 	int prefix_offset;
 
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY_OUTPUT) &&
+	    flags & LOG_OUTPUT_FLAG_FORMAT_DICT) {
+		log_output_msg_dict_process(log_output, msg, flags);
+		return;
+	}
+
 	if (IS_ENABLED(CONFIG_LOG_MIPI_SYST_ENABLE) &&
 	    flags & LOG_OUTPUT_FLAG_FORMAT_SYST) {
 		log_output_msg_syst_process(log_output, msg, flags);
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <logging/log_output.h>
+#include <logging/log_core.h>
+#include <sys/byteorder.h>
+#include <string.h>
+
+/* Dictionary-based binary output. Instead of rendering a message to
+ * text, only the address of the format string and the raw arguments are
+ * emitted; the host resolves the addresses against the matching ELF
+ * file. See scripts/logging/parse_log_dict.py for the decoder and the
+ * exact record layout. All multi-byte fields are little-endian.
+ *
+ * String arguments that live in read-only data are emitted as their
+ * address like any other argument; strings duplicated with log_strdup()
+ * are transient, so their contents are appended to the record and the
+ * matching bit is set in the string mask.
+ */
+
+#define DICT_SYNC_BYTE		0xD7
+
+#define DICT_MSG_TYPE_STD	1
+#define DICT_MSG_TYPE_HEXDUMP	2
+#define DICT_MSG_TYPE_RAW_STR	3
+
+/* Chunk size used when streaming hexdump payloads. */
+#define DICT_HEXDUMP_CHUNK	32
+
+static void dict_write(const struct log_output *output, const void *data,
+		       size_t len)
+{
+	const uint8_t *buf = data;
+	int idx;
+
+	while (len--) {
+		if (output->control_block->offset == output->size) {
+			log_output_flush(output);
+		}
+
+		idx = atomic_inc(&output->control_block->offset);
+		output->buf[idx] = *buf++;
+	}
+}
+
+static void dict_write_u8(const struct log_output *output, uint8_t v)
+{
+	dict_write(output, &v, sizeof(v));
+}
+
+static void dict_write_u16(const struct log_output *output, uint16_t v)
+{
+	uint8_t b[sizeof(v)];
+
+	sys_put_le16(v, b);
+	dict_write(output, b, sizeof(b));
+}
+
+static void dict_write_u32(const struct log_output *output, uint32_t v)
+{
+	uint8_t b[sizeof(v)];
+
+	sys_put_le32(v, b);
+	dict_write(output, b, sizeof(b));
+}
+
+static void dict_std_print(const struct log_output *output,
+			   struct log_msg *msg)
+{
+	uint32_t nargs = log_msg_nargs_get(msg);
+	uint16_t str_mask = 0;
+	const char *str;
+	uint16_t len;
+	uint32_t i;
+
+	for (i = 0; i < nargs; i++) {
+		str = (const char *)log_msg_arg_get(msg, i);
+		if (log_is_strdup(str)) {
+			str_mask |= BIT(i);
+		}
+	}
+
+	dict_write_u8(output, (uint8_t)nargs);
+	dict_write_u16(output, str_mask);
+
+	for (i = 0; i < nargs; i++) {
+		dict_write_u32(output, (uint32_t)log_msg_arg_get(msg, i));
+	}
+
+	/* Transient string contents, in argument order. */
+	for (i = 0; i < nargs; i++) {
+		if ((str_mask & BIT(i)) == 0U) {
+			continue;
+		}
+		str = (const char *)log_msg_arg_get(msg, i);
+		len = (uint16_t)strlen(str);
+		dict_write_u16(output, len);
+		dict_write(output, str, len);
+	}
+}
+
+static void dict_hexdump_print(const struct log_output *output,
+			       struct log_msg *msg)
+{
+	uint8_t buf[DICT_HEXDUMP_CHUNK];
+	size_t offset = 0;
+	size_t len;
+
+	dict_write_u8(output, 0U);
+	dict_write_u16(output, 0U);
+
+	/* Stream the payload in chunks; a short or empty chunk length
+	 * terminates the record.
+	 */
+	while (true) {
+		len = sizeof(buf);
+		log_msg_hexdump_data_get(msg, buf, &len, offset);
+		dict_write_u16(output, (uint16_t)len);
+		if (len == 0U) {
+			break;
+		}
+		dict_write(output, buf, len);
+		offset += len;
+		if (len < sizeof(buf)) {
+			break;
+		}
+	}
+}
+
+void log_output_msg_dict_process(const struct log_output *output,
+				 struct log_msg *msg, uint32_t flags)
+{
+	uint8_t level = (uint8_t)log_msg_level_get(msg);
+	bool std_msg = log_msg_is_std(msg);
+	bool raw_string = (level == LOG_LEVEL_INTERNAL_RAW_STRING);
+	uint8_t type;
+
+	ARG_UNUSED(flags);
+
+	if (std_msg) {
+		type = DICT_MSG_TYPE_STD;
+	} else {
+		type = raw_string ? DICT_MSG_TYPE_RAW_STR :
+				    DICT_MSG_TYPE_HEXDUMP;
+	}
+
+	dict_write_u8(output, DICT_SYNC_BYTE);
+	dict_write_u8(output, type);
+	dict_write_u8(output, level);
+	dict_write_u8(output, (uint8_t)log_msg_domain_id_get(msg));
+	dict_write_u16(output, (uint16_t)log_msg_source_id_get(msg));
+	dict_write_u32(output, log_msg_timestamp_get(msg));
+	dict_write_u32(output, (uint32_t)(uintptr_t)log_msg_str_get(msg));
+
+	if (std_msg) {
+		dict_std_print(output, msg);
+	} else {
+		dict_hexdump_print(output, msg);
+	}
+
+	log_output_flush(output);
+}
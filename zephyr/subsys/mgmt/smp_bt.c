@@ -12,8 +12,10 @@
 
 #include <zephyr.h>
 #include <init.h>
+#include <sys/byteorder.h>
 #include <bluetooth/bluetooth.h>
 #include <bluetooth/uuid.h>
+#include <bluetooth/att.h>
 #include <bluetooth/gatt.h>
 
 #include <mgmt/smp_bt.h>
@@ -29,6 +31,26 @@ struct smp_bt_user_data {
 
 static struct zephyr_smp_transport smp_bt_transport;
 
+static void smp_bt_ud_free(void *ud);
+
+#if defined(CONFIG_MCUMGR_SMP_BT_REASSEMBLY)
+/* An SMP request header is eight bytes, with the big-endian payload length
+ * at offset 2.
+ */
+#define SMP_HDR_SIZE	8
+#define SMP_HDR_LEN_OFF	2
+
+/* Partially received request. Requests from different connections are not
+ * interleaved; a fragment from another connection drops the stale partial
+ * packet, which also cleans up after a disconnect mid-request.
+ */
+static struct {
+	struct bt_conn *conn;
+	struct net_buf *nb;
+	uint16_t expected;
+} smp_bt_reassembly;
+#endif
+
 /* SMP service.
  * {8D53DC1D-1DB7-4CD3-868B-8A527460AA84}
  */
@@ -54,13 +76,66 @@ static ssize_t smp_bt_chr_write(struct bt_conn *conn,
 	struct smp_bt_user_data *ud;
 	struct net_buf *nb;
 
+#if defined(CONFIG_MCUMGR_SMP_BT_REASSEMBLY)
+	if (smp_bt_reassembly.nb != NULL && smp_bt_reassembly.conn != conn) {
+		smp_bt_ud_free(net_buf_user_data(smp_bt_reassembly.nb));
+		mcumgr_buf_free(smp_bt_reassembly.nb);
+		smp_bt_reassembly.nb = NULL;
+	}
+
+	if (smp_bt_reassembly.nb == NULL) {
+		/* Start of a request; the header carries the total length. */
+		if (len < SMP_HDR_SIZE) {
+			return BT_GATT_ERR(BT_ATT_ERR_INVALID_ATTRIBUTE_LEN);
+		}
+
+		nb = mcumgr_buf_alloc();
+		if (nb == NULL) {
+			return BT_GATT_ERR(BT_ATT_ERR_INSUFFICIENT_RESOURCES);
+		}
+
+		smp_bt_reassembly.expected = SMP_HDR_SIZE +
+			sys_get_be16((const uint8_t *)buf + SMP_HDR_LEN_OFF);
+		if (smp_bt_reassembly.expected > net_buf_tailroom(nb)) {
+			mcumgr_buf_free(nb);
+			return BT_GATT_ERR(BT_ATT_ERR_INSUFFICIENT_RESOURCES);
+		}
+
+		ud = net_buf_user_data(nb);
+		ud->conn = bt_conn_ref(conn);
+
+		smp_bt_reassembly.conn = conn;
+		smp_bt_reassembly.nb = nb;
+	} else {
+		nb = smp_bt_reassembly.nb;
+	}
+
+	if (nb->len + len > smp_bt_reassembly.expected) {
+		/* Fragment does not agree with the header; drop the packet. */
+		smp_bt_ud_free(net_buf_user_data(nb));
+		mcumgr_buf_free(nb);
+		smp_bt_reassembly.nb = NULL;
+		return BT_GATT_ERR(BT_ATT_ERR_INVALID_ATTRIBUTE_LEN);
+	}
+
+	net_buf_add_mem(nb, buf, len);
+
+	if (nb->len == smp_bt_reassembly.expected) {
+		smp_bt_reassembly.nb = NULL;
+		zephyr_smp_rx_req(&smp_bt_transport, nb);
+	}
+#else
 	nb = mcumgr_buf_alloc();
+	if (nb == NULL) {
+		return BT_GATT_ERR(BT_ATT_ERR_INSUFFICIENT_RESOURCES);
+	}
 	net_buf_add_mem(nb, buf, len);
 
 	ud = net_buf_user_data(nb);
 	ud->conn = bt_conn_ref(conn);
 
 	zephyr_smp_rx_req(&smp_bt_transport, nb);
+#endif
 
 	return len;
 }
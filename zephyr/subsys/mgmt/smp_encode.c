@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <errno.h>
+#include <net/buf.h>
+#include <sys/byteorder.h>
+#include <mgmt/smp_encode.h>
+
+/* CBOR major types, shifted into the head byte */
+#define MAJOR_UINT	(0 << 5)
+#define MAJOR_NEGINT	(1 << 5)
+#define MAJOR_BYTES	(2 << 5)
+#define MAJOR_TEXT	(3 << 5)
+#define MAJOR_ARRAY	(4 << 5)
+#define MAJOR_MAP	(5 << 5)
+
+#define SIMPLE_FALSE	0xf4
+#define SIMPLE_TRUE	0xf5
+#define INDEF_MAP	0xbf
+#define INDEF_BREAK	0xff
+
+/* Worst case head: one type byte plus a 64-bit argument */
+#define HEAD_MAX	9
+
+static inline bool enc_room(struct smp_enc *enc, size_t len)
+{
+	if (enc->oom || (enc->size - enc->len) < len) {
+		enc->oom = true;
+		return false;
+	}
+
+	return true;
+}
+
+static void enc_head(struct smp_enc *enc, uint8_t major, uint64_t arg)
+{
+	uint8_t *p;
+
+	if (!enc_room(enc, HEAD_MAX)) {
+		return;
+	}
+
+	p = &enc->buf[enc->len];
+
+	/* canonical (shortest form) argument encoding */
+	if (arg < 24ULL) {
+		p[0] = major | (uint8_t)arg;
+		enc->len += 1;
+	} else if (arg <= UINT8_MAX) {
+		p[0] = major | 24U;
+		p[1] = (uint8_t)arg;
+		enc->len += 2;
+	} else if (arg <= UINT16_MAX) {
+		p[0] = major | 25U;
+		sys_put_be16((uint16_t)arg, &p[1]);
+		enc->len += 3;
+	} else if (arg <= UINT32_MAX) {
+		p[0] = major | 26U;
+		sys_put_be32((uint32_t)arg, &p[1]);
+		enc->len += 5;
+	} else {
+		p[0] = major | 27U;
+		sys_put_be64(arg, &p[1]);
+		enc->len += 9;
+	}
+}
+
+static void enc_byte(struct smp_enc *enc, uint8_t byte)
+{
+	if (!enc_room(enc, 1)) {
+		return;
+	}
+
+	enc->buf[enc->len++] = byte;
+}
+
+void smp_enc_init(struct smp_enc *enc, struct net_buf *nb)
+{
+	enc->buf = net_buf_tail(nb);
+	enc->size = net_buf_tailroom(nb);
+	enc->len = 0;
+	enc->oom = false;
+}
+
+int smp_enc_commit(struct smp_enc *enc, struct net_buf *nb)
+{
+	if (enc->oom) {
+		return -ENOMEM;
+	}
+
+	net_buf_add(nb, enc->len);
+	return 0;
+}
+
+void smp_enc_map(struct smp_enc *enc, size_t pairs)
+{
+	enc_head(enc, MAJOR_MAP, pairs);
+}
+
+void smp_enc_map_indef(struct smp_enc *enc)
+{
+	enc_byte(enc, INDEF_MAP);
+}
+
+void smp_enc_array(struct smp_enc *enc, size_t items)
+{
+	enc_head(enc, MAJOR_ARRAY, items);
+}
+
+void smp_enc_end(struct smp_enc *enc)
+{
+	enc_byte(enc, INDEF_BREAK);
+}
+
+void smp_enc_uint(struct smp_enc *enc, uint64_t value)
+{
+	enc_head(enc, MAJOR_UINT, value);
+}
+
+void smp_enc_int(struct smp_enc *enc, int64_t value)
+{
+	if (value < 0) {
+		enc_head(enc, MAJOR_NEGINT, ~(uint64_t)value);
+	} else {
+		enc_head(enc, MAJOR_UINT, (uint64_t)value);
+	}
+}
+
+void smp_enc_bool(struct smp_enc *enc, bool value)
+{
+	enc_byte(enc, value ? SIMPLE_TRUE : SIMPLE_FALSE);
+}
+
+void smp_enc_text(struct smp_enc *enc, const char *str, size_t len)
+{
+	enc_head(enc, MAJOR_TEXT, len);
+
+	if (!enc_room(enc, len)) {
+		return;
+	}
+
+	memcpy(&enc->buf[enc->len], str, len);
+	enc->len += len;
+}
+
+void smp_enc_str(struct smp_enc *enc, const char *str)
+{
+	smp_enc_text(enc, str, strlen(str));
+}
+
+void smp_enc_bytes(struct smp_enc *enc, const void *data, size_t len)
+{
+	enc_head(enc, MAJOR_BYTES, len);
+
+	if (!enc_room(enc, len)) {
+		return;
+	}
+
+	memcpy(&enc->buf[enc->len], data, len);
+	enc->len += len;
+}
@@ -46,6 +46,12 @@ static inline uint8_t get_6co_cid(struct net_icmpv6_nd_opt_6co *opt)
 static struct net_6lo_context ctx_6co[CONFIG_NET_MAX_6LO_CONTEXTS];
 #endif
 
+#if defined(CONFIG_NET_6LO_FLOW_CACHE)
+static void flow_cache_flush(void);
+#else
+#define flow_cache_flush(...)
+#endif
+
 static const uint8_t udp_nhc_inline_size_table[] = {4, 3, 3, 1};
 
 static const uint8_t tf_inline_size_table[] = {4, 3, 1, 0};
@@ -164,6 +170,9 @@ static inline void set_6lo_context(struct net_if *iface, uint8_t index,
 	ctx_6co[index].is_used = true;
 	ctx_6co[index].iface = iface;
 
+	/* Cached compression decisions may depend on the old context. */
+	flow_cache_flush();
+
 	/*TODO: Start timer */
 	ctx_6co[index].lifetime = context->lifetime;
 	ctx_6co[index].compress = get_6co_compress(context);
@@ -192,6 +201,7 @@ void net_6lo_set_context(struct net_if *iface,
 			/* Remove if lifetime is zero */
 			if (!context->lifetime) {
 				ctx_6co[i].is_used = false;
+				flow_cache_flush();
 				return;
 			}
 
@@ -718,6 +728,159 @@ static struct net_6lo_context *get_dst_addr_ctx(struct net_pkt *pkt,
  * | 0 | 1 | 1 |  TF   |NH | HLIM  |CID|SAC|  SAM  | M |DAC|  DAM  |
  * +---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+
  */
+#if defined(CONFIG_NET_6LO_FLOW_CACHE)
+/* Everything the IPHC compression decisions depend on, except the
+ * payload length and the UDP checksum which are patched per packet.
+ */
+struct net_6lo_flow_key {
+	struct in6_addr src;
+	struct in6_addr dst;
+	uint8_t vtc_flow[4];
+	uint16_t udp_src_port;
+	uint16_t udp_dst_port;
+	uint8_t nexthdr;
+	uint8_t hop_limit;
+	uint8_t ll_src[8];
+	uint8_t ll_dst[8];
+	uint8_t ll_src_len;
+	uint8_t ll_dst_len;
+};
+
+struct net_6lo_flow {
+	bool used;
+	struct net_6lo_flow_key key;
+	int64_t last_used;
+	/* Precomputed compressed header */
+	uint8_t hdr[NET_IPV6UDPH_LEN];
+	uint8_t hdr_len;
+	uint8_t uncomp_len;
+};
+
+static struct net_6lo_flow flow_cache[CONFIG_NET_6LO_FLOW_CACHE_ENTRIES];
+
+static void flow_cache_flush(void)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(flow_cache); i++) {
+		flow_cache[i].used = false;
+	}
+}
+
+static bool flow_cache_key(struct net_pkt *pkt, struct net_ipv6_hdr *ipv6,
+			   struct net_6lo_flow_key *key)
+{
+	struct net_linkaddr *ll_src = net_pkt_lladdr_src(pkt);
+	struct net_linkaddr *ll_dst = net_pkt_lladdr_dst(pkt);
+
+	if (ll_src->len > sizeof(key->ll_src) ||
+	    ll_dst->len > sizeof(key->ll_dst)) {
+		return false;
+	}
+
+	/* The key is compared with memcmp(), clear the padding too. */
+	(void)memset(key, 0, sizeof(*key));
+
+	net_ipaddr_copy(&key->src, &ipv6->src);
+	net_ipaddr_copy(&key->dst, &ipv6->dst);
+	memcpy(key->vtc_flow, &ipv6->vtc, sizeof(key->vtc_flow));
+	key->nexthdr = ipv6->nexthdr;
+	key->hop_limit = ipv6->hop_limit;
+
+	if (ipv6->nexthdr == IPPROTO_UDP) {
+		struct net_udp_hdr *udp = (struct net_udp_hdr *)
+			(pkt->buffer->data + NET_IPV6H_LEN);
+
+		key->udp_src_port = udp->src_port;
+		key->udp_dst_port = udp->dst_port;
+	}
+
+	if (ll_src->addr) {
+		memcpy(key->ll_src, ll_src->addr, ll_src->len);
+		key->ll_src_len = ll_src->len;
+	}
+
+	if (ll_dst->addr) {
+		memcpy(key->ll_dst, ll_dst->addr, ll_dst->len);
+		key->ll_dst_len = ll_dst->len;
+	}
+
+	return true;
+}
+
+static struct net_6lo_flow *flow_cache_lookup(const struct net_6lo_flow_key *key)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(flow_cache); i++) {
+		if (flow_cache[i].used &&
+		    memcmp(&flow_cache[i].key, key, sizeof(*key)) == 0) {
+			return &flow_cache[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Apply a cached header template: replace the uncompressed headers with
+ * the precomputed compressed form, then patch in the current UDP
+ * checksum which is carried inline at the end of the template.
+ */
+static int flow_cache_apply(struct net_pkt *pkt, struct net_6lo_flow *flow)
+{
+	uint8_t compressed = flow->uncomp_len - flow->hdr_len;
+	uint16_t chksum = 0U;
+	bool udp = NET_IPV6_HDR(pkt)->nexthdr == IPPROTO_UDP;
+
+	if (udp) {
+		struct net_udp_hdr *hdr = (struct net_udp_hdr *)
+			(pkt->buffer->data + NET_IPV6H_LEN);
+
+		chksum = hdr->chksum;
+	}
+
+	memcpy(pkt->buffer->data + compressed, flow->hdr, flow->hdr_len);
+
+	if (udp) {
+		memcpy(pkt->buffer->data + flow->uncomp_len - sizeof(chksum),
+		       &chksum, sizeof(chksum));
+	}
+
+	net_buf_pull(pkt->buffer, compressed);
+
+	flow->last_used = k_uptime_get();
+
+	return compressed;
+}
+
+static void flow_cache_store(const struct net_6lo_flow_key *key,
+			     struct net_pkt *pkt, uint8_t hdr_len,
+			     uint8_t uncomp_len)
+{
+	struct net_6lo_flow *flow = NULL;
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(flow_cache); i++) {
+		if (!flow_cache[i].used) {
+			flow = &flow_cache[i];
+			break;
+		}
+
+		if (flow == NULL ||
+		    flow_cache[i].last_used < flow->last_used) {
+			flow = &flow_cache[i];
+		}
+	}
+
+	memcpy(&flow->key, key, sizeof(*key));
+	memcpy(flow->hdr, pkt->buffer->data, hdr_len);
+	flow->hdr_len = hdr_len;
+	flow->uncomp_len = uncomp_len;
+	flow->last_used = k_uptime_get();
+	flow->used = true;
+}
+#endif /* CONFIG_NET_6LO_FLOW_CACHE */
+
 static inline int compress_IPHC_header(struct net_pkt *pkt)
 {
 #if defined(CONFIG_NET_6LO_CONTEXT)
@@ -729,6 +892,12 @@ static inline int compress_IPHC_header(struct net_pkt *pkt)
 	struct net_ipv6_hdr *ipv6 = NET_IPV6_HDR(pkt);
 	struct net_udp_hdr *udp;
 	uint8_t *inline_pos;
+#if defined(CONFIG_NET_6LO_FLOW_CACHE)
+	struct net_6lo_flow_key flow_key;
+	struct net_6lo_flow *flow;
+	bool flow_key_ok;
+	uint8_t uncomp_len;
+#endif
 
 	if (pkt->frags->len < NET_IPV6H_LEN) {
 		NET_ERR("Invalid length %d, min %d",
@@ -743,6 +912,19 @@ static inline int compress_IPHC_header(struct net_pkt *pkt)
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_NET_6LO_FLOW_CACHE)
+	uncomp_len = NET_IPV6H_LEN +
+		(ipv6->nexthdr == IPPROTO_UDP ? NET_UDPH_LEN : 0);
+
+	flow_key_ok = flow_cache_key(pkt, ipv6, &flow_key);
+	if (flow_key_ok) {
+		flow = flow_cache_lookup(&flow_key);
+		if (flow && flow->uncomp_len == uncomp_len) {
+			return flow_cache_apply(pkt, flow);
+		}
+	}
+#endif
+
 	inline_pos = pkt->buffer->data + NET_IPV6H_LEN;
 
 	if (ipv6->nexthdr == IPPROTO_UDP) {
@@ -827,6 +1009,14 @@ sa_end:
 
 	net_buf_pull(pkt->buffer, compressed);
 
+#if defined(CONFIG_NET_6LO_FLOW_CACHE)
+	if (flow_key_ok && compressed > 0 &&
+	    uncomp_len - compressed <= sizeof(flow->hdr)) {
+		flow_cache_store(&flow_key, pkt, uncomp_len - compressed,
+				 uncomp_len);
+	}
+#endif
+
 	return compressed;
 }
 
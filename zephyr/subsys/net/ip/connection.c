@@ -141,6 +141,146 @@ static void conn_set_unused(struct net_conn *conn)
 	sys_slist_prepend(&conn_unused, &conn->node);
 }
 
+#if defined(CONFIG_NET_CONN_HASH)
+/* Fully specified connections are additionally chained into a hash
+ * table keyed by the packet 4-tuple, so that the common established
+ * connection case is found without walking conn_used. Wildcard
+ * (listening) connections are never hashed and still rely on the
+ * list walk in net_conn_input().
+ */
+static sys_slist_t conn_hash[CONFIG_NET_CONN_HASH_BUCKETS];
+
+static bool conn_is_hashable(struct net_conn *conn)
+{
+	uint8_t spec = NET_CONN_REMOTE_ADDR_SPEC | NET_CONN_LOCAL_ADDR_SPEC |
+		       NET_CONN_REMOTE_PORT_SPEC | NET_CONN_LOCAL_PORT_SPEC;
+
+	if (conn->proto != IPPROTO_UDP && conn->proto != IPPROTO_TCP) {
+		return false;
+	}
+
+	if (conn->family != AF_INET && conn->family != AF_INET6) {
+		return false;
+	}
+
+	return (conn->flags & spec) == spec;
+}
+
+static const uint8_t *conn_addr_bytes(const struct sockaddr *addr)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV6) && addr->sa_family == AF_INET6) {
+		return (const uint8_t *)&net_sin6(addr)->sin6_addr;
+	}
+
+	return (const uint8_t *)&net_sin(addr)->sin_addr;
+}
+
+static uint32_t conn_tuple_hash(uint8_t family, uint16_t proto,
+				const uint8_t *remote, const uint8_t *local,
+				size_t addr_len,
+				uint16_t remote_port, uint16_t local_port)
+{
+	uint32_t hash = ((uint32_t)family << 16) | proto;
+	size_t i;
+
+	/* Multiplicative (Fibonacci) mixing, good enough to spread the
+	 * tuples over the buckets. Ports are kept in network byte order
+	 * on both the connection and the packet side, so no conversion
+	 * is needed here.
+	 */
+	for (i = 0; i < addr_len; i++) {
+		hash = (hash ^ remote[i]) * 0x9e3779b9U;
+		hash = (hash ^ local[i]) * 0x9e3779b9U;
+	}
+
+	hash = (hash ^ (((uint32_t)remote_port << 16) | local_port)) *
+	       0x9e3779b9U;
+
+	return hash % CONFIG_NET_CONN_HASH_BUCKETS;
+}
+
+static uint32_t conn_hash_bucket(struct net_conn *conn)
+{
+	return conn_tuple_hash(conn->family, conn->proto,
+			       conn_addr_bytes(&conn->remote_addr),
+			       conn_addr_bytes(&conn->local_addr),
+			       conn->family == AF_INET6 ?
+					sizeof(struct in6_addr) :
+					sizeof(struct in_addr),
+			       net_sin(&conn->remote_addr)->sin_port,
+			       net_sin(&conn->local_addr)->sin_port);
+}
+
+static void conn_hash_insert(struct net_conn *conn)
+{
+	if (conn_is_hashable(conn)) {
+		sys_slist_prepend(&conn_hash[conn_hash_bucket(conn)],
+				  &conn->hash_node);
+	}
+}
+
+static void conn_hash_remove(struct net_conn *conn)
+{
+	if (conn_is_hashable(conn)) {
+		sys_slist_find_and_remove(&conn_hash[conn_hash_bucket(conn)],
+					  &conn->hash_node);
+	}
+}
+
+static struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+					 union net_ip_header *ip_hdr,
+					 uint16_t proto,
+					 uint16_t src_port, uint16_t dst_port)
+{
+	const uint8_t *remote, *local;
+	struct net_conn *conn;
+	size_t addr_len;
+	uint32_t hash;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		remote = (const uint8_t *)&ip_hdr->ipv6->src;
+		local = (const uint8_t *)&ip_hdr->ipv6->dst;
+		addr_len = sizeof(struct in6_addr);
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
+		   net_pkt_family(pkt) == AF_INET) {
+		remote = (const uint8_t *)&ip_hdr->ipv4->src;
+		local = (const uint8_t *)&ip_hdr->ipv4->dst;
+		addr_len = sizeof(struct in_addr);
+	} else {
+		return NULL;
+	}
+
+	hash = conn_tuple_hash(net_pkt_family(pkt), proto, remote, local,
+			       addr_len, src_port, dst_port);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&conn_hash[hash], conn, hash_node) {
+		if (conn->proto != proto ||
+		    conn->family != net_pkt_family(pkt)) {
+			continue;
+		}
+
+		if (net_sin(&conn->remote_addr)->sin_port != src_port ||
+		    net_sin(&conn->local_addr)->sin_port != dst_port) {
+			continue;
+		}
+
+		if (memcmp(conn_addr_bytes(&conn->remote_addr), remote,
+			   addr_len) != 0 ||
+		    memcmp(conn_addr_bytes(&conn->local_addr), local,
+			   addr_len) != 0) {
+			continue;
+		}
+
+		return conn;
+	}
+
+	return NULL;
+}
+#else
+#define conn_hash_insert(...)
+#define conn_hash_remove(...)
+#endif /* CONFIG_NET_CONN_HASH */
+
 /* Check if we already have identical connection handler installed. */
 static struct net_conn *conn_find_handler(uint16_t proto, uint8_t family,
 					  const struct sockaddr *remote_addr,
@@ -354,6 +494,8 @@ int net_conn_register(uint16_t proto, uint8_t family,
 
 	conn_set_used(conn);
 
+	conn_hash_insert(conn);
+
 	conn_register_debug(conn, remote_port, local_port);
 
 	return 0;
@@ -376,6 +518,8 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	NET_DBG("Connection handler %p removed", conn);
 
+	conn_hash_remove(conn);
+
 	sys_slist_find_and_remove(&conn_used, &conn->node);
 
 	conn_set_unused(conn);
@@ -568,6 +712,23 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		}
 	}
 
+#if defined(CONFIG_NET_CONN_HASH)
+	/* A fully specified connection matching the packet 4-tuple has
+	 * the highest possible rank, and an established connection always
+	 * overrides listeners, so a hash hit ends the search. Multicast
+	 * packets may have several recipients and are always matched from
+	 * the list.
+	 */
+	if (!is_mcast_pkt && (net_pkt_family(pkt) == AF_INET ||
+			      net_pkt_family(pkt) == AF_INET6)) {
+		best_match = conn_hash_lookup(pkt, ip_hdr, proto,
+					      src_port, dst_port);
+		if (best_match != NULL) {
+			goto deliver;
+		}
+	}
+#endif
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
 		if (conn->proto != proto) {
 			continue;
@@ -694,6 +855,9 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		return NET_OK;
 	}
 
+#if defined(CONFIG_NET_CONN_HASH)
+deliver:
+#endif
 	conn = best_match;
 	if (conn) {
 		NET_DBG("[%p] match found cb %p ud %p rank 0x%02x",
@@ -756,4 +920,10 @@ void net_conn_init(void)
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
 	}
+
+#if defined(CONFIG_NET_CONN_HASH)
+	for (i = 0; i < CONFIG_NET_CONN_HASH_BUCKETS; i++) {
+		sys_slist_init(&conn_hash[i]);
+	}
+#endif
 }
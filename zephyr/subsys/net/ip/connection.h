@@ -50,6 +50,13 @@ struct net_conn {
 	/** Internal slist node */
 	sys_snode_t node;
 
+#if defined(CONFIG_NET_CONN_HASH)
+	/** Node in the 4-tuple hash table, used when the connection is
+	 * fully specified.
+	 */
+	sys_snode_t hash_node;
+#endif
+
 	/** Remote IP address */
 	struct sockaddr remote_addr;
 
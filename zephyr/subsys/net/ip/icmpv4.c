@@ -65,7 +65,9 @@ int net_icmpv4_finalize(struct net_pkt *pkt)
 		return -ENOBUFS;
 	}
 
-	icmp_hdr->chksum = net_calc_chksum_icmpv4(pkt);
+	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt))) {
+		icmp_hdr->chksum = net_calc_chksum_icmpv4(pkt);
+	}
 
 	return net_pkt_set_data(pkt, &icmpv4_access);
 }
@@ -674,7 +676,8 @@ enum net_verdict net_icmpv4_input(struct net_pkt *pkt,
 		return NET_DROP;
 	}
 
-	if (net_calc_chksum_icmpv4(pkt) != 0U) {
+	if (net_if_need_calc_rx_checksum(net_pkt_iface(pkt)) &&
+	    net_calc_chksum_icmpv4(pkt) != 0U) {
 		NET_DBG("DROP: Invalid checksum");
 		goto drop;
 	}
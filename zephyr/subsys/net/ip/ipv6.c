@@ -165,6 +165,20 @@ static inline bool ipv6_drop_on_unknown_option(struct net_pkt *pkt,
 	return true;
 }
 
+/* Number of bytes that can be parsed at the cursor position without
+ * crossing into the next buffer fragment.
+ */
+static size_t ipv6_linear_len(struct net_pkt *pkt)
+{
+	struct net_pkt_cursor *cursor = &pkt->cursor;
+
+	if (!cursor->buf) {
+		return 0;
+	}
+
+	return cursor->buf->len - (cursor->pos - cursor->buf->data);
+}
+
 static inline int ipv6_handle_ext_hdr_options(struct net_pkt *pkt,
 					      struct net_ipv6_hdr *hdr,
 					      uint16_t pkt_len)
@@ -186,35 +200,83 @@ static inline int ipv6_handle_ext_hdr_options(struct net_pkt *pkt,
 	length += 2U;
 
 	while (length < exthdr_len) {
+		uint8_t *opt = net_pkt_cursor_get_pos(pkt);
+		size_t linear = ipv6_linear_len(pkt);
+		size_t parsed = 0U;
 		uint8_t opt_type, opt_len;
 
-		/* Each extension option has type and length */
-		if (net_pkt_read_u8(pkt, &opt_type)) {
+		/* Scan options directly from the linear view of the
+		 * current buffer, falling back to cursor reads below
+		 * only when an option straddles two buffer fragments.
+		 */
+		while (length < exthdr_len && parsed < linear) {
+			opt_type = opt[parsed];
+
+			if (opt_type == NET_IPV6_EXT_HDR_OPT_PAD1) {
+				parsed++;
+				length++;
+				continue;
+			}
+
+			if (parsed + 2U > linear) {
+				break;
+			}
+
+			opt_len = opt[parsed + 1U];
+
+			if (opt_type != NET_IPV6_EXT_HDR_OPT_PADN) {
+				/* Make sure that the option length is
+				 * not too large. The former 1 + 1 is the
+				 * length of extension type + length
+				 * fields. The latter 1 + 1 is the length
+				 * of the sub-option type and length
+				 * fields.
+				 */
+				if (opt_len > (exthdr_len -
+					       (1 + 1 + 1 + 1))) {
+					return -EINVAL;
+				}
+
+				if (ipv6_drop_on_unknown_option(pkt, hdr,
+								opt_type,
+								length)) {
+					return -ENOTSUP;
+				}
+			}
+
+			if (parsed + 2U + opt_len > linear) {
+				break;
+			}
+
+			parsed += 2U + opt_len;
+			length += 2U + opt_len;
+		}
+
+		if (parsed > 0 && net_pkt_skip(pkt, parsed)) {
 			return -ENOBUFS;
 		}
 
-		if (opt_type != NET_IPV6_EXT_HDR_OPT_PAD1) {
-			if (net_pkt_read_u8(pkt, &opt_len)) {
-				return -ENOBUFS;
-			}
+		if (length >= exthdr_len) {
+			break;
+		}
+
+		/* This option straddles buffer fragments, parse it with
+		 * the cursor read primitives.
+		 */
+		if (net_pkt_read_u8(pkt, &opt_type)) {
+			return -ENOBUFS;
 		}
 
-		switch (opt_type) {
-		case NET_IPV6_EXT_HDR_OPT_PAD1:
+		if (opt_type == NET_IPV6_EXT_HDR_OPT_PAD1) {
 			length++;
-			break;
-		case NET_IPV6_EXT_HDR_OPT_PADN:
-			NET_DBG("PADN option");
-			length += opt_len + 2;
+			continue;
+		}
 
-			break;
-		default:
-			/* Make sure that the option length is not too large.
-			 * The former 1 + 1 is the length of extension type +
-			 * length fields.
-			 * The latter 1 + 1 is the length of the sub-option
-			 * type and length fields.
-			 */
+		if (net_pkt_read_u8(pkt, &opt_len)) {
+			return -ENOBUFS;
+		}
+
+		if (opt_type != NET_IPV6_EXT_HDR_OPT_PADN) {
 			if (opt_len > (exthdr_len - (1 + 1 + 1 + 1))) {
 				return -EINVAL;
 			}
@@ -223,15 +285,13 @@ static inline int ipv6_handle_ext_hdr_options(struct net_pkt *pkt,
 							opt_type, length)) {
 				return -ENOTSUP;
 			}
+		}
 
-			if (net_pkt_skip(pkt, opt_len)) {
-				return -ENOBUFS;
-			}
-
-			length += opt_len + 2;
-
-			break;
+		if (net_pkt_skip(pkt, opt_len)) {
+			return -ENOBUFS;
 		}
+
+		length += opt_len + 2;
 	}
 
 	return exthdr_len;
@@ -122,6 +122,71 @@ static inline struct net_nbr *get_nbr(int idx)
 	return &net_neighbor_pool[idx].nbr;
 }
 
+#if defined(CONFIG_NET_IPV6_NBR_CACHE_HASH)
+/* Hash index over the neighbor pool: bucket heads and per-slot chain
+ * links hold pool indexes, -1 terminates a chain. Entries are added in
+ * nbr_init() and removed when the table entry is released.
+ */
+static int16_t nbr_hash_head[CONFIG_NET_IPV6_NBR_HASH_BUCKETS];
+static int16_t nbr_hash_next[CONFIG_NET_IPV6_MAX_NEIGHBORS];
+
+static int nbr_slot(struct net_nbr *nbr)
+{
+	return ((uint8_t *)nbr - (uint8_t *)&net_neighbor_pool[0].nbr) /
+		sizeof(net_neighbor_pool[0]);
+}
+
+static uint32_t nbr_addr_hash(const struct in6_addr *addr)
+{
+	uint32_t hash = 0U;
+	int i;
+
+	for (i = 0; i < sizeof(addr->s6_addr); i++) {
+		hash = (hash ^ addr->s6_addr[i]) * 0x9e3779b9U;
+	}
+
+	return hash % CONFIG_NET_IPV6_NBR_HASH_BUCKETS;
+}
+
+static void nbr_hash_insert(struct net_nbr *nbr)
+{
+	uint32_t bucket = nbr_addr_hash(&net_ipv6_nbr_data(nbr)->addr);
+	int slot = nbr_slot(nbr);
+
+	nbr_hash_next[slot] = nbr_hash_head[bucket];
+	nbr_hash_head[bucket] = slot;
+}
+
+static void nbr_hash_remove(struct net_nbr *nbr)
+{
+	uint32_t bucket = nbr_addr_hash(&net_ipv6_nbr_data(nbr)->addr);
+	int slot = nbr_slot(nbr);
+	int16_t *link = &nbr_hash_head[bucket];
+
+	while (*link >= 0) {
+		if (*link == slot) {
+			*link = nbr_hash_next[slot];
+			return;
+		}
+
+		link = &nbr_hash_next[*link];
+	}
+}
+
+static void nbr_hash_clear(void)
+{
+	int i;
+
+	for (i = 0; i < CONFIG_NET_IPV6_NBR_HASH_BUCKETS; i++) {
+		nbr_hash_head[i] = -1;
+	}
+}
+#else
+#define nbr_hash_insert(...)
+#define nbr_hash_remove(...)
+#define nbr_hash_clear(...)
+#endif /* CONFIG_NET_IPV6_NBR_CACHE_HASH */
+
 static inline struct net_nbr *get_nbr_from_data(struct net_ipv6_nbr_data *data)
 {
 	int i;
@@ -261,6 +326,24 @@ static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 {
 	int i;
 
+#if defined(CONFIG_NET_IPV6_NBR_CACHE_HASH)
+	for (i = nbr_hash_head[nbr_addr_hash(addr)]; i >= 0;
+	     i = nbr_hash_next[i]) {
+		struct net_nbr *nbr = get_nbr(i);
+
+		if (!nbr->ref) {
+			continue;
+		}
+
+		if (iface && nbr->iface != iface) {
+			continue;
+		}
+
+		if (net_ipv6_addr_cmp(&net_ipv6_nbr_data(nbr)->addr, addr)) {
+			return nbr;
+		}
+	}
+#else
 	for (i = 0; i < CONFIG_NET_IPV6_MAX_NEIGHBORS; i++) {
 		struct net_nbr *nbr = get_nbr(i);
 
@@ -276,6 +359,7 @@ static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 			return nbr;
 		}
 	}
+#endif
 
 	return NULL;
 }
@@ -408,6 +492,7 @@ static void nbr_init(struct net_nbr *nbr, struct net_if *iface,
 	nbr->iface = iface;
 
 	net_ipaddr_copy(&net_ipv6_nbr_data(nbr)->addr, addr);
+	nbr_hash_insert(nbr);
 	ipv6_nbr_set_state(nbr, state);
 	net_ipv6_nbr_data(nbr)->is_router = is_router;
 	net_ipv6_nbr_data(nbr)->pending = NULL;
@@ -653,12 +738,16 @@ void net_neighbor_data_remove(struct net_nbr *nbr)
 {
 	NET_DBG("Neighbor %p removed", nbr);
 
+	nbr_hash_remove(nbr);
+
 	return;
 }
 
 void net_neighbor_table_clear(struct net_nbr_table *table)
 {
 	NET_DBG("Neighbor table %p cleared", table);
+
+	nbr_hash_clear();
 }
 
 struct in6_addr *net_ipv6_nbr_lookup_by_index(struct net_if *iface,
@@ -2499,6 +2588,7 @@ void net_ipv6_nbr_init(void)
 	net_icmpv6_register_handler(&ns_input_handler);
 	net_icmpv6_register_handler(&na_input_handler);
 	k_delayed_work_init(&ipv6_ns_reply_timer, ipv6_ns_reply_timeout);
+	nbr_hash_clear();
 #endif
 #if defined(CONFIG_NET_IPV6_ND)
 	net_icmpv6_register_handler(&ra_input_handler);
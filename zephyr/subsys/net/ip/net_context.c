@@ -27,7 +27,12 @@ LOG_MODULE_REGISTER(net_ctx, CONFIG_NET_CONTEXT_LOG_LEVEL);
 #include <net/ethernet.h>
 #include <net/socket_can.h>
 
+#if defined(CONFIG_NET_CONTEXT_UDP_HDR_TEMPLATE)
+#include <net/net_mgmt.h>
+#endif
+
 #include "connection.h"
+#include "packet_filter.h"
 #include "net_private.h"
 
 #include "ipv6.h"
@@ -349,6 +354,10 @@ int net_context_unref(struct net_context *context)
 		context->conn_handler = NULL;
 	}
 
+	if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET_FILTER)) {
+		net_packet_filter_detach(context);
+	}
+
 	net_context_set_state(context, NET_CONTEXT_UNCONNECTED);
 
 	context->flags &= ~NET_CONTEXT_IN_USE;
@@ -1030,6 +1039,9 @@ int net_context_connect(struct net_context *context,
 
 	if (IS_ENABLED(CONFIG_NET_UDP) &&
 	    net_context_get_type(context) == SOCK_DGRAM) {
+#if defined(CONFIG_NET_CONTEXT_UDP_HDR_TEMPLATE)
+		udp_tmpl_build(context);
+#endif
 		if (cb) {
 			cb(context, 0, user_data);
 		}
@@ -1210,6 +1222,111 @@ static int context_write_data(struct net_pkt *pkt, const void *buf,
 	return ret;
 }
 
+#if defined(CONFIG_NET_CONTEXT_UDP_HDR_TEMPLATE)
+/* Precompute the IPv4 + UDP header for a connected context so that the
+ * send path can copy it verbatim instead of resolving the source address
+ * and rebuilding the headers for every packet. The length and checksum
+ * fields are left zeroed, net_ipv4_finalize() patches them as usual.
+ */
+static void udp_tmpl_build(struct net_context *context)
+{
+	struct net_ipv4_hdr *ipv4_hdr;
+	struct net_udp_hdr *udp_hdr;
+	struct sockaddr_in *remote = net_sin(&context->remote);
+	const struct in_addr *src = NULL;
+	struct net_if *iface;
+	uint8_t ttl;
+
+	context->udp_tmpl.valid = false;
+
+	if (net_context_get_family(context) != AF_INET ||
+	    net_context_get_type(context) != SOCK_DGRAM ||
+	    !(context->flags & NET_CONTEXT_REMOTE_ADDR_SET)) {
+		return;
+	}
+
+	iface = net_context_get_iface(context);
+	if (!iface) {
+		iface = net_if_get_default();
+		if (!iface) {
+			return;
+		}
+	}
+
+	if (net_sin_ptr(&context->local)->sin_addr) {
+		src = net_sin_ptr(&context->local)->sin_addr;
+	}
+
+	if (!src || net_ipv4_is_addr_unspecified(src) ||
+	    net_ipv4_is_addr_mcast(src)) {
+		src = net_if_ipv4_select_src_addr(iface, &remote->sin_addr);
+		if (net_ipv4_is_addr_unspecified(src)) {
+			return;
+		}
+	}
+
+	ttl = net_context_get_ipv4_ttl(context);
+	if (ttl == 0U) {
+		ttl = net_if_ipv4_get_ttl(iface);
+	}
+
+	(void)memset(context->udp_tmpl.hdr, 0, sizeof(context->udp_tmpl.hdr));
+
+	ipv4_hdr = (struct net_ipv4_hdr *)context->udp_tmpl.hdr;
+	ipv4_hdr->vhl = 0x45;
+	ipv4_hdr->ttl = ttl;
+	net_ipaddr_copy(&ipv4_hdr->src, src);
+	net_ipaddr_copy(&ipv4_hdr->dst, &remote->sin_addr);
+
+	udp_hdr = (struct net_udp_hdr *)&context->udp_tmpl.hdr[NET_IPV4H_LEN];
+	udp_hdr->src_port =
+		net_sin((struct sockaddr *)&context->local)->sin_port;
+	udp_hdr->dst_port = remote->sin_port;
+
+	context->udp_tmpl.valid = true;
+}
+
+static bool udp_tmpl_usable(struct net_context *context,
+			    const struct sockaddr *dst_addr)
+{
+	const struct sockaddr_in *addr4 =
+		(const struct sockaddr_in *)dst_addr;
+	struct sockaddr_in *remote = net_sin(&context->remote);
+
+	return context->udp_tmpl.valid &&
+		addr4->sin_addr.s_addr == remote->sin_addr.s_addr &&
+		addr4->sin_port == remote->sin_port;
+}
+
+#if defined(CONFIG_NET_MGMT_EVENT)
+static struct net_mgmt_event_callback udp_tmpl_mgmt_cb;
+
+static void udp_tmpl_refresh(struct net_context *context, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	udp_tmpl_build(context);
+}
+
+static void udp_tmpl_event_handler(struct net_mgmt_event_callback *cb,
+				   uint32_t mgmt_event, struct net_if *iface)
+{
+	ARG_UNUSED(cb);
+	ARG_UNUSED(iface);
+
+	if (mgmt_event != NET_EVENT_IPV4_ADDR_ADD &&
+	    mgmt_event != NET_EVENT_IPV4_ADDR_DEL) {
+		return;
+	}
+
+	/* An address change can invalidate the cached source address,
+	 * so rebuild the template of every connected UDP context.
+	 */
+	net_context_foreach(udp_tmpl_refresh, NULL);
+}
+#endif /* CONFIG_NET_MGMT_EVENT */
+#endif /* CONFIG_NET_CONTEXT_UDP_HDR_TEMPLATE */
+
 static int context_setup_udp_packet(struct net_context *context,
 				    struct net_pkt *pkt,
 				    const void *buf,
@@ -1221,6 +1338,22 @@ static int context_setup_udp_packet(struct net_context *context,
 	int ret = -EINVAL;
 	uint16_t dst_port = 0U;
 
+#if defined(CONFIG_NET_CONTEXT_UDP_HDR_TEMPLATE)
+	if (IS_ENABLED(CONFIG_NET_IPV4) &&
+	    net_context_get_family(context) == AF_INET &&
+	    udp_tmpl_usable(context, dst_addr)) {
+		ret = net_pkt_write(pkt, context->udp_tmpl.hdr,
+				    NET_IPV4UDPH_LEN);
+		if (ret < 0) {
+			return ret;
+		}
+
+		net_pkt_set_ip_hdr_len(pkt, sizeof(struct net_ipv4_hdr));
+
+		return context_write_data(pkt, buf, len, msg);
+	}
+#endif
+
 	if (IS_ENABLED(CONFIG_NET_IPV6) &&
 	    net_context_get_family(context) == AF_INET6) {
 		struct sockaddr_in6 *addr6 = (struct sockaddr_in6 *)dst_addr;
@@ -1853,6 +1986,15 @@ static enum net_verdict net_context_raw_packet_received(
 		return NET_DROP;
 	}
 
+	/* Reject uninteresting frames before they are queued to the
+	 * socket, so a filtering sniffer does not pay for packets it
+	 * would only discard.
+	 */
+	if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET_FILTER) &&
+	    !net_packet_filter_run(context, pkt)) {
+		return NET_DROP;
+	}
+
 	net_context_set_iface(context, net_pkt_iface(pkt));
 	net_pkt_set_context(pkt, context);
 
@@ -2085,6 +2227,73 @@ static int set_context_proxy(struct net_context *context,
 #endif
 }
 
+static int set_context_tcp_nodelay(struct net_context *context,
+				   const void *value, size_t len)
+{
+#if defined(CONFIG_NET_TCP2_AUTOCORK)
+	if (len > sizeof(bool)) {
+		return -EINVAL;
+	}
+
+	context->options.tcp_nodelay = *((bool *)value);
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+static int set_context_tcp_cork(struct net_context *context,
+				const void *value, size_t len)
+{
+#if defined(CONFIG_NET_TCP2_AUTOCORK)
+	if (len > sizeof(bool)) {
+		return -EINVAL;
+	}
+
+	context->options.tcp_cork = *((bool *)value);
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+static int set_context_tcp_cong(struct net_context *context,
+				const void *value, size_t len)
+{
+#if defined(CONFIG_NET_TCP2_CONG_CTRL)
+	int idx;
+
+	idx = net_tcp_cong_lookup(value, len);
+	if (idx < 0) {
+		return idx;
+	}
+
+	context->options.tcp_cong = (uint8_t)idx + 1U;
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+static int set_context_pacing_rate(struct net_context *context,
+				   const void *value, size_t len)
+{
+#if defined(CONFIG_NET_TCP2_CONG_CTRL)
+	if (len > sizeof(uint32_t)) {
+		return -EINVAL;
+	}
+
+	context->options.tcp_pacing_rate = *((uint32_t *)value);
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
 int net_context_set_option(struct net_context *context,
 			   enum net_context_option option,
 			   const void *value, size_t len)
@@ -2112,6 +2321,18 @@ int net_context_set_option(struct net_context *context,
 	case NET_OPT_SOCKS5:
 		ret = set_context_proxy(context, value, len);
 		break;
+	case NET_OPT_NODELAY:
+		ret = set_context_tcp_nodelay(context, value, len);
+		break;
+	case NET_OPT_CORK:
+		ret = set_context_tcp_cork(context, value, len);
+		break;
+	case NET_OPT_TCP_CONG:
+		ret = set_context_tcp_cong(context, value, len);
+		break;
+	case NET_OPT_PACING_RATE:
+		ret = set_context_pacing_rate(context, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&context->lock);
@@ -2119,6 +2340,74 @@ int net_context_set_option(struct net_context *context,
 	return ret;
 }
 
+static int get_context_tcp_nodelay(struct net_context *context,
+				   void *value, size_t *len)
+{
+#if defined(CONFIG_NET_TCP2_AUTOCORK)
+	*((bool *)value) = context->options.tcp_nodelay;
+
+	if (len) {
+		*len = sizeof(bool);
+	}
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+static int get_context_tcp_cork(struct net_context *context,
+				void *value, size_t *len)
+{
+#if defined(CONFIG_NET_TCP2_AUTOCORK)
+	*((bool *)value) = context->options.tcp_cork;
+
+	if (len) {
+		*len = sizeof(bool);
+	}
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+static int get_context_tcp_cong(struct net_context *context,
+				void *value, size_t *len)
+{
+#if defined(CONFIG_NET_TCP2_CONG_CTRL)
+	const char *name = net_tcp_cong_name(context->options.tcp_cong);
+	size_t name_len = strlen(name);
+
+	if (len == NULL || *len <= name_len) {
+		return -EINVAL;
+	}
+
+	memcpy(value, name, name_len + 1);
+	*len = name_len;
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+static int get_context_pacing_rate(struct net_context *context,
+				   void *value, size_t *len)
+{
+#if defined(CONFIG_NET_TCP2_CONG_CTRL)
+	*((uint32_t *)value) = context->options.tcp_pacing_rate;
+
+	if (len) {
+		*len = sizeof(uint32_t);
+	}
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
 int net_context_get_option(struct net_context *context,
 			    enum net_context_option option,
 			    void *value, size_t *len)
@@ -2146,6 +2435,18 @@ int net_context_get_option(struct net_context *context,
 	case NET_OPT_SOCKS5:
 		ret = get_context_proxy(context, value, len);
 		break;
+	case NET_OPT_NODELAY:
+		ret = get_context_tcp_nodelay(context, value, len);
+		break;
+	case NET_OPT_CORK:
+		ret = get_context_tcp_cork(context, value, len);
+		break;
+	case NET_OPT_TCP_CONG:
+		ret = get_context_tcp_cong(context, value, len);
+		break;
+	case NET_OPT_PACING_RATE:
+		ret = get_context_pacing_rate(context, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&context->lock);
@@ -2177,4 +2478,13 @@ void net_context_foreach(net_context_cb_t cb, void *user_data)
 void net_context_init(void)
 {
 	k_sem_init(&contexts_lock, 1, UINT_MAX);
+
+#if defined(CONFIG_NET_CONTEXT_UDP_HDR_TEMPLATE) && \
+	defined(CONFIG_NET_MGMT_EVENT)
+	net_mgmt_init_event_callback(&udp_tmpl_mgmt_cb,
+				     udp_tmpl_event_handler,
+				     NET_EVENT_IPV4_ADDR_ADD |
+				     NET_EVENT_IPV4_ADDR_DEL);
+	net_mgmt_add_event_callback(&udp_tmpl_mgmt_cb);
+#endif
 }
@@ -370,6 +370,18 @@ static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
 	NET_DBG("TC %d with prio %d pkt %p", tc, prio, pkt);
 #endif
 
+#if defined(CONFIG_NET_RX_DIRECT_DISPATCH)
+	/* If nothing is pending for this traffic class, run the stack
+	 * directly in this context and skip the RX thread wakeup.
+	 * Queued packets keep their ordering as we only bypass an empty
+	 * queue.
+	 */
+	if (!k_is_in_isr() && net_tc_rx_queue_is_empty(tc)) {
+		net_rx(iface, pkt);
+		return;
+	}
+#endif
+
 	net_tc_submit_to_rx_queue(tc, pkt);
 }
 
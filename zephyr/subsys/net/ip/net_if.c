@@ -3743,6 +3743,58 @@ void net_if_add_tx_timestamp(struct net_pkt *pkt)
 }
 #endif /* CONFIG_NET_PKT_TIMESTAMP_THREAD */
 
+#if defined(CONFIG_NET_IF_RX_POLL)
+K_THREAD_STACK_DEFINE(rx_poll_stack, CONFIG_NET_IF_RX_POLL_STACK_SIZE);
+K_FIFO_DEFINE(rx_poll_queue);
+
+static struct k_thread rx_poll_thread_data;
+
+static void net_rx_poll_thread(void)
+{
+	struct net_if_rx_poll *ctx;
+
+	NET_DBG("Starting RX poll thread");
+
+	while (1) {
+		ctx = k_fifo_get(&rx_poll_queue, K_FOREVER);
+
+		if (ctx->poll(ctx->iface, CONFIG_NET_IF_RX_POLL_BUDGET) >=
+		    CONFIG_NET_IF_RX_POLL_BUDGET) {
+			/* The ring may hold more frames; requeue behind
+			 * the other interfaces so one busy port cannot
+			 * starve the rest.
+			 */
+			k_fifo_put(&rx_poll_queue, ctx);
+			continue;
+		}
+
+		/* Drained; back to interrupt-driven RX. The interrupt is
+		 * still masked at this point so the driver cannot race
+		 * the flag update.
+		 */
+		atomic_clear(&ctx->scheduled);
+		ctx->rx_irq(ctx->iface, true);
+	}
+}
+
+void net_if_rx_poll_init(struct net_if_rx_poll *ctx, struct net_if *iface,
+			 net_if_rx_poll_t poll, net_if_rx_irq_t rx_irq)
+{
+	ctx->iface = iface;
+	ctx->poll = poll;
+	ctx->rx_irq = rx_irq;
+	atomic_clear(&ctx->scheduled);
+}
+
+void net_if_rx_poll_schedule(struct net_if_rx_poll *ctx)
+{
+	if (atomic_cas(&ctx->scheduled, 0, 1)) {
+		ctx->rx_irq(ctx->iface, false);
+		k_fifo_put(&rx_poll_queue, ctx);
+	}
+}
+#endif /* CONFIG_NET_IF_RX_POLL */
+
 void net_if_init(void)
 {
 	int if_count = 0;
@@ -3773,6 +3825,14 @@ void net_if_init(void)
 	k_thread_name_set(&tx_thread_ts, "tx_tstamp");
 #endif /* CONFIG_NET_PKT_TIMESTAMP_THREAD */
 
+#if defined(CONFIG_NET_IF_RX_POLL)
+	k_thread_create(&rx_poll_thread_data, rx_poll_stack,
+			K_THREAD_STACK_SIZEOF(rx_poll_stack),
+			(k_thread_entry_t)net_rx_poll_thread,
+			NULL, NULL, NULL, K_PRIO_COOP(1), 0, K_NO_WAIT);
+	k_thread_name_set(&rx_poll_thread_data, "rx_poll");
+#endif /* CONFIG_NET_IF_RX_POLL */
+
 #if defined(CONFIG_NET_VLAN)
 	/* Make sure that we do not have too many network interfaces
 	 * compared to the number of VLAN interfaces.
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/** @file
+ * @brief Network buffer pool usage telemetry
+ *
+ * Raises NET_EVENT_MEM_PRESSURE when a packet slab or data buffer pool
+ * crosses the configured occupancy threshold and NET_EVENT_MEM_ALLOC_FAIL
+ * when an allocation fails outright, both rate limited so a system
+ * sitting at the threshold does not flood the event queue. Current
+ * occupancy can always be pulled with net_mem_usage_get().
+ */
+
+#include <kernel.h>
+#include <net/net_if.h>
+#include <net/net_mgmt.h>
+#include <net/net_event.h>
+#include <net/net_pkt.h>
+#include <net/net_mem_monitor.h>
+
+/* Returns true if an event of this kind fired less than the rate
+ * limit interval ago; otherwise stamps the slot and lets it through.
+ */
+static bool rate_limited(uint32_t *last_ms)
+{
+	uint32_t now = k_uptime_get_32();
+
+	if (*last_ms != 0U &&
+	    (now - *last_ms) < CONFIG_NET_MEM_MONITOR_RATE_LIMIT) {
+		return true;
+	}
+
+	*last_ms = now;
+
+	return false;
+}
+
+static void notify_pressure(void)
+{
+	static uint32_t last_pressure_ms;
+
+	if (!rate_limited(&last_pressure_ms)) {
+		net_mgmt_event_notify(NET_EVENT_MEM_PRESSURE,
+				      net_if_get_default());
+	}
+}
+
+void net_mem_monitor_slab_check(struct k_mem_slab *slab)
+{
+	uint32_t used = k_mem_slab_num_used_get(slab);
+
+	if (used * 100U >=
+	    (uint32_t)CONFIG_NET_MEM_MONITOR_THRESHOLD * slab->num_blocks) {
+		notify_pressure();
+	}
+}
+
+void net_mem_monitor_pool_check(struct net_buf_pool *pool)
+{
+	uint32_t used = pool->buf_count - pool->avail_count;
+
+	if (used * 100U >=
+	    (uint32_t)CONFIG_NET_MEM_MONITOR_THRESHOLD * pool->buf_count) {
+		notify_pressure();
+	}
+}
+
+void net_mem_monitor_alloc_failed(void)
+{
+	static uint32_t last_fail_ms;
+
+	if (!rate_limited(&last_fail_ms)) {
+		net_mgmt_event_notify(NET_EVENT_MEM_ALLOC_FAIL,
+				      net_if_get_default());
+	}
+}
+
+void net_mem_usage_get(struct net_mem_usage *usage)
+{
+	struct k_mem_slab *rx;
+	struct k_mem_slab *tx;
+	struct net_buf_pool *rx_data;
+	struct net_buf_pool *tx_data;
+
+	net_pkt_get_info(&rx, &tx, &rx_data, &tx_data);
+
+	usage->rx_pkt_total = rx->num_blocks;
+	usage->rx_pkt_used = k_mem_slab_num_used_get(rx);
+	usage->tx_pkt_total = tx->num_blocks;
+	usage->tx_pkt_used = k_mem_slab_num_used_get(tx);
+	usage->rx_data_total = rx_data->buf_count;
+	usage->rx_data_used = rx_data->buf_count - rx_data->avail_count;
+	usage->tx_data_total = tx_data->buf_count;
+	usage->tx_data_used = tx_data->buf_count - tx_data->avail_count;
+}
@@ -19,6 +19,8 @@ LOG_MODULE_REGISTER(net_mgmt, CONFIG_NET_MGMT_EVENT_LOG_LEVEL);
 #include "net_private.h"
 
 struct mgmt_event_entry {
+	/* Ring slot sequence number, see mgmt_push_event() */
+	atomic_t seq;
 	uint32_t event;
 	struct net_if *iface;
 
@@ -28,6 +30,9 @@ struct mgmt_event_entry {
 #endif /* CONFIG_NET_MGMT_EVENT_INFO */
 };
 
+/* Layer is two bits wide, see NET_MGMT_GET_LAYER() */
+#define MGMT_EVENT_LAYERS 4
+
 struct mgmt_event_wait {
 	struct k_sem sync_call;
 	struct net_if *iface;
@@ -40,91 +45,93 @@ K_THREAD_STACK_DEFINE(mgmt_stack, CONFIG_NET_MGMT_EVENT_STACK_SIZE);
 static struct k_thread mgmt_thread_data;
 static struct mgmt_event_entry events[CONFIG_NET_MGMT_EVENT_QUEUE_SIZE];
 static uint32_t global_event_mask;
-static sys_slist_t event_callbacks;
-static int16_t in_event;
-static int16_t out_event;
-
+static sys_slist_t event_callbacks[MGMT_EVENT_LAYERS];
+static atomic_t events_head;
+static atomic_val_t events_tail;
+static atomic_t event_drops[MGMT_EVENT_LAYERS];
+
+/* Push an event into the ring without taking any lock, so that any
+ * number of threads can notify events concurrently.  Each slot carries
+ * a sequence number: a producer claims a slot by moving events_head
+ * with a compare-and-swap, fills it, and publishes it by advancing the
+ * slot sequence.  When the ring is full the event is dropped and
+ * accounted, never overwritten under the consumer.
+ */
 static inline void mgmt_push_event(uint32_t mgmt_event, struct net_if *iface,
 				   void *info, size_t length)
 {
-	int16_t i_idx;
+	struct mgmt_event_entry *entry;
+	atomic_val_t pos, seq;
 
 #ifndef CONFIG_NET_MGMT_EVENT_INFO
 	ARG_UNUSED(info);
 	ARG_UNUSED(length);
+#else
+	if (info && length > NET_EVENT_INFO_MAX_SIZE) {
+		NET_ERR("Event info length %zu > max size %zu",
+			length, NET_EVENT_INFO_MAX_SIZE);
+		return;
+	}
 #endif /* CONFIG_NET_MGMT_EVENT_INFO */
 
-	k_sem_take(&net_mgmt_lock, K_FOREVER);
+	pos = atomic_get(&events_head);
 
-	i_idx = in_event + 1;
-	if (i_idx == CONFIG_NET_MGMT_EVENT_QUEUE_SIZE) {
-		i_idx = 0;
-	}
+	for (;;) {
+		entry = &events[(uint32_t)pos %
+				CONFIG_NET_MGMT_EVENT_QUEUE_SIZE];
+		seq = atomic_get(&entry->seq);
 
-#ifdef CONFIG_NET_MGMT_EVENT_INFO
-	if (info && length) {
-		if (length <= NET_EVENT_INFO_MAX_SIZE) {
-			memcpy(events[i_idx].info, info, length);
-			events[i_idx].info_length = length;
-		} else {
-			NET_ERR("Event info length %zu > max size %zu",
-				length, NET_EVENT_INFO_MAX_SIZE);
-			k_sem_give(&net_mgmt_lock);
+		if (seq == pos) {
+			if (atomic_cas(&events_head, pos, pos + 1)) {
+				break;
+			}
+		} else if (seq - pos < 0) {
+			/* Ring is full, count the drop per event layer. */
+			atomic_inc(&event_drops[NET_MGMT_GET_LAYER(mgmt_event)]);
 
+			NET_DBG("Event 0x%08x dropped, queue full", mgmt_event);
 			return;
 		}
-	} else {
-		events[i_idx].info_length = 0;
-	}
-#endif /* CONFIG_NET_MGMT_EVENT_INFO */
-
-	events[i_idx].event = mgmt_event;
-	events[i_idx].iface = iface;
-
-	if (i_idx == out_event) {
-		uint16_t o_idx = out_event + 1;
 
-		if (o_idx == CONFIG_NET_MGMT_EVENT_QUEUE_SIZE) {
-			o_idx = 0U;
-		}
+		pos = atomic_get(&events_head);
+	}
 
-		if (events[o_idx].event) {
-			out_event = o_idx;
-		}
-	} else if (out_event < 0) {
-		out_event = i_idx;
+#ifdef CONFIG_NET_MGMT_EVENT_INFO
+	if (info && length) {
+		memcpy(entry->info, info, length);
+		entry->info_length = length;
+	} else {
+		entry->info_length = 0;
 	}
+#endif /* CONFIG_NET_MGMT_EVENT_INFO */
 
-	in_event = i_idx;
+	entry->event = mgmt_event;
+	entry->iface = iface;
 
-	k_sem_give(&net_mgmt_lock);
+	atomic_set(&entry->seq, pos + 1);
 }
 
-static inline struct mgmt_event_entry *mgmt_pop_event(void)
+/* Consume the next published event, copying it out so the ring slot can
+ * be released before the (possibly slow) callbacks run.  Only the
+ * net_mgmt thread consumes events.
+ */
+static inline bool mgmt_pop_event(struct mgmt_event_entry *dst)
 {
-	int16_t o_idx;
+	struct mgmt_event_entry *entry =
+		&events[(uint32_t)events_tail %
+			CONFIG_NET_MGMT_EVENT_QUEUE_SIZE];
 
-	if (out_event < 0 || !events[out_event].event) {
-		return NULL;
+	if (atomic_get(&entry->seq) != events_tail + 1) {
+		return false;
 	}
 
-	o_idx = out_event;
-	out_event++;
-
-	if (o_idx == in_event) {
-		in_event = -1;
-		out_event = -1;
-	} else if (out_event == CONFIG_NET_MGMT_EVENT_QUEUE_SIZE) {
-		out_event = 0;
-	}
+	*dst = *entry;
 
-	return &events[o_idx];
-}
+	atomic_set(&entry->seq,
+		   events_tail + CONFIG_NET_MGMT_EVENT_QUEUE_SIZE);
+	events_tail++;
 
-static inline void mgmt_clean_event(struct mgmt_event_entry *mgmt_event)
-{
-	mgmt_event->event = 0U;
-	mgmt_event->iface = NULL;
+	return true;
 }
 
 static inline void mgmt_add_event_mask(uint32_t event_mask)
@@ -135,11 +142,15 @@ static inline void mgmt_add_event_mask(uint32_t event_mask)
 static inline void mgmt_rebuild_global_event_mask(void)
 {
 	struct net_mgmt_event_callback *cb, *tmp;
+	int i;
 
 	global_event_mask = 0U;
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&event_callbacks, cb, tmp, node) {
-		mgmt_add_event_mask(cb->event_mask);
+	for (i = 0; i < MGMT_EVENT_LAYERS; i++) {
+		SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&event_callbacks[i], cb,
+						  tmp, node) {
+			mgmt_add_event_mask(cb->event_mask);
+		}
 	}
 }
 
@@ -160,13 +171,15 @@ static inline void mgmt_run_callbacks(struct mgmt_event_entry *mgmt_event)
 {
 	sys_snode_t *prev = NULL;
 	struct net_mgmt_event_callback *cb, *tmp;
+	sys_slist_t *cbs =
+		&event_callbacks[NET_MGMT_GET_LAYER(mgmt_event->event)];
 
 	NET_DBG("Event layer %u code %u cmd %u",
 		NET_MGMT_GET_LAYER(mgmt_event->event),
 		NET_MGMT_GET_LAYER_CODE(mgmt_event->event),
 		NET_MGMT_GET_COMMAND(mgmt_event->event));
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&event_callbacks, cb, tmp, node) {
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(cbs, cb, tmp, node) {
 		if (!(NET_MGMT_GET_LAYER(mgmt_event->event) ==
 		      NET_MGMT_GET_LAYER(cb->event_mask)) ||
 		    !(NET_MGMT_GET_LAYER_CODE(mgmt_event->event) ==
@@ -203,7 +216,7 @@ static inline void mgmt_run_callbacks(struct mgmt_event_entry *mgmt_event)
 			cb->raised_event = mgmt_event->event;
 			sync_data->iface = mgmt_event->iface;
 
-			sys_slist_remove(&event_callbacks, prev, &cb->node);
+			sys_slist_remove(cbs, prev, &cb->node);
 
 			k_sem_give(cb->sync_call);
 		} else {
@@ -222,32 +235,29 @@ static inline void mgmt_run_callbacks(struct mgmt_event_entry *mgmt_event)
 
 static void mgmt_thread(void)
 {
-	struct mgmt_event_entry *mgmt_event;
+	struct mgmt_event_entry mgmt_event;
 
 	while (1) {
 		k_sem_take(&network_event, K_FOREVER);
-		k_sem_take(&net_mgmt_lock, K_FOREVER);
 
 		NET_DBG("Handling events, forwarding it relevantly");
 
-		mgmt_event = mgmt_pop_event();
-		if (!mgmt_event) {
-			/* System is over-loaded?
-			 * At this point we have most probably notified
-			 * more events than we could handle
+		if (!mgmt_pop_event(&mgmt_event)) {
+			/* A producer claimed a slot but has not published
+			 * it yet; give it a moment to finish instead of
+			 * spinning on the semaphore.
 			 */
-			NET_DBG("Some event got probably lost (%u)",
-				k_sem_count_get(&network_event));
-
-			k_sem_init(&network_event, 0, UINT_MAX);
-			k_sem_give(&net_mgmt_lock);
-
+			k_sem_give(&network_event);
+			k_sleep(K_MSEC(1));
 			continue;
 		}
 
-		mgmt_run_callbacks(mgmt_event);
+		/* The lock only protects the callback lists: the event
+		 * itself was copied out of the ring already.
+		 */
+		k_sem_take(&net_mgmt_lock, K_FOREVER);
 
-		mgmt_clean_event(mgmt_event);
+		mgmt_run_callbacks(&mgmt_event);
 
 		k_sem_give(&net_mgmt_lock);
 
@@ -314,7 +324,8 @@ void net_mgmt_add_event_callback(struct net_mgmt_event_callback *cb)
 
 	k_sem_take(&net_mgmt_lock, K_FOREVER);
 
-	sys_slist_prepend(&event_callbacks, &cb->node);
+	sys_slist_prepend(&event_callbacks[NET_MGMT_GET_LAYER(cb->event_mask)],
+			  &cb->node);
 
 	mgmt_add_event_mask(cb->event_mask);
 
@@ -327,7 +338,9 @@ void net_mgmt_del_event_callback(struct net_mgmt_event_callback *cb)
 
 	k_sem_take(&net_mgmt_lock, K_FOREVER);
 
-	sys_slist_find_and_remove(&event_callbacks, &cb->node);
+	sys_slist_find_and_remove(
+		&event_callbacks[NET_MGMT_GET_LAYER(cb->event_mask)],
+		&cb->node);
 
 	mgmt_rebuild_global_event_mask();
 
@@ -348,6 +361,15 @@ void net_mgmt_event_notify_with_info(uint32_t mgmt_event, struct net_if *iface,
 	}
 }
 
+uint32_t net_mgmt_event_dropped(uint8_t layer)
+{
+	if (layer >= MGMT_EVENT_LAYERS) {
+		return 0U;
+	}
+
+	return (uint32_t)atomic_get(&event_drops[layer]);
+}
+
 int net_mgmt_event_wait(uint32_t mgmt_event_mask,
 			uint32_t *raised_event,
 			struct net_if **iface,
@@ -377,15 +399,24 @@ int net_mgmt_event_wait_on_iface(struct net_if *iface,
 
 void net_mgmt_event_init(void)
 {
-	sys_slist_init(&event_callbacks);
-	global_event_mask = 0U;
+	int i;
 
-	in_event = -1;
-	out_event = -1;
+	for (i = 0; i < MGMT_EVENT_LAYERS; i++) {
+		sys_slist_init(&event_callbacks[i]);
+	}
+
+	global_event_mask = 0U;
 
 	(void)memset(events, 0, CONFIG_NET_MGMT_EVENT_QUEUE_SIZE *
 			sizeof(struct mgmt_event_entry));
 
+	atomic_set(&events_head, 0);
+	events_tail = 0;
+
+	for (i = 0; i < CONFIG_NET_MGMT_EVENT_QUEUE_SIZE; i++) {
+		atomic_set(&events[i].seq, i);
+	}
+
 	k_thread_create(&mgmt_thread_data, mgmt_stack,
 			K_THREAD_STACK_SIZEOF(mgmt_stack),
 			(k_thread_entry_t)mgmt_thread, NULL, NULL, NULL,
@@ -37,6 +37,7 @@ LOG_MODULE_REGISTER(net_pkt, CONFIG_NET_PKT_LOG_LEVEL);
 #include <net/net_pkt.h>
 #include <net/ethernet.h>
 #include <net/udp.h>
+#include <net/net_mem_monitor.h>
 
 #include "net_private.h"
 #include "tcp_internal.h"
@@ -119,6 +120,16 @@ NET_BUF_POOL_FIXED_DEFINE(rx_bufs, CONFIG_NET_BUF_RX_COUNT,
 NET_BUF_POOL_FIXED_DEFINE(tx_bufs, CONFIG_NET_BUF_TX_COUNT,
 			  CONFIG_NET_BUF_DATA_SIZE, NULL);
 
+#if defined(CONFIG_NET_BUF_SMALL_DATA)
+/* Small allocations (protocol control segments etc.) are served from
+ * these pools so that they do not consume full sized fragments.
+ */
+NET_BUF_POOL_FIXED_DEFINE(rx_small_bufs, CONFIG_NET_BUF_SMALL_RX_COUNT,
+			  CONFIG_NET_BUF_SMALL_DATA_SIZE, NULL);
+NET_BUF_POOL_FIXED_DEFINE(tx_small_bufs, CONFIG_NET_BUF_SMALL_TX_COUNT,
+			  CONFIG_NET_BUF_SMALL_DATA_SIZE, NULL);
+#endif /* CONFIG_NET_BUF_SMALL_DATA */
+
 #else /* !CONFIG_NET_BUF_FIXED_DATA_SIZE */
 
 NET_BUF_POOL_VAR_DEFINE(rx_bufs, CONFIG_NET_BUF_RX_COUNT,
@@ -275,6 +286,12 @@ const char *net_pkt_pool2str(struct net_buf_pool *pool)
 		return "RDATA";
 	} else if (pool == &tx_bufs) {
 		return "TDATA";
+#if defined(CONFIG_NET_BUF_SMALL_DATA)
+	} else if (pool == &rx_small_bufs) {
+		return "RSDATA";
+	} else if (pool == &tx_small_bufs) {
+		return "TSDATA";
+#endif
 	}
 
 	return "EDATA";
@@ -904,12 +921,16 @@ static struct net_buf *pkt_alloc_buffer(struct net_buf_pool *pool,
 #endif
 	}
 
+	net_mem_monitor_pool_check(pool);
+
 	return first;
 error:
 	if (first) {
 		net_buf_unref(first);
 	}
 
+	net_mem_monitor_alloc_failed();
+
 	return NULL;
 }
 
@@ -927,6 +948,11 @@ static struct net_buf *pkt_alloc_buffer(struct net_buf_pool *pool,
 	struct net_buf *buf;
 
 	buf = net_buf_alloc_len(pool, size, timeout);
+	if (buf == NULL) {
+		net_mem_monitor_alloc_failed();
+	} else {
+		net_mem_monitor_pool_check(pool);
+	}
 
 #if CONFIG_NET_PKT_LOG_LEVEL >= LOG_LEVEL_DBG
 	NET_FRAG_CHECK_IF_NOT_IN_USE(buf, buf->ref + 1);
@@ -1140,6 +1166,33 @@ int net_pkt_alloc_buffer(struct net_pkt *pkt,
 
 	if (!pool) {
 		pool = pkt->slab == &tx_pkts ? &tx_bufs : &rx_bufs;
+
+#if defined(CONFIG_NET_BUF_SMALL_DATA)
+		/* Requests fitting in a small fragment are tried from the
+		 * small pools first, without waiting: if the small pool is
+		 * exhausted the regular pool below keeps the original
+		 * behavior.
+		 */
+		if (alloc_len <= CONFIG_NET_BUF_SMALL_DATA_SIZE) {
+			struct net_buf_pool *small_pool;
+
+			small_pool = pkt->slab == &tx_pkts ? &tx_small_bufs :
+							     &rx_small_bufs;
+
+#if NET_LOG_LEVEL >= LOG_LEVEL_DBG
+			buf = pkt_alloc_buffer(small_pool, alloc_len,
+					       K_NO_WAIT, caller, line);
+#else
+			buf = pkt_alloc_buffer(small_pool, alloc_len,
+					       K_NO_WAIT);
+#endif
+			if (buf) {
+				net_pkt_append_buffer(pkt, buf);
+
+				return 0;
+			}
+		}
+#endif /* CONFIG_NET_BUF_SMALL_DATA */
 	}
 
 	if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT) &&
@@ -1190,9 +1243,12 @@ static struct net_pkt *pkt_alloc(struct k_mem_slab *slab, k_timeout_t timeout)
 
 	ret = k_mem_slab_alloc(slab, (void **)&pkt, timeout);
 	if (ret) {
+		net_mem_monitor_alloc_failed();
 		return NULL;
 	}
 
+	net_mem_monitor_slab_check(slab);
+
 	memset(pkt, 0, sizeof(struct net_pkt));
 
 	pkt->atomic_ref = ATOMIC_INIT(1);
@@ -1467,6 +1523,29 @@ void net_pkt_append_buffer(struct net_pkt *pkt, struct net_buf *buffer)
 	}
 }
 
+#if defined(CONFIG_NET_BUF_FIXED_DATA_SIZE)
+struct net_buf *net_pkt_rx_data_loan(k_timeout_t timeout)
+{
+	return net_pkt_get_reserve_rx_data(timeout);
+}
+
+struct net_pkt *net_pkt_rx_claim_loaned(struct net_if *iface,
+					struct net_buf *buffer,
+					k_timeout_t timeout)
+{
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_rx_alloc_on_iface(iface, timeout);
+	if (!pkt) {
+		return NULL;
+	}
+
+	net_pkt_append_buffer(pkt, buffer);
+
+	return pkt;
+}
+#endif /* CONFIG_NET_BUF_FIXED_DATA_SIZE */
+
 void net_pkt_cursor_init(struct net_pkt *pkt)
 {
 	pkt->cursor.buf = pkt->buffer;
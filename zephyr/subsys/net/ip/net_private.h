@@ -78,6 +78,9 @@ static inline enum net_verdict net_ipv6_input(struct net_pkt *pkt,
 #endif
 extern bool net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt);
 extern void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt);
+#if defined(CONFIG_NET_RX_DIRECT_DISPATCH)
+extern bool net_tc_rx_queue_is_empty(uint8_t tc);
+#endif
 extern enum net_verdict net_promisc_mode_input(struct net_pkt *pkt);
 
 char *net_sprint_addr(sa_family_t af, const void *addr);
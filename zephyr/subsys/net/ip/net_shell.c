@@ -3526,6 +3526,8 @@ static int cmd_net_stats_iface(const struct shell *shell, size_t argc,
 static int cmd_net_stats(const struct shell *shell, size_t argc, char *argv[])
 {
 #if defined(CONFIG_NET_STATISTICS)
+	net_stats_fold();
+
 	if (!argv[1]) {
 		cmd_net_stats_all(shell, argc, argv);
 		return 0;
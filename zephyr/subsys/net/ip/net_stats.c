@@ -29,6 +29,22 @@ LOG_MODULE_REGISTER(net_stats, NET_LOG_LEVEL);
  */
 struct net_stats net_stats = { 0 };
 
+#if defined(CONFIG_NET_STATISTICS_PERCPU)
+struct sys_percpu_counter net_stats_percpu_processing_error;
+struct sys_percpu_counter net_stats_percpu_bytes_recv;
+struct sys_percpu_counter net_stats_percpu_bytes_sent;
+
+void net_stats_fold(void)
+{
+	net_stats.processing_error +=
+		sys_percpu_counter_fold(&net_stats_percpu_processing_error);
+	net_stats.bytes.received +=
+		sys_percpu_counter_fold(&net_stats_percpu_bytes_recv);
+	net_stats.bytes.sent +=
+		sys_percpu_counter_fold(&net_stats_percpu_bytes_sent);
+}
+#endif /* CONFIG_NET_STATISTICS_PERCPU */
+
 #if defined(CONFIG_NET_STATISTICS_PERIODIC_OUTPUT)
 
 #define PRINT_STATISTICS_INTERVAL (30 * MSEC_PER_SEC)
@@ -72,6 +88,8 @@ static inline void stats(struct net_if *iface)
 	int i;
 
 	if (!next_print || (abs(cmp) > PRINT_STATISTICS_INTERVAL)) {
+		net_stats_fold();
+
 		if (iface) {
 			NET_INFO("Interface %p [%d]", iface,
 				 net_if_get_by_iface(iface));
@@ -240,6 +258,8 @@ static int net_stats_get(uint32_t mgmt_request, struct net_if *iface,
 	size_t len_chk = 0;
 	void *src = NULL;
 
+	net_stats_fold();
+
 	switch (NET_MGMT_GET_COMMAND(mgmt_request)) {
 	case NET_REQUEST_STATS_CMD_GET_ALL:
 		len_chk = sizeof(struct net_stats);
@@ -372,4 +392,10 @@ void net_stats_reset(struct net_if *iface)
 
 	net_if_stats_reset_all();
 	memset(&net_stats, 0, sizeof(net_stats));
+
+#if defined(CONFIG_NET_STATISTICS_PERCPU)
+	sys_percpu_counter_reset(&net_stats_percpu_processing_error);
+	sys_percpu_counter_reset(&net_stats_percpu_bytes_recv);
+	sys_percpu_counter_reset(&net_stats_percpu_bytes_sent);
+#endif
 }
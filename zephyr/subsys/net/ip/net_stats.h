@@ -31,11 +31,39 @@ extern struct net_stats net_stats;
 #define UPDATE_STAT(_iface, _cmd) \
 	{ NET_ASSERT(_iface); (UPDATE_STAT_GLOBAL(_cmd)); \
 	  SET_STAT(_iface->_cmd); }
+
+#if defined(CONFIG_NET_STATISTICS_PERCPU)
+#include <sys/percpu_counter.h>
+
+/* The highest-rate global counters are updated CPU-locally and folded
+ * into net_stats by net_stats_fold() on the read paths, so that packet
+ * processing on several cores does not contend on the net_stats cache
+ * line. Per-interface statistics keep the direct update.
+ */
+extern struct sys_percpu_counter net_stats_percpu_processing_error;
+extern struct sys_percpu_counter net_stats_percpu_bytes_recv;
+extern struct sys_percpu_counter net_stats_percpu_bytes_sent;
+
+/* Fold the per-CPU deltas accumulated since the last fold into the
+ * global net_stats structure. Must be called before net_stats fields
+ * covered by the per-CPU counters are read.
+ */
+void net_stats_fold(void);
+#else
+#define net_stats_fold()
+#endif /* CONFIG_NET_STATISTICS_PERCPU */
+
 /* Core stats */
 
 static inline void net_stats_update_processing_error(struct net_if *iface)
 {
+#if defined(CONFIG_NET_STATISTICS_PERCPU)
+	NET_ASSERT(iface);
+	sys_percpu_counter_inc(&net_stats_percpu_processing_error);
+	SET_STAT(iface->stats.processing_error++);
+#else
 	UPDATE_STAT(iface, stats.processing_error++);
+#endif
 }
 
 static inline void net_stats_update_ip_errors_protoerr(struct net_if *iface)
@@ -51,13 +79,25 @@ static inline void net_stats_update_ip_errors_vhlerr(struct net_if *iface)
 static inline void net_stats_update_bytes_recv(struct net_if *iface,
 					       uint32_t bytes)
 {
+#if defined(CONFIG_NET_STATISTICS_PERCPU)
+	NET_ASSERT(iface);
+	sys_percpu_counter_add(&net_stats_percpu_bytes_recv, bytes);
+	SET_STAT(iface->stats.bytes.received += bytes);
+#else
 	UPDATE_STAT(iface, stats.bytes.received += bytes);
+#endif
 }
 
 static inline void net_stats_update_bytes_sent(struct net_if *iface,
 					       uint32_t bytes)
 {
+#if defined(CONFIG_NET_STATISTICS_PERCPU)
+	NET_ASSERT(iface);
+	sys_percpu_counter_add(&net_stats_percpu_bytes_sent, bytes);
+	SET_STAT(iface->stats.bytes.sent += bytes);
+#else
 	UPDATE_STAT(iface, stats.bytes.sent += bytes);
+#endif
 }
 #else
 #define net_stats_update_processing_error(iface)
@@ -65,6 +105,7 @@ static inline void net_stats_update_bytes_sent(struct net_if *iface,
 #define net_stats_update_ip_errors_vhlerr(iface)
 #define net_stats_update_bytes_recv(iface, bytes)
 #define net_stats_update_bytes_sent(iface, bytes)
+#define net_stats_fold()
 #endif /* CONFIG_NET_STATISTICS */
 
 #if defined(CONFIG_NET_STATISTICS_IPV6) && defined(CONFIG_NET_NATIVE_IPV6)
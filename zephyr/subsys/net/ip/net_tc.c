@@ -45,6 +45,13 @@ void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 	k_work_submit_to_queue(&rx_classes[tc].work_q, net_pkt_work(pkt));
 }
 
+#if defined(CONFIG_NET_RX_DIRECT_DISPATCH)
+bool net_tc_rx_queue_is_empty(uint8_t tc)
+{
+	return k_queue_is_empty(&rx_classes[tc].work_q.queue);
+}
+#endif
+
 int net_tx_priority2tc(enum net_priority prio)
 {
 	if (prio > NET_PRIORITY_NC) {
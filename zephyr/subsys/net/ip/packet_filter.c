@@ -0,0 +1,457 @@
+/** @file
+ * @brief Classic BPF filters for packet sockets
+ *
+ * Filter programs attached with SO_ATTACH_FILTER are run against every
+ * frame that would be delivered to a packet socket, before the frame
+ * is queued to the socket. This lets a sniffer style application
+ * reject uninteresting traffic in the RX path instead of receiving
+ * and discarding it.
+ */
+
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <logging/log.h>
+LOG_MODULE_REGISTER(net_pkt_filter, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <errno.h>
+#include <string.h>
+#include <sys/util.h>
+
+#include <net/net_core.h>
+#include <net/net_pkt.h>
+#include <net/net_context.h>
+#include <net/socket_filter.h>
+
+#include "packet_filter.h"
+
+/* A validated filter program, bound to one net_context at a time. */
+struct net_socket_filter {
+	bool used;
+	uint16_t len;
+	struct sock_filter insns[CONFIG_NET_SOCKETS_PACKET_FILTER_MAX_INSNS];
+};
+
+static struct net_socket_filter filters[CONFIG_NET_SOCKETS_PACKET_FILTER_COUNT];
+
+/* Serializes attach/detach against a filter run in the RX path. Filter
+ * programs are short and cannot loop (only forward jumps pass the
+ * validator), so the lock hold time in the RX path is bounded.
+ */
+static struct k_spinlock filter_lock;
+
+/* Check a program before accepting it, so the interpreter does not
+ * need any runtime bounds checking on jumps or scratch memory and is
+ * guaranteed to terminate.
+ */
+static bool filter_is_valid(const struct sock_filter *insns, uint16_t len)
+{
+	uint16_t pc;
+
+	for (pc = 0U; pc < len; pc++) {
+		const struct sock_filter *insn = &insns[pc];
+
+		switch (insn->code) {
+		case BPF_LD | BPF_W | BPF_ABS:
+		case BPF_LD | BPF_H | BPF_ABS:
+		case BPF_LD | BPF_B | BPF_ABS:
+		case BPF_LD | BPF_W | BPF_IND:
+		case BPF_LD | BPF_H | BPF_IND:
+		case BPF_LD | BPF_B | BPF_IND:
+		case BPF_LD | BPF_W | BPF_LEN:
+		case BPF_LD | BPF_IMM:
+		case BPF_LDX | BPF_W | BPF_LEN:
+		case BPF_LDX | BPF_IMM:
+		case BPF_LDX | BPF_B | BPF_MSH:
+		case BPF_ALU | BPF_ADD | BPF_K:
+		case BPF_ALU | BPF_ADD | BPF_X:
+		case BPF_ALU | BPF_SUB | BPF_K:
+		case BPF_ALU | BPF_SUB | BPF_X:
+		case BPF_ALU | BPF_MUL | BPF_K:
+		case BPF_ALU | BPF_MUL | BPF_X:
+		case BPF_ALU | BPF_DIV | BPF_X:
+		case BPF_ALU | BPF_MOD | BPF_X:
+		case BPF_ALU | BPF_OR | BPF_K:
+		case BPF_ALU | BPF_OR | BPF_X:
+		case BPF_ALU | BPF_AND | BPF_K:
+		case BPF_ALU | BPF_AND | BPF_X:
+		case BPF_ALU | BPF_XOR | BPF_K:
+		case BPF_ALU | BPF_XOR | BPF_X:
+		case BPF_ALU | BPF_LSH | BPF_X:
+		case BPF_ALU | BPF_RSH | BPF_X:
+		case BPF_ALU | BPF_NEG:
+		case BPF_MISC | BPF_TAX:
+		case BPF_MISC | BPF_TXA:
+		case BPF_RET | BPF_K:
+		case BPF_RET | BPF_A:
+			break;
+		case BPF_ALU | BPF_DIV | BPF_K:
+		case BPF_ALU | BPF_MOD | BPF_K:
+			if (insn->k == 0U) {
+				return false;
+			}
+
+			break;
+		case BPF_ALU | BPF_LSH | BPF_K:
+		case BPF_ALU | BPF_RSH | BPF_K:
+			/* A shift by 32 or more is undefined on the
+			 * 32-bit accumulator.
+			 */
+			if (insn->k >= 32U) {
+				return false;
+			}
+
+			break;
+		case BPF_LD | BPF_MEM:
+		case BPF_LDX | BPF_MEM:
+		case BPF_ST:
+		case BPF_STX:
+			if (insn->k >= BPF_MEMWORDS) {
+				return false;
+			}
+
+			break;
+		case BPF_JMP | BPF_JA:
+			/* Jump offsets are unsigned, so a valid program
+			 * can only jump forward and must terminate.
+			 */
+			if (insn->k >= (uint32_t)(len - pc - 1)) {
+				return false;
+			}
+
+			break;
+		case BPF_JMP | BPF_JEQ | BPF_K:
+		case BPF_JMP | BPF_JEQ | BPF_X:
+		case BPF_JMP | BPF_JGT | BPF_K:
+		case BPF_JMP | BPF_JGT | BPF_X:
+		case BPF_JMP | BPF_JGE | BPF_K:
+		case BPF_JMP | BPF_JGE | BPF_X:
+		case BPF_JMP | BPF_JSET | BPF_K:
+		case BPF_JMP | BPF_JSET | BPF_X:
+			if (insn->jt >= len - pc - 1 ||
+			    insn->jf >= len - pc - 1) {
+				return false;
+			}
+
+			break;
+		default:
+			return false;
+		}
+	}
+
+	return BPF_CLASS(insns[len - 1].code) == BPF_RET;
+}
+
+/* Big endian packet data load, as classic BPF specifies. A load past
+ * the end of the frame terminates the program with a drop verdict,
+ * which filter_run() maps from the false return value.
+ */
+static bool filter_load(struct net_pkt *pkt, uint32_t offset, uint16_t size,
+			uint32_t *value)
+{
+	net_pkt_cursor_init(pkt);
+
+	if (offset > net_pkt_get_len(pkt) || net_pkt_skip(pkt, offset)) {
+		return false;
+	}
+
+	if (size == sizeof(uint32_t)) {
+		return net_pkt_read_be32(pkt, value) == 0;
+	} else if (size == sizeof(uint16_t)) {
+		uint16_t val16;
+
+		if (net_pkt_read_be16(pkt, &val16)) {
+			return false;
+		}
+
+		*value = val16;
+	} else {
+		uint8_t val8;
+
+		if (net_pkt_read_u8(pkt, &val8)) {
+			return false;
+		}
+
+		*value = val8;
+	}
+
+	return true;
+}
+
+static bool filter_run(struct net_socket_filter *filter, struct net_pkt *pkt)
+{
+	uint32_t mem[BPF_MEMWORDS] = { 0 };
+	uint32_t pkt_len = net_pkt_get_len(pkt);
+	uint32_t acc = 0U, idx = 0U;
+	uint16_t pc;
+
+	for (pc = 0U; pc < filter->len; pc++) {
+		const struct sock_filter *insn = &filter->insns[pc];
+
+		switch (insn->code) {
+		case BPF_LD | BPF_W | BPF_ABS:
+		case BPF_LD | BPF_H | BPF_ABS:
+		case BPF_LD | BPF_B | BPF_ABS:
+			if (!filter_load(pkt, insn->k,
+					 1U << (2U - (BPF_SIZE(insn->code) >> 3)),
+					 &acc)) {
+				return false;
+			}
+
+			break;
+		case BPF_LD | BPF_W | BPF_IND:
+		case BPF_LD | BPF_H | BPF_IND:
+		case BPF_LD | BPF_B | BPF_IND:
+			if (idx + insn->k < idx ||
+			    !filter_load(pkt, idx + insn->k,
+					 1U << (2U - (BPF_SIZE(insn->code) >> 3)),
+					 &acc)) {
+				return false;
+			}
+
+			break;
+		case BPF_LD | BPF_W | BPF_LEN:
+			acc = pkt_len;
+			break;
+		case BPF_LD | BPF_IMM:
+			acc = insn->k;
+			break;
+		case BPF_LD | BPF_MEM:
+			acc = mem[insn->k];
+			break;
+		case BPF_LDX | BPF_W | BPF_LEN:
+			idx = pkt_len;
+			break;
+		case BPF_LDX | BPF_IMM:
+			idx = insn->k;
+			break;
+		case BPF_LDX | BPF_MEM:
+			idx = mem[insn->k];
+			break;
+		case BPF_LDX | BPF_B | BPF_MSH: {
+			uint32_t val;
+
+			if (!filter_load(pkt, insn->k, sizeof(uint8_t), &val)) {
+				return false;
+			}
+
+			idx = (val & 0x0f) << 2;
+			break;
+		}
+		case BPF_ST:
+			mem[insn->k] = acc;
+			break;
+		case BPF_STX:
+			mem[insn->k] = idx;
+			break;
+		case BPF_ALU | BPF_ADD | BPF_K:
+			acc += insn->k;
+			break;
+		case BPF_ALU | BPF_ADD | BPF_X:
+			acc += idx;
+			break;
+		case BPF_ALU | BPF_SUB | BPF_K:
+			acc -= insn->k;
+			break;
+		case BPF_ALU | BPF_SUB | BPF_X:
+			acc -= idx;
+			break;
+		case BPF_ALU | BPF_MUL | BPF_K:
+			acc *= insn->k;
+			break;
+		case BPF_ALU | BPF_MUL | BPF_X:
+			acc *= idx;
+			break;
+		case BPF_ALU | BPF_DIV | BPF_K:
+			acc /= insn->k;
+			break;
+		case BPF_ALU | BPF_DIV | BPF_X:
+			if (idx == 0U) {
+				return false;
+			}
+
+			acc /= idx;
+			break;
+		case BPF_ALU | BPF_MOD | BPF_K:
+			acc %= insn->k;
+			break;
+		case BPF_ALU | BPF_MOD | BPF_X:
+			if (idx == 0U) {
+				return false;
+			}
+
+			acc %= idx;
+			break;
+		case BPF_ALU | BPF_OR | BPF_K:
+			acc |= insn->k;
+			break;
+		case BPF_ALU | BPF_OR | BPF_X:
+			acc |= idx;
+			break;
+		case BPF_ALU | BPF_AND | BPF_K:
+			acc &= insn->k;
+			break;
+		case BPF_ALU | BPF_AND | BPF_X:
+			acc &= idx;
+			break;
+		case BPF_ALU | BPF_XOR | BPF_K:
+			acc ^= insn->k;
+			break;
+		case BPF_ALU | BPF_XOR | BPF_X:
+			acc ^= idx;
+			break;
+		case BPF_ALU | BPF_LSH | BPF_K:
+			acc <<= insn->k;
+			break;
+		case BPF_ALU | BPF_LSH | BPF_X:
+			if (idx >= 32U) {
+				return false;
+			}
+
+			acc <<= idx;
+			break;
+		case BPF_ALU | BPF_RSH | BPF_K:
+			acc >>= insn->k;
+			break;
+		case BPF_ALU | BPF_RSH | BPF_X:
+			if (idx >= 32U) {
+				return false;
+			}
+
+			acc >>= idx;
+			break;
+		case BPF_ALU | BPF_NEG:
+			acc = -acc;
+			break;
+		case BPF_MISC | BPF_TAX:
+			idx = acc;
+			break;
+		case BPF_MISC | BPF_TXA:
+			acc = idx;
+			break;
+		case BPF_JMP | BPF_JA:
+			pc += insn->k;
+			break;
+		case BPF_JMP | BPF_JEQ | BPF_K:
+			pc += (acc == insn->k) ? insn->jt : insn->jf;
+			break;
+		case BPF_JMP | BPF_JEQ | BPF_X:
+			pc += (acc == idx) ? insn->jt : insn->jf;
+			break;
+		case BPF_JMP | BPF_JGT | BPF_K:
+			pc += (acc > insn->k) ? insn->jt : insn->jf;
+			break;
+		case BPF_JMP | BPF_JGT | BPF_X:
+			pc += (acc > idx) ? insn->jt : insn->jf;
+			break;
+		case BPF_JMP | BPF_JGE | BPF_K:
+			pc += (acc >= insn->k) ? insn->jt : insn->jf;
+			break;
+		case BPF_JMP | BPF_JGE | BPF_X:
+			pc += (acc >= idx) ? insn->jt : insn->jf;
+			break;
+		case BPF_JMP | BPF_JSET | BPF_K:
+			pc += (acc & insn->k) ? insn->jt : insn->jf;
+			break;
+		case BPF_JMP | BPF_JSET | BPF_X:
+			pc += (acc & idx) ? insn->jt : insn->jf;
+			break;
+		case BPF_RET | BPF_K:
+			return insn->k != 0U;
+		case BPF_RET | BPF_A:
+			return acc != 0U;
+		}
+	}
+
+	/* Not reachable, a valid program ends in a return. */
+	return false;
+}
+
+int net_packet_filter_attach(struct net_context *context,
+			     const struct sock_fprog *fprog)
+{
+	struct net_socket_filter *filter = NULL;
+	k_spinlock_key_t key;
+	int i;
+
+	if (!fprog || !fprog->filter || fprog->len == 0U) {
+		return -EINVAL;
+	}
+
+	if (fprog->len > CONFIG_NET_SOCKETS_PACKET_FILTER_MAX_INSNS) {
+		return -ENOMEM;
+	}
+
+	if (!filter_is_valid(fprog->filter, fprog->len)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&filter_lock);
+
+	/* Replace in place when the socket already has a filter. */
+	if (context->pkt_filter) {
+		filter = context->pkt_filter;
+	} else {
+		for (i = 0; i < ARRAY_SIZE(filters); i++) {
+			if (!filters[i].used) {
+				filter = &filters[i];
+				break;
+			}
+		}
+	}
+
+	if (!filter) {
+		k_spin_unlock(&filter_lock, key);
+		return -ENOMEM;
+	}
+
+	filter->used = true;
+	filter->len = fprog->len;
+	memcpy(filter->insns, fprog->filter,
+	       fprog->len * sizeof(struct sock_filter));
+
+	context->pkt_filter = filter;
+
+	k_spin_unlock(&filter_lock, key);
+
+	NET_DBG("Attached %u insn filter %p to context %p",
+		fprog->len, filter, context);
+
+	return 0;
+}
+
+void net_packet_filter_detach(struct net_context *context)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&filter_lock);
+
+	if (context->pkt_filter) {
+		context->pkt_filter->used = false;
+		context->pkt_filter = NULL;
+	}
+
+	k_spin_unlock(&filter_lock, key);
+}
+
+bool net_packet_filter_run(struct net_context *context, struct net_pkt *pkt)
+{
+	struct net_pkt_cursor backup;
+	k_spinlock_key_t key;
+	bool ok = true;
+
+	key = k_spin_lock(&filter_lock);
+
+	if (context->pkt_filter) {
+		net_pkt_cursor_backup(pkt, &backup);
+		ok = filter_run(context->pkt_filter, pkt);
+		net_pkt_cursor_restore(pkt, &backup);
+	}
+
+	k_spin_unlock(&filter_lock, key);
+
+	return ok;
+}
@@ -0,0 +1,83 @@
+/** @file
+ * @brief Classic BPF filters for packet sockets
+ *
+ * This is not to be included by the application.
+ */
+
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __PACKET_FILTER_H
+#define __PACKET_FILTER_H
+
+#include <zephyr/types.h>
+#include <net/net_context.h>
+#include <net/net_pkt.h>
+#include <net/socket_filter.h>
+
+/**
+ * @brief Validate a filter program and attach it to a packet socket.
+ * An already attached program is replaced.
+ *
+ * @param context Network context the filter is attached to.
+ * @param fprog Filter program copied from the caller.
+ *
+ * @return 0 if ok, -EINVAL if the program is malformed, -ENOMEM if
+ * all the filter slots are in use or the program is too long.
+ */
+#if defined(CONFIG_NET_SOCKETS_PACKET_FILTER)
+int net_packet_filter_attach(struct net_context *context,
+			     const struct sock_fprog *fprog);
+#else
+static inline int net_packet_filter_attach(struct net_context *context,
+					   const struct sock_fprog *fprog)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(fprog);
+
+	return -ENOPROTOOPT;
+}
+#endif
+
+/**
+ * @brief Detach the filter program from a packet socket, if any.
+ *
+ * @param context Network context the filter was attached to.
+ */
+#if defined(CONFIG_NET_SOCKETS_PACKET_FILTER)
+void net_packet_filter_detach(struct net_context *context);
+#else
+static inline void net_packet_filter_detach(struct net_context *context)
+{
+	ARG_UNUSED(context);
+}
+#endif
+
+/**
+ * @brief Run the filter program attached to a packet socket against
+ * a received frame. Called before the packet is queued to the socket
+ * so rejected frames cost no further processing.
+ *
+ * @param context Network context the packet would be delivered to.
+ * @param pkt Received network packet.
+ *
+ * @return true if the packet is accepted (or no filter is attached),
+ * false if the filter rejected the packet.
+ */
+#if defined(CONFIG_NET_SOCKETS_PACKET_FILTER)
+bool net_packet_filter_run(struct net_context *context, struct net_pkt *pkt);
+#else
+static inline bool net_packet_filter_run(struct net_context *context,
+					 struct net_pkt *pkt)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(pkt);
+
+	return true;
+}
+#endif
+
+#endif /* __PACKET_FILTER_H */
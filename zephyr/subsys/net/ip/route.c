@@ -118,6 +118,300 @@ static inline struct net_route_entry *net_route_data(struct net_nbr *nbr)
 	return (struct net_route_entry *)nbr->data;
 }
 
+#if defined(CONFIG_NET_ROUTE_LPM)
+/* Path compressed binary trie indexing the routes by prefix. Each node
+ * covers the first prefix_len bits of addr; a node with a route attached
+ * represents a stored prefix, the others are branching points. Lookup
+ * walks at most 128 levels regardless of the number of routes.
+ */
+struct route_lpm_node {
+	struct route_lpm_node *parent;
+	struct route_lpm_node *child[2];
+	struct net_route_entry *route;
+	struct in6_addr addr;
+	uint8_t prefix_len;
+	bool used;
+};
+
+/* Every stored prefix needs at most one leaf and one branching node. */
+static struct route_lpm_node route_lpm_pool[2 * CONFIG_NET_MAX_ROUTES];
+static struct route_lpm_node route_lpm_root;
+
+/* Number of prefixes that are stored twice (same prefix on two
+ * interfaces) plus one if the node pool ever ran out. The trie keeps a
+ * single route per prefix, so while this is non-zero the lookup falls
+ * back to the linear scan.
+ */
+static int route_lpm_degraded;
+
+static uint8_t lpm_bit(const struct in6_addr *addr, uint8_t pos)
+{
+	return (addr->s6_addr[pos >> 3] >> (7 - (pos & 7))) & 1;
+}
+
+static uint8_t lpm_common_len(const struct in6_addr *a,
+			      const struct in6_addr *b,
+			      uint8_t max)
+{
+	uint8_t len = 0U;
+
+	while (len < max && lpm_bit(a, len) == lpm_bit(b, len)) {
+		len++;
+	}
+
+	return len;
+}
+
+static struct route_lpm_node *lpm_node_alloc(void)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(route_lpm_pool); i++) {
+		if (!route_lpm_pool[i].used) {
+			memset(&route_lpm_pool[i], 0,
+			       sizeof(route_lpm_pool[i]));
+			route_lpm_pool[i].used = true;
+
+			return &route_lpm_pool[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void lpm_node_free(struct route_lpm_node *node)
+{
+	node->used = false;
+}
+
+/* Find or create the node for the given prefix. */
+static struct route_lpm_node *lpm_insert(struct in6_addr *addr,
+					 uint8_t prefix_len)
+{
+	struct route_lpm_node *node = &route_lpm_root;
+
+	while (true) {
+		struct route_lpm_node *branch, *leaf;
+		uint8_t common, bit;
+
+		common = lpm_common_len(addr, &node->addr,
+					MIN(prefix_len, node->prefix_len));
+
+		if (common < node->prefix_len) {
+			/* Split node: insert a branching point covering
+			 * only the shared bits.
+			 */
+			branch = lpm_node_alloc();
+			if (!branch) {
+				return NULL;
+			}
+
+			net_ipaddr_copy(&branch->addr, &node->addr);
+			branch->prefix_len = common;
+			branch->parent = node->parent;
+
+			if (node->parent->child[0] == node) {
+				node->parent->child[0] = branch;
+			} else {
+				node->parent->child[1] = branch;
+			}
+
+			branch->child[lpm_bit(&node->addr, common)] = node;
+			node->parent = branch;
+
+			if (common == prefix_len) {
+				return branch;
+			}
+
+			leaf = lpm_node_alloc();
+			if (!leaf) {
+				return NULL;
+			}
+
+			net_ipaddr_copy(&leaf->addr, addr);
+			leaf->prefix_len = prefix_len;
+			leaf->parent = branch;
+			branch->child[lpm_bit(addr, common)] = leaf;
+
+			return leaf;
+		}
+
+		if (prefix_len == node->prefix_len) {
+			return node;
+		}
+
+		bit = lpm_bit(addr, node->prefix_len);
+
+		if (!node->child[bit]) {
+			leaf = lpm_node_alloc();
+			if (!leaf) {
+				return NULL;
+			}
+
+			net_ipaddr_copy(&leaf->addr, addr);
+			leaf->prefix_len = prefix_len;
+			leaf->parent = node;
+			node->child[bit] = leaf;
+
+			return leaf;
+		}
+
+		node = node->child[bit];
+	}
+}
+
+static struct route_lpm_node *lpm_find_exact(struct in6_addr *addr,
+					     uint8_t prefix_len)
+{
+	struct route_lpm_node *node = &route_lpm_root;
+
+	while (node && node->prefix_len < prefix_len) {
+		node = node->child[lpm_bit(addr, node->prefix_len)];
+	}
+
+	if (node && node->prefix_len == prefix_len &&
+	    net_ipv6_is_prefix((uint8_t *)addr, (uint8_t *)&node->addr,
+			       prefix_len)) {
+		return node;
+	}
+
+	return NULL;
+}
+
+/* Remove empty nodes on the way towards the root, splicing out
+ * branching points that are left with a single child.
+ */
+static void lpm_prune(struct route_lpm_node *node)
+{
+	while (node != &route_lpm_root && !node->route) {
+		struct route_lpm_node *parent = node->parent;
+		struct route_lpm_node *child;
+
+		if (node->child[0] && node->child[1]) {
+			break;
+		}
+
+		child = node->child[0] ? node->child[0] : node->child[1];
+
+		if (parent->child[0] == node) {
+			parent->child[0] = child;
+		} else {
+			parent->child[1] = child;
+		}
+
+		if (child) {
+			child->parent = parent;
+		}
+
+		lpm_node_free(node);
+		node = parent;
+	}
+}
+
+static void route_lpm_add(struct net_route_entry *route)
+{
+	struct route_lpm_node *node;
+
+	node = lpm_insert(&route->addr, route->prefix_len);
+	if (!node) {
+		NET_ERR("Cannot index route %p, falling back to scan", route);
+		route_lpm_degraded++;
+		return;
+	}
+
+	if (node->route && node->route != route) {
+		/* Same prefix on another interface; keep the old entry
+		 * and disable the trie until one of them goes away.
+		 */
+		route_lpm_degraded++;
+
+		return;
+	}
+
+	node->route = route;
+}
+
+static void route_lpm_del(struct net_route_entry *route)
+{
+	struct route_lpm_node *node;
+	int i;
+
+	node = lpm_find_exact(&route->addr, route->prefix_len);
+	if (!node) {
+		return;
+	}
+
+	if (node->route != route) {
+		/* This was a duplicate that never made it to the trie */
+		if (route_lpm_degraded > 0) {
+			route_lpm_degraded--;
+		}
+
+		return;
+	}
+
+	/* If a duplicate prefix exists, let it take over the node */
+	for (i = 0; i < CONFIG_NET_MAX_ROUTES; i++) {
+		struct net_nbr *nbr = get_nbr(i);
+		struct net_route_entry *replacement;
+
+		if (!nbr->ref) {
+			continue;
+		}
+
+		replacement = net_route_data(nbr);
+
+		if (replacement != route &&
+		    replacement->prefix_len == route->prefix_len &&
+		    net_ipv6_is_prefix((uint8_t *)&replacement->addr,
+				       (uint8_t *)&route->addr,
+				       route->prefix_len)) {
+			node->route = replacement;
+
+			if (route_lpm_degraded > 0) {
+				route_lpm_degraded--;
+			}
+
+			return;
+		}
+	}
+
+	node->route = NULL;
+	lpm_prune(node);
+}
+
+static struct net_route_entry *route_lpm_lookup(struct net_if *iface,
+						struct in6_addr *dst)
+{
+	struct route_lpm_node *node = &route_lpm_root;
+	struct net_route_entry *found = NULL;
+
+	while (node) {
+		if (!net_ipv6_is_prefix((uint8_t *)dst,
+					(uint8_t *)&node->addr,
+					node->prefix_len)) {
+			break;
+		}
+
+		if (node->route &&
+		    (!iface || node->route->iface == iface)) {
+			found = node->route;
+		}
+
+		if (node->prefix_len >= 128) {
+			break;
+		}
+
+		node = node->child[lpm_bit(dst, node->prefix_len)];
+	}
+
+	return found;
+}
+#else
+#define route_lpm_add(...)
+#define route_lpm_del(...)
+#endif /* CONFIG_NET_ROUTE_LPM */
+
 struct net_nbr *net_route_get_nbr(struct net_route_entry *route)
 {
 	int i;
@@ -264,6 +558,20 @@ struct net_route_entry *net_route_lookup(struct net_if *iface,
 	uint8_t longest_match = 0U;
 	int i;
 
+#if defined(CONFIG_NET_ROUTE_LPM)
+	if (!route_lpm_degraded) {
+		found = route_lpm_lookup(iface, dst);
+
+		if (found) {
+			net_route_info("Found", found, dst);
+
+			update_route_access(found);
+		}
+
+		return found;
+	}
+#endif
+
 	for (i = 0; i < CONFIG_NET_MAX_ROUTES && longest_match < 128; i++) {
 		struct net_nbr *nbr = get_nbr(i);
 
@@ -403,6 +711,8 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 
 	sys_slist_prepend(&routes, &route->node);
 
+	route_lpm_add(route);
+
 	tmp = nbr_nexthop_get(iface, nexthop);
 
 	NET_ASSERT(tmp == nbr_nexthop);
@@ -456,6 +766,8 @@ int net_route_del(struct net_route_entry *route)
 
 	sys_slist_find_and_remove(&routes, &route->node);
 
+	route_lpm_del(route);
+
 	nbr = net_route_get_nbr(route);
 	if (!nbr) {
 		return -ENOENT;
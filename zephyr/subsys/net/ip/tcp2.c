@@ -32,6 +32,11 @@ static K_MEM_SLAB_DEFINE(tcp_conns_slab, sizeof(struct tcp),
 				CONFIG_NET_MAX_CONTEXTS, 4);
 
 static void tcp_in(struct tcp *conn, struct net_pkt *pkt);
+#ifdef CONFIG_NET_TCP2_OOO_QUEUE
+static void tcp_ooo_flush(struct tcp *conn);
+#else
+#define tcp_ooo_flush(_conn)
+#endif
 
 int (*tcp_send_cb)(struct net_pkt *pkt) = NULL;
 size_t (*tcp_recv_cb)(struct tcp *conn, struct net_pkt *pkt) = NULL;
@@ -169,6 +174,53 @@ static int tcp_endpoint_set(union tcp_endpoint *ep, struct net_pkt *pkt,
 	return ret;
 }
 
+#if defined(CONFIG_NET_TCP2_CONN_HASH)
+/* Connections with their endpoints set are additionally indexed by a
+ * hash over both endpoints, so the per-segment lookup does not scan
+ * the global connection list. Listening connections have no remote
+ * endpoint and are not in the table; they are found through their
+ * registered net_conn handler as before.
+ */
+static sys_slist_t tcp_conn_buckets[CONFIG_NET_TCP2_CONN_HASH_BUCKETS];
+
+static uint32_t tcp_conn_hash(union tcp_endpoint *src, union tcp_endpoint *dst)
+{
+	size_t len = tcp_endpoint_len(src->sa.sa_family);
+	const uint8_t *data = (const uint8_t *)src;
+	uint32_t hash = 5381;
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		hash = hash * 33 + data[i];
+	}
+
+	data = (const uint8_t *)dst;
+
+	for (i = 0; i < len; i++) {
+		hash = hash * 33 + data[i];
+	}
+
+	return hash % CONFIG_NET_TCP2_CONN_HASH_BUCKETS;
+}
+
+static void tcp_conn_hash_add(struct tcp *conn)
+{
+	sys_slist_prepend(&tcp_conn_buckets[tcp_conn_hash(&conn->src,
+							  &conn->dst)],
+			  &conn->hash_node);
+}
+
+static void tcp_conn_hash_del(struct tcp *conn)
+{
+	sys_slist_find_and_remove(&tcp_conn_buckets[tcp_conn_hash(&conn->src,
+								  &conn->dst)],
+				  &conn->hash_node);
+}
+#else
+#define tcp_conn_hash_add(_conn)
+#define tcp_conn_hash_del(_conn)
+#endif /* CONFIG_NET_TCP2_CONN_HASH */
+
 static const char *tcp_flags(uint8_t flags)
 {
 #define BUF_SIZE 25 /* 6 * 4 + 1 */
@@ -318,6 +370,7 @@ static int tcp_conn_unref(struct tcp *conn)
 	net_context_unref(conn->context);
 
 	tcp_send_queue_flush(conn);
+	tcp_ooo_flush(conn);
 
 	if (k_delayed_work_remaining_get(&conn->send_data_timer)) {
 		k_delayed_work_cancel(&conn->send_data_timer);
@@ -326,6 +379,34 @@ static int tcp_conn_unref(struct tcp *conn)
 
 	k_delayed_work_cancel(&conn->timewait_timer);
 
+#ifdef CONFIG_NET_TCP2_AUTOCORK
+	k_delayed_work_cancel(&conn->autocork_timer);
+#endif
+
+#ifdef CONFIG_NET_TCP2_CONG_CTRL
+	k_delayed_work_cancel(&conn->pacing_timer);
+#endif
+
+#ifdef CONFIG_NET_TCP2_BACKLOG
+	{
+		struct tcp *iter;
+
+		/* Handshake did not complete, release the backlog slot */
+		if (conn->listener && conn->listener->syn_backlog > 0U) {
+			conn->listener->syn_backlog--;
+		}
+
+		/* Orphan embryonic connections of a dying listener */
+		SYS_SLIST_FOR_EACH_CONTAINER(&tcp_conns, iter, next) {
+			if (iter->listener == conn) {
+				iter->listener = NULL;
+			}
+		}
+	}
+#endif
+
+	tcp_conn_hash_del(conn);
+
 	sys_slist_find_and_remove(&tcp_conns, (sys_snode_t *)conn);
 
 	memset(conn, 0, sizeof(*conn));
@@ -476,6 +557,10 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	recv_options->mss_found = false;
 	recv_options->wnd_found = false;
+#ifdef CONFIG_NET_TCP2_SACK
+	recv_options->sack_perm_found = false;
+	recv_options->sack_count = 0U;
+#endif
 
 	for ( ; len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -519,9 +604,41 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 				goto end;
 			}
 
-			recv_options->window = opt;
+			recv_options->window = options[2];
 			recv_options->wnd_found = true;
 			break;
+#ifdef CONFIG_NET_TCP2_SACK
+		case TCPOPT_SACK_PERM:
+			if (opt_len != 2) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_perm_found = true;
+			break;
+		case TCPOPT_SACK: {
+			uint8_t blocks;
+
+			if (opt_len < 10 || ((opt_len - 2) % 8) != 0) {
+				result = false;
+				goto end;
+			}
+
+			blocks = MIN((opt_len - 2U) / 8U, TCP_SACK_RANGES_MAX);
+
+			for (uint8_t i = 0; i < blocks; i++) {
+				recv_options->sack[i].left =
+					ntohl(UNALIGNED_GET((uint32_t *)
+						(options + 2 + i * 8)));
+				recv_options->sack[i].right =
+					ntohl(UNALIGNED_GET((uint32_t *)
+						(options + 6 + i * 8)));
+			}
+
+			recv_options->sack_count = blocks;
+			break;
+		}
+#endif /* CONFIG_NET_TCP2_SACK */
 		default:
 			continue;
 		}
@@ -567,6 +684,175 @@ static size_t tcp_data_get(struct tcp *conn, struct net_pkt *pkt)
 	return len;
 }
 
+#ifdef CONFIG_NET_TCP2_OOO_QUEUE
+static void tcp_ooo_flush(struct tcp *conn)
+{
+	struct net_pkt *pkt;
+
+	while ((pkt = tcp_slist(&conn->ooo_queue, get, struct net_pkt,
+				next))) {
+		tcp_pkt_unref(pkt);
+	}
+
+	conn->ooo_len = 0U;
+}
+
+/* Park a data segment received above conn->ack until the gap is filled */
+static void tcp_ooo_queue(struct tcp *conn, struct net_pkt *pkt)
+{
+	uint32_t seq = th_seq(th_get(pkt));
+	struct net_pkt *queued;
+
+	if (conn->ooo_len >= CONFIG_NET_TCP2_OOO_QUEUE_LEN) {
+		return;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&conn->ooo_queue, queued, next) {
+		if (th_seq(th_get(queued)) == seq) {
+			return; /* this segment is already parked */
+		}
+	}
+
+	tcp_pkt_ref(pkt);
+	sys_slist_append(&conn->ooo_queue, &pkt->next);
+	conn->ooo_len++;
+
+	NET_DBG("conn: %p, parked Seq=%u, queued=%hhu", conn, seq,
+		conn->ooo_len);
+}
+
+/* Deliver parked segments that fill the gap at conn->ack. Segments
+ * that start below conn->ack by the time the gap closes are dropped:
+ * anything not yet delivered out of them stays unacknowledged and is
+ * covered by the peer's retransmission.
+ */
+static void tcp_ooo_deliver(struct tcp *conn)
+{
+	struct net_pkt *pkt, *tmp;
+	bool progress = true;
+
+	while (progress) {
+		progress = false;
+
+		SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&conn->ooo_queue, pkt, tmp,
+						  next) {
+			uint32_t seq = th_seq(th_get(pkt));
+			size_t len = tcp_data_len(pkt);
+
+			if (seq == conn->ack) {
+				sys_slist_find_and_remove(&conn->ooo_queue,
+							  &pkt->next);
+				conn->ooo_len--;
+
+				if (tcp_data_get(conn, pkt) >= 0) {
+					conn_ack(conn, + len);
+					progress = true;
+				}
+
+				tcp_pkt_unref(pkt);
+			} else if (!net_tcp_seq_greater(seq, conn->ack)) {
+				sys_slist_find_and_remove(&conn->ooo_queue,
+							  &pkt->next);
+				conn->ooo_len--;
+				tcp_pkt_unref(pkt);
+			}
+		}
+	}
+}
+#else /* !CONFIG_NET_TCP2_OOO_QUEUE */
+#define tcp_ooo_deliver(_conn)
+#endif /* CONFIG_NET_TCP2_OOO_QUEUE */
+
+#if defined(CONFIG_NET_TCP2_SACK) && defined(CONFIG_NET_TCP2_OOO_QUEUE)
+#define TCP_SACK_BLOCKS_MAX 3
+
+/* Room needed to report the parked out-of-order segments, or 0 */
+static size_t tcp_sack_opt_len(struct tcp *conn)
+{
+	struct net_pkt *queued;
+	size_t blocks = 0U;
+
+	if (!conn->sack_enabled) {
+		return 0;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&conn->ooo_queue, queued, next) {
+		if (++blocks == TCP_SACK_BLOCKS_MAX) {
+			break;
+		}
+	}
+
+	return blocks ? 4U + blocks * 8U : 0U;
+}
+
+/* Append a SACK option describing the out-of-order queue; opt_len
+ * must come from tcp_sack_opt_len() on the same queue state.
+ */
+static int tcp_sack_opt_write(struct tcp *conn, struct net_pkt *pkt,
+			      size_t opt_len)
+{
+	uint8_t opts[4U + 8U * TCP_SACK_BLOCKS_MAX] = {
+		TCPOPT_NOP, TCPOPT_NOP, TCPOPT_SACK, opt_len - 2U
+	};
+	size_t blocks = (opt_len - 4U) / 8U;
+	struct net_pkt *queued;
+	size_t i = 0U;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&conn->ooo_queue, queued, next) {
+		uint32_t left = th_seq(th_get(queued));
+
+		if (i == blocks) {
+			break;
+		}
+
+		sys_put_be32(left, &opts[4U + i * 8U]);
+		sys_put_be32(left + tcp_data_len(queued), &opts[8U + i * 8U]);
+		i++;
+	}
+
+	return net_pkt_write(pkt, opts, opt_len);
+}
+#endif /* CONFIG_NET_TCP2_SACK && CONFIG_NET_TCP2_OOO_QUEUE */
+
+#ifdef CONFIG_NET_TCP2_WINDOW_SCALING
+/* Smallest shift that makes the maximum receive window fit in the
+ * 16-bit window field
+ */
+static uint8_t tcp_recv_win_shift(void)
+{
+	uint8_t shift = 0U;
+
+	while ((CONFIG_NET_TCP2_MAX_RECV_WINDOW >> shift) > UINT16_MAX) {
+		shift++;
+	}
+
+	return shift;
+}
+
+/* Advertise what the stack can actually buffer: when pool usage
+ * accounting is available the window follows the free space in the RX
+ * data pool, with the legacy default window as the floor so that the
+ * connection keeps draining even when the pool momentarily runs dry.
+ */
+static void tcp_recv_win_update(struct tcp *conn)
+{
+	uint32_t win = CONFIG_NET_TCP2_MAX_RECV_WINDOW;
+
+#if defined(CONFIG_NET_BUF_POOL_USAGE) && \
+	defined(CONFIG_NET_BUF_FIXED_DATA_SIZE)
+	struct net_buf_pool *rx_data, *tx_data;
+	struct k_mem_slab *rx, *tx;
+
+	net_pkt_get_info(&rx, &tx, &rx_data, &tx_data);
+
+	win = MIN(win, (uint32_t)MAX(rx_data->avail_count, 0) *
+		       CONFIG_NET_BUF_DATA_SIZE);
+#endif
+
+	conn->recv_win = MAX(win, (uint32_t)tcp_window);
+}
+#endif /* CONFIG_NET_TCP2_WINDOW_SCALING */
+
 static int tcp_finalize_pkt(struct net_pkt *pkt)
 {
 	net_pkt_cursor_init(pkt);
@@ -583,7 +869,7 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 }
 
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
-			  uint32_t seq)
+			  uint32_t seq, size_t sack_len)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct tcphdr *th;
@@ -600,13 +886,74 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 
 	th->th_off = 5;
 	th->th_flags = flags;
-	th->th_win = htons(conn->recv_win);
 	th->th_seq = htonl(seq);
 
+#ifdef CONFIG_NET_TCP2_WINDOW_SCALING
+	if (flags & SYN) {
+		/* The window field of a SYN segment is never scaled */
+		th->th_win = htons(MIN(conn->recv_win, UINT16_MAX));
+	} else {
+		uint8_t shift = conn->win_scaled ? conn->recv_win_shift : 0U;
+
+		tcp_recv_win_update(conn);
+
+		th->th_win = htons(MIN(conn->recv_win >> shift, UINT16_MAX));
+	}
+#else
+	th->th_win = htons(conn->recv_win);
+#endif
+
 	if (ACK & flags) {
 		th->th_ack = htonl(conn->ack);
 	}
 
+#if TCP_SYN_OPTS_LEN > 0
+	if (flags & SYN) {
+		uint8_t opts[TCP_SYN_OPTS_LEN];
+		uint8_t optlen = 0U;
+		int ret;
+
+#ifdef CONFIG_NET_TCP2_WINDOW_SCALING
+		opts[optlen++] = TCPOPT_NOP;
+		opts[optlen++] = TCPOPT_WINDOW;
+		opts[optlen++] = 3U;
+		opts[optlen++] = conn->recv_win_shift;
+#endif
+#ifdef CONFIG_NET_TCP2_SACK
+		opts[optlen++] = TCPOPT_NOP;
+		opts[optlen++] = TCPOPT_NOP;
+		opts[optlen++] = TCPOPT_SACK_PERM;
+		opts[optlen++] = 2U;
+#endif
+
+		th->th_off = 5U + optlen / 4U;
+
+		ret = net_pkt_set_data(pkt, &tcp_access);
+		if (ret < 0) {
+			return ret;
+		}
+
+		return net_pkt_write(pkt, opts, optlen);
+	}
+#endif /* TCP_SYN_OPTS_LEN > 0 */
+
+#if defined(CONFIG_NET_TCP2_SACK) && defined(CONFIG_NET_TCP2_OOO_QUEUE)
+	if (sack_len > 0U) {
+		int ret;
+
+		th->th_off += sack_len / 4U;
+
+		ret = net_pkt_set_data(pkt, &tcp_access);
+		if (ret < 0) {
+			return ret;
+		}
+
+		return tcp_sack_opt_write(conn, pkt, sack_len);
+	}
+#else
+	ARG_UNUSED(sack_len);
+#endif
+
 	return net_pkt_set_data(pkt, &tcp_access);
 }
 
@@ -630,10 +977,27 @@ static int ip_header_add(struct tcp *conn, struct net_pkt *pkt)
 static void tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 			uint32_t seq)
 {
+	size_t alloc_len = sizeof(struct tcphdr);
+	size_t sack_len = 0U;
 	struct net_pkt *pkt;
 	int ret;
 
-	pkt = tcp_pkt_alloc(conn, sizeof(struct tcphdr));
+	if (flags & SYN) {
+		alloc_len += TCP_SYN_OPTS_LEN;
+	}
+
+#if defined(CONFIG_NET_TCP2_SACK) && defined(CONFIG_NET_TCP2_OOO_QUEUE)
+	/* Only segments without payload report the out-of-order queue:
+	 * the option bytes are written right after the header, which
+	 * would overwrite the start of any appended data.
+	 */
+	if (!(flags & SYN) && data == NULL) {
+		sack_len = tcp_sack_opt_len(conn);
+		alloc_len += sack_len;
+	}
+#endif
+
+	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
 		goto out;
 	}
@@ -651,7 +1015,7 @@ static void tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		goto out;
 	}
 
-	ret = tcp_header_add(conn, pkt, flags, seq);
+	ret = tcp_header_add(conn, pkt, flags, seq, sack_len);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
 		goto out;
@@ -714,9 +1078,173 @@ static void tcp_pkt_peek(struct net_pkt *to, struct net_pkt *from, size_t pos,
 	net_pkt_copy(to, from, len);
 }
 
+#ifdef CONFIG_NET_TCP2_CONG_CTRL
+static int tcp_send_queued_data(struct tcp *conn);
+
+/* "none": no congestion window at all, the peer's receive window is
+ * the only limit. The cheapest possible choice for local links.
+ */
+static void cong_none_init(struct tcp *conn)
+{
+	conn->cwnd = UINT32_MAX;
+	conn->ssthresh = UINT32_MAX;
+}
+
+/* "reno": classic slow start and congestion avoidance with a window
+ * collapse on retransmission timeout, suitable for lossy bearers.
+ */
+static void cong_reno_init(struct tcp *conn)
+{
+	conn->cwnd = 4 * conn_mss(conn);
+	conn->ssthresh = UINT32_MAX;
+}
+
+static void cong_reno_on_ack(struct tcp *conn, uint32_t len_acked)
+{
+	uint16_t mss = conn_mss(conn);
+
+	if (conn->cwnd < conn->ssthresh) {
+		/* Slow start: grow by the amount acknowledged */
+		conn->cwnd += len_acked;
+	} else {
+		/* Congestion avoidance: roughly one MSS per RTT */
+		conn->cwnd += MAX((uint32_t)mss * mss / conn->cwnd, 1U);
+	}
+}
+
+static void cong_reno_on_loss(struct tcp *conn)
+{
+	uint16_t mss = conn_mss(conn);
+
+	conn->ssthresh = MAX((uint32_t)conn->unacked_len / 2, 2U * mss);
+	/* A retransmission timeout restarts from slow start */
+	conn->cwnd = mss;
+}
+
+static const struct tcp_cong_ops tcp_cong_algs[] = {
+	{ "none", cong_none_init, NULL, NULL },
+	{ "reno", cong_reno_init, cong_reno_on_ack, cong_reno_on_loss },
+};
+
+#ifdef CONFIG_NET_TCP2_CONG_DEFAULT_RENO
+#define TCP_CONG_DEFAULT 1
+#else
+#define TCP_CONG_DEFAULT 0
+#endif
+
+int net_tcp_cong_lookup(const char *name, size_t len)
+{
+	for (int i = 0; i < ARRAY_SIZE(tcp_cong_algs); i++) {
+		if (strlen(tcp_cong_algs[i].name) == len &&
+		    strncmp(tcp_cong_algs[i].name, name, len) == 0) {
+			return i;
+		}
+	}
+
+	return -ENOENT;
+}
+
+const char *net_tcp_cong_name(uint8_t option)
+{
+	/* Option value 0 selects the build-time default */
+	if (option == 0U || option > ARRAY_SIZE(tcp_cong_algs)) {
+		return tcp_cong_algs[TCP_CONG_DEFAULT].name;
+	}
+
+	return tcp_cong_algs[option - 1].name;
+}
+
+/* Resolve the context's algorithm selection once the connection is
+ * established: the MSS is known by then and the option can no longer
+ * change the algorithm mid-flight.
+ */
+static void conn_cong_establish(struct tcp *conn)
+{
+	uint8_t option = conn->context != NULL ?
+		conn->context->options.tcp_cong : 0U;
+
+	if (option == 0U || option > ARRAY_SIZE(tcp_cong_algs)) {
+		conn->cong = &tcp_cong_algs[TCP_CONG_DEFAULT];
+	} else {
+		conn->cong = &tcp_cong_algs[option - 1];
+	}
+
+	conn->cong->init(conn);
+}
+
+static void conn_cong_on_ack(struct tcp *conn, uint32_t len_acked)
+{
+	if (conn->cong->on_ack != NULL) {
+		conn->cong->on_ack(conn, len_acked);
+	}
+}
+
+static void conn_cong_on_loss(struct tcp *conn)
+{
+	if (conn->cong->on_loss != NULL) {
+		conn->cong->on_loss(conn);
+	}
+}
+
+static uint32_t tcp_effective_send_win(struct tcp *conn)
+{
+	return MIN(conn->send_win, conn->cwnd);
+}
+
+/* Inter-segment delay implementing the pacing rate set on the owning
+ * context, zero when pacing is off.
+ */
+static uint32_t tcp_pacing_delay_ms(struct tcp *conn)
+{
+	uint32_t rate = conn->context != NULL ?
+		conn->context->options.tcp_pacing_rate : 0U;
+
+	if (rate == 0U) {
+		return 0U;
+	}
+
+	return MAX((uint32_t)conn_mss(conn) * 1000U / rate, 1U);
+}
+
+/* The pacing gap has elapsed: release the next segment */
+static void tcp_pacing_timeout(struct k_work *work)
+{
+	struct tcp *conn = CONTAINER_OF(work, struct tcp, pacing_timer);
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	if (conn->state == TCP_ESTABLISHED) {
+		tcp_send_queued_data(conn);
+	}
+
+	k_mutex_unlock(&conn->lock);
+}
+#else /* CONFIG_NET_TCP2_CONG_CTRL */
+static void conn_cong_establish(struct tcp *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static void conn_cong_on_ack(struct tcp *conn, uint32_t len_acked)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(len_acked);
+}
+
+static void conn_cong_on_loss(struct tcp *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static uint32_t tcp_effective_send_win(struct tcp *conn)
+{
+	return conn->send_win;
+}
+#endif /* CONFIG_NET_TCP2_CONG_CTRL */
+
 static bool tcp_window_full(struct tcp *conn)
 {
-	bool window_full = !(conn->unacked_len < conn->send_win);
+	bool window_full = !(conn->unacked_len < tcp_effective_send_win(conn));
 
 	NET_DBG("conn: %p window_full=%hu", conn, window_full);
 
@@ -749,7 +1277,7 @@ static int tcp_send_data(struct tcp *conn)
 
 	pos = conn->unacked_len;
 	len = MIN3(conn->send_data_total - conn->unacked_len,
-		   conn->send_win - conn->unacked_len,
+		   tcp_effective_send_win(conn) - conn->unacked_len,
 		   conn_mss(conn));
 
 	pkt = tcp_pkt_alloc(conn, len);
@@ -792,6 +1320,21 @@ static int tcp_send_queued_data(struct tcp *conn)
 		if (ret < 0) {
 			break;
 		}
+
+#ifdef CONFIG_NET_TCP2_CONG_CTRL
+		if (tcp_unsent_len(conn) > 0) {
+			uint32_t delay = tcp_pacing_delay_ms(conn);
+
+			/* Space out the remaining segments instead of
+			 * bursting up to the window edge.
+			 */
+			if (delay > 0U) {
+				k_delayed_work_submit(&conn->pacing_timer,
+						      K_MSEC(delay));
+				break;
+			}
+		}
+#endif
 	}
 
 	if (conn->unacked_len) {
@@ -810,6 +1353,61 @@ static int tcp_send_queued_data(struct tcp *conn)
 	return ret;
 }
 
+#ifdef CONFIG_NET_TCP2_SACK
+/* Retransmit only the ranges of send_data the peer has not
+ * selectively acknowledged. Returns the number of bytes resent.
+ */
+static int tcp_resend_missing(struct tcp *conn)
+{
+	size_t pos = 0U;
+	int resent = 0;
+
+	while (pos < conn->send_data_total) {
+		uint32_t seq = conn->seq + pos;
+		size_t len = MIN(conn->send_data_total - pos, conn_mss(conn));
+		struct net_pkt *pkt;
+		bool sacked = false;
+
+		for (uint8_t i = 0; i < conn->sacked_count; i++) {
+			struct tcp_sack_range *range = &conn->sacked[i];
+
+			if (!net_tcp_seq_greater(range->left, seq) &&
+			    net_tcp_seq_greater(range->right, seq)) {
+				/* seq held by the peer: skip the range */
+				pos += range->right - seq;
+				sacked = true;
+				break;
+			}
+
+			if (net_tcp_seq_greater(range->left, seq)) {
+				/* Clip the segment at the next held range */
+				len = MIN(len, range->left - seq);
+			}
+		}
+
+		if (sacked) {
+			continue;
+		}
+
+		pkt = tcp_pkt_alloc(conn, len);
+		if (!pkt) {
+			break;
+		}
+
+		tcp_pkt_peek(pkt, conn->send_data, pos, len);
+
+		tcp_out_ext(conn, PSH | ACK, pkt, seq);
+
+		resent += len;
+		pos += len;
+	}
+
+	conn->unacked_len += resent;
+
+	return resent;
+}
+#endif /* CONFIG_NET_TCP2_SACK */
+
 static void tcp_resend_data(struct k_work *work)
 {
 	struct tcp *conn = CONTAINER_OF(work, struct tcp, send_data_timer);
@@ -825,7 +1423,17 @@ static void tcp_resend_data(struct k_work *work)
 
 	conn->data_mode = TCP_DATA_MODE_RESEND;
 	conn->unacked_len = 0;
+	conn_cong_on_loss(conn);
+
+#ifdef CONFIG_NET_TCP2_SACK
+	if (conn->sack_enabled && conn->sacked_count > 0U) {
+		tcp_resend_missing(conn);
+	} else {
+		tcp_send_data(conn);
+	}
+#else
 	tcp_send_data(conn);
+#endif
 
 	conn->send_data_retries++;
 	k_delayed_work_submit(&conn->send_data_timer, K_MSEC(tcp_rto));
@@ -844,6 +1452,24 @@ static void tcp_timewait_timeout(struct k_work *work)
 	tcp_conn_unref(conn);
 }
 
+#ifdef CONFIG_NET_TCP2_AUTOCORK
+/* The autocork hold-back time is up: push out whatever partial
+ * segment is still queued.
+ */
+static void tcp_autocork_timeout(struct k_work *work)
+{
+	struct tcp *conn = CONTAINER_OF(work, struct tcp, autocork_timer);
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	if (conn->state == TCP_ESTABLISHED) {
+		tcp_send_queued_data(conn);
+	}
+
+	k_mutex_unlock(&conn->lock);
+}
+#endif
+
 static void tcp_conn_ref(struct tcp *conn)
 {
 	int ref_count = atomic_inc(&conn->ref_count) + 1;
@@ -869,11 +1495,19 @@ static struct tcp *tcp_conn_alloc(void)
 
 	conn->recv_win = tcp_window;
 
+#ifdef CONFIG_NET_TCP2_WINDOW_SCALING
+	conn->recv_win_shift = tcp_recv_win_shift();
+#endif
+
 	conn->seq = (IS_ENABLED(CONFIG_NET_TEST_PROTOCOL) ||
 		     IS_ENABLED(CONFIG_NET_TEST)) ? 0 : sys_rand32_get();
 
 	sys_slist_init(&conn->send_queue);
 
+#ifdef CONFIG_NET_TCP2_OOO_QUEUE
+	sys_slist_init(&conn->ooo_queue);
+#endif
+
 	k_delayed_work_init(&conn->send_timer, tcp_send_process);
 
 	k_delayed_work_init(&conn->timewait_timer, tcp_timewait_timeout);
@@ -881,6 +1515,20 @@ static struct tcp *tcp_conn_alloc(void)
 	conn->send_data = tcp_pkt_alloc(conn, 0);
 	k_delayed_work_init(&conn->send_data_timer, tcp_resend_data);
 
+#ifdef CONFIG_NET_TCP2_AUTOCORK
+	k_delayed_work_init(&conn->autocork_timer, tcp_autocork_timeout);
+#endif
+
+#ifdef CONFIG_NET_TCP2_CONG_CTRL
+	/* Unclamped until the handshake completes and the context's
+	 * algorithm selection is resolved.
+	 */
+	conn->cong = &tcp_cong_algs[TCP_CONG_DEFAULT];
+	conn->cwnd = UINT32_MAX;
+	conn->ssthresh = UINT32_MAX;
+	k_delayed_work_init(&conn->pacing_timer, tcp_pacing_timeout);
+#endif
+
 	k_sem_init(&conn->connect_sem, 0, UINT_MAX);
 	conn->in_connect = false;
 
@@ -913,6 +1561,7 @@ out:
 	return ret;
 }
 
+#if !defined(CONFIG_NET_TCP2_CONN_HASH)
 static bool tcp_endpoint_cmp(union tcp_endpoint *ep, struct net_pkt *pkt,
 			     enum pkt_addr which)
 {
@@ -930,9 +1579,36 @@ static bool tcp_conn_cmp(struct tcp *conn, struct net_pkt *pkt)
 	return tcp_endpoint_cmp(&conn->src, pkt, TCP_EP_DST) &&
 		tcp_endpoint_cmp(&conn->dst, pkt, TCP_EP_SRC);
 }
+#endif /* !CONFIG_NET_TCP2_CONN_HASH */
 
 static struct tcp *tcp_conn_search(struct net_pkt *pkt)
 {
+#if defined(CONFIG_NET_TCP2_CONN_HASH)
+	union tcp_endpoint ep_src, ep_dst;
+	struct tcp *conn;
+	size_t len;
+
+	/* The packet endpoints are parsed once here instead of once
+	 * per compared connection.
+	 */
+	if (tcp_endpoint_set(&ep_src, pkt, TCP_EP_DST) < 0 ||
+	    tcp_endpoint_set(&ep_dst, pkt, TCP_EP_SRC) < 0) {
+		return NULL;
+	}
+
+	len = tcp_endpoint_len(ep_src.sa.sa_family);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&tcp_conn_buckets[tcp_conn_hash(&ep_src,
+								     &ep_dst)],
+				     conn, hash_node) {
+		if (memcmp(&conn->src, &ep_src, len) == 0 &&
+		    memcmp(&conn->dst, &ep_dst, len) == 0) {
+			return conn;
+		}
+	}
+
+	return NULL;
+#else
 	bool found = false;
 	struct tcp *conn;
 
@@ -945,6 +1621,7 @@ static struct tcp *tcp_conn_search(struct net_pkt *pkt)
 	}
 
 	return found ? conn : NULL;
+#endif
 }
 
 static struct tcp *tcp_conn_new(struct net_pkt *pkt);
@@ -971,14 +1648,33 @@ static enum net_verdict tcp_recv(struct net_conn *net_conn,
 	if (th->th_flags & SYN && !(th->th_flags & ACK)) {
 		struct tcp *conn_old = ((struct net_context *)user_data)->tcp;
 
+#ifdef CONFIG_NET_TCP2_BACKLOG
+		if (conn_old->syn_backlog >= CONFIG_NET_TCP2_BACKLOG_SIZE) {
+			/* The peer will retransmit the SYN */
+			NET_DBG("conn: %p, SYN backlog full", conn_old);
+			return NET_DROP;
+		}
+#endif
+
 		conn = tcp_conn_new(pkt);
+		if (conn == NULL) {
+			return NET_DROP;
+		}
 
+#ifdef CONFIG_NET_TCP2_BACKLOG
+		/* The accept callback runs when the handshake completes,
+		 * see TCP_SYN_RECEIVED in tcp_in().
+		 */
+		conn->listener = conn_old;
+		conn_old->syn_backlog++;
+#else
 		net_ipaddr_copy(&conn_old->context->remote, &conn->dst.sa);
 
 		conn_old->accept_cb(conn->context,
 				    &conn_old->context->remote,
 				    sizeof(struct sockaddr), 0,
 				    conn_old->context);
+#endif
 	}
  in:
 	if (conn) {
@@ -1022,6 +1718,8 @@ static struct tcp *tcp_conn_new(struct net_pkt *pkt)
 		goto err;
 	}
 
+	tcp_conn_hash_add(conn);
+
 	NET_DBG("conn: src: %s, dst: %s",
 		log_strdup(net_sprint_addr(conn->src.sa.sa_family,
 				(const void *)&conn->src.sin.sin_addr)),
@@ -1099,9 +1797,40 @@ static void tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		goto next_state;
 	}
 
+#ifdef CONFIG_NET_TCP2_SACK
+	if (th && (fl & SYN) && conn->recv_options.sack_perm_found) {
+		conn->sack_enabled = true;
+	}
+
+	if (th && conn->sack_enabled) {
+		/* Every ACK reflects the peer's current scoreboard */
+		if (tcp_options_len > 0) {
+			memcpy(conn->sacked, conn->recv_options.sack,
+			       sizeof(conn->sacked));
+			conn->sacked_count = conn->recv_options.sack_count;
+		} else {
+			conn->sacked_count = 0U;
+		}
+	}
+#endif /* CONFIG_NET_TCP2_SACK */
+
+#ifdef CONFIG_NET_TCP2_WINDOW_SCALING
+	if (th && (fl & SYN) && conn->recv_options.wnd_found) {
+		/* RFC 7323 limits the shift to 14 */
+		conn->send_win_shift = MIN(conn->recv_options.window, 14);
+		conn->win_scaled = true;
+	}
+
+	if (th) {
+		conn->send_win = (uint32_t)ntohs(th->th_win) <<
+			((conn->win_scaled && !(fl & SYN)) ?
+			 conn->send_win_shift : 0U);
+	}
+#else
 	if (th) {
 		conn->send_win = ntohs(th->th_win);
 	}
+#endif
 
 	if (FL(&fl, &, RST)) {
 		conn_state(conn, TCP_CLOSED);
@@ -1127,9 +1856,38 @@ next_state:
 				th_seq(th) == conn->ack)) {
 			tcp_send_timer_cancel(conn);
 			next = TCP_ESTABLISHED;
+			conn_cong_establish(conn);
 			net_context_set_state(conn->context,
 					      NET_CONTEXT_CONNECTED);
 
+#ifdef CONFIG_NET_TCP2_BACKLOG
+			/* Handshake complete: release the backlog slot
+			 * and only now surface the connection to the
+			 * listening socket.
+			 */
+			if (conn->listener) {
+				struct tcp *listener;
+				int key = irq_lock();
+
+				listener = conn->listener;
+				conn->listener = NULL;
+
+				if (listener->syn_backlog > 0U) {
+					listener->syn_backlog--;
+				}
+
+				irq_unlock(key);
+
+				if (listener->accept_cb) {
+					listener->accept_cb(
+						conn->context,
+						&conn->context->remote,
+						sizeof(struct sockaddr), 0,
+						listener->context);
+				}
+			}
+#endif
+
 			if (len) {
 				if (tcp_data_get(conn, pkt) < 0) {
 					break;
@@ -1155,6 +1913,7 @@ next_state:
 			}
 			k_sem_give(&conn->connect_sem);
 			next = TCP_ESTABLISHED;
+			conn_cong_establish(conn);
 			net_context_set_state(conn->context,
 					      NET_CONTEXT_CONNECTED);
 			tcp_out(conn, ACK);
@@ -1193,6 +1952,7 @@ next_state:
 			conn->send_data_total -= len_acked;
 			conn->unacked_len -= len_acked;
 			conn_seq(conn, + len_acked);
+			conn_cong_on_ack(conn, len_acked);
 
 			conn_send_data_dump(conn);
 
@@ -1223,9 +1983,16 @@ next_state:
 					break;
 				}
 				conn_ack(conn, + len);
+				tcp_ooo_deliver(conn);
 				tcp_out(conn, ACK);
 			} else if (net_tcp_seq_greater(conn->ack, th_seq(th))) {
 				tcp_out(conn, ACK); /* peer has resent */
+#ifdef CONFIG_NET_TCP2_OOO_QUEUE
+			} else {
+				tcp_ooo_queue(conn, pkt);
+				/* Duplicate ACK points the peer at the gap */
+				tcp_out(conn, ACK);
+#endif
 			}
 		}
 		break;
@@ -1353,6 +2120,28 @@ int net_tcp_queue_data(struct net_context *context, struct net_pkt *pkt)
 	pkt->buffer = NULL;
 	tcp_pkt_unref(pkt);
 
+#ifdef CONFIG_NET_TCP2_AUTOCORK
+	if (!context->options.tcp_nodelay &&
+	    (context->options.tcp_cork ||
+	     (conn->unacked_len > 0 &&
+	      tcp_unsent_len(conn) < conn_mss(conn)))) {
+		/* Hold back the partial segment: either the connection
+		 * is corked, or data is in flight and what is queued
+		 * does not yet fill a segment (Nagle). The autocork
+		 * timer bounds the delay when not corked; an incoming
+		 * ACK flushes the queue earlier.
+		 */
+		if (!context->options.tcp_cork) {
+			k_delayed_work_submit(
+				&conn->autocork_timer,
+				K_MSEC(CONFIG_NET_TCP2_AUTOCORK_TIMEOUT));
+		}
+
+		k_mutex_unlock(&conn->lock);
+		goto out;
+	}
+#endif
+
 	ret = tcp_send_queued_data(conn);
 	if (ret < 0) {
 		k_mutex_unlock(&conn->lock);
@@ -1449,6 +2238,8 @@ int net_tcp_connect(struct net_context *context,
 		ret = -EPROTONOSUPPORT;
 	}
 
+	tcp_conn_hash_add(conn);
+
 	NET_DBG("conn: %p src: %s, dst: %s", conn,
 		log_strdup(net_sprint_addr(conn->src.sa.sa_family,
 				(const void *)&conn->src.sin.sin_addr)),
@@ -1637,6 +2428,7 @@ static enum net_verdict tcp_input(struct net_conn *net_conn,
 			conn = context->tcp;
 			tcp_endpoint_set(&conn->dst, pkt, TCP_EP_SRC);
 			tcp_endpoint_set(&conn->src, pkt, TCP_EP_DST);
+			tcp_conn_hash_add(conn);
 			/* Make an extra reference, the sanity check suite
 			 * will delete the connection explicitly
 			 */
@@ -1758,6 +2550,7 @@ enum net_verdict tp_input(struct net_conn *net_conn,
 				conn = context->tcp;
 				tcp_endpoint_set(&conn->dst, pkt, TCP_EP_SRC);
 				tcp_endpoint_set(&conn->src, pkt, TCP_EP_DST);
+				tcp_conn_hash_add(conn);
 				conn->iface = pkt->iface;
 				tcp_conn_ref(conn);
 			}
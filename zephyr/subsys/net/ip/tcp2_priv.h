@@ -96,7 +96,7 @@
 #define conn_send_data_dump(_conn)					\
 ({									\
 	NET_DBG("conn: %p total=%zd, unacked_len=%d, "			\
-		"send_win=%hu, mss=%hu",				\
+		"send_win=%u, mss=%hu",				\
 		(_conn), net_pkt_get_len((_conn)->send_data),		\
 		conn->unacked_len, conn->send_win,			\
 		conn_mss((_conn)));					\
@@ -110,6 +110,23 @@
 #define TCPOPT_NOP	1
 #define TCPOPT_MAXSEG	2
 #define TCPOPT_WINDOW	3
+#define TCPOPT_SACK_PERM	4
+#define TCPOPT_SACK	5
+
+/* Length of the options appended to a SYN segment */
+#ifdef CONFIG_NET_TCP2_WINDOW_SCALING
+#define TCP_OPT_WS_LEN 4
+#else
+#define TCP_OPT_WS_LEN 0
+#endif
+#ifdef CONFIG_NET_TCP2_SACK
+#define TCP_OPT_SACK_PERM_LEN 4
+#else
+#define TCP_OPT_SACK_PERM_LEN 0
+#endif
+#define TCP_SYN_OPTS_LEN (TCP_OPT_WS_LEN + TCP_OPT_SACK_PERM_LEN)
+
+#define TCP_SACK_RANGES_MAX 4
 
 enum pkt_addr {
 	TCP_EP_SRC = 1,
@@ -169,15 +186,49 @@ union tcp_endpoint {
 	struct sockaddr_in6 sin6;
 };
 
+#ifdef CONFIG_NET_TCP2_SACK
+struct tcp_sack_range { /* half-open range [left, right) */
+	uint32_t left;
+	uint32_t right;
+};
+#endif
+
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
 	bool mss_found : 1;
 	bool wnd_found : 1;
+#ifdef CONFIG_NET_TCP2_SACK
+	bool sack_perm_found : 1;
+	uint8_t sack_count;
+	struct tcp_sack_range sack[TCP_SACK_RANGES_MAX];
+#endif
+};
+
+#ifdef CONFIG_NET_TCP2_CONG_CTRL
+struct tcp;
+
+/* Per-connection congestion control module. Algorithms only steer the
+ * congestion window; the send machinery clamps the effective window to
+ * MIN(peer window, cwnd) and paces segments off the timer wheel when a
+ * pacing rate is set on the owning context.
+ */
+struct tcp_cong_ops {
+	const char *name;
+	/* Called when the connection reaches ESTABLISHED */
+	void (*init)(struct tcp *conn);
+	/* Called for every ACK advancing the send window */
+	void (*on_ack)(struct tcp *conn, uint32_t len_acked);
+	/* Called when the retransmission timer fires */
+	void (*on_loss)(struct tcp *conn);
 };
+#endif
 
 struct tcp { /* TCP connection */
 	sys_snode_t next;
+#ifdef CONFIG_NET_TCP2_CONN_HASH
+	sys_snode_t hash_node;
+#endif
 	struct net_context *context;
 	struct k_mutex lock;
 	void *recv_user_data;
@@ -186,8 +237,13 @@ struct tcp { /* TCP connection */
 	uint32_t ack;
 	union tcp_endpoint src;
 	union tcp_endpoint dst;
-	uint16_t recv_win;
-	uint16_t send_win;
+	uint32_t recv_win;
+	uint32_t send_win;
+#ifdef CONFIG_NET_TCP2_WINDOW_SCALING
+	uint8_t recv_win_shift;
+	uint8_t send_win_shift;
+	bool win_scaled;
+#endif
 	struct tcp_options recv_options;
 	struct k_delayed_work send_timer;
 	sys_slist_t send_queue;
@@ -200,10 +256,36 @@ struct tcp { /* TCP connection */
 	bool in_retransmission;
 	size_t send_retries;
 	struct k_delayed_work timewait_timer;
+#ifdef CONFIG_NET_TCP2_AUTOCORK
+	struct k_delayed_work autocork_timer;
+#endif
+#ifdef CONFIG_NET_TCP2_CONG_CTRL
+	const struct tcp_cong_ops *cong;
+	uint32_t cwnd;
+	uint32_t ssthresh;
+	struct k_delayed_work pacing_timer;
+#endif
+#ifdef CONFIG_NET_TCP2_OOO_QUEUE
+	sys_slist_t ooo_queue;
+	uint8_t ooo_len;
+#endif
+#ifdef CONFIG_NET_TCP2_SACK
+	bool sack_enabled;
+	uint8_t sacked_count;
+	struct tcp_sack_range sacked[TCP_SACK_RANGES_MAX];
+#endif
 	struct net_if *iface;
 	struct k_sem connect_sem; /* semaphore for blocking connect */
 	bool in_connect;
 	net_tcp_accept_cb_t accept_cb;
+#ifdef CONFIG_NET_TCP2_BACKLOG
+	/* Listener this embryonic connection was derived from, NULL
+	 * once the handshake has completed (or for other connections).
+	 */
+	struct tcp *listener;
+	/* On a listener, the number of embryonic connections */
+	uint8_t syn_backlog;
+#endif
 	atomic_t ref_count;
 };
 
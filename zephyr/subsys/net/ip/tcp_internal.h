@@ -661,6 +661,27 @@ static inline int net_tcp_update_recv_wnd(struct net_context *context,
 }
 #endif
 
+#if defined(CONFIG_NET_TCP2_CONG_CTRL)
+/**
+ * @brief Look up a congestion control algorithm by name
+ *
+ * @param name Algorithm name, not necessarily NUL terminated
+ * @param len Length of the name
+ *
+ * @return Algorithm index, or -ENOENT if no such algorithm
+ */
+int net_tcp_cong_lookup(const char *name, size_t len);
+
+/**
+ * @brief Resolve a context's algorithm option value to a name
+ *
+ * @param option Stored option value; 0 selects the build-time default
+ *
+ * @return Algorithm name
+ */
+const char *net_tcp_cong_name(uint8_t option);
+#endif
+
 /**
  * @brief Initialize TCP parts of a context
  *
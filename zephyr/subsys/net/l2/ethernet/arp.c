@@ -23,6 +23,15 @@ LOG_MODULE_REGISTER(net_arp, CONFIG_NET_ARP_LOG_LEVEL);
 #define NET_BUF_TIMEOUT K_MSEC(100)
 #define ARP_REQUEST_TIMEOUT (2 * MSEC_PER_SEC)
 
+#if defined(CONFIG_NET_ARP_NEGATIVE_CACHE)
+#define ARP_NEGATIVE_BACKOFF_MAX (64 * MSEC_PER_SEC)
+#endif
+
+#if defined(CONFIG_NET_ARP_CACHE_REFRESH)
+#define ARP_CACHE_LIFETIME (CONFIG_NET_ARP_CACHE_LIFETIME * MSEC_PER_SEC)
+#define ARP_REFRESH_CHECK_INTERVAL (ARP_CACHE_LIFETIME / 4)
+#endif
+
 static bool arp_cache_initialized;
 static struct arp_entry arp_entries[CONFIG_NET_ARP_TABLE_SIZE];
 
@@ -32,22 +41,49 @@ static sys_slist_t arp_table;
 
 struct k_delayed_work arp_request_timer;
 
+#if defined(CONFIG_NET_ARP_CACHE_REFRESH)
+static struct k_delayed_work arp_refresh_timer;
+#endif
+
+#if defined(CONFIG_NET_ARP_NEGATIVE_CACHE)
+static uint32_t arp_negative_backoff(struct arp_entry *entry)
+{
+	uint8_t shift = MIN(entry->failures, 5);
+
+	return MIN((uint32_t)ARP_REQUEST_TIMEOUT << shift,
+		   ARP_NEGATIVE_BACKOFF_MAX);
+}
+#endif
+
+static void arp_pending_drain(struct arp_entry *entry)
+{
+	for (uint8_t i = 0U; i < entry->pending_count; i++) {
+		NET_DBG("Releasing pending pkt %p (ref %d)",
+			entry->pending[i],
+			atomic_get(&entry->pending[i]->atomic_ref) - 1);
+		net_pkt_unref(entry->pending[i]);
+		entry->pending[i] = NULL;
+	}
+
+	entry->pending_count = 0U;
+}
+
 static void arp_entry_cleanup(struct arp_entry *entry, bool pending)
 {
 	NET_DBG("%p", entry);
 
 	if (pending) {
-		NET_DBG("Releasing pending pkt %p (ref %d)",
-			entry->pending,
-			atomic_get(&entry->pending->atomic_ref) - 1);
-		net_pkt_unref(entry->pending);
-		entry->pending = NULL;
+		arp_pending_drain(entry);
 	}
 
 	entry->iface = NULL;
 
 	(void)memset(&entry->ip, 0, sizeof(struct in_addr));
 	(void)memset(&entry->eth, 0, sizeof(struct net_eth_addr));
+#if defined(CONFIG_NET_ARP_NEGATIVE_CACHE)
+	entry->failures = 0U;
+	entry->negative = false;
+#endif
 }
 
 static struct arp_entry *arp_entry_find(sys_slist_t *list,
@@ -191,10 +227,27 @@ static void arp_request_timeout(struct k_work *work)
 			break;
 		}
 
-		arp_entry_cleanup(entry, true);
-
 		sys_slist_remove(&arp_pending_entries, NULL, &entry->node);
+
+#if defined(CONFIG_NET_ARP_NEGATIVE_CACHE)
+		/* Keep the entry as a negative one so that subsequent
+		 * sends to this address are dropped immediately until
+		 * the backoff expires, instead of allocating and
+		 * queueing packets that can never be delivered.
+		 */
+		arp_pending_drain(entry);
+
+		if (entry->failures < UINT8_MAX) {
+			entry->failures++;
+		}
+
+		entry->negative = true;
+		entry->req_start = current;
+		sys_slist_prepend(&arp_table, &entry->node);
+#else
+		arp_entry_cleanup(entry, true);
 		sys_slist_append(&arp_free_entries, &entry->node);
+#endif
 
 		entry = NULL;
 	}
@@ -240,7 +293,7 @@ static inline struct net_pkt *arp_prepare(struct net_if *iface,
 	struct in_addr *my_addr;
 	struct net_pkt *pkt;
 
-	if (current_ip) {
+	if (current_ip && pending) {
 		/* This is the IPv4 autoconf case where we have already
 		 * things setup so no need to allocate new net_pkt
 		 */
@@ -266,7 +319,9 @@ static inline struct net_pkt *arp_prepare(struct net_if *iface,
 	 * request and we want to send it again.
 	 */
 	if (entry) {
-		entry->pending = net_pkt_ref(pending);
+		entry->pending[0] = net_pkt_ref(pending);
+		entry->pending_count = 1U;
+		entry->pending_dropped = 0U;
 		entry->iface = net_pkt_iface(pkt);
 
 		net_ipaddr_copy(&entry->ip, next_addr);
@@ -313,6 +368,59 @@ static inline struct net_pkt *arp_prepare(struct net_if *iface,
 	return pkt;
 }
 
+#if defined(CONFIG_NET_ARP_CACHE_REFRESH)
+static void arp_cache_refresh(struct k_work *work)
+{
+	uint32_t current = k_uptime_get_32();
+	sys_snode_t *prev = NULL;
+	struct arp_entry *entry, *next;
+
+	ARG_UNUSED(work);
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&arp_table, entry, next, node) {
+		uint32_t age = current - entry->req_start;
+
+#if defined(CONFIG_NET_ARP_NEGATIVE_CACHE)
+		if (entry->negative) {
+			prev = &entry->node;
+			continue;
+		}
+#endif
+		if (age > 2 * ARP_CACHE_LIFETIME) {
+			/* The refresh requests went unanswered, the peer
+			 * is gone so drop the entry.
+			 */
+			arp_entry_cleanup(entry, false);
+
+			sys_slist_remove(&arp_table, prev, &entry->node);
+			sys_slist_prepend(&arp_free_entries, &entry->node);
+			continue;
+		}
+
+		if (age > ARP_CACHE_LIFETIME - ARP_REFRESH_CHECK_INTERVAL) {
+			/* Re-resolve in the background before the entry
+			 * goes stale so that active flows never stall on
+			 * re-resolution.
+			 */
+			struct in_addr *my_addr = if_get_addr(entry->iface,
+							      NULL);
+			struct net_pkt *req;
+
+			req = arp_prepare(entry->iface, &entry->ip, NULL,
+					  NULL, my_addr);
+			if (req) {
+				net_if_queue_tx(entry->iface, req);
+			}
+		}
+
+		prev = &entry->node;
+	}
+
+	k_delayed_work_submit(&arp_refresh_timer,
+			      K_MSEC(ARP_REFRESH_CHECK_INTERVAL));
+}
+#endif /* CONFIG_NET_ARP_CACHE_REFRESH */
+
 struct net_pkt *net_arp_prepare(struct net_pkt *pkt,
 				struct in_addr *request_ip,
 				struct in_addr *current_ip)
@@ -350,6 +458,29 @@ struct net_pkt *net_arp_prepare(struct net_pkt *pkt,
 	 * to send any ARP packet.
 	 */
 	entry = arp_entry_find_move_first(net_pkt_iface(pkt), addr);
+
+#if defined(CONFIG_NET_ARP_NEGATIVE_CACHE)
+	if (entry && entry->negative) {
+		if ((int32_t)(entry->req_start + arp_negative_backoff(entry) -
+			      k_uptime_get_32()) > 0) {
+			/* The address failed to resolve recently, drop the
+			 * packet right away instead of queueing it behind a
+			 * request that is going to time out again.
+			 */
+			NET_DBG("Negative entry for %s, dropping",
+				log_strdup(net_sprint_ipv4_addr(addr)));
+			return NULL;
+		}
+
+		/* Backoff expired, retry the resolution with this entry */
+		sys_slist_find_and_remove(&arp_table, &entry->node);
+		entry->negative = false;
+
+		return arp_prepare(net_pkt_iface(pkt), addr, entry, pkt,
+				   current_ip);
+	}
+#endif
+
 	if (!entry) {
 		struct net_pkt *req;
 
@@ -361,8 +492,34 @@ struct net_pkt *net_arp_prepare(struct net_pkt *pkt,
 				/* Then let's take one from table? */
 				entry = arp_entry_get_last_from_table();
 			}
+
+#if defined(CONFIG_NET_ARP_NEGATIVE_CACHE)
+			if (entry) {
+				entry->failures = 0U;
+				entry->negative = false;
+			}
+#endif
 		} else {
-			/* There is a pending already */
+			/* There is a pending query already, queue this
+			 * packet behind it if there is room left.
+			 */
+			if (entry->pending_count <
+			    CONFIG_NET_ARP_PENDING_QUEUE_LEN) {
+				entry->pending[entry->pending_count] =
+					net_pkt_ref(pkt);
+				entry->pending_count++;
+			} else {
+				if (entry->pending_dropped < UINT16_MAX) {
+					entry->pending_dropped++;
+				}
+
+				NET_DBG("Pending queue full for %s "
+					"(%u dropped)",
+					log_strdup(net_sprint_ipv4_addr(addr)),
+					entry->pending_dropped);
+				return NULL;
+			}
+
 			entry = NULL;
 		}
 
@@ -370,9 +527,10 @@ struct net_pkt *net_arp_prepare(struct net_pkt *pkt,
 				  current_ip);
 
 		if (!entry) {
-			/* We cannot send the packet, the ARP cache is full
-			 * or there is already a pending query to this IP
-			 * address, so this packet must be discarded.
+			/* Either the ARP cache is full and this packet must
+			 * be discarded, or the packet was queued behind an
+			 * already pending query and only the query itself
+			 * is sent again.
 			 */
 			NET_DBG("Resending ARP %p", req);
 		}
@@ -433,6 +591,29 @@ static void arp_update(struct net_if *iface,
 			arp_gratuitous(iface, src, hwaddr);
 		}
 
+#if defined(CONFIG_NET_ARP_CACHE_REFRESH)
+		{
+			struct arp_entry *tbl_entry;
+
+			/* A reply to a background refresh updates the
+			 * existing entry and restarts its lifetime.
+			 */
+			tbl_entry = arp_entry_find(&arp_table, iface, src,
+						   NULL);
+#if defined(CONFIG_NET_ARP_NEGATIVE_CACHE)
+			if (tbl_entry && tbl_entry->negative) {
+				tbl_entry = NULL;
+			}
+#endif
+			if (tbl_entry) {
+				memcpy(&tbl_entry->eth, hwaddr,
+				       sizeof(struct net_eth_addr));
+				tbl_entry->req_start = k_uptime_get_32();
+				return;
+			}
+		}
+#endif
+
 		if (force) {
 			sys_snode_t *prev = NULL;
 			struct arp_entry *entry;
@@ -441,6 +622,11 @@ static void arp_update(struct net_if *iface,
 			if (entry) {
 				memcpy(&entry->eth, hwaddr,
 				       sizeof(struct net_eth_addr));
+#if defined(CONFIG_NET_ARP_NEGATIVE_CACHE)
+				/* The peer is clearly reachable again */
+				entry->failures = 0U;
+				entry->negative = false;
+#endif
 			} else {
 				/* Add new entry as it was not found and force
 				 * was set.
@@ -456,6 +642,10 @@ static void arp_update(struct net_if *iface,
 					entry->iface = iface;
 					net_ipaddr_copy(&entry->ip, src);
 					memcpy(&entry->eth, hwaddr, sizeof(entry->eth));
+#if defined(CONFIG_NET_ARP_NEGATIVE_CACHE)
+					entry->failures = 0U;
+					entry->negative = false;
+#endif
 					sys_slist_prepend(&arp_table, &entry->node);
 				}
 			}
@@ -464,24 +654,32 @@ static void arp_update(struct net_if *iface,
 		return;
 	}
 
-	/* Set the dst in the pending packet */
-	net_pkt_lladdr_dst(entry->pending)->len = sizeof(struct net_eth_addr);
-	net_pkt_lladdr_dst(entry->pending)->addr =
-		(uint8_t *) &NET_ETH_HDR(entry->pending)->dst.addr;
-
-	NET_DBG("dst %s pending %p frag %p",
-		log_strdup(net_sprint_ipv4_addr(&entry->ip)),
-		entry->pending, entry->pending->frags);
-
-	pkt = entry->pending;
-	entry->pending = NULL;
-
 	memcpy(&entry->eth, hwaddr, sizeof(struct net_eth_addr));
+	entry->req_start = k_uptime_get_32();
+#if defined(CONFIG_NET_ARP_NEGATIVE_CACHE)
+	entry->failures = 0U;
+	entry->negative = false;
+#endif
 
 	/* Inserting entry into the table */
 	sys_slist_prepend(&arp_table, &entry->node);
 
-	net_if_queue_tx(iface, pkt);
+	/* Flush the packets that were waiting for this resolution */
+	for (uint8_t i = 0U; i < entry->pending_count; i++) {
+		pkt = entry->pending[i];
+		entry->pending[i] = NULL;
+
+		net_pkt_lladdr_dst(pkt)->len = sizeof(struct net_eth_addr);
+		net_pkt_lladdr_dst(pkt)->addr = (uint8_t *)&entry->eth;
+
+		NET_DBG("dst %s pending %p frag %p",
+			log_strdup(net_sprint_ipv4_addr(&entry->ip)),
+			pkt, pkt->frags);
+
+		net_if_queue_tx(iface, pkt);
+	}
+
+	entry->pending_count = 0U;
 }
 
 static inline struct net_pkt *arp_prepare_reply(struct net_if *iface,
@@ -740,5 +938,11 @@ void net_arp_init(void)
 
 	k_delayed_work_init(&arp_request_timer, arp_request_timeout);
 
+#if defined(CONFIG_NET_ARP_CACHE_REFRESH)
+	k_delayed_work_init(&arp_refresh_timer, arp_cache_refresh);
+	k_delayed_work_submit(&arp_refresh_timer,
+			      K_MSEC(ARP_REFRESH_CHECK_INTERVAL));
+#endif
+
 	arp_cache_initialized = true;
 }
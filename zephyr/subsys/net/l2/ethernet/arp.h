@@ -54,10 +54,23 @@ struct arp_entry {
 	uint32_t req_start;
 	struct net_if *iface;
 	struct in_addr ip;
-	union {
-		struct net_pkt *pending;
-		struct net_eth_addr eth;
-	};
+	struct net_eth_addr eth;
+	/** Packets waiting for this address to resolve, in arrival
+	 * order.  A plain pointer array on purpose: a net_pkt can be
+	 * waiting on several resolutions at once, so it must not be
+	 * linked into a list through the packet itself.
+	 */
+	struct net_pkt *pending[CONFIG_NET_ARP_PENDING_QUEUE_LEN];
+	/** Number of packets in pending */
+	uint8_t pending_count;
+	/** Packets dropped because the pending queue was full */
+	uint16_t pending_dropped;
+#if defined(CONFIG_NET_ARP_NEGATIVE_CACHE)
+	/** Consecutive resolution failures, drives the backoff */
+	uint8_t failures;
+	/** Entry records a failed resolution */
+	bool negative;
+#endif
 };
 
 typedef void (*net_arp_cb_t)(struct arp_entry *entry,
@@ -587,6 +587,7 @@ static void gptp_add_port(struct net_if *iface, void *user_data)
 	clk = net_eth_get_ptp_clock(iface);
 	if (clk) {
 		gptp_domain.iface[*num_ports] = iface;
+		gptp_domain.clk[*num_ports] = clk;
 		net_eth_set_ptp_port(iface, *num_ports);
 		(*num_ports)++;
 	}
@@ -57,6 +57,8 @@ extern "C" {
 	(&gptp_domain.port_bmca_data[port - GPTP_PORT_START])
 #define GPTP_PORT_IFACE(port) \
 	gptp_domain.iface[port - GPTP_PORT_START]
+#define GPTP_PORT_CLK(port) \
+	gptp_domain.clk[port - GPTP_PORT_START]
 
 #if defined(CONFIG_NET_GPTP_STATISTICS)
 #define GPTP_PORT_PARAM_DS(port)				\
@@ -569,6 +571,12 @@ struct gptp_domain {
 
 	/* Network interface linked to the PTP PORT. */
 	struct net_if *iface[CONFIG_NET_GPTP_NUM_PORTS];
+
+	/* PTP clock of the PTP PORT, looked up once at port setup so
+	 * timestamp reads do not go through the ethernet driver API
+	 * on every call.
+	 */
+	struct device *clk[CONFIG_NET_GPTP_NUM_PORTS];
 };
 
 /**
@@ -24,6 +24,23 @@ static bool ts_cb_registered;
 static const struct net_eth_addr gptp_multicast_eth_addr = {
 	{ 0x01, 0x80, 0xc2, 0x00, 0x00, 0x0e } };
 
+#if defined(CONFIG_NET_GPTP_MSG_TEMPLATES)
+/* Cached copy of a periodic message, built on the first transmission.
+ * Later transmissions copy the cached bytes into the fresh packet and
+ * only patch the fields that change between messages.
+ */
+struct gptp_msg_template {
+	bool valid;
+	uint8_t frame[sizeof(struct gptp_hdr) +
+		      MAX(sizeof(struct gptp_sync),
+			  sizeof(struct gptp_pdelay_req))];
+};
+
+static struct gptp_msg_template sync_template[CONFIG_NET_GPTP_NUM_PORTS];
+static struct gptp_msg_template fup_template[CONFIG_NET_GPTP_NUM_PORTS];
+static struct gptp_msg_template pdelay_req_template[CONFIG_NET_GPTP_NUM_PORTS];
+#endif /* CONFIG_NET_GPTP_MSG_TEMPLATES */
+
 #define NET_GPTP_INFO(msg, pkt)						\
 	if (CONFIG_NET_GPTP_LOG_LEVEL >= LOG_LEVEL_DBG) {		\
 		struct gptp_hdr *hdr = GPTP_HDR(pkt);			\
@@ -204,6 +221,18 @@ struct net_pkt *gptp_prepare_sync(int port)
 	sync = GPTP_SYNC(pkt);
 	hdr = GPTP_HDR(pkt);
 
+#if defined(CONFIG_NET_GPTP_MSG_TEMPLATES)
+	if (sync_template[port - GPTP_PORT_START].valid) {
+		memcpy(hdr, sync_template[port - GPTP_PORT_START].frame,
+		       sizeof(struct gptp_hdr) + sizeof(struct gptp_sync));
+
+		hdr->sequence_id = htons(port_ds->sync_seq_id);
+		port_ds->sync_seq_id++;
+
+		return pkt;
+	}
+#endif
+
 	/*
 	 * Header configuration.
 	 *
@@ -232,6 +261,15 @@ struct net_pkt *gptp_prepare_sync(int port)
 	/* Update sequence number. */
 	port_ds->sync_seq_id++;
 
+#if defined(CONFIG_NET_GPTP_MSG_TEMPLATES)
+	/* The sequence id is patched on reuse, everything else is
+	 * constant between syncs.
+	 */
+	memcpy(sync_template[port - GPTP_PORT_START].frame, hdr,
+	       sizeof(struct gptp_hdr) + sizeof(struct gptp_sync));
+	sync_template[port - GPTP_PORT_START].valid = true;
+#endif
+
 	return pkt;
 }
 
@@ -259,6 +297,19 @@ struct net_pkt *gptp_prepare_follow_up(int port, struct net_pkt *sync)
 	hdr = GPTP_HDR(pkt);
 	sync_hdr = GPTP_HDR(sync);
 
+#if defined(CONFIG_NET_GPTP_MSG_TEMPLATES)
+	if (fup_template[port - GPTP_PORT_START].valid) {
+		memcpy(hdr, fup_template[port - GPTP_PORT_START].frame,
+		       sizeof(struct gptp_hdr));
+
+		hdr->sequence_id = sync_hdr->sequence_id;
+		hdr->correction_field =
+			gptp_timestamp_to_nsec(&sync->timestamp);
+
+		return pkt;
+	}
+#endif
+
 	/*
 	 * Header configuration.
 	 *
@@ -284,6 +335,16 @@ struct net_pkt *gptp_prepare_follow_up(int port, struct net_pkt *sync)
 
 	/* PTP configuration will be set by the MDSyncSend state machine. */
 
+#if defined(CONFIG_NET_GPTP_MSG_TEMPLATES)
+	/* The sequence id and correction field are patched on reuse and
+	 * the follow up body is filled by the MDSyncSend state machine,
+	 * so only the header is cached.
+	 */
+	memcpy(fup_template[port - GPTP_PORT_START].frame, hdr,
+	       sizeof(struct gptp_hdr));
+	fup_template[port - GPTP_PORT_START].valid = true;
+#endif
+
 	return pkt;
 }
 
@@ -311,6 +372,20 @@ struct net_pkt *gptp_prepare_pdelay_req(int port)
 	req = GPTP_PDELAY_REQ(pkt);
 	hdr = GPTP_HDR(pkt);
 
+#if defined(CONFIG_NET_GPTP_MSG_TEMPLATES)
+	if (pdelay_req_template[port - GPTP_PORT_START].valid) {
+		memcpy(hdr, pdelay_req_template[port - GPTP_PORT_START].frame,
+		       sizeof(struct gptp_hdr) +
+		       sizeof(struct gptp_pdelay_req));
+
+		hdr->sequence_id = htons(port_ds->pdelay_req_seq_id);
+		hdr->log_msg_interval = port_ds->cur_log_pdelay_req_itv;
+		port_ds->pdelay_req_seq_id++;
+
+		return pkt;
+	}
+#endif
+
 	/* Header configuration. */
 	hdr->transport_specific = GPTP_TRANSPORT_802_1_AS;
 	hdr->message_type = GPTP_PATH_DELAY_REQ_MESSAGE;
@@ -342,6 +417,15 @@ struct net_pkt *gptp_prepare_pdelay_req(int port)
 	/* Update sequence number. */
 	port_ds->pdelay_req_seq_id++;
 
+#if defined(CONFIG_NET_GPTP_MSG_TEMPLATES)
+	/* The sequence id and message interval are patched on reuse,
+	 * everything else is constant between requests.
+	 */
+	memcpy(pdelay_req_template[port - GPTP_PORT_START].frame, hdr,
+	       sizeof(struct gptp_hdr) + sizeof(struct gptp_pdelay_req));
+	pdelay_req_template[port - GPTP_PORT_START].valid = true;
+#endif
+
 	return pkt;
 }
 
@@ -334,7 +334,7 @@ uint64_t gptp_get_current_time_nanosecond(int port)
 {
 	struct device *clk;
 
-	clk = net_eth_get_ptp_clock(GPTP_PORT_IFACE(port));
+	clk = GPTP_PORT_CLK(port);
 	if (clk) {
 		struct net_ptp_time tm = {};
 
@@ -766,7 +766,7 @@ static void gptp_update_local_port_clock(void)
 		(global_ds->sync_receipt_time.fract_nsecond / GPTP_POW2_16) -
 		(global_ds->sync_receipt_local_time % NSEC_PER_SEC);
 
-	clk = net_eth_get_ptp_clock(GPTP_PORT_IFACE(port));
+	clk = GPTP_PORT_CLK(port);
 	if (!clk) {
 		return;
 	}
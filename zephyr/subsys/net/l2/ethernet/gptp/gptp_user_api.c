@@ -63,7 +63,7 @@ int gptp_event_capture(struct net_ptp_time *slave_time, bool *gm_present)
 		/* Get first available clock, or slave clock if GM present. */
 		if (!*gm_present || (GPTP_GLOBAL_DS()->selected_role[port] ==
 				     GPTP_PORT_SLAVE)) {
-			clk = net_eth_get_ptp_clock(GPTP_PORT_IFACE(port));
+			clk = GPTP_PORT_CLK(port);
 			if (clk) {
 				ptp_clock_get(clk, slave_time);
 				irq_unlock(key);
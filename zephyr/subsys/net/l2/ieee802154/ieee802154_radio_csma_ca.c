@@ -20,6 +20,34 @@ LOG_MODULE_REGISTER(net_ieee802154_csma, CONFIG_NET_L2_IEEE802154_LOG_LEVEL);
 #include "ieee802154_utils.h"
 #include "ieee802154_radio_utils.h"
 
+static inline int hw_csma_ca_radio_send(struct net_if *iface,
+					struct net_pkt *pkt,
+					struct net_buf *frag,
+					bool ack_required)
+{
+	uint8_t retries = CONFIG_NET_L2_IEEE802154_RADIO_TX_RETRIES;
+	int ret = -EIO;
+
+	NET_DBG("frag %p (hw CSMA)", frag);
+
+	while (retries) {
+		retries--;
+
+		ret = ieee802154_tx(iface, IEEE802154_TX_MODE_CSMA_CA,
+				    pkt, frag);
+		if (ret) {
+			continue;
+		}
+
+		ret = wait_for_ack(iface, ack_required);
+		if (!ret) {
+			break;
+		}
+	}
+
+	return ret;
+}
+
 static inline int csma_ca_radio_send(struct net_if *iface,
 				     struct net_pkt *pkt,
 				     struct net_buf *frag)
@@ -33,6 +61,13 @@ static inline int csma_ca_radio_send(struct net_if *iface,
 	uint8_t nb = 0U;
 	int ret = -EIO;
 
+	if (ieee802154_get_hw_capabilities(iface) & IEEE802154_HW_CSMA) {
+		/* The radio runs the backoff sequence and clear channel
+		 * assessment itself; no need to busy-wait here.
+		 */
+		return hw_csma_ca_radio_send(iface, pkt, frag, ack_required);
+	}
+
 	NET_DBG("frag %p", frag);
 
 loop:
@@ -8,6 +8,7 @@
 LOG_MODULE_REGISTER(net_wifi_mgmt, CONFIG_NET_L2_WIFI_MGMT_LOG_LEVEL);
 
 #include <errno.h>
+#include <string.h>
 
 #include <net/net_core.h>
 #include <net/net_if.h>
@@ -47,6 +48,35 @@ static int wifi_connect(uint32_t mgmt_request, struct net_if *iface,
 
 NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_WIFI_CONNECT, wifi_connect);
 
+#ifdef CONFIG_NET_L2_WIFI_MGMT_CACHE
+static struct wifi_scan_result
+	scan_cache[CONFIG_NET_L2_WIFI_MGMT_CACHE_SCAN_ENTRIES];
+static uint8_t scan_cache_fill;
+static uint8_t scan_cache_count;
+static int64_t scan_cache_time;
+static bool scan_cache_valid;
+
+static bool conn_state_connected;
+static int conn_state_last_status;
+
+static void scan_cache_add(struct wifi_scan_result *entry)
+{
+	if (scan_cache_fill < ARRAY_SIZE(scan_cache)) {
+		scan_cache[scan_cache_fill++] = *entry;
+	}
+}
+
+static void scan_cache_done(int status)
+{
+	scan_cache_count = scan_cache_fill;
+	scan_cache_time = k_uptime_get();
+	scan_cache_valid = (status == 0);
+}
+#else
+#define scan_cache_add(entry)
+#define scan_cache_done(status)
+#endif /* CONFIG_NET_L2_WIFI_MGMT_CACHE */
+
 static void scan_result_cb(struct net_if *iface, int status,
 			    struct wifi_scan_result *entry)
 {
@@ -59,12 +89,16 @@ static void scan_result_cb(struct net_if *iface, int status,
 			.status = status,
 		};
 
+		scan_cache_done(status);
+
 		net_mgmt_event_notify_with_info(NET_EVENT_WIFI_SCAN_DONE,
 						iface, &scan_status,
 						sizeof(struct wifi_status));
 		return;
 	}
 
+	scan_cache_add(entry);
+
 	net_mgmt_event_notify_with_info(NET_EVENT_WIFI_SCAN_RESULT, iface,
 					entry, sizeof(struct wifi_scan_result));
 }
@@ -80,11 +114,64 @@ static int wifi_scan(uint32_t mgmt_request, struct net_if *iface,
 		return -ENOTSUP;
 	}
 
+#ifdef CONFIG_NET_L2_WIFI_MGMT_CACHE
+	scan_cache_fill = 0U;
+#endif
+
 	return off_api->scan(dev, scan_result_cb);
 }
 
 NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_WIFI_SCAN, wifi_scan);
 
+#ifdef CONFIG_NET_L2_WIFI_MGMT_CACHE
+static int wifi_scan_results(uint32_t mgmt_request, struct net_if *iface,
+			     void *data, size_t len)
+{
+	struct wifi_scan_results *results =
+		(struct wifi_scan_results *)data;
+	uint8_t count;
+
+	if (len != sizeof(struct wifi_scan_results) ||
+	    results->results == NULL) {
+		return -EINVAL;
+	}
+
+	if (!scan_cache_valid) {
+		return -ENODATA;
+	}
+
+	count = MIN(results->capacity, scan_cache_count);
+	memcpy(results->results, scan_cache,
+	       count * sizeof(struct wifi_scan_result));
+
+	results->count = count;
+	results->age_ms = (uint32_t)(k_uptime_get() - scan_cache_time);
+
+	return 0;
+}
+
+NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_WIFI_SCAN_RESULTS,
+				  wifi_scan_results);
+
+static int wifi_conn_state(uint32_t mgmt_request, struct net_if *iface,
+			   void *data, size_t len)
+{
+	struct wifi_conn_state *state = (struct wifi_conn_state *)data;
+
+	if (len != sizeof(struct wifi_conn_state)) {
+		return -EINVAL;
+	}
+
+	state->connected = conn_state_connected;
+	state->last_status = conn_state_last_status;
+
+	return 0;
+}
+
+NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_WIFI_CONN_STATE,
+				  wifi_conn_state);
+#endif /* CONFIG_NET_L2_WIFI_MGMT_CACHE */
+
 
 static int wifi_disconnect(uint32_t mgmt_request, struct net_if *iface,
 			   void *data, size_t len)
@@ -108,6 +195,11 @@ void wifi_mgmt_raise_connect_result_event(struct net_if *iface, int status)
 		.status = status,
 	};
 
+#ifdef CONFIG_NET_L2_WIFI_MGMT_CACHE
+	conn_state_connected = (status == 0);
+	conn_state_last_status = status;
+#endif
+
 	net_mgmt_event_notify_with_info(NET_EVENT_WIFI_CONNECT_RESULT,
 					iface, &cnx_status,
 					sizeof(struct wifi_status));
@@ -119,6 +211,11 @@ void wifi_mgmt_raise_disconnect_result_event(struct net_if *iface, int status)
 		.status = status,
 	};
 
+#ifdef CONFIG_NET_L2_WIFI_MGMT_CACHE
+	conn_state_connected = false;
+	conn_state_last_status = status;
+#endif
+
 	net_mgmt_event_notify_with_info(NET_EVENT_WIFI_DISCONNECT_RESULT,
 					iface, &cnx_status,
 					sizeof(struct wifi_status));
@@ -905,6 +905,23 @@ int coap_append_block2_option(struct coap_packet *cpkt,
 	return r;
 }
 
+int coap_append_block2_option_at(struct coap_packet *cpkt,
+				 const struct coap_block_context *ctx,
+				 size_t offset)
+{
+	uint16_t bytes = coap_block_size_to_bytes(ctx->block_size);
+	int val = 0;
+
+	if (!is_request(cpkt) || (offset % bytes) != 0) {
+		return -EINVAL;
+	}
+
+	SET_BLOCK_SIZE(val, ctx->block_size);
+	SET_NUM(val, offset / bytes);
+
+	return coap_append_option_int(cpkt, COAP_OPTION_BLOCK2, val);
+}
+
 int coap_append_size1_option(struct coap_packet *cpkt,
 			     struct coap_block_context *ctx)
 {
@@ -1160,6 +1177,41 @@ struct coap_pending *coap_pending_received(
 	return NULL;
 }
 
+void coap_pending_schedule(sys_slist_t *queue, struct coap_pending *pending)
+{
+	struct coap_pending *p;
+	sys_snode_t *prev = NULL;
+	uint32_t expiry = pending->t0 + pending->timeout;
+
+	sys_slist_find_and_remove(queue, &pending->node);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(queue, p, node) {
+		if ((int32_t)(p->t0 + p->timeout - expiry) > 0) {
+			break;
+		}
+
+		prev = &p->node;
+	}
+
+	if (prev) {
+		sys_slist_insert(queue, prev, &pending->node);
+	} else {
+		sys_slist_prepend(queue, &pending->node);
+	}
+}
+
+void coap_pending_unschedule(sys_slist_t *queue, struct coap_pending *pending)
+{
+	sys_slist_find_and_remove(queue, &pending->node);
+}
+
+struct coap_pending *coap_pending_next_scheduled(sys_slist_t *queue)
+{
+	sys_snode_t *node = sys_slist_peek_head(queue);
+
+	return node ? CONTAINER_OF(node, struct coap_pending, node) : NULL;
+}
+
 struct coap_pending *coap_pending_next_to_expire(
 	struct coap_pending *pendings, size_t len)
 {
@@ -360,6 +360,112 @@ static inline int get_slot_by_id(struct dns_resolve_context *ctx,
 	return -ENOENT;
 }
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+/* Cache of resolved addresses, keyed by query name and type. Entries
+ * expire when the record TTL runs out; expired slots are reused first.
+ */
+struct dns_cache_entry {
+	char name[DNS_MAX_NAME_LEN + 1];
+	enum dns_query_type query_type;
+	struct dns_addrinfo info;
+	int64_t expiry; /* uptime in ms when the entry goes stale */
+	bool used;
+};
+
+static struct dns_cache_entry dns_cache[CONFIG_DNS_RESOLVER_CACHE_ENTRIES];
+static K_MUTEX_DEFINE(dns_cache_mutex);
+
+static void dns_cache_add(const char *name, enum dns_query_type type,
+			  const struct dns_addrinfo *info, uint32_t ttl)
+{
+	struct dns_cache_entry *entry = NULL;
+	int64_t now = k_uptime_get();
+	int i;
+
+	if (ttl == 0U || strlen(name) > DNS_MAX_NAME_LEN) {
+		/* Responses we may not hold on to are not cached */
+		return;
+	}
+
+	k_mutex_lock(&dns_cache_mutex, K_FOREVER);
+
+	for (i = 0; i < CONFIG_DNS_RESOLVER_CACHE_ENTRIES; i++) {
+		if (dns_cache[i].used &&
+		    dns_cache[i].query_type == type &&
+		    strcmp(dns_cache[i].name, name) == 0) {
+			entry = &dns_cache[i];
+			break;
+		}
+
+		if (!dns_cache[i].used || dns_cache[i].expiry <= now) {
+			entry = &dns_cache[i];
+			continue;
+		}
+
+		if (!entry ||
+		    (entry->used && dns_cache[i].expiry < entry->expiry)) {
+			entry = &dns_cache[i];
+		}
+	}
+
+	strcpy(entry->name, name);
+	entry->query_type = type;
+	memcpy(&entry->info, info, sizeof(entry->info));
+	entry->expiry = now + (int64_t)ttl * MSEC_PER_SEC;
+	entry->used = true;
+
+	k_mutex_unlock(&dns_cache_mutex);
+}
+
+static bool dns_cache_lookup(const char *name, enum dns_query_type type,
+			     struct dns_addrinfo *info)
+{
+	int64_t now = k_uptime_get();
+	bool found = false;
+	int i;
+
+	k_mutex_lock(&dns_cache_mutex, K_FOREVER);
+
+	for (i = 0; i < CONFIG_DNS_RESOLVER_CACHE_ENTRIES; i++) {
+		if (!dns_cache[i].used) {
+			continue;
+		}
+
+		if (dns_cache[i].expiry <= now) {
+			dns_cache[i].used = false;
+			continue;
+		}
+
+		if (dns_cache[i].query_type == type &&
+		    strcmp(dns_cache[i].name, name) == 0) {
+			memcpy(info, &dns_cache[i].info, sizeof(*info));
+			found = true;
+			break;
+		}
+	}
+
+	k_mutex_unlock(&dns_cache_mutex);
+
+	return found;
+}
+
+static void dns_cache_flush(void)
+{
+	int i;
+
+	k_mutex_lock(&dns_cache_mutex, K_FOREVER);
+
+	for (i = 0; i < CONFIG_DNS_RESOLVER_CACHE_ENTRIES; i++) {
+		dns_cache[i].used = false;
+	}
+
+	k_mutex_unlock(&dns_cache_mutex);
+}
+#else
+#define dns_cache_add(...)
+#define dns_cache_flush(...)
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
+
 static int dns_read(struct dns_resolve_context *ctx,
 		    struct net_pkt *pkt,
 		    struct net_buf *dns_data,
@@ -530,6 +636,10 @@ static int dns_read(struct dns_resolve_context *ctx,
 			src = dns_msg.msg + dns_msg.response_position;
 			memcpy(addr, src, address_size);
 
+			dns_cache_add(ctx->queries[query_idx].query,
+				      ctx->queries[query_idx].query_type,
+				      &info, ttl);
+
 		query_known:
 			ctx->queries[query_idx].cb(DNS_EAI_INPROGRESS, &info,
 					ctx->queries[query_idx].user_data);
@@ -965,6 +1075,22 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 	}
 
 try_resolve:
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	{
+		struct dns_addrinfo cached = { 0 };
+
+		if (dns_cache_lookup(query, type, &cached)) {
+			NET_DBG("Query %s answered from cache",
+				log_strdup(query));
+
+			cb(DNS_EAI_INPROGRESS, &cached, user_data);
+			cb(DNS_EAI_ALLDONE, NULL, user_data);
+
+			return 0;
+		}
+	}
+#endif
+
 	i = get_cb_slot(ctx);
 	if (i < 0) {
 		return -EAGAIN;
@@ -1132,6 +1258,8 @@ int dns_resolve_close(struct dns_resolve_context *ctx)
 
 	ctx->is_used = false;
 
+	dns_cache_flush();
+
 	return 0;
 }
 
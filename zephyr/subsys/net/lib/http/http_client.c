@@ -681,3 +681,239 @@ int http_client_req(int sock, struct http_request *req,
 out:
 	return ret;
 }
+
+#if defined(CONFIG_HTTP_CLIENT_CONNECTION_POOL)
+
+#define HTTP_POOL_HOST_LEN CONFIG_HTTP_CLIENT_CONNECTION_POOL_HOST_LEN
+#define HTTP_POOL_PORT_LEN sizeof("65535")
+
+struct http_pool_entry {
+	int sock;
+	bool used;
+	bool busy;
+	int64_t last_used;
+	char host[HTTP_POOL_HOST_LEN + 1];
+	char port[HTTP_POOL_PORT_LEN];
+};
+
+static struct http_pool_entry
+	http_pool[CONFIG_HTTP_CLIENT_CONNECTION_POOL_SIZE];
+
+static K_MUTEX_DEFINE(http_pool_lock);
+
+static bool http_pool_key_ok(const struct http_request *req)
+{
+	return strlen(req->host) <= HTTP_POOL_HOST_LEN &&
+	       strlen(req->port) < HTTP_POOL_PORT_LEN;
+}
+
+/* Take a matching idle connection out of the pool, if there is one. */
+static struct http_pool_entry *http_pool_acquire(const struct http_request *req)
+{
+	struct http_pool_entry *entry = NULL;
+	int i;
+
+	k_mutex_lock(&http_pool_lock, K_FOREVER);
+
+	for (i = 0; i < ARRAY_SIZE(http_pool); i++) {
+		if (http_pool[i].used && !http_pool[i].busy &&
+		    strcmp(http_pool[i].host, req->host) == 0 &&
+		    strcmp(http_pool[i].port, req->port) == 0) {
+			entry = &http_pool[i];
+			entry->busy = true;
+			break;
+		}
+	}
+
+	k_mutex_unlock(&http_pool_lock);
+
+	return entry;
+}
+
+/* Return a connection to the pool, or close it. An entry of NULL with
+ * keep set stores a new connection, evicting the least recently used
+ * idle entry if the pool is full.
+ */
+static void http_pool_release(struct http_pool_entry *entry, int sock,
+			      const struct http_request *req, bool keep)
+{
+	struct http_pool_entry *oldest = NULL;
+	int i;
+
+	k_mutex_lock(&http_pool_lock, K_FOREVER);
+
+	if (keep && entry == NULL) {
+		for (i = 0; i < ARRAY_SIZE(http_pool); i++) {
+			if (!http_pool[i].used) {
+				oldest = &http_pool[i];
+				break;
+			}
+
+			if (!http_pool[i].busy &&
+			    (oldest == NULL ||
+			     http_pool[i].last_used < oldest->last_used)) {
+				oldest = &http_pool[i];
+			}
+		}
+
+		if (oldest != NULL) {
+			if (oldest->used) {
+				(void)close(oldest->sock);
+			}
+
+			strcpy(oldest->host, req->host);
+			strcpy(oldest->port, req->port);
+			oldest->sock = sock;
+			oldest->used = true;
+			entry = oldest;
+		}
+	}
+
+	if (entry != NULL) {
+		if (keep) {
+			entry->busy = false;
+			entry->last_used = k_uptime_get();
+		} else {
+			entry->used = false;
+			entry->busy = false;
+			(void)close(sock);
+		}
+	} else if (!keep || oldest == NULL) {
+		/* Not pooled, or all entries were busy. */
+		(void)close(sock);
+	}
+
+	k_mutex_unlock(&http_pool_lock);
+}
+
+static int http_pool_connect(struct http_request *req, void *user_data)
+{
+	struct addrinfo hints = {
+		.ai_socktype = SOCK_STREAM,
+	};
+	struct addrinfo *res, *rp;
+	int sock = -1;
+	int proto = req->proto != 0 ? req->proto : IPPROTO_TCP;
+	int ret;
+
+	ret = getaddrinfo(req->host, req->port, &hints, &res);
+	if (ret != 0) {
+		NET_DBG("Cannot resolve %s:%s (%d)", log_strdup(req->host),
+			log_strdup(req->port), ret);
+		return -EHOSTUNREACH;
+	}
+
+	for (rp = res; rp != NULL; rp = rp->ai_next) {
+		sock = socket(rp->ai_family, rp->ai_socktype, proto);
+		if (sock < 0) {
+			continue;
+		}
+
+		if (req->setup_cb != NULL) {
+			ret = req->setup_cb(sock, req, user_data);
+			if (ret < 0) {
+				(void)close(sock);
+				sock = -1;
+				continue;
+			}
+		}
+
+		if (connect(sock, rp->ai_addr, rp->ai_addrlen) == 0) {
+			break;
+		}
+
+		(void)close(sock);
+		sock = -1;
+	}
+
+	freeaddrinfo(res);
+
+	if (sock < 0) {
+		NET_DBG("Cannot connect to %s:%s", log_strdup(req->host),
+			log_strdup(req->port));
+		return -ECONNREFUSED;
+	}
+
+	return sock;
+}
+
+int http_client_pool_req(struct http_request *req, int32_t timeout,
+			 void *user_data)
+{
+	struct http_pool_entry *entry;
+	bool keep;
+	int sock, ret;
+
+	if (req == NULL || req->host == NULL || req->port == NULL) {
+		return -EINVAL;
+	}
+
+	if (!http_pool_key_ok(req)) {
+		/* Cannot be used as a pool key, run unpooled. */
+		sock = http_pool_connect(req, user_data);
+		if (sock < 0) {
+			return sock;
+		}
+
+		ret = http_client_req(sock, req, timeout, user_data);
+		(void)close(sock);
+
+		return ret;
+	}
+
+	entry = http_pool_acquire(req);
+	if (entry != NULL) {
+		sock = entry->sock;
+	} else {
+		sock = http_pool_connect(req, user_data);
+		if (sock < 0) {
+			return sock;
+		}
+	}
+
+	ret = http_client_req(sock, req, timeout, user_data);
+
+	if (entry != NULL && req->internal.response.processed == 0 &&
+	    (ret < 0 || !req->internal.response.message_complete)) {
+		/* The reused connection was stale (closed by the server
+		 * while idle). Reconnect and retry the request once.
+		 */
+		NET_DBG("Stale pooled connection to %s:%s, reconnecting",
+			log_strdup(req->host), log_strdup(req->port));
+
+		http_pool_release(entry, sock, req, false);
+		entry = NULL;
+
+		sock = http_pool_connect(req, user_data);
+		if (sock < 0) {
+			return sock;
+		}
+
+		ret = http_client_req(sock, req, timeout, user_data);
+	}
+
+	keep = ret >= 0 && req->internal.response.message_complete &&
+	       http_should_keep_alive(&req->internal.parser);
+
+	http_pool_release(entry, sock, req, keep);
+
+	return ret;
+}
+
+void http_client_pool_purge(void)
+{
+	int i;
+
+	k_mutex_lock(&http_pool_lock, K_FOREVER);
+
+	for (i = 0; i < ARRAY_SIZE(http_pool); i++) {
+		if (http_pool[i].used && !http_pool[i].busy) {
+			(void)close(http_pool[i].sock);
+			http_pool[i].used = false;
+		}
+	}
+
+	k_mutex_unlock(&http_pool_lock);
+}
+
+#endif /* CONFIG_HTTP_CLIENT_CONNECTION_POOL */
@@ -93,6 +93,10 @@ struct observe_node {
 	uint32_t counter;
 	uint16_t format;
 	uint8_t  tkl;
+#if defined(CONFIG_LWM2M_NOTIFY_ATTR_FILTERS)
+	int64_t last_value;
+	bool last_value_set;
+#endif
 };
 
 struct notification_attrs {
@@ -151,6 +155,14 @@ struct block_context {
 
 static struct block_context block1_contexts[NUM_BLOCK1_CONTEXT];
 
+#if defined(CONFIG_LWM2M_NOTIFY_ATTR_FILTERS)
+static int path_to_objs(const struct lwm2m_obj_path *path,
+			struct lwm2m_engine_obj_inst **obj_inst,
+			struct lwm2m_engine_obj_field **obj_field,
+			struct lwm2m_engine_res **res,
+			struct lwm2m_engine_res_inst **res_inst);
+#endif
+
 /* write-attribute related definitons */
 static const char * const LWM2M_ATTR_STR[] = { "pmin", "pmax",
 					       "gt", "lt", "st" };
@@ -369,6 +381,172 @@ static void clear_attrs(void *ref)
 	}
 }
 
+#if defined(CONFIG_LWM2M_NOTIFY_ATTR_FILTERS)
+
+/* gt/lt/st attributes use the float32 encoding: scale resource values to
+ * the same fixed point (millionths) so they can be compared without
+ * floating point support.
+ */
+#define NOTIFY_ATTR_SCALE ((int64_t)LWM2M_FLOAT32_DEC_MAX)
+
+static int64_t float32_to_scaled(const float32_value_t *f)
+{
+	return (int64_t)f->val1 * NOTIFY_ATTR_SCALE + f->val2;
+}
+
+static int observe_value_scaled(const struct lwm2m_obj_path *path,
+				int64_t *value)
+{
+	struct lwm2m_engine_obj_field *obj_field = NULL;
+	struct lwm2m_engine_res_inst *res_inst = NULL;
+	void *data_ptr;
+	int ret;
+
+	ret = path_to_objs(path, NULL, &obj_field, NULL, &res_inst);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (!res_inst || !res_inst->data_ptr) {
+		return -ENOENT;
+	}
+
+	data_ptr = res_inst->data_ptr;
+
+	switch (obj_field->data_type) {
+	case LWM2M_RES_TYPE_U32:
+	case LWM2M_RES_TYPE_TIME:
+		*value = (int64_t)*(uint32_t *)data_ptr * NOTIFY_ATTR_SCALE;
+		break;
+
+	case LWM2M_RES_TYPE_U16:
+		*value = (int64_t)*(uint16_t *)data_ptr * NOTIFY_ATTR_SCALE;
+		break;
+
+	case LWM2M_RES_TYPE_U8:
+		*value = (int64_t)*(uint8_t *)data_ptr * NOTIFY_ATTR_SCALE;
+		break;
+
+	case LWM2M_RES_TYPE_S64:
+		*value = *(int64_t *)data_ptr * NOTIFY_ATTR_SCALE;
+		break;
+
+	case LWM2M_RES_TYPE_S32:
+		*value = (int64_t)*(int32_t *)data_ptr * NOTIFY_ATTR_SCALE;
+		break;
+
+	case LWM2M_RES_TYPE_S16:
+		*value = (int64_t)*(int16_t *)data_ptr * NOTIFY_ATTR_SCALE;
+		break;
+
+	case LWM2M_RES_TYPE_S8:
+		*value = (int64_t)*(int8_t *)data_ptr * NOTIFY_ATTR_SCALE;
+		break;
+
+	case LWM2M_RES_TYPE_FLOAT32:
+		*value = float32_to_scaled((float32_value_t *)data_ptr);
+		break;
+
+	case LWM2M_RES_TYPE_FLOAT64:
+		*value = ((float64_value_t *)data_ptr)->val1 *
+			 NOTIFY_ATTR_SCALE +
+			 ((float64_value_t *)data_ptr)->val2 *
+			 NOTIFY_ATTR_SCALE / LWM2M_FLOAT64_DEC_MAX;
+		break;
+
+	default:
+		/* not a numeric resource: attributes don't apply */
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/* Decide whether a changed resource should wake the given observer.
+ * Non numeric resources and observations above resource level always
+ * notify; otherwise the server supplied gt/lt/st attributes gate the
+ * event.  Fails open so a lookup problem never silences an observer.
+ */
+static bool observe_attr_notify(struct observe_node *obs)
+{
+	struct lwm2m_engine_obj_inst *obj_inst = NULL;
+	struct lwm2m_engine_res *res = NULL;
+	struct notification_attrs nattrs = { 0 };
+	struct lwm2m_obj_path path;
+	int64_t value, gt, lt, st;
+	bool notify = false;
+	int ret;
+
+	if (obs->path.level < 3U) {
+		return true;
+	}
+
+	memcpy(&path, &obs->path, sizeof(path));
+	path.res_inst_id = 0U;
+
+	ret = path_to_objs(&path, &obj_inst, NULL, &res, NULL);
+	if (ret < 0) {
+		return true;
+	}
+
+	ret = update_attrs(obj_inst->obj, &nattrs);
+	if (ret == 0) {
+		ret = update_attrs(obj_inst, &nattrs);
+	}
+
+	if (ret == 0) {
+		ret = update_attrs(res, &nattrs);
+	}
+
+	if (ret < 0 ||
+	    !(nattrs.flags & (BIT(LWM2M_ATTR_GT) | BIT(LWM2M_ATTR_LT) |
+			      BIT(LWM2M_ATTR_STEP)))) {
+		return true;
+	}
+
+	if (observe_value_scaled(&path, &value) < 0) {
+		return true;
+	}
+
+	if (!obs->last_value_set) {
+		obs->last_value = value;
+		obs->last_value_set = true;
+		return true;
+	}
+
+	if (nattrs.flags & BIT(LWM2M_ATTR_GT)) {
+		gt = float32_to_scaled(&nattrs.gt);
+		if ((obs->last_value > gt) != (value > gt)) {
+			notify = true;
+		}
+	}
+
+	if (nattrs.flags & BIT(LWM2M_ATTR_LT)) {
+		lt = float32_to_scaled(&nattrs.lt);
+		if ((obs->last_value < lt) != (value < lt)) {
+			notify = true;
+		}
+	}
+
+	if (nattrs.flags & BIT(LWM2M_ATTR_STEP)) {
+		int64_t delta = value - obs->last_value;
+
+		st = float32_to_scaled(&nattrs.st);
+		if (delta >= st || -delta >= st) {
+			notify = true;
+		}
+	}
+
+	if (notify) {
+		obs->last_value = value;
+	}
+
+	return notify;
+}
+#else
+#define observe_attr_notify(_obs) true
+#endif /* CONFIG_LWM2M_NOTIFY_ATTR_FILTERS */
+
 int lwm2m_notify_observer(uint16_t obj_id, uint16_t obj_inst_id, uint16_t res_id)
 {
 	struct observe_node *obs;
@@ -380,6 +558,10 @@ int lwm2m_notify_observer(uint16_t obj_id, uint16_t obj_inst_id, uint16_t res_id
 		    obs->path.obj_inst_id == obj_inst_id &&
 		    (obs->path.level < 3 ||
 		     obs->path.res_id == res_id)) {
+			if (!observe_attr_notify(obs)) {
+				continue;
+			}
+
 			/* update the event time for this observer */
 			obs->event_timestamp = k_uptime_get();
 
@@ -4071,6 +4253,7 @@ static int lwm2m_engine_service(void)
 	struct observe_node *obs;
 	struct service_node *srv;
 	int64_t timestamp, service_due_timestamp;
+	bool flush;
 
 	/*
 	 * 1. scan the observer list
@@ -4079,28 +4262,59 @@ static int lwm2m_engine_service(void)
 	 *    attaching the notify response handler
 	 */
 	timestamp = k_uptime_get();
-	SYS_SLIST_FOR_EACH_CONTAINER(&engine_observer_list, obs, node) {
-		/*
-		 * manual notify requirements:
-		 * - event_timestamp > last_timestamp
-		 * - current timestamp > last_timestamp + min_period_sec
-		 */
-		if (obs->event_timestamp > obs->last_timestamp &&
-		    timestamp > obs->last_timestamp +
-				MSEC_PER_SEC * obs->min_period_sec) {
-			obs->last_timestamp = k_uptime_get();
-			generate_notify_message(obs, true);
 
-		/*
-		 * automatic time-based notify requirements:
-		 * - current timestamp > last_timestamp + max_period_sec
-		 */
-		} else if (timestamp > obs->last_timestamp +
-				MSEC_PER_SEC * obs->max_period_sec) {
-			obs->last_timestamp = k_uptime_get();
-			generate_notify_message(obs, false);
+	/* With a non zero aggregation window a due notification may be
+	 * held back for up to the window so that observers becoming due
+	 * shortly after it can be flushed in the same pass.  A pmax
+	 * driven notification is never delayed and flushes the rest.
+	 */
+	flush = (CONFIG_LWM2M_NOTIFY_AGGREGATION_MS == 0);
+	if (!flush) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&engine_observer_list, obs,
+					     node) {
+			int64_t due = MAX(obs->event_timestamp,
+					  obs->last_timestamp +
+					  MSEC_PER_SEC * obs->min_period_sec);
+
+			if (obs->event_timestamp > obs->last_timestamp &&
+			    timestamp > due +
+					CONFIG_LWM2M_NOTIFY_AGGREGATION_MS) {
+				flush = true;
+				break;
+			}
+
+			if (timestamp > obs->last_timestamp +
+					MSEC_PER_SEC * obs->max_period_sec) {
+				flush = true;
+				break;
+			}
 		}
+	}
 
+	if (flush) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&engine_observer_list, obs, node) {
+			/*
+			 * manual notify requirements:
+			 * - event_timestamp > last_timestamp
+			 * - current timestamp > last_timestamp + min_period_sec
+			 */
+			if (obs->event_timestamp > obs->last_timestamp &&
+			    timestamp > obs->last_timestamp +
+					MSEC_PER_SEC * obs->min_period_sec) {
+				obs->last_timestamp = k_uptime_get();
+				generate_notify_message(obs, true);
+
+			/*
+			 * automatic time-based notify requirements:
+			 * - current timestamp > last_timestamp + max_period_sec
+			 */
+			} else if (timestamp > obs->last_timestamp +
+					MSEC_PER_SEC * obs->max_period_sec) {
+				obs->last_timestamp = k_uptime_get();
+				generate_notify_message(obs, false);
+			}
+
+		}
 	}
 
 	timestamp = k_uptime_get();
@@ -73,6 +73,7 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 #include "lwm2m_rw_json.h"
 #include "lwm2m_rw_plain_text.h"
 #include "lwm2m_engine.h"
+#include "lwm2m_util.h"
 
 #define T_OBJECT_BEGIN	BIT(0)
 #define T_OBJECT_END	BIT(1)
@@ -336,44 +337,51 @@ static size_t put_json_prefix(struct lwm2m_output_context *out,
 {
 	struct json_out_formatter_data *fd;
 	char *sep;
-	int len = 0;
+	size_t len = 0;
 
 	fd = engine_get_out_user_data(out);
 	if (!fd) {
 		return 0;
 	}
 
+	/* Assemble the name prefix directly: it is emitted once per
+	 * resource on whole-instance reads, where printf-style
+	 * formatting dominated the encode time.  The worst case fits
+	 * TOKEN_BUF_LEN with plenty to spare, so the pieces are
+	 * appended unchecked.
+	 */
 	sep = SEPARATOR(fd->writer_flags);
-	if (fd->path_level >= 2U) {
-		if (fd->writer_flags & WRITER_RESOURCE_INSTANCE) {
-			len = snprintk(json_buffer, sizeof(json_buffer),
-				       "%s{\"n\":\"%u/%u\",%s:",
-				       sep, path->res_id, path->res_inst_id,
-				       format);
-		} else {
-			len = snprintk(json_buffer, sizeof(json_buffer),
-				       "%s{\"n\":\"%u\",%s:",
-				       sep, path->res_id, format);
-		}
-	} else {
-		if (fd->writer_flags & WRITER_RESOURCE_INSTANCE) {
-			len = snprintk(json_buffer, sizeof(json_buffer),
-				       "%s{\"n\":\"%u/%u/%u\",%s:",
-				       sep, path->obj_inst_id, path->res_id,
-				       path->res_inst_id, format);
-		} else {
-			len = snprintk(json_buffer, sizeof(json_buffer),
-				       "%s{\"n\":\"%u/%u\",%s:",
-				       sep, path->obj_inst_id, path->res_id,
-				       format);
-		}
+	while (*sep != '\0') {
+		json_buffer[len++] = *sep++;
 	}
 
-	if (len < 0) {
-		/* TODO: Generate error? */
-		return 0;
+	memcpy(&json_buffer[len], "{\"n\":\"", 6);
+	len += 6U;
+
+	if (fd->path_level < 2U) {
+		len += lwm2m_u64_to_str(path->obj_inst_id, &json_buffer[len],
+					sizeof(json_buffer) - len);
+		json_buffer[len++] = '/';
+	}
+
+	len += lwm2m_u64_to_str(path->res_id, &json_buffer[len],
+				sizeof(json_buffer) - len);
+
+	if (fd->writer_flags & WRITER_RESOURCE_INSTANCE) {
+		json_buffer[len++] = '/';
+		len += lwm2m_u64_to_str(path->res_inst_id, &json_buffer[len],
+					sizeof(json_buffer) - len);
+	}
+
+	json_buffer[len++] = '"';
+	json_buffer[len++] = ',';
+
+	while (*format != '\0') {
+		json_buffer[len++] = *format++;
 	}
 
+	json_buffer[len++] = ':';
+
 	if (buf_append(CPKT_BUF_WRITE(out->out_cpkt), json_buffer, len) < 0) {
 		/* TODO: Generate error? */
 		return 0;
@@ -400,13 +408,27 @@ static size_t put_json_postfix(struct lwm2m_output_context *out)
 	return 1;
 }
 
+static size_t put_number(struct lwm2m_output_context *out, int64_t value)
+{
+	char buf[sizeof("-9223372036854775808")];
+	size_t len;
+
+	len = lwm2m_s64_to_str(value, buf, sizeof(buf));
+	if (len == 0U ||
+	    buf_append(CPKT_BUF_WRITE(out->out_cpkt), buf, len) < 0) {
+		return 0;
+	}
+
+	return len;
+}
+
 static size_t put_s32(struct lwm2m_output_context *out,
 		      struct lwm2m_obj_path *path, int32_t value)
 {
 	int len;
 
 	len = put_json_prefix(out, path, "\"v\"");
-	len += plain_text_put_format(out, "%d", value);
+	len += put_number(out, (int64_t)value);
 	len += put_json_postfix(out);
 
 	return (size_t)len;
@@ -430,7 +452,7 @@ static size_t put_s64(struct lwm2m_output_context *out,
 	int len;
 
 	len = put_json_prefix(out, path, "\"v\"");
-	len += plain_text_put_format(out, "%lld", value);
+	len += put_number(out, value);
 	len += put_json_postfix(out);
 	return (size_t)len;
 }
@@ -521,7 +543,15 @@ static size_t put_bool(struct lwm2m_output_context *out,
 	size_t len;
 
 	len = put_json_prefix(out, path, "\"bv\"");
-	len += plain_text_put_format(out, "%s", value ? "true" : "false");
+
+	if (value) {
+		len += buf_append(CPKT_BUF_WRITE(out->out_cpkt),
+				  "true", 4) < 0 ? 0 : 4;
+	} else {
+		len += buf_append(CPKT_BUF_WRITE(out->out_cpkt),
+				  "false", 5) < 0 ? 0 : 5;
+	}
+
 	len += put_json_postfix(out);
 	return (size_t)len;
 }
@@ -533,8 +563,13 @@ static size_t put_objlnk(struct lwm2m_output_context *out,
 	size_t len;
 
 	len = put_json_prefix(out, path, "\"ov\"");
-	len += plain_text_put_format(out, "\"%u:%u\"", value->obj_id,
-				     value->obj_inst);
+	len += put_char(out, '"');
+
+	len += put_number(out, value->obj_id);
+	len += put_char(out, ':');
+	len += put_number(out, value->obj_inst);
+
+	len += put_char(out, '"');
 	len += put_json_postfix(out);
 
 	return len;
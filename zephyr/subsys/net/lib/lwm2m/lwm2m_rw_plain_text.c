@@ -71,6 +71,7 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 #include "lwm2m_object.h"
 #include "lwm2m_rw_plain_text.h"
 #include "lwm2m_engine.h"
+#include "lwm2m_util.h"
 
 /* some temporary buffer space for format conversions */
 static char pt_buffer[42]; /* can handle float64 format */
@@ -97,79 +98,89 @@ size_t plain_text_put_format(struct lwm2m_output_context *out,
 	return (size_t)n;
 }
 
+static size_t put_s64(struct lwm2m_output_context *out,
+		      struct lwm2m_obj_path *path, int64_t value)
+{
+	char buf[sizeof("-9223372036854775808")];
+	size_t len;
+
+	len = lwm2m_s64_to_str(value, buf, sizeof(buf));
+	if (len == 0U ||
+	    buf_append(CPKT_BUF_WRITE(out->out_cpkt), buf, len) < 0) {
+		return 0;
+	}
+
+	return len;
+}
+
 static size_t put_s32(struct lwm2m_output_context *out,
 		      struct lwm2m_obj_path *path, int32_t value)
 {
-	return plain_text_put_format(out, "%d", value);
+	return put_s64(out, path, (int64_t)value);
 }
 
 static size_t put_s8(struct lwm2m_output_context *out,
 		     struct lwm2m_obj_path *path, int8_t value)
 {
-	return plain_text_put_format(out, "%d", value);
+	return put_s64(out, path, (int64_t)value);
 }
 
 static size_t put_s16(struct lwm2m_output_context *out,
 		      struct lwm2m_obj_path *path, int16_t value)
 {
-	return plain_text_put_format(out, "%d", value);
-}
-
-static size_t put_s64(struct lwm2m_output_context *out,
-		      struct lwm2m_obj_path *path, int64_t value)
-{
-	return plain_text_put_format(out, "%lld", value);
+	return put_s64(out, path, (int64_t)value);
 }
 
 size_t plain_text_put_float32fix(struct lwm2m_output_context *out,
 				 struct lwm2m_obj_path *path,
 				 float32_value_t *value)
 {
-	size_t len;
-	char buf[sizeof("000000")];
-
-	/* value of 123 -> "000123" -- ignore sign */
-	len = snprintk(buf, sizeof(buf), "%06d", abs(value->val2));
-	if (len != 6U) {
-		strcpy(buf, "0");
-	} else {
-		/* clear ending zeroes, but leave 1 if needed */
-		while (len > 1U && buf[len - 1] == '0') {
-			buf[--len] = '\0';
-		}
+	/* sign, int32 whole part, '.', 6 fraction digits, NUL */
+	char buf[sizeof("-") + sizeof("-2147483648.000000")];
+	size_t len = 0;
+
+	/* handle negative val2 when val1 is 0 */
+	if (value->val1 == 0 && value->val2 < 0) {
+		buf[len++] = '-';
+	}
+
+	len += lwm2m_s64_to_str(value->val1, &buf[len], sizeof(buf) - len);
+	buf[len++] = '.';
+	len += lwm2m_frac_to_str(value->val2 < 0 ?
+					-(int64_t)value->val2 : value->val2,
+				 6U, &buf[len], sizeof(buf) - len);
+
+	if (buf_append(CPKT_BUF_WRITE(out->out_cpkt), buf, len) < 0) {
+		return 0;
 	}
 
-	return plain_text_put_format(out, "%s%d.%s",
-				     /* handle negative val2 when val1 is 0 */
-				     (value->val1 == 0 && value->val2 < 0) ?
-						"-" : "",
-				     value->val1, buf);
+	return len;
 }
 
 size_t plain_text_put_float64fix(struct lwm2m_output_context *out,
 				 struct lwm2m_obj_path *path,
 				 float64_value_t *value)
 {
-	size_t len;
-	char buf[sizeof("000000000")];
-
-	/* value of 123 -> "000000123" -- ignore sign */
-	len = snprintf(buf, sizeof(buf), "%09lld",
-		       (long long int)abs(value->val2));
-	if (len != 9U) {
-		strcpy(buf, "0");
-	} else {
-		/* clear ending zeroes, but leave 1 if needed */
-		while (len > 1U && buf[len - 1] == '0') {
-			buf[--len] = '\0';
-		}
+	/* sign, int64 whole part, '.', 9 fraction digits, NUL */
+	char buf[sizeof("-") + sizeof("-9223372036854775808.000000000")];
+	size_t len = 0;
+
+	/* handle negative val2 when val1 is 0 */
+	if (value->val1 == 0 && value->val2 < 0) {
+		buf[len++] = '-';
+	}
+
+	len += lwm2m_s64_to_str(value->val1, &buf[len], sizeof(buf) - len);
+	buf[len++] = '.';
+	len += lwm2m_frac_to_str(value->val2 < 0 ?
+					-value->val2 : value->val2,
+				 9U, &buf[len], sizeof(buf) - len);
+
+	if (buf_append(CPKT_BUF_WRITE(out->out_cpkt), buf, len) < 0) {
+		return 0;
 	}
 
-	return plain_text_put_format(out, "%s%lld.%s",
-				     /* handle negative val2 when val1 is 0 */
-				     (value->val1 == 0 && value->val2 < 0) ?
-						"-" : "",
-				     value->val1, buf);
+	return len;
 }
 
 static size_t put_string(struct lwm2m_output_context *out,
@@ -187,19 +198,32 @@ static size_t put_bool(struct lwm2m_output_context *out,
 		       struct lwm2m_obj_path *path,
 		       bool value)
 {
-	if (value) {
-		return plain_text_put_format(out, "%u", 1);
-	} else {
-		return plain_text_put_format(out, "%u", 0);
+	uint8_t tmp = value ? '1' : '0';
+
+	if (buf_append(CPKT_BUF_WRITE(out->out_cpkt), &tmp, 1) < 0) {
+		return 0;
 	}
+
+	return 1;
 }
 
 static size_t put_objlnk(struct lwm2m_output_context *out,
 			 struct lwm2m_obj_path *path,
 			 struct lwm2m_objlnk *value)
 {
-	return plain_text_put_format(out, "%u:%u", value->obj_id,
-				     value->obj_inst);
+	char buf[sizeof("65535:65535")];
+	size_t len;
+
+	len = lwm2m_u64_to_str(value->obj_id, buf, sizeof(buf));
+	buf[len++] = ':';
+	len += lwm2m_u64_to_str(value->obj_inst, &buf[len],
+				sizeof(buf) - len);
+
+	if (buf_append(CPKT_BUF_WRITE(out->out_cpkt), buf, len) < 0) {
+		return 0;
+	}
+
+	return len;
 }
 
 static int get_length_left(struct lwm2m_input_context *in)
@@ -296,3 +296,73 @@ int lwm2m_b64_to_f64(uint8_t *b64, size_t len, float64_value_t *f64)
 
 	return 0;
 }
+
+/* Fast integer-to-ASCII conversion.  The content formatters sit on the
+ * registration-interface read path and were spending most of their time
+ * inside printf-style formatting; these helpers emit digits directly.
+ */
+size_t lwm2m_u64_to_str(uint64_t value, char *buf, size_t buflen)
+{
+	char tmp[20]; /* up to UINT64_MAX */
+	size_t len = 0;
+
+	do {
+		tmp[len++] = (value % 10) + '0';
+		value /= 10;
+	} while (value > 0 && len < sizeof(tmp));
+
+	if (len >= buflen) {
+		return 0;
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		buf[i] = tmp[len - 1 - i];
+	}
+
+	buf[len] = '\0';
+	return len;
+}
+
+size_t lwm2m_s64_to_str(int64_t value, char *buf, size_t buflen)
+{
+	size_t len = 0;
+	uint64_t uval;
+
+	if (value < 0) {
+		if (buflen < 2) {
+			return 0;
+		}
+
+		buf[len++] = '-';
+		/* negating in unsigned space handles INT64_MIN */
+		uval = ~(uint64_t)value + 1ULL;
+	} else {
+		uval = (uint64_t)value;
+	}
+
+	return len + lwm2m_u64_to_str(uval, buf + len, buflen - len);
+}
+
+size_t lwm2m_frac_to_str(uint64_t value, uint8_t digits, char *buf,
+			 size_t buflen)
+{
+	size_t len = digits;
+
+	if (digits == 0U || (size_t)digits >= buflen) {
+		return 0;
+	}
+
+	/* fixed width, zero padded */
+	for (int i = digits - 1; i >= 0; i--) {
+		buf[i] = (value % 10) + '0';
+		value /= 10;
+	}
+
+	/* clear ending zeroes, but leave 1 if needed */
+	while (len > 1U && buf[len - 1] == '0') {
+		len--;
+	}
+
+	buf[len] = '\0';
+	return len;
+}
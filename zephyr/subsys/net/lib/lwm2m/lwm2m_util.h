@@ -17,4 +17,17 @@ int lwm2m_f64_to_b64(float64_value_t *f64, uint8_t *b64, size_t len);
 int lwm2m_b32_to_f32(uint8_t *b32, size_t len, float32_value_t *f32);
 int lwm2m_b64_to_f64(uint8_t *b64, size_t len, float64_value_t *f64);
 
+/* fast integer-to-ASCII conversions (avoid printf-style formatting on
+ * the content-format encode paths); all NUL-terminate and return the
+ * string length, or 0 if the buffer is too small
+ */
+size_t lwm2m_u64_to_str(uint64_t value, char *buf, size_t buflen);
+size_t lwm2m_s64_to_str(int64_t value, char *buf, size_t buflen);
+
+/* render exactly "digits" zero-padded decimal digits of a fraction
+ * value, then trim trailing zeroes (leaving at least one digit)
+ */
+size_t lwm2m_frac_to_str(uint64_t value, uint8_t digits, char *buf,
+			 size_t buflen);
+
 #endif /* LWM2M_UTIL_H_ */
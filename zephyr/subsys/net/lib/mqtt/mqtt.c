@@ -287,6 +287,80 @@ error:
 	return err_code;
 }
 
+int mqtt_publish_stream(struct mqtt_client *client,
+			const struct mqtt_publish_param *param,
+			mqtt_payload_stream_cb_t cb, void *user_data)
+{
+	int err_code;
+	struct buf_ctx packet;
+	size_t offset = 0;
+
+	NULL_PARAM_CHECK(client);
+	NULL_PARAM_CHECK(param);
+	NULL_PARAM_CHECK(cb);
+
+	MQTT_TRC("[CID %p]:[State 0x%02x]: >> Topic size 0x%08x, "
+		 "Data size 0x%08x (streamed)", client, client->internal.state,
+		 param->message.topic.topic.size,
+		 param->message.payload.len);
+
+	mqtt_mutex_lock(client);
+
+	tx_buf_init(client, &packet);
+
+	err_code = verify_tx_state(client);
+	if (err_code < 0) {
+		goto error;
+	}
+
+	err_code = publish_encode(param, &packet);
+	if (err_code < 0) {
+		goto error;
+	}
+
+	/* The headers must go out before tx_buf can be reused as the
+	 * chunk staging area.
+	 */
+	err_code = client_write(client, packet.cur,
+				packet.end - packet.cur);
+	if (err_code < 0) {
+		goto error;
+	}
+
+	while (offset < param->message.payload.len) {
+		size_t chunk = MIN(param->message.payload.len - offset,
+				   client->tx_buf_size);
+		int len;
+
+		len = cb(client, client->tx_buf, chunk, offset, user_data);
+		if (len <= 0) {
+			/* The message length was already announced to
+			 * the broker, a short payload corrupts the
+			 * stream.
+			 */
+			err_code = (len == 0) ? -EIO : len;
+			client_disconnect(client, err_code, true);
+			goto error;
+		}
+
+		err_code = client_write(client, client->tx_buf,
+					MIN((size_t)len, chunk));
+		if (err_code < 0) {
+			goto error;
+		}
+
+		offset += MIN((size_t)len, chunk);
+	}
+
+error:
+	MQTT_TRC("[CID %p]:[State 0x%02x]: << result 0x%08x",
+			 client, client->internal.state, err_code);
+
+	mqtt_mutex_unlock(client);
+
+	return err_code;
+}
+
 int mqtt_publish_qos1_ack(struct mqtt_client *client,
 			  const struct mqtt_puback_param *param)
 {
@@ -6,6 +6,7 @@
 
 /* libc headers */
 #include <stdlib.h>
+#include <string.h>
 #include <ctype.h>
 
 /* Zephyr headers */
@@ -190,6 +191,25 @@ int z_impl_z_zsock_getaddrinfo_internal(const char *host, const char *service,
 		return 0;
 	}
 
+	/* Do the same for IPv6 numeric addresses, after the same kind of
+	 * quick heuristic: a literal must contain a colon.
+	 */
+	if (RESOLVE_IPV6(family) &&
+	    strchr(host, ':') != NULL &&
+	    zsock_inet_pton(AF_INET6, host,
+			    &net_sin6(&res->_ai_addr)->sin6_addr) == 1) {
+		struct sockaddr_in6 *addr =
+			(struct sockaddr_in6 *)&res->_ai_addr;
+
+		addr->sin6_port = htons(port);
+		addr->sin6_family = AF_INET6;
+		INIT_ADDRINFO(res, addr);
+		res->ai_family = AF_INET6;
+		res->ai_socktype = SOCK_STREAM;
+		res->ai_protocol = IPPROTO_TCP;
+		return 0;
+	}
+
 	if (ai_flags & AI_NUMERICHOST) {
 		/* Asked to resolve host as numeric, but it wasn't possible
 		 * to do that.
@@ -197,6 +217,69 @@ int z_impl_z_zsock_getaddrinfo_internal(const char *host, const char *service,
 		return DNS_EAI_FAIL;
 	}
 
+#if defined(CONFIG_NET_SOCKETS_STATIC_HOSTS)
+	{
+		int idx = 0;
+
+		Z_STRUCT_SECTION_FOREACH(zsock_static_host, entry) {
+			struct sockaddr addr;
+
+			if (idx >= AI_ARR_MAX) {
+				break;
+			}
+
+			if (strcmp(entry->name, host) != 0) {
+				continue;
+			}
+
+			if (!net_ipaddr_parse(entry->address,
+					      strlen(entry->address), &addr)) {
+				LOG_ERR("Invalid static host address %s",
+					entry->address);
+				continue;
+			}
+
+			if (addr.sa_family == AF_INET &&
+			    RESOLVE_IPV4(family)) {
+				struct sockaddr_in *in =
+					(struct sockaddr_in *)
+						&res[idx]._ai_addr;
+
+				memcpy(in, net_sin(&addr), sizeof(*in));
+				in->sin_port = htons(port);
+				INIT_ADDRINFO(&res[idx], in);
+				res[idx].ai_family = AF_INET;
+			} else if (addr.sa_family == AF_INET6 &&
+				   RESOLVE_IPV6(family)) {
+				struct sockaddr_in6 *in6 =
+					(struct sockaddr_in6 *)
+						&res[idx]._ai_addr;
+
+				memcpy(in6, net_sin6(&addr), sizeof(*in6));
+				in6->sin6_port = htons(port);
+				INIT_ADDRINFO(&res[idx], in6);
+				res[idx].ai_family = AF_INET6;
+			} else {
+				continue;
+			}
+
+			res[idx].ai_socktype = SOCK_STREAM;
+			res[idx].ai_protocol = IPPROTO_TCP;
+
+			if (idx > 0) {
+				res[idx - 1].ai_next = &res[idx];
+			}
+
+			idx++;
+		}
+
+		if (idx > 0) {
+			res[idx - 1].ai_next = NULL;
+			return 0;
+		}
+	}
+#endif /* CONFIG_NET_SOCKETS_STATIC_HOSTS */
+
 	ai_state.hints = hints;
 	ai_state.idx = 0U;
 	ai_state.port = htons(port);
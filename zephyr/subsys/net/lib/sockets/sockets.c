@@ -18,6 +18,9 @@ LOG_MODULE_REGISTER(net_sock, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <syscall_handler.h>
 #include <sys/fdtable.h>
 #include <sys/math_extras.h>
+#if defined(CONFIG_NET_SOCKETS_SENDFILE)
+#include <fs/fs.h>
+#endif
 
 #if defined(CONFIG_SOCKS)
 #include "socks.h"
@@ -748,6 +751,60 @@ fail:
 #include <syscalls/zsock_sendmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_zsock_sendmmsg(int sock, struct zsock_mmsghdr *msgs,
+			  unsigned int vlen, int flags)
+{
+	unsigned int i;
+
+	for (i = 0; i < vlen; i++) {
+		ssize_t ret;
+
+		ret = z_impl_zsock_sendmsg(sock, &msgs[i].msg_hdr, flags);
+		if (ret < 0) {
+			/* errno is already set, report the datagrams that
+			 * were sent before the error.
+			 */
+			return i > 0 ? (int)i : -1;
+		}
+
+		msgs[i].msg_len = ret;
+	}
+
+	return i;
+}
+
+#ifdef CONFIG_USERSPACE
+static int z_vrfy_zsock_sendmmsg(int sock, struct zsock_mmsghdr *msgs,
+				 unsigned int vlen, int flags)
+{
+	unsigned int i;
+
+	/* Same burst limit as Linux (UIO_MAXIOV), this also keeps the
+	 * size calculation below from overflowing.
+	 */
+	Z_OOPS(Z_SYSCALL_VERIFY(vlen <= 1024));
+	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(msgs,
+				      vlen * sizeof(struct zsock_mmsghdr)));
+
+	for (i = 0; i < vlen; i++) {
+		unsigned int msg_len;
+		ssize_t ret;
+
+		ret = z_vrfy_zsock_sendmsg(sock, &msgs[i].msg_hdr, flags);
+		if (ret < 0) {
+			return i > 0 ? (int)i : -1;
+		}
+
+		msg_len = ret;
+		Z_OOPS(z_user_to_copy(&msgs[i].msg_len, &msg_len,
+				      sizeof(msg_len)));
+	}
+
+	return i;
+}
+#include <syscalls/zsock_sendmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 static int sock_get_pkt_src_addr(struct net_pkt *pkt,
 				 enum net_ip_protocol proto,
 				 struct sockaddr *addr,
@@ -1094,6 +1151,269 @@ ssize_t z_vrfy_zsock_recvfrom(int sock, void *buf, size_t max_len, int flags,
 #include <syscalls/zsock_recvfrom_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_zsock_recvmmsg(int sock, struct zsock_mmsghdr *msgs,
+			  unsigned int vlen, int flags)
+{
+	unsigned int i;
+
+	for (i = 0; i < vlen; i++) {
+		struct msghdr *msg_hdr = &msgs[i].msg_hdr;
+		socklen_t addrlen = msg_hdr->msg_namelen;
+		ssize_t ret;
+
+		if (msg_hdr->msg_iovlen < 1) {
+			errno = EINVAL;
+			return i > 0 ? (int)i : -1;
+		}
+
+		/* Only the first datagram of the burst may block, the
+		 * rest is drained without waiting.
+		 */
+		ret = z_impl_zsock_recvfrom(sock,
+					    msg_hdr->msg_iov[0].iov_base,
+					    msg_hdr->msg_iov[0].iov_len,
+					    i > 0 ?
+					    flags | ZSOCK_MSG_DONTWAIT : flags,
+					    msg_hdr->msg_name,
+					    msg_hdr->msg_name ?
+					    &addrlen : NULL);
+		if (ret < 0) {
+			if (i > 0 && errno == EAGAIN) {
+				return i;
+			}
+
+			return i > 0 ? (int)i : -1;
+		}
+
+		msg_hdr->msg_namelen = addrlen;
+		msgs[i].msg_len = ret;
+	}
+
+	return i;
+}
+
+#ifdef CONFIG_USERSPACE
+static int z_vrfy_zsock_recvmmsg(int sock, struct zsock_mmsghdr *msgs,
+				 unsigned int vlen, int flags)
+{
+	unsigned int i;
+
+	/* Same burst limit as Linux (UIO_MAXIOV), this also keeps the
+	 * size calculation below from overflowing.
+	 */
+	Z_OOPS(Z_SYSCALL_VERIFY(vlen <= 1024));
+	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(msgs,
+				      vlen * sizeof(struct zsock_mmsghdr)));
+
+	for (i = 0; i < vlen; i++) {
+		struct msghdr msg_copy;
+		struct iovec iov_copy;
+		unsigned int msg_len;
+		ssize_t ret;
+
+		Z_OOPS(z_user_from_copy(&msg_copy, &msgs[i].msg_hdr,
+					sizeof(msg_copy)));
+		Z_OOPS(Z_SYSCALL_VERIFY(msg_copy.msg_iovlen >= 1));
+		Z_OOPS(z_user_from_copy(&iov_copy, msg_copy.msg_iov,
+					sizeof(iov_copy)));
+
+		/* The buffer and address pointers are validated by
+		 * the recvfrom handler.
+		 */
+		ret = z_vrfy_zsock_recvfrom(sock, iov_copy.iov_base,
+					    iov_copy.iov_len,
+					    i > 0 ?
+					    flags | ZSOCK_MSG_DONTWAIT : flags,
+					    msg_copy.msg_name,
+					    msg_copy.msg_name ?
+					    &msgs[i].msg_hdr.msg_namelen :
+					    NULL);
+		if (ret < 0) {
+			if (i > 0 && errno == EAGAIN) {
+				return i;
+			}
+
+			return i > 0 ? (int)i : -1;
+		}
+
+		msg_len = ret;
+		Z_OOPS(z_user_to_copy(&msgs[i].msg_len, &msg_len,
+				      sizeof(msg_len)));
+	}
+
+	return i;
+}
+#include <syscalls/zsock_recvmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+ssize_t zsock_recv_pkt(int sock, struct net_pkt **result, int flags,
+		       struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	const struct socket_op_vtable *vtable;
+	k_timeout_t timeout = K_FOREVER;
+	struct net_context *ctx;
+	struct net_pkt *pkt;
+
+	ctx = get_sock_vtable(sock, &vtable);
+	if (!ctx) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable != &sock_fd_op_vtable) {
+		/* TLS, CAN etc. sockets own their queued data */
+		errno = ENOTSUP;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	}
+
+	pkt = k_fifo_get(&ctx->recv_q, timeout);
+	if (!pkt) {
+		errno = EAGAIN;
+		return -1;
+	}
+
+	if (src_addr && addrlen) {
+		int rv;
+
+		rv = sock_get_pkt_src_addr(pkt, net_context_get_ip_proto(ctx),
+					   src_addr, *addrlen);
+		if (rv < 0) {
+			errno = -rv;
+			net_pkt_unref(pkt);
+			return -1;
+		}
+
+		if (src_addr->sa_family == AF_INET) {
+			*addrlen = sizeof(struct sockaddr_in);
+		} else if (src_addr->sa_family == AF_INET6) {
+			*addrlen = sizeof(struct sockaddr_in6);
+		} else {
+			errno = ENOTSUP;
+			net_pkt_unref(pkt);
+			return -1;
+		}
+	}
+
+	net_stats_update_tc_rx_time(net_pkt_iface(pkt),
+				    net_pkt_priority(pkt),
+				    net_pkt_timestamp(pkt)->nanosecond,
+				    k_cycle_get_32());
+
+	*result = pkt;
+
+	return net_pkt_remaining_data(pkt);
+}
+
+int zsock_pkt_iovec(struct net_pkt *pkt, struct iovec *iov, int iov_cnt)
+{
+	struct net_buf *buf = pkt->cursor.buf;
+	uint8_t *pos = pkt->cursor.pos;
+	int cnt = 0;
+
+	while (buf) {
+		size_t len = buf->len - (pos - buf->data);
+
+		if (len > 0) {
+			if (cnt == iov_cnt) {
+				return -EMSGSIZE;
+			}
+
+			iov[cnt].iov_base = pos;
+			iov[cnt].iov_len = len;
+			cnt++;
+		}
+
+		buf = buf->frags;
+		pos = buf ? buf->data : NULL;
+	}
+
+	return cnt;
+}
+
+void zsock_pkt_free(struct net_pkt *pkt)
+{
+	net_pkt_unref(pkt);
+}
+#endif /* CONFIG_NET_SOCKETS_ZEROCOPY */
+
+#if defined(CONFIG_NET_SOCKETS_SENDFILE)
+ssize_t zsock_sendfile(int sock, struct fs_file_t *file, off_t *offset,
+		       size_t count)
+{
+	uint8_t chunk[CONFIG_NET_SOCKETS_SENDFILE_CHUNK_SIZE];
+	ssize_t total = 0;
+	off_t orig_pos = 0;
+	int err = 0;
+
+	if (offset != NULL) {
+		orig_pos = fs_tell(file);
+		if (orig_pos < 0) {
+			errno = (int)-orig_pos;
+			return -1;
+		}
+
+		err = fs_seek(file, *offset, FS_SEEK_SET);
+		if (err < 0) {
+			errno = -err;
+			return -1;
+		}
+	}
+
+	while ((size_t)total < count) {
+		size_t pos = 0;
+		ssize_t len;
+
+		len = fs_read(file, chunk,
+			      MIN(count - (size_t)total, sizeof(chunk)));
+		if (len < 0) {
+			err = (int)len;
+			break;
+		}
+
+		if (len == 0) {
+			/* End of file before count bytes; not an error,
+			 * same as BSD sendfile().
+			 */
+			break;
+		}
+
+		while (pos < (size_t)len) {
+			ssize_t out = zsock_send(sock, chunk + pos,
+						 (size_t)len - pos, 0);
+
+			if (out < 0) {
+				err = -errno;
+				break;
+			}
+
+			pos += out;
+			total += out;
+		}
+
+		if (err != 0) {
+			break;
+		}
+	}
+
+	if (offset != NULL) {
+		*offset += total;
+		(void)fs_seek(file, orig_pos, FS_SEEK_SET);
+	}
+
+	if (err != 0 && total == 0) {
+		errno = -err;
+		return -1;
+	}
+
+	return total;
+}
+#endif /* CONFIG_NET_SOCKETS_SENDFILE */
+
 /* As this is limited function, we don't follow POSIX signature, with
  * "..." instead of last arg.
  */
@@ -1416,9 +1736,59 @@ int zsock_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 
 				return 0;
 			}
+			break;
+
+		case SO_MAX_PACING_RATE:
+			if (IS_ENABLED(CONFIG_NET_TCP2_CONG_CTRL)) {
+				ret = net_context_get_option(
+						ctx, NET_OPT_PACING_RATE,
+						optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
 		}
 
 		break;
+
+	case IPPROTO_TCP:
+		switch (optname) {
+		case TCP_CONGESTION:
+			ret = net_context_get_option(ctx, NET_OPT_TCP_CONG,
+						     optval, optlen);
+			if (ret < 0) {
+				errno = -ret;
+				return -1;
+			}
+
+			return 0;
+
+		case TCP_NODELAY:
+			ret = net_context_get_option(ctx, NET_OPT_NODELAY,
+						     optval, optlen);
+			if (ret < 0) {
+				errno = -ret;
+				return -1;
+			}
+
+			return 0;
+
+		case TCP_CORK:
+			ret = net_context_get_option(ctx, NET_OPT_CORK,
+						     optval, optlen);
+			if (ret < 0) {
+				errno = -ret;
+				return -1;
+			}
+
+			return 0;
+		}
+		break;
 	}
 
 	errno = ENOPROTOOPT;
@@ -1537,6 +1907,21 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 				return 0;
 			}
 
+			break;
+
+		case SO_MAX_PACING_RATE:
+			if (IS_ENABLED(CONFIG_NET_TCP2_CONG_CTRL)) {
+				ret = net_context_set_option(
+						ctx, NET_OPT_PACING_RATE,
+						optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
 			break;
 		}
 
@@ -1544,10 +1929,42 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 
 	case IPPROTO_TCP:
 		switch (optname) {
+		case TCP_CONGESTION:
+			ret = net_context_set_option(ctx, NET_OPT_TCP_CONG,
+						     optval, optlen);
+			if (ret < 0) {
+				errno = -ret;
+				return -1;
+			}
+
+			return 0;
+
 		case TCP_NODELAY:
-			/* Ignore for now. Provided to let port
-			 * existing apps.
-			 */
+			ret = net_context_set_option(ctx, NET_OPT_NODELAY,
+						     optval, optlen);
+			if (ret == -ENOTSUP) {
+				/* Segments are sent immediately anyway
+				 * without autocorking; accept the option
+				 * to let existing apps port.
+				 */
+				return 0;
+			}
+
+			if (ret < 0) {
+				errno = -ret;
+				return -1;
+			}
+
+			return 0;
+
+		case TCP_CORK:
+			ret = net_context_set_option(ctx, NET_OPT_CORK,
+						     optval, optlen);
+			if (ret < 0) {
+				errno = -ret;
+				return -1;
+			}
+
 			return 0;
 		}
 		break;
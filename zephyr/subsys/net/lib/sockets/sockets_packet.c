@@ -21,6 +21,7 @@ LOG_MODULE_REGISTER(net_sock_packet, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <sys/fdtable.h>
 
 #include "../../ip/net_stats.h"
+#include "../../ip/packet_filter.h"
 
 #include "sockets_internal.h"
 
@@ -265,6 +266,32 @@ int zpacket_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 int zpacket_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 			const void *optval, socklen_t optlen)
 {
+	if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET_FILTER) &&
+	    level == SOL_SOCKET) {
+		int ret;
+
+		if (optname == SO_ATTACH_FILTER) {
+			if (!optval || optlen < sizeof(struct sock_fprog)) {
+				errno = EINVAL;
+				return -1;
+			}
+
+			ret = net_packet_filter_attach(
+				ctx, (const struct sock_fprog *)optval);
+			if (ret < 0) {
+				errno = -ret;
+				return -1;
+			}
+
+			return 0;
+		}
+
+		if (optname == SO_DETACH_FILTER) {
+			net_packet_filter_detach(ctx);
+			return 0;
+		}
+	}
+
 	return sock_fd_op_vtable.setsockopt(ctx, level, optname,
 					    optval, optlen);
 }
@@ -35,6 +35,7 @@ LOG_MODULE_REGISTER(net_sock_tls, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <mbedtls/ssl_cookie.h>
 #include <mbedtls/error.h>
 #include <mbedtls/debug.h>
+#include <mbedtls/platform.h>
 #endif /* CONFIG_MBEDTLS */
 
 #include "sockets_internal.h"
@@ -83,6 +84,11 @@ struct tls_context {
 	/** Information whether TLS context was initialized. */
 	bool is_initialized;
 
+	/** Information whether a nonblocking handshake is in progress,
+	 *  to be driven from the poll update function.
+	 */
+	bool handshake_in_progress;
+
 	/** Information whether TLS handshake is complete or not. */
 	struct k_sem tls_established;
 
@@ -145,6 +151,69 @@ static mbedtls_ctr_drbg_context tls_ctr_drbg;
 /* A global pool of TLS contexts. */
 static struct tls_context tls_contexts[CONFIG_NET_SOCKETS_TLS_MAX_CONTEXTS];
 
+#if defined(CONFIG_NET_SOCKETS_TLS_MEM_POOL)
+#if !defined(MBEDTLS_PLATFORM_MEMORY)
+#error "CONFIG_NET_SOCKETS_TLS_MEM_POOL requires MBEDTLS_PLATFORM_MEMORY" \
+	" to be enabled in the mbedTLS configuration file"
+#endif
+
+/* Dedicated arena for mbedTLS allocations.  The power-of-four block
+ * splitting of the memory pool acts as size classes for the mbedTLS
+ * allocation profile (many small bignum limbs and cipher contexts plus
+ * two large record buffers per context), and keeps TLS churn from
+ * fragmenting the shared libc heap.
+ */
+K_MEM_POOL_DEFINE(tls_mem_pool,
+		  CONFIG_NET_SOCKETS_TLS_MEM_POOL_MIN_BLOCK_SIZE,
+		  CONFIG_NET_SOCKETS_TLS_MEM_POOL_MAX_BLOCK_SIZE,
+		  CONFIG_NET_SOCKETS_TLS_MEM_POOL_BLOCK_COUNT, 4);
+
+static void *tls_calloc(size_t nmemb, size_t size)
+{
+	void *ptr;
+
+	if (size != 0 && nmemb > (SIZE_MAX / size)) {
+		return NULL;
+	}
+
+	ptr = k_mem_pool_malloc(&tls_mem_pool, nmemb * size);
+	if (ptr != NULL) {
+		(void)memset(ptr, 0, nmemb * size);
+	}
+
+	return ptr;
+}
+#endif /* CONFIG_NET_SOCKETS_TLS_MEM_POOL */
+
+#if defined(CONFIG_NET_SOCKETS_TLS_SESSION_CACHE)
+/** Cached TLS session, keyed by the peer address, so that a client
+ *  reconnecting to a recently used server can resume the session
+ *  instead of running the full asymmetric handshake.
+ */
+struct tls_session_cache {
+	/** Information whether the entry holds a valid session. */
+	bool used;
+
+	/** Peer address the session was established with. */
+	struct sockaddr peer;
+
+	/** Length of the peer address. */
+	socklen_t peerlen;
+
+	/** Uptime of the last store/restore, for LRU eviction. */
+	int64_t last_used;
+
+	/** Saved mbedTLS session. */
+	mbedtls_ssl_session session;
+};
+
+static struct tls_session_cache
+	session_cache[CONFIG_NET_SOCKETS_TLS_SESSION_CACHE_ENTRIES];
+
+/* A mutex for protecting the session cache. */
+static struct k_mutex session_cache_lock;
+#endif /* CONFIG_NET_SOCKETS_TLS_SESSION_CACHE */
+
 /* A mutex for protecting TLS context allocation. */
 static struct k_mutex context_lock;
 
@@ -276,6 +345,17 @@ static int tls_init(struct device *unused)
 
 	k_mutex_init(&context_lock);
 
+#if defined(CONFIG_NET_SOCKETS_TLS_MEM_POOL)
+	/* k_free() releases memory pool blocks as well. */
+	(void)mbedtls_platform_set_calloc_free(tls_calloc, k_free);
+#endif
+
+#if defined(CONFIG_NET_SOCKETS_TLS_SESSION_CACHE)
+	(void)memset(session_cache, 0, sizeof(session_cache));
+
+	k_mutex_init(&session_cache_lock);
+#endif
+
 	mbedtls_ctr_drbg_init(&tls_ctr_drbg);
 
 	ret = mbedtls_ctr_drbg_seed(&tls_ctr_drbg, tls_entropy_func, dev,
@@ -300,6 +380,121 @@ static inline bool is_handshake_complete(struct net_context *ctx)
 	return k_sem_count_get(&ctx->tls->tls_established) != 0;
 }
 
+#if defined(CONFIG_NET_SOCKETS_TLS_SESSION_CACHE)
+static struct tls_session_cache *tls_session_find(const struct sockaddr *peer,
+						  socklen_t peerlen)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(session_cache); i++) {
+		if (session_cache[i].used &&
+		    session_cache[i].peerlen == peerlen &&
+		    memcmp(&session_cache[i].peer, peer, peerlen) == 0) {
+			return &session_cache[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void tls_session_store(struct net_context *context,
+			      const struct sockaddr *peer,
+			      socklen_t peerlen)
+{
+	struct tls_session_cache *entry;
+	int i, ret;
+
+	if (peerlen > sizeof(entry->peer)) {
+		return;
+	}
+
+	k_mutex_lock(&session_cache_lock, K_FOREVER);
+
+	entry = tls_session_find(peer, peerlen);
+	if (entry == NULL) {
+		/* Pick a free slot, or evict the least recently used one. */
+		entry = &session_cache[0];
+
+		for (i = 0; i < ARRAY_SIZE(session_cache); i++) {
+			if (!session_cache[i].used) {
+				entry = &session_cache[i];
+				break;
+			}
+
+			if (session_cache[i].last_used < entry->last_used) {
+				entry = &session_cache[i];
+			}
+		}
+
+		if (entry->used) {
+			mbedtls_ssl_session_free(&entry->session);
+			entry->used = false;
+		}
+
+		memcpy(&entry->peer, peer, peerlen);
+		entry->peerlen = peerlen;
+	} else {
+		mbedtls_ssl_session_free(&entry->session);
+		entry->used = false;
+	}
+
+	mbedtls_ssl_session_init(&entry->session);
+
+	ret = mbedtls_ssl_get_session(&context->tls->ssl, &entry->session);
+	if (ret != 0) {
+		mbedtls_ssl_session_free(&entry->session);
+	} else {
+		entry->used = true;
+		entry->last_used = k_uptime_get();
+	}
+
+	k_mutex_unlock(&session_cache_lock);
+}
+
+static void tls_session_restore(struct net_context *context,
+				const struct sockaddr *peer,
+				socklen_t peerlen)
+{
+	struct tls_session_cache *entry;
+	int ret;
+
+	k_mutex_lock(&session_cache_lock, K_FOREVER);
+
+	entry = tls_session_find(peer, peerlen);
+	if (entry != NULL) {
+		/* Failure is not fatal, continue with a full handshake. */
+		ret = mbedtls_ssl_set_session(&context->tls->ssl,
+					      &entry->session);
+		if (ret != 0) {
+			NET_DBG("Session restore failed: -%x", -ret);
+		}
+
+		entry->last_used = k_uptime_get();
+	}
+
+	k_mutex_unlock(&session_cache_lock);
+}
+
+static void tls_session_store_remote(struct net_context *context)
+{
+	socklen_t peerlen;
+
+	if (context->remote.sa_family == AF_INET) {
+		peerlen = sizeof(struct sockaddr_in);
+	} else if (context->remote.sa_family == AF_INET6) {
+		peerlen = sizeof(struct sockaddr_in6);
+	} else {
+		return;
+	}
+
+	tls_session_store(context, &context->remote, peerlen);
+}
+#else
+#define tls_session_store(...)
+#define tls_session_store_remote(...)
+#define tls_session_restore(...)
+#endif /* CONFIG_NET_SOCKETS_TLS_SESSION_CACHE */
+
 /* Allocate TLS context. */
 static struct tls_context *tls_alloc(void)
 {
@@ -809,6 +1004,10 @@ static int tls_mbedtls_handshake(struct net_context *context, bool block)
 		break;
 	}
 
+	if (ret != -EAGAIN) {
+		context->tls->handshake_in_progress = false;
+	}
+
 	if (ret == 0) {
 		k_sem_give(&context->tls->tls_established);
 	}
@@ -1237,13 +1436,27 @@ int ztls_connect_ctx(struct net_context *ctx, const struct sockaddr *addr,
 		/* Do not use any socket flags during the handshake. */
 		ctx->tls->flags = 0;
 
-		/* TODO For simplicity, TLS handshake blocks the socket
-		 * even for non-blocking socket.
-		 */
-		ret = tls_mbedtls_handshake(ctx, true);
+		tls_session_restore(ctx, addr, addrlen);
+
+		if (sock_is_nonblock(ctx)) {
+			ret = tls_mbedtls_handshake(ctx, false);
+			if (ret == -EAGAIN) {
+				/* Let poll() drive the remainder of the
+				 * handshake from its update function.
+				 */
+				ctx->tls->handshake_in_progress = true;
+				errno = EINPROGRESS;
+				return -1;
+			}
+		} else {
+			ret = tls_mbedtls_handshake(ctx, true);
+		}
+
 		if (ret < 0) {
 			goto error;
 		}
+
+		tls_session_store(ctx, addr, addrlen);
 	} else {
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 		/* Just store the address. */
@@ -1402,10 +1615,10 @@ static ssize_t sendto_dtls_client(struct net_context *ctx, const void *buf,
 	}
 
 	if (!is_handshake_complete(ctx)) {
-		/* TODO For simplicity, TLS handshake blocks the socket even for
-		 * non-blocking socket.
-		 */
-		ret = tls_mbedtls_handshake(ctx, true);
+		bool is_block = !((flags & ZSOCK_MSG_DONTWAIT) ||
+				  sock_is_nonblock(ctx));
+
+		ret = tls_mbedtls_handshake(ctx, is_block);
 		if (ret < 0) {
 			goto error;
 		}
@@ -1705,6 +1918,24 @@ static int ztls_poll_prepare_ctx(struct net_context *ctx,
 		return 0;
 	}
 
+	if (ctx->tls->handshake_in_progress &&
+	    (pfd->events & (ZSOCK_POLLIN | ZSOCK_POLLOUT))) {
+		if (*pev == pev_end) {
+			return -ENOMEM;
+		}
+
+		/* Wait for handshake traffic; the handshake state machine
+		 * is advanced from the poll update function.
+		 */
+		(*pev)->obj = &ctx->recv_q;
+		(*pev)->type = K_POLL_TYPE_FIFO_DATA_AVAILABLE;
+		(*pev)->mode = K_POLL_MODE_NOTIFY_ONLY;
+		(*pev)->state = K_POLL_STATE_NOT_READY;
+		(*pev)++;
+
+		return 0;
+	}
+
 	if (pfd->events & ZSOCK_POLLIN) {
 		if (*pev == pev_end) {
 			return -ENOMEM;
@@ -1758,6 +1989,35 @@ static int ztls_poll_update_ctx(struct net_context *ctx,
 		return 0;
 	}
 
+	if (ctx->tls->handshake_in_progress &&
+	    (pfd->events & (ZSOCK_POLLIN | ZSOCK_POLLOUT))) {
+		int ret = tls_mbedtls_handshake(ctx, false);
+
+		if (ret == -EAGAIN) {
+			(*pev)->state = K_POLL_STATE_NOT_READY;
+			(*pev)++;
+			return -EAGAIN;
+		}
+
+		if (ret < 0) {
+			pfd->revents |= ZSOCK_POLLERR;
+			(*pev)++;
+			return 0;
+		}
+
+		tls_session_store_remote(ctx);
+
+		if (!(pfd->events & ZSOCK_POLLIN)) {
+			pfd->revents |= ZSOCK_POLLOUT;
+			(*pev)++;
+			return 0;
+		}
+
+		/* Handshake complete: fall through, the registered event
+		 * matches what the POLLIN handling below expects.
+		 */
+	}
+
 	/* For now, assume that socket is always writable */
 	if (pfd->events & ZSOCK_POLLOUT) {
 		pfd->revents |= ZSOCK_POLLOUT;
@@ -478,6 +478,54 @@ static int websocket_prepare_and_send(struct websocket_context *ctx,
 #endif /* CONFIG_NET_TEST */
 }
 
+/* Mask or unmask a websocket payload in place, XORing a native word at
+ * a time.  The offset tells how many bytes of the message were already
+ * processed, as the 4 byte mask must continue from that position.
+ */
+static void websocket_mask_payload(uint8_t *payload, size_t payload_len,
+				   uint32_t masking_value, size_t offset)
+{
+	uintptr_t word_mask;
+	uint32_t mask32;
+	uint8_t *mask_bytes = (uint8_t *)&mask32;
+	size_t i = 0;
+	int k;
+
+	/* Process one byte at a time until the payload pointer is word
+	 * aligned.
+	 */
+	while (i < payload_len &&
+	       ((uintptr_t)&payload[i] % sizeof(uintptr_t)) != 0) {
+		payload[i] ^= masking_value >> (8 * (3 - (i + offset) % 4));
+		i++;
+	}
+
+	if (payload_len - i >= sizeof(uintptr_t)) {
+		/* Assemble the mask in payload byte order, starting from
+		 * the current position within the masking value, and
+		 * replicate it to a native word.
+		 */
+		for (k = 0; k < 4; k++) {
+			mask_bytes[k] = masking_value >>
+				(8 * (3 - (i + offset + k) % 4));
+		}
+
+		word_mask = mask32;
+#if UINTPTR_MAX > UINT32_MAX
+		word_mask |= (uintptr_t)mask32 << 32;
+#endif
+
+		while (payload_len - i >= sizeof(uintptr_t)) {
+			*(uintptr_t *)&payload[i] ^= word_mask;
+			i += sizeof(uintptr_t);
+		}
+	}
+
+	for (; i < payload_len; i++) {
+		payload[i] ^= masking_value >> (8 * (3 - (i + offset) % 4));
+	}
+}
+
 int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		       enum websocket_opcode opcode, bool mask, bool final,
 		       int32_t timeout)
@@ -548,8 +596,6 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 
 	/* Add masking value if needed */
 	if (mask) {
-		int i;
-
 		ctx->masking_value = sys_rand32_get();
 
 		header[hdr_len++] |= ctx->masking_value >> 24;
@@ -564,10 +610,8 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 
 		memcpy(data_to_send, payload, payload_len);
 
-		for (i = 0; i < payload_len; i++) {
-			data_to_send[i] ^=
-				ctx->masking_value >> (8 * (3 - i % 4));
-		}
+		websocket_mask_payload(data_to_send, payload_len,
+				       ctx->masking_value, 0);
 	}
 
 	ret = websocket_prepare_and_send(ctx, header, hdr_len,
@@ -829,17 +873,12 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 
 	/* Unmask the data */
 	if (ctx->masked) {
-		/* As we might have less than 4 received bytes, we must select
-		 * which byte from masking value to take. The mask_shift will
-		 * tell that.
+		/* We might not be at a 4 byte boundary within the message,
+		 * so the mask must continue from the right byte of the
+		 * masking value.
 		 */
-		int mask_shift = (ctx->total_read - recv_len) % sizeof(uint32_t);
-		int i;
-
-		for (i = 0; i < recv_len; i++) {
-			buf[i] ^= ctx->masking_value >>
-				(8 * (3 - (i + mask_shift) % 4));
-		}
+		websocket_mask_payload(buf, recv_len, ctx->masking_value,
+				       ctx->total_read - recv_len);
 	}
 
 #if HEXDUMP_RECV_PACKETS
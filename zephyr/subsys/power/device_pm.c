@@ -7,6 +7,7 @@
 #include <zephyr.h>
 #include <kernel.h>
 #include <device.h>
+#include <init.h>
 #include <sys/__assert.h>
 
 #define LOG_LEVEL CONFIG_SYS_PM_LOG_LEVEL /* From power module Kconfig */
@@ -85,6 +86,44 @@ fsm_out:
 	k_poll_signal_raise(&dev->pm->signal, pm_state);
 }
 
+#ifdef CONFIG_DEVICE_PM_BATCH_SUSPEND
+static struct k_delayed_work pm_reaper;
+
+/* Suspend every idle device in one pass, so a burst of put() calls
+ * from different subsystems results in a single deferred sweep instead
+ * of one work item per device.
+ */
+static void pm_reaper_handler(struct k_work *work)
+{
+	struct device *devices;
+	size_t count;
+	size_t i;
+
+	ARG_UNUSED(work);
+
+	count = z_device_get_all_static(&devices);
+	for (i = 0; i < count; i++) {
+		struct device *dev = &devices[i];
+
+		if ((dev->pm != NULL) && (dev->pm->dev != NULL) &&
+		    dev->pm->enable && (atomic_get(&dev->pm->usage) == 0)) {
+			k_work_submit(&dev->pm->work);
+		}
+	}
+}
+
+static int pm_reaper_init(struct device *unused)
+{
+	ARG_UNUSED(unused);
+
+	k_delayed_work_init(&pm_reaper, pm_reaper_handler);
+
+	return 0;
+}
+
+SYS_INIT(pm_reaper_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_DEVICE_PM_BATCH_SUSPEND */
+
 static int device_pm_request(struct device *dev,
 			     uint32_t target_state, uint32_t pm_flags)
 {
@@ -98,10 +137,32 @@ static int device_pm_request(struct device *dev,
 		if (atomic_inc(&dev->pm->usage) < 0) {
 			return 0;
 		}
+
+		/* Lock-free fast path: with the usage count raised, a
+		 * pending suspend re-checks it and backs off, so an
+		 * already active device needs no state machine round
+		 * trip.
+		 */
+		if (atomic_get(&dev->pm->fsm_state) ==
+		    DEVICE_PM_FSM_STATE_ACTIVE) {
+			return 0;
+		}
 	} else {
 		if (atomic_dec(&dev->pm->usage) > 1) {
 			return 0;
 		}
+
+#ifdef CONFIG_DEVICE_PM_BATCH_SUSPEND
+		/* Defer and batch asynchronous suspends; each new idle
+		 * device extends the window, then one sweep suspends
+		 * the whole idle group.
+		 */
+		if (pm_flags & DEVICE_PM_ASYNC) {
+			(void)k_delayed_work_submit(&pm_reaper,
+				K_MSEC(CONFIG_DEVICE_PM_SUSPEND_DELAY_MS));
+			return 0;
+		}
+#endif
 	}
 
 	k_work_submit(&dev->pm->work);
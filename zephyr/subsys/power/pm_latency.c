@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Wakeup latency QoS constraints.  Subsystems register the maximum
+ * wakeup latency they can tolerate; the tightest bound is kept in a
+ * single word so the idle path reads it with one atomic load, while
+ * the (rare) add/update/remove operations recompute it under a
+ * spinlock.
+ */
+
+#include <kernel.h>
+#include <power/power.h>
+
+static sys_slist_t latency_reqs = SYS_SLIST_STATIC_INIT(&latency_reqs);
+static struct k_spinlock latency_lock;
+static atomic_t latency_bound_us = ATOMIC_INIT(INT32_MAX);
+
+static void latency_recompute(void)
+{
+	struct sys_pm_latency_req *req;
+	int32_t bound = INT32_MAX;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&latency_reqs, req, node) {
+		bound = MIN(bound, req->latency_us);
+	}
+
+	atomic_set(&latency_bound_us, bound);
+}
+
+void sys_pm_latency_request_add(struct sys_pm_latency_req *req,
+				int32_t latency_us)
+{
+	k_spinlock_key_t key;
+
+	req->latency_us = latency_us;
+
+	key = k_spin_lock(&latency_lock);
+	sys_slist_append(&latency_reqs, &req->node);
+	latency_recompute();
+	k_spin_unlock(&latency_lock, key);
+}
+
+void sys_pm_latency_request_update(struct sys_pm_latency_req *req,
+				   int32_t latency_us)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&latency_lock);
+	req->latency_us = latency_us;
+	latency_recompute();
+	k_spin_unlock(&latency_lock, key);
+}
+
+void sys_pm_latency_request_remove(struct sys_pm_latency_req *req)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&latency_lock);
+	(void)sys_slist_find_and_remove(&latency_reqs, &req->node);
+	latency_recompute();
+	k_spin_unlock(&latency_lock, key);
+}
+
+int32_t sys_pm_latency_constraint_us(void)
+{
+	return (int32_t)atomic_get(&latency_bound_us);
+}
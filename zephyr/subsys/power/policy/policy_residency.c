@@ -45,10 +45,89 @@ static const unsigned int pm_min_residency[] = {
 #endif /* CONFIG_SYS_POWER_DEEP_SLEEP_STATES */
 };
 
+#ifdef CONFIG_SYS_PM_LATENCY_QOS
+/* Worst-case exit latency per state, from measurements on the target
+ * platform.  States whose exit latency exceeds the currently
+ * registered latency QoS bound are not eligible.
+ */
+static const int32_t pm_exit_latency_us[] = {
+#ifdef CONFIG_SYS_POWER_SLEEP_STATES
+#ifdef CONFIG_HAS_SYS_POWER_STATE_SLEEP_1
+	CONFIG_SYS_PM_EXIT_LATENCY_SLEEP_1,
+#endif
+
+#ifdef CONFIG_HAS_SYS_POWER_STATE_SLEEP_2
+	CONFIG_SYS_PM_EXIT_LATENCY_SLEEP_2,
+#endif
+
+#ifdef CONFIG_HAS_SYS_POWER_STATE_SLEEP_3
+	CONFIG_SYS_PM_EXIT_LATENCY_SLEEP_3,
+#endif
+#endif /* CONFIG_SYS_POWER_SLEEP_STATES */
+
+#ifdef CONFIG_SYS_POWER_DEEP_SLEEP_STATES
+#ifdef CONFIG_HAS_SYS_POWER_STATE_DEEP_SLEEP_1
+	CONFIG_SYS_PM_EXIT_LATENCY_DEEP_SLEEP_1,
+#endif
+
+#ifdef CONFIG_HAS_SYS_POWER_STATE_DEEP_SLEEP_2
+	CONFIG_SYS_PM_EXIT_LATENCY_DEEP_SLEEP_2,
+#endif
+
+#ifdef CONFIG_HAS_SYS_POWER_STATE_DEEP_SLEEP_3
+	CONFIG_SYS_PM_EXIT_LATENCY_DEEP_SLEEP_3,
+#endif
+#endif /* CONFIG_SYS_POWER_DEEP_SLEEP_STATES */
+};
+#endif /* CONFIG_SYS_PM_LATENCY_QOS */
+
+#ifdef CONFIG_SYS_PM_IDLE_PREDICT
+/* EWMA weight is 1/2^SYS_PM_IDLE_EWMA_SHIFT: small enough to smooth
+ * over scheduling jitter, large enough to track workload changes
+ * within a handful of idle periods.
+ */
+#define SYS_PM_IDLE_EWMA_SHIFT	3
+
+static uint32_t idle_ewma_cycles;
+
+void sys_pm_idle_predictor_update(uint32_t cycles)
+{
+	if (idle_ewma_cycles == 0U) {
+		idle_ewma_cycles = cycles;
+	} else {
+		idle_ewma_cycles += (cycles >> SYS_PM_IDLE_EWMA_SHIFT) -
+				    (idle_ewma_cycles >> SYS_PM_IDLE_EWMA_SHIFT);
+	}
+}
+
+/* Idle periods commonly end on device interrupts the kernel timeout
+ * queue knows nothing about, so use the EWMA of recent actual idle
+ * periods when it predicts an earlier wakeup than the next timeout.
+ */
+static int32_t predicted_idle_ticks(int32_t ticks)
+{
+	int32_t predicted = k_cyc_to_ticks_floor32(idle_ewma_cycles);
+
+	if ((idle_ewma_cycles != 0U) &&
+	    ((ticks == K_TICKS_FOREVER) || (predicted < ticks))) {
+		return predicted;
+	}
+
+	return ticks;
+}
+#endif /* CONFIG_SYS_PM_IDLE_PREDICT */
+
 enum power_states sys_pm_policy_next_state(int32_t ticks)
 {
+#ifdef CONFIG_SYS_PM_LATENCY_QOS
+	int32_t latency_bound_us = sys_pm_latency_constraint_us();
+#endif
 	int i;
 
+#ifdef CONFIG_SYS_PM_IDLE_PREDICT
+	ticks = predicted_idle_ticks(ticks);
+#endif
+
 	if ((ticks != K_TICKS_FOREVER) && (ticks < pm_min_residency[0])) {
 		LOG_DBG("Not enough time for PM operations: %d", ticks);
 		return SYS_POWER_STATE_ACTIVE;
@@ -59,6 +138,11 @@ enum power_states sys_pm_policy_next_state(int32_t ticks)
 		if (!sys_pm_ctrl_is_state_enabled((enum power_states)(i))) {
 			continue;
 		}
+#endif
+#ifdef CONFIG_SYS_PM_LATENCY_QOS
+		if (pm_exit_latency_us[i] > latency_bound_us) {
+			continue;
+		}
 #endif
 		if ((ticks == K_TICKS_FOREVER) ||
 		    (ticks >= pm_min_residency[i])) {
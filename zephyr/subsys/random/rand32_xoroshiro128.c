@@ -13,28 +13,20 @@
  * See <http://creativecommons.org/publicdomain/zero/1.0/>.
  */
 
-/* This is the successor to xorshift128+. It is the fastest full-period
- * generator passing BigCrush without systematic failures, but due to the
- * relatively short period it is acceptable only for applications with a
- * mild amount of parallelism; otherwise, use a xorshift1024* generator.
- *
- * Beside passing BigCrush, this generator passes the PractRand test suite
- * up to (and included) 16TB, with the exception of binary rank tests, as
- * the lowest bit of this generator is an LSFR. The next bit is not an
- * LFSR, but in the long run it will fail binary rank tests, too. The
- * other bits have no LFSR artifacts.
- *
- * We suggest to use a sign test to extract a random Boolean value, and
- * right shifts to extract subsets of bits.
+/* This is xoroshiro128++ 1.0, one of our all-purpose, rock-solid,
+ * small-state generators. It is extremely (sub-ns) fast and it passes all
+ * tests we are aware of, but its state space is large enough only for
+ * mild parallelism; in particular, unlike the xoroshiro128+ variant used
+ * here previously, its output has no LFSR artifacts in the low bits.
  *
  * Note that the generator uses a simulated rotate operation, which most C
- * compilers will turn into a single instruction. In Java, you can use
- * Long.rotateLeft(). In languages that do not make low-level rotation
- * instructions accessible xorshift128+ could be faster.
+ * compilers will turn into a single instruction.
  *
- * The state must be seeded so that it is not everywhere zero. If you have
- * a 64-bit seed, we suggest to seed a splitmix64 generator and use its
- * output to fill s.
+ * The state must be seeded so that it is not everywhere zero.
+ *
+ * On SMP each CPU runs its own instance of the generator, seeded
+ * independently, so hot-path callers never contend on shared state; the
+ * update is done with interrupts masked on the local CPU only.
  */
 
 #include <init.h>
@@ -43,7 +35,11 @@
 #include <kernel.h>
 #include <string.h>
 
-static uint64_t state[2];
+#ifdef CONFIG_SMP
+static uint64_t state[CONFIG_MP_NUM_CPUS][2];
+#else
+static uint64_t state[1][2];
+#endif
 
 static inline uint64_t rotl(const uint64_t x, int k)
 {
@@ -76,13 +72,29 @@ static int xoroshiro128_initialize(struct device *dev)
 
 static uint32_t xoroshiro128_next(void)
 {
-	const uint64_t s0 = state[0];
-	uint64_t s1 = state[1];
-	const uint64_t result = s0 + s1;
+	uint64_t *s;
+	uint64_t s0;
+	uint64_t s1;
+	uint64_t result;
+#ifdef CONFIG_SMP
+	unsigned int key = arch_irq_lock();
+
+	s = state[arch_curr_cpu()->id];
+#else
+	s = state[0];
+#endif
+
+	s0 = s[0];
+	s1 = s[1];
+	result = rotl(s0 + s1, 17) + s0;
 
 	s1 ^= s0;
-	state[0] = rotl(s0, 55) ^ s1 ^ (s1 << 14);
-	state[1] = rotl(s1, 36);
+	s[0] = rotl(s0, 49) ^ s1 ^ (s1 << 21);
+	s[1] = rotl(s1, 28);
+
+#ifdef CONFIG_SMP
+	arch_irq_unlock(key);
+#endif
 
 	return (uint32_t)result;
 }
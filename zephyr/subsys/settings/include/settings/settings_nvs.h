@@ -38,6 +38,18 @@ struct settings_nvs {
 	struct nvs_fs cf_nvs;
 	uint16_t last_name_id;
 	const char *flash_dev_name;
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+	/* RAM index of the stored names: the name entry ID together with
+	 * a hash of the name's first path component, used to skip records
+	 * outside the subtree being loaded.
+	 */
+	struct {
+		uint16_t name_id;
+		uint16_t name_hash;
+	} cache[CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE];
+	uint16_t cache_cnt;
+	bool cache_valid;
+#endif
 };
 
 /* register nvs to be a source of settings */
@@ -24,6 +24,104 @@ sys_slist_t settings_handlers;
 
 K_MUTEX_DEFINE(settings_lock);
 
+#if defined(CONFIG_SETTINGS_HANDLER_HASH) || \
+	defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+uint32_t settings_hash(const char *name, size_t len)
+{
+	uint32_t hash = 5381U;
+
+	while (len--) {
+		hash = (hash * 33U) ^ (uint8_t)*name++;
+	}
+
+	return hash;
+}
+#endif
+
+#if defined(CONFIG_SETTINGS_HANDLER_HASH)
+/* Handler names hashed into an open-addressed table. Lookups hash the
+ * record name at every path component boundary and probe from the
+ * longest prefix down, which preserves the best-match semantics of the
+ * list scan. When the table overflows, lookups fall back to the scan.
+ */
+static struct {
+	uint32_t hash;
+	struct settings_handler_static *ch;
+} settings_handler_hash[CONFIG_SETTINGS_HANDLER_HASH_SIZE];
+static bool settings_handler_hash_valid;
+
+static void settings_handler_hash_insert(struct settings_handler_static *ch)
+{
+	uint32_t hash = settings_hash(ch->name, strlen(ch->name));
+	int i, idx;
+
+	for (i = 0; i < CONFIG_SETTINGS_HANDLER_HASH_SIZE; i++) {
+		idx = (hash + i) % CONFIG_SETTINGS_HANDLER_HASH_SIZE;
+		if (settings_handler_hash[idx].ch == NULL) {
+			settings_handler_hash[idx].hash = hash;
+			settings_handler_hash[idx].ch = ch;
+			return;
+		}
+	}
+
+	settings_handler_hash_valid = false;
+}
+
+static struct settings_handler_static *
+settings_handler_hash_lookup(const char *name, const char **next)
+{
+	uint32_t hash[SETTINGS_MAX_DIR_DEPTH];
+	uint32_t h = 5381U;
+	const char *tmpnext;
+	const char *p = name;
+	int depth = 0;
+	int i, idx;
+
+	/* Hash every prefix of the name that ends at a component
+	 * boundary; the stepping matches settings_hash().
+	 */
+	while (depth < SETTINGS_MAX_DIR_DEPTH) {
+		while ((*p != '\0') && (*p != SETTINGS_NAME_END) &&
+		       (*p != SETTINGS_NAME_SEPARATOR)) {
+			h = (h * 33U) ^ (uint8_t)*p;
+			p++;
+		}
+		hash[depth++] = h;
+		if (*p != SETTINGS_NAME_SEPARATOR) {
+			break;
+		}
+		h = (h * 33U) ^ (uint8_t)*p;
+		p++;
+	}
+
+	while (depth > 0) {
+		depth--;
+		for (i = 0; i < CONFIG_SETTINGS_HANDLER_HASH_SIZE; i++) {
+			idx = (hash[depth] + i) %
+			      CONFIG_SETTINGS_HANDLER_HASH_SIZE;
+			if (settings_handler_hash[idx].ch == NULL) {
+				break;
+			}
+			if (settings_handler_hash[idx].hash != hash[depth]) {
+				continue;
+			}
+			if (settings_name_steq(name,
+					       settings_handler_hash[idx].ch->name,
+					       &tmpnext)) {
+				if (next) {
+					*next = tmpnext;
+				}
+				return settings_handler_hash[idx].ch;
+			}
+		}
+	}
+
+	if (next) {
+		*next = NULL;
+	}
+	return NULL;
+}
+#endif /* CONFIG_SETTINGS_HANDLER_HASH */
 
 void settings_store_init(void);
 
@@ -32,6 +130,12 @@ void settings_init(void)
 #if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
 	sys_slist_init(&settings_handlers);
 #endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
+#if defined(CONFIG_SETTINGS_HANDLER_HASH)
+	settings_handler_hash_valid = true;
+	Z_STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
+		settings_handler_hash_insert(ch);
+	}
+#endif /* CONFIG_SETTINGS_HANDLER_HASH */
 	settings_store_init();
 }
 
@@ -56,6 +160,9 @@ int settings_register(struct settings_handler *handler)
 		}
 	}
 	sys_slist_append(&settings_handlers, &handler->node);
+#if defined(CONFIG_SETTINGS_HANDLER_HASH)
+	settings_handler_hash_insert((struct settings_handler_static *)handler);
+#endif /* CONFIG_SETTINGS_HANDLER_HASH */
 
 end:
 	k_mutex_unlock(&settings_lock);
@@ -140,6 +247,12 @@ struct settings_handler_static *settings_parse_and_lookup(const char *name,
 	struct settings_handler_static *bestmatch;
 	const char *tmpnext;
 
+#if defined(CONFIG_SETTINGS_HANDLER_HASH)
+	if (settings_handler_hash_valid) {
+		return settings_handler_hash_lookup(name, next);
+	}
+#endif /* CONFIG_SETTINGS_HANDLER_HASH */
+
 	bestmatch = NULL;
 	if (next) {
 		*next = NULL;
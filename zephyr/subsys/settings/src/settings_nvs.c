@@ -31,6 +31,52 @@ static struct settings_store_itf settings_nvs_itf = {
 	.csi_save = settings_nvs_save,
 };
 
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+static uint16_t settings_nvs_name_hash(const char *name)
+{
+	uint32_t hash;
+	size_t len = 0;
+
+	/* Hash the first path component only; a record can belong to a
+	 * subtree only when their first components are equal.
+	 */
+	while ((name[len] != '\0') && (name[len] != SETTINGS_NAME_END) &&
+	       (name[len] != SETTINGS_NAME_SEPARATOR)) {
+		len++;
+	}
+
+	hash = settings_hash(name, len);
+	return (uint16_t)(hash ^ (hash >> 16));
+}
+
+static int settings_nvs_cache_add(struct settings_nvs *cf, uint16_t name_id,
+				  const char *name)
+{
+	if (cf->cache_cnt >= CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE) {
+		return -ENOMEM;
+	}
+
+	cf->cache[cf->cache_cnt].name_id = name_id;
+	cf->cache[cf->cache_cnt].name_hash = settings_nvs_name_hash(name);
+	cf->cache_cnt++;
+	return 0;
+}
+
+static void settings_nvs_cache_remove(struct settings_nvs *cf,
+				      uint16_t name_id)
+{
+	uint16_t i;
+
+	for (i = 0; i < cf->cache_cnt; i++) {
+		if (cf->cache[i].name_id == name_id) {
+			cf->cache_cnt--;
+			cf->cache[i] = cf->cache[cf->cache_cnt];
+			return;
+		}
+	}
+}
+#endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
+
 static ssize_t settings_nvs_read_fn(void *back_end, void *data, size_t len)
 {
 	struct settings_nvs_read_fn_arg *rd_fn_arg;
@@ -74,15 +120,52 @@ static int settings_nvs_load(struct settings_store *cs,
 	char buf;
 	ssize_t rc1, rc2;
 	uint16_t name_id = NVS_NAMECNT_ID;
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+	uint16_t subtree_hash = 0U;
+	uint16_t idx = 0U;
+	bool cached = false;
+	bool overflow = false;
+
+	if (cf->cache_valid && arg && arg->subtree) {
+		subtree_hash = settings_nvs_name_hash(arg->subtree);
+		cached = true;
+	} else {
+		/* (Re)build the cache while scanning every record. */
+		cf->cache_valid = false;
+		cf->cache_cnt = 0U;
+	}
+#endif
 
 	name_id = cf->last_name_id + 1;
 
 	while (1) {
 
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+		if (cached) {
+			/* Visit only records whose first path component
+			 * hashes like the requested subtree.
+			 */
+			if (idx >= cf->cache_cnt) {
+				break;
+			}
+			if (cf->cache[idx].name_hash != subtree_hash) {
+				idx++;
+				continue;
+			}
+			name_id = cf->cache[idx].name_id;
+			idx++;
+		} else {
+			name_id--;
+			if (name_id == NVS_NAMECNT_ID) {
+				break;
+			}
+		}
+#else
 		name_id--;
 		if (name_id == NVS_NAMECNT_ID) {
 			break;
 		}
+#endif
 
 		/* In the NVS backend, each setting item is stored in two NVS
 		 * entries one for the setting's name and one with the
@@ -93,10 +176,24 @@ static int settings_nvs_load(struct settings_store *cs,
 			       &buf, sizeof(buf));
 
 		if ((rc1 <= 0) && (rc2 <= 0)) {
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+			if (cached) {
+				/* The cache no longer matches the storage;
+				 * rebuild it on the next full load.
+				 */
+				cf->cache_valid = false;
+			}
+#endif
 			continue;
 		}
 
 		if ((rc1 <= 0) || (rc2 <= 0)) {
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+			if (cached) {
+				cf->cache_valid = false;
+				continue;
+			}
+#endif
 			/* Settings item is not stored correctly in the NVS.
 			 * NVS entry for its name or value is either missing
 			 * or deleted. Clean dirty entries to make space for
@@ -114,6 +211,12 @@ static int settings_nvs_load(struct settings_store *cs,
 
 		/* Found a name, this might not include a trailing \0 */
 		name[rc1] = '\0';
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+		if (!cached &&
+		    settings_nvs_cache_add(cf, name_id, name) != 0) {
+			overflow = true;
+		}
+#endif
 		read_fn_arg.fs = &cf->cf_nvs;
 		read_fn_arg.id = name_id + NVS_NAME_ID_OFFSET;
 
@@ -125,6 +228,13 @@ static int settings_nvs_load(struct settings_store *cs,
 			break;
 		}
 	}
+
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+	if (!cached && (ret == 0) && !overflow) {
+		cf->cache_valid = true;
+	}
+#endif
+
 	return ret;
 }
 
@@ -194,6 +304,11 @@ static int settings_nvs_save(struct settings_store *cs, const char *name,
 				return rc;
 			}
 
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+			if (cf->cache_valid) {
+				settings_nvs_cache_remove(cf, name_id);
+			}
+#endif
 			return 0;
 		}
 		write_name_id = name_id;
@@ -220,6 +335,12 @@ static int settings_nvs_save(struct settings_store *cs, const char *name,
 		if (rc < 0) {
 			return rc;
 		}
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+		if (cf->cache_valid &&
+		    settings_nvs_cache_add(cf, write_name_id, name) != 0) {
+			cf->cache_valid = false;
+		}
+#endif
 	}
 
 	/* update the last_name_id and write to flash if required*/
@@ -247,6 +368,11 @@ int settings_nvs_backend_init(struct settings_nvs *cf)
 		return rc;
 	}
 
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+	cf->cache_cnt = 0U;
+	cf->cache_valid = false;
+#endif
+
 	rc = nvs_read(&cf->cf_nvs, NVS_NAMECNT_ID, &last_name_id,
 		      sizeof(last_name_id));
 	if (rc < 0) {
@@ -20,6 +20,12 @@ extern "C" {
 int settings_cli_register(void);
 int settings_nmgr_register(void);
 
+#if defined(CONFIG_SETTINGS_HANDLER_HASH) || \
+	defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+/* Hash of a settings name (or name fragment) of the given length. */
+uint32_t settings_hash(const char *name, size_t len);
+#endif
+
 struct mgmt_cbuf;
 int settings_cbor_line(struct mgmt_cbuf *cb, char *name, int nlen, char *value,
 		       int vlen);
@@ -14,6 +14,9 @@
 #include <string.h>
 #include <device.h>
 #include <drivers/timer/system_timer.h>
+#if defined(CONFIG_NET_BUF)
+#include <net/buf.h>
+#endif
 
 static int cmd_kernel_version(const struct shell *shell,
 			      size_t argc, char **argv)
@@ -171,6 +174,38 @@ static int cmd_kernel_stacks(const struct shell *shell,
 }
 #endif
 
+#if defined(CONFIG_SYS_HEAP_RUNTIME_STATS)
+static int cmd_kernel_heaps(const struct shell *shell,
+			    size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	Z_STRUCT_SECTION_FOREACH(k_heap, h) {
+		struct sys_heap_runtime_stats stats;
+
+		k_heap_runtime_stats_get(h, &stats);
+
+		shell_print(shell, "%p (%zu bytes):", h, h->heap.init_bytes);
+		shell_print(shell,
+			    "\tallocated %zu, peak %zu, free %zu, "
+			    "largest free %zu, failed allocs %u",
+			    stats.allocated_bytes, stats.max_allocated_bytes,
+			    stats.free_bytes, stats.largest_free_bytes,
+			    stats.failed_allocs);
+
+		for (int i = 0; i < SYS_HEAP_RUNTIME_STATS_BUCKETS; i++) {
+			if (stats.free_chunks[i] != 0U) {
+				shell_print(shell, "\tbucket[%d]: %u free",
+					    i, stats.free_chunks[i]);
+			}
+		}
+	}
+
+	return 0;
+}
+#endif
+
 #if defined(CONFIG_REBOOT)
 static int cmd_kernel_reboot_warm(const struct shell *shell,
 				  size_t argc, char **argv)
@@ -197,11 +232,86 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_reboot,
 );
 #endif
 
+#if defined(CONFIG_SPIN_LOCK_PROFILE)
+static void spin_profile_print_cb(const struct k_spin_profile_stats *stats,
+				  void *user_data)
+{
+	const struct shell *shell = user_data;
+
+	shell_print(shell, "%p: acquired %u, contended %u",
+		    stats->lock, stats->acquisitions, stats->contentions);
+	shell_print(shell,
+		    "\tspin %llu cycles (max %u), hold %llu cycles (max %u)",
+		    stats->spin_cycles, stats->max_spin_cycles,
+		    stats->hold_cycles, stats->max_hold_cycles);
+}
+
+static int cmd_kernel_spinlocks(const struct shell *shell,
+				size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	k_spin_profile_foreach(spin_profile_print_cb, (void *)shell);
+
+	return 0;
+}
+#endif
+
+static int cmd_kernel_pools(const struct shell *shell,
+			    size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	Z_STRUCT_SECTION_FOREACH(k_mem_slab, slab) {
+		shell_print(shell,
+			    "slab %p: %u x %zu bytes, used %u, peak %u",
+			    slab, slab->num_blocks, slab->block_size,
+			    k_mem_slab_num_used_get(slab),
+			    k_mem_slab_max_used_get(slab));
+	}
+
+#if defined(CONFIG_NET_BUF)
+	{
+		extern struct net_buf_pool _net_buf_pool_list[];
+		extern struct net_buf_pool _net_buf_pool_list_end[];
+		struct net_buf_pool *pool;
+
+		for (pool = _net_buf_pool_list;
+		     pool < _net_buf_pool_list_end; pool++) {
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+			shell_print(shell, "pool %s: %u buffers, peak %u",
+				    pool->name, pool->buf_count,
+				    net_buf_pool_peak_used_get(pool));
+#else
+			shell_print(shell, "pool %p: %u buffers, peak %u",
+				    pool, pool->buf_count,
+				    net_buf_pool_peak_used_get(pool));
+#endif /* CONFIG_NET_BUF_POOL_USAGE */
+		}
+	}
+#endif /* CONFIG_NET_BUF */
+
+	return 0;
+}
+
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel,
 	SHELL_CMD(cycles, NULL, "Kernel cycles.", cmd_kernel_cycles),
+#if defined(CONFIG_SYS_HEAP_RUNTIME_STATS)
+	SHELL_CMD(heaps, NULL, "List k_heap usage statistics.",
+		  cmd_kernel_heaps),
+#endif
+	SHELL_CMD(pools, NULL,
+		  "List memory slab and buffer pool occupancy watermarks.",
+		  cmd_kernel_pools),
 #if defined(CONFIG_REBOOT)
 	SHELL_CMD(reboot, &sub_kernel_reboot, "Reboot.", NULL),
 #endif
+#if defined(CONFIG_SPIN_LOCK_PROFILE)
+	SHELL_CMD(spinlocks, NULL, "List spinlock contention statistics.",
+		  cmd_kernel_spinlocks),
+#endif
 #if defined(CONFIG_INIT_STACKS) && defined(CONFIG_THREAD_STACK_INFO) && \
 		defined(CONFIG_THREAD_MONITOR)
 	SHELL_CMD(stacks, NULL, "List threads stack usage.", cmd_kernel_stacks),
@@ -291,6 +291,15 @@ static void find_completion_candidates(const struct shell *shell,
 	*longest = 0U;
 	*cnt = 0;
 
+	if (cmd == NULL) {
+		/* Root commands are sorted at link time; matches form a
+		 * contiguous run found by binary search.
+		 */
+		shell_root_cmd_prefix_search(incompl_cmd, incompl_cmd_len,
+					     first_idx, cnt, longest);
+		return;
+	}
+
 	while ((candidate = shell_cmd_get(cmd, idx, &dloc)) != NULL) {
 		bool is_candidate;
 		is_candidate = is_completion_candidate(candidate->syntax,
@@ -1044,6 +1053,13 @@ static void transport_evt_handler(enum shell_transport_evt evt_type, void *ctx)
 	struct shell *shell = (struct shell *)ctx;
 	struct k_poll_signal *signal;
 
+#ifdef CONFIG_SHELL_ASYNC_OUTPUT
+	if (evt_type == SHELL_TRANSPORT_EVT_TX_RDY) {
+		/* Transport can take data again; restart the drain. */
+		k_work_submit(&shell->ctx->tx_work);
+	}
+#endif
+
 	signal = (evt_type == SHELL_TRANSPORT_EVT_RX_RDY) ?
 			&shell->ctx->signals[SHELL_SIGNAL_RXRDY] :
 			&shell->ctx->signals[SHELL_SIGNAL_TXDONE];
@@ -1117,6 +1133,14 @@ static int instance_init(const struct shell *shell, const void *p_config,
 	shell->ctx->vt100_ctx.cons.name_len = shell_strlen(shell->ctx->prompt);
 	flag_use_colors_set(shell, IS_ENABLED(CONFIG_SHELL_VT100_COLORS));
 
+#ifdef CONFIG_SHELL_ASYNC_OUTPUT
+	shell->ctx->shell = shell;
+	ring_buf_init(&shell->ctx->tx_ringbuf,
+		      CONFIG_SHELL_ASYNC_OUTPUT_BUF_SIZE, shell->tx_buf);
+	k_work_init(&shell->ctx->tx_work, shell_tx_work_handler);
+	k_sem_init(&shell->ctx->tx_sem, 0, 1);
+#endif
+
 	return shell->iface->api->init(shell->iface, p_config,
 				       transport_evt_handler,
 				       (void *) shell);
@@ -368,6 +368,81 @@ static void shell_pend_on_txdone(const struct shell *shell)
 	}
 }
 
+#ifdef CONFIG_SHELL_ASYNC_OUTPUT
+void shell_tx_work_handler(struct k_work *work)
+{
+	struct shell_ctx *ctx = CONTAINER_OF(work, struct shell_ctx, tx_work);
+	const struct shell *shell = ctx->shell;
+	uint8_t *data;
+	uint32_t claimed;
+	size_t tmp_cnt;
+	int err;
+
+	while (true) {
+		claimed = ring_buf_get_claim(&ctx->tx_ringbuf, &data,
+					     ctx->tx_ringbuf.size);
+		if (claimed == 0U) {
+			break;
+		}
+
+		err = shell->iface->api->write(shell->iface, data, claimed,
+					       &tmp_cnt);
+		(void)err;
+		__ASSERT_NO_MSG(err == 0);
+
+		err = ring_buf_get_finish(&ctx->tx_ringbuf, tmp_cnt);
+		__ASSERT_NO_MSG(err == 0);
+
+		k_sem_give(&ctx->tx_sem);
+
+		if (tmp_cnt == 0U) {
+			/* Transport full; the drain resumes on TX_RDY. */
+			break;
+		}
+	}
+}
+
+void shell_write(const struct shell *shell, const void *data,
+		 size_t length)
+{
+	__ASSERT_NO_MSG(shell && data);
+
+	size_t offset = 0;
+	size_t cnt;
+
+	if (shell->ctx->state == SHELL_STATE_PANIC_MODE_ACTIVE) {
+		/* Flush what is still queued, then write through. */
+		shell_tx_work_handler(&shell->ctx->tx_work);
+
+		while (length) {
+			int err = shell->iface->api->write(shell->iface,
+					&((const uint8_t *)data)[offset],
+					length, &cnt);
+			(void)err;
+			__ASSERT_NO_MSG(err == 0);
+			offset += cnt;
+			length -= cnt;
+		}
+		return;
+	}
+
+	while (length) {
+		cnt = ring_buf_put(&shell->ctx->tx_ringbuf,
+				   &((const uint8_t *)data)[offset], length);
+		offset += cnt;
+		length -= cnt;
+
+		k_work_submit(&shell->ctx->tx_work);
+
+		if (cnt == 0U) {
+			/* The bounded ring is full; wait until the drain
+			 * frees space.
+			 */
+			k_sem_take(&shell->ctx->tx_sem, K_FOREVER);
+		}
+	}
+}
+#else
 void shell_write(const struct shell *shell, const void *data,
 		 size_t length)
 {
@@ -391,6 +466,7 @@ void shell_write(const struct shell *shell, const void *data,
 		}
 	}
 }
+#endif /* CONFIG_SHELL_ASYNC_OUTPUT */
 
 /* Function shall be only used by the fprintf module. */
 void shell_print_stream(const void *user_ctx, const char *data,
@@ -229,6 +229,14 @@ void shell_print_prompt_and_cmd(const struct shell *shell);
 void shell_write(const struct shell *shell, const void *data,
 		 size_t length);
 
+#ifdef CONFIG_SHELL_ASYNC_OUTPUT
+/* Work handler draining the asynchronous TX ring buffer to the
+ * transport. Resubmitted from the transport TX_RDY event when the
+ * transport could not take all pending data.
+ */
+void shell_tx_work_handler(struct k_work *work);
+#endif
+
 /**
  * @internal @brief This function shall not be used directly, it is required by
  *		    the fprintf module.
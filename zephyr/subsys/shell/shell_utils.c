@@ -229,22 +229,76 @@ static inline uint32_t shell_root_cmd_count(void)
 				sizeof(struct shell_cmd_entry);
 }
 
-/* Function returning pointer to parent command matching requested syntax. */
+/* Function returning pointer to parent command matching requested syntax.
+ *
+ * The linker sorts the root command section by syntax (SORT on the
+ * section name, which ends with the syntax token), so the lookup is a
+ * binary search instead of a scan over every registered command.
+ */
 const struct shell_static_entry *shell_root_cmd_find(const char *syntax)
 {
-	const size_t cmd_count = shell_root_cmd_count();
-	const struct shell_cmd_entry *cmd;
+	size_t lo = 0;
+	size_t hi = shell_root_cmd_count();
 
-	for (size_t cmd_idx = 0; cmd_idx < cmd_count; ++cmd_idx) {
-		cmd = shell_root_cmd_get(cmd_idx);
-		if (strcmp(syntax, cmd->u.entry->syntax) == 0) {
-			return cmd->u.entry;
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		const struct shell_static_entry *entry =
+					shell_root_cmd_get(mid)->u.entry;
+		int cmp = strcmp(entry->syntax, syntax);
+
+		if (cmp == 0) {
+			return entry;
+		} else if (cmp < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
 		}
 	}
 
 	return NULL;
 }
 
+/* Locate the contiguous run of root commands starting with the pattern.
+ * Relies on the same link-time ordering as shell_root_cmd_find().
+ */
+void shell_root_cmd_prefix_search(const char *prefix, size_t len,
+				  size_t *first, size_t *cnt,
+				  uint16_t *longest)
+{
+	const size_t cmd_count = shell_root_cmd_count();
+	size_t lo = 0;
+	size_t hi = cmd_count;
+
+	*cnt = 0;
+	*longest = 0U;
+
+	/* First command whose syntax is not less than the pattern. */
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (strncmp(shell_root_cmd_get(mid)->u.entry->syntax,
+			    prefix, len) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	*first = lo;
+
+	while (lo < cmd_count) {
+		const char *syntax = shell_root_cmd_get(lo)->u.entry->syntax;
+
+		if (strncmp(syntax, prefix, len) != 0) {
+			break;
+		}
+
+		*longest = Z_MAX(shell_strlen(syntax), *longest);
+		(*cnt)++;
+		lo++;
+	}
+}
+
 const struct shell_static_entry *shell_cmd_get(
 					const struct shell_static_entry *parent,
 					size_t idx,
@@ -82,6 +82,14 @@ int shell_command_add(char *buff, uint16_t *buff_len,
 
 const struct shell_static_entry *shell_root_cmd_find(const char *syntax);
 
+/* Binary search for the run of root commands starting with the pattern.
+ * Returns the index of the first match, the number of matches and the
+ * longest matching syntax length.
+ */
+void shell_root_cmd_prefix_search(const char *prefix, size_t len,
+				  size_t *first, size_t *cnt,
+				  uint16_t *longest);
+
 void shell_spaces_trim(char *str);
 
 static inline void transport_buffer_flush(const struct shell *shell)
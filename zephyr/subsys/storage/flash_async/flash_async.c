@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <errno.h>
+#include <drivers/flash.h>
+#include <storage/flash_async.h>
+
+#define LOG_LEVEL CONFIG_FLASH_ASYNC_LOG_LEVEL
+#include <logging/log.h>
+LOG_MODULE_REGISTER(flash_async);
+
+static K_FIFO_DEFINE(flash_async_fifo);
+
+static void flash_async_work_handler(struct k_work *work);
+
+static K_WORK_DEFINE(flash_async_work, flash_async_work_handler);
+
+static int flash_async_run(struct flash_async_op *op)
+{
+	int rc;
+
+	rc = flash_write_protection_set(op->dev, false);
+	if (rc != 0) {
+		return rc;
+	}
+
+	switch (op->type) {
+	case FLASH_ASYNC_WRITE:
+		rc = flash_write(op->dev, op->offset, op->data, op->len);
+		break;
+	case FLASH_ASYNC_ERASE:
+		rc = flash_erase(op->dev, op->offset, op->len);
+		break;
+	default:
+		rc = -EINVAL;
+		break;
+	}
+
+	(void)flash_write_protection_set(op->dev, true);
+
+	return rc;
+}
+
+static void flash_async_work_handler(struct k_work *work)
+{
+	struct flash_async_op *op;
+	int rc;
+
+	ARG_UNUSED(work);
+
+	while ((op = k_fifo_get(&flash_async_fifo, K_NO_WAIT)) != NULL) {
+		rc = flash_async_run(op);
+		if (rc != 0) {
+			LOG_ERR("op %u at 0x%lx failed (%d)", op->type,
+				(long)op->offset, rc);
+		}
+		if (op->cb != NULL) {
+			/* The callback may reuse or free the operation */
+			op->cb(op, rc);
+		}
+	}
+}
+
+int flash_async_submit(struct flash_async_op *op)
+{
+	if ((op == NULL) || (op->dev == NULL) ||
+	    ((op->type == FLASH_ASYNC_WRITE) && (op->data == NULL))) {
+		return -EINVAL;
+	}
+
+	k_fifo_put(&flash_async_fifo, op);
+	k_work_submit(&flash_async_work);
+
+	return 0;
+}
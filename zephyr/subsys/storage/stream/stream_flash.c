@@ -123,6 +123,13 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		return -ENOMEM;
 	}
 
+#ifdef CONFIG_STREAM_FLASH_SHA256
+	/* Hash the payload only; flush padding is excluded below. */
+	if (len > 0) {
+		tc_sha256_update(&ctx->sha256, data, len);
+	}
+#endif
+
 	while ((len - processed) >=
 	       (buf_empty_bytes = ctx->buf_len - ctx->buf_bytes)) {
 		memcpy(ctx->buf + ctx->buf_bytes, data + processed,
@@ -233,5 +240,26 @@ int stream_flash_init(struct stream_flash_ctx *ctx, struct device *fdev,
 	ctx->last_erased_page_start_offset = -1;
 #endif
 
+#ifdef CONFIG_STREAM_FLASH_SHA256
+	if (tc_sha256_init(&ctx->sha256) != TC_CRYPTO_SUCCESS) {
+		return -EFAULT;
+	}
+#endif
+
+	return 0;
+}
+
+#ifdef CONFIG_STREAM_FLASH_SHA256
+int stream_flash_sha256(struct stream_flash_ctx *ctx, uint8_t *hash)
+{
+	if (!ctx || !hash) {
+		return -EFAULT;
+	}
+
+	if (tc_sha256_final(hash, &ctx->sha256) != TC_CRYPTO_SUCCESS) {
+		return -EINVAL;
+	}
+
 	return 0;
 }
+#endif /* CONFIG_STREAM_FLASH_SHA256 */
@@ -72,6 +72,32 @@ int tracing_buffer_put_finish(uint32_t size);
  */
 uint32_t tracing_buffer_put(uint8_t *data, uint32_t size);
 
+#ifdef CONFIG_TRACING_PERCPU_BUFFER
+/**
+ * @brief Get address of the first valid data in a CPU's tracing buffer.
+ *
+ * @param cpu  CPU the stream belongs to.
+ * @param data Pointer to the address. It's set to a location pointing to
+ *             the first valid data within the CPU's tracing buffer.
+ * @param size Requested buffer size (in bytes).
+ *
+ * @return Size of valid buffer which can be smaller than requested
+ *         if there isn't enough valid data or buffer wraps.
+ */
+uint32_t tracing_buffer_cpu_get_claim(uint8_t cpu, uint8_t **data,
+				      uint32_t size);
+
+/**
+ * @brief Indicate number of bytes read from a CPU's claimed buffer.
+ *
+ * @param cpu  CPU the stream belongs to.
+ * @param size Number of bytes read from claimed buffer.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EINVAL Given @a size exceeds available data of tracing buffer.
+ */
+int tracing_buffer_cpu_get_finish(uint8_t cpu, uint32_t size);
+#else
 /**
  * @brief Get address of the first valid data in tracing buffer.
  *
@@ -103,6 +129,55 @@ int tracing_buffer_get_finish(uint32_t size);
  * @retval Number of bytes written to the output buffer.
  */
 uint32_t tracing_buffer_get(uint8_t *data, uint32_t size);
+#endif /* CONFIG_TRACING_PERCPU_BUFFER */
+
+/**
+ * @brief Discard the oldest tracing data until @a size bytes are free.
+ *
+ * Only available in flight recorder mode, where the newest events must
+ * always fit.
+ *
+ * @param size Number of free bytes needed.
+ */
+void tracing_buffer_make_room(uint32_t size);
+
+#ifdef CONFIG_TRACING_FLIGHT_RECORDER
+/**
+ * @brief Freeze the tracing buffer and record the snapshot header.
+ */
+void tracing_buffer_freeze(void);
+
+/**
+ * @brief Check if a frozen snapshot is present.
+ *
+ * @return true if the snapshot header holds a valid snapshot.
+ */
+bool tracing_buffer_snapshot_valid(void);
+
+/**
+ * @brief Get the size of the frozen snapshot.
+ *
+ * @return Snapshot size in bytes, 0 if there is no valid snapshot.
+ */
+uint32_t tracing_buffer_snapshot_size(void);
+
+/**
+ * @brief Copy data out of the frozen snapshot.
+ *
+ * @param offset Offset into the snapshot to read from.
+ * @param buf    Output buffer.
+ * @param len    Number of bytes to read.
+ *
+ * @return Number of bytes copied, 0 when @a offset is out of range.
+ */
+uint32_t tracing_buffer_snapshot_read(uint32_t offset, uint8_t *buf,
+				      uint32_t len);
+
+/**
+ * @brief Invalidate the snapshot and reset the tracing buffer.
+ */
+void tracing_buffer_snapshot_clear(void);
+#endif /* CONFIG_TRACING_FLIGHT_RECORDER */
 
 /**
  * @brief Get buffer from tracing command buffer.
@@ -14,9 +14,18 @@
 extern "C" {
 #endif
 
+#ifdef CONFIG_TRACING_PERCPU_BUFFER
+/* Writes only touch the current CPU's stream, so masking local
+ * interrupts is enough; no cross-CPU lock is taken.
+ */
+#define TRACING_LOCK()		{ unsigned int key; key = arch_irq_lock()
+
+#define TRACING_UNLOCK()	{ arch_irq_unlock(key); } }
+#else
 #define TRACING_LOCK()		{ int key; key = irq_lock()
 
 #define TRACING_UNLOCK()	{ irq_unlock(key); } }
+#endif
 
 /**
  * @brief Check tracing enabled or not.
@@ -60,6 +69,40 @@ void tracing_trigger_output(bool before_put_is_empty);
  */
 bool is_tracing_thread(void);
 
+#ifdef CONFIG_TRACING_FLIGHT_RECORDER
+/**
+ * @brief Stop the flight recorder and freeze its buffer.
+ *
+ * Called from the fatal error path; the frozen buffer survives a warm
+ * reboot and can be read back with tracing_flight_recorder_read().
+ */
+void tracing_flight_recorder_freeze(void);
+
+/**
+ * @brief Get the size of the frozen flight recorder snapshot.
+ *
+ * @return Snapshot size in bytes, 0 when no snapshot is present.
+ */
+uint32_t tracing_flight_recorder_size(void);
+
+/**
+ * @brief Read data out of the frozen flight recorder snapshot.
+ *
+ * @param offset Offset into the snapshot to read from.
+ * @param buf    Output buffer.
+ * @param len    Number of bytes to read.
+ *
+ * @return Number of bytes copied.
+ */
+uint32_t tracing_flight_recorder_read(uint32_t offset, uint8_t *buf,
+				      uint32_t len);
+
+/**
+ * @brief Discard the frozen snapshot and resume recording.
+ */
+void tracing_flight_recorder_clear(void);
+#endif /* CONFIG_TRACING_FLIGHT_RECORDER */
+
 #ifdef __cplusplus
 }
 #endif
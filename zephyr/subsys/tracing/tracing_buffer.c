@@ -5,9 +5,10 @@
  */
 
 #include <sys/ring_buffer.h>
+#ifdef CONFIG_TRACING_PERCPU_BUFFER
+#include <kernel_structs.h>
+#endif
 
-static struct ring_buf tracing_ring_buf;
-static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
 static uint8_t tracing_cmd_buffer[CONFIG_TRACING_CMD_BUFFER_SIZE];
 
 uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
@@ -17,6 +18,89 @@ uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 	return sizeof(tracing_cmd_buffer);
 }
 
+#ifdef CONFIG_TRACING_PERCPU_BUFFER
+
+/*
+ * Every CPU owns a stream: events are put to the ring buffer of the CPU
+ * they occurred on with only local interrupts masked, so tracing one CPU
+ * never contends with another. The tracing thread drains each stream
+ * separately and the host merges them by the per-event timestamps.
+ */
+static struct ring_buf tracing_ring_buf[CONFIG_MP_NUM_CPUS];
+static uint8_t tracing_buffer[CONFIG_MP_NUM_CPUS]
+			     [CONFIG_TRACING_BUFFER_SIZE + 1];
+
+static inline struct ring_buf *tracing_buf_cur(void)
+{
+	return &tracing_ring_buf[_current_cpu->id];
+}
+
+uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size)
+{
+	return ring_buf_put_claim(tracing_buf_cur(), data, size);
+}
+
+int tracing_buffer_put_finish(uint32_t size)
+{
+	return ring_buf_put_finish(tracing_buf_cur(), size);
+}
+
+uint32_t tracing_buffer_put(uint8_t *data, uint32_t size)
+{
+	return ring_buf_put(tracing_buf_cur(), data, size);
+}
+
+uint32_t tracing_buffer_cpu_get_claim(uint8_t cpu, uint8_t **data,
+				      uint32_t size)
+{
+	return ring_buf_get_claim(&tracing_ring_buf[cpu], data, size);
+}
+
+int tracing_buffer_cpu_get_finish(uint8_t cpu, uint32_t size)
+{
+	return ring_buf_get_finish(&tracing_ring_buf[cpu], size);
+}
+
+void tracing_buffer_init(void)
+{
+	for (int cpu = 0; cpu < CONFIG_MP_NUM_CPUS; cpu++) {
+		ring_buf_init(&tracing_ring_buf[cpu],
+			      sizeof(tracing_buffer[cpu]),
+			      tracing_buffer[cpu]);
+	}
+}
+
+bool tracing_buffer_is_empty(void)
+{
+	for (int cpu = 0; cpu < CONFIG_MP_NUM_CPUS; cpu++) {
+		if (!ring_buf_is_empty(&tracing_ring_buf[cpu])) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+uint32_t tracing_buffer_capacity_get(void)
+{
+	return ring_buf_capacity_get(tracing_buf_cur());
+}
+
+uint32_t tracing_buffer_space_get(void)
+{
+	return ring_buf_space_get(tracing_buf_cur());
+}
+
+#else /* CONFIG_TRACING_PERCPU_BUFFER */
+
+static struct ring_buf tracing_ring_buf;
+#ifdef CONFIG_TRACING_FLIGHT_RECORDER
+/* Kept out of .bss so the contents survive a warm reboot. */
+__noinit static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
+#else
+static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
+#endif
+
 uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size)
 {
 	return ring_buf_put_claim(&tracing_ring_buf, data, size);
@@ -67,3 +151,96 @@ uint32_t tracing_buffer_space_get(void)
 {
 	return ring_buf_space_get(&tracing_ring_buf);
 }
+
+#ifdef CONFIG_TRACING_FLIGHT_RECORDER
+
+#define TRACING_FR_MAGIC 0x46524543
+
+/*
+ * Snapshot header filled in when the recorder is frozen. It lives in
+ * noinit RAM next to the trace buffer so both can be read back after a
+ * warm reboot.
+ */
+struct tracing_fr_snapshot {
+	uint32_t magic;
+	uint32_t read_off;
+	uint32_t len;
+};
+
+__noinit static struct tracing_fr_snapshot fr_snapshot;
+static bool fr_frozen;
+
+void tracing_buffer_make_room(uint32_t size)
+{
+	uint8_t *dummy;
+	uint32_t claimed;
+
+	/* Discard the oldest data so the newest always fits. */
+	while (ring_buf_space_get(&tracing_ring_buf) < size) {
+		claimed = ring_buf_get_claim(&tracing_ring_buf, &dummy, size);
+		if (claimed == 0U) {
+			break;
+		}
+		ring_buf_get_finish(&tracing_ring_buf, claimed);
+	}
+}
+
+void tracing_buffer_freeze(void)
+{
+	uint8_t *data;
+	uint32_t claimed;
+
+	if (fr_frozen) {
+		return;
+	}
+	fr_frozen = true;
+
+	claimed = ring_buf_get_claim(&tracing_ring_buf, &data,
+				     sizeof(tracing_buffer));
+	fr_snapshot.read_off = (claimed != 0U) ?
+			(uint32_t)(data - tracing_buffer) : 0U;
+	fr_snapshot.len = ring_buf_capacity_get(&tracing_ring_buf) -
+			  ring_buf_space_get(&tracing_ring_buf);
+	fr_snapshot.magic = TRACING_FR_MAGIC;
+}
+
+bool tracing_buffer_snapshot_valid(void)
+{
+	return fr_snapshot.magic == TRACING_FR_MAGIC;
+}
+
+uint32_t tracing_buffer_snapshot_size(void)
+{
+	return tracing_buffer_snapshot_valid() ? fr_snapshot.len : 0U;
+}
+
+uint32_t tracing_buffer_snapshot_read(uint32_t offset, uint8_t *buf,
+				      uint32_t len)
+{
+	uint32_t pos;
+
+	if (!tracing_buffer_snapshot_valid() || offset >= fr_snapshot.len) {
+		return 0;
+	}
+
+	len = MIN(len, fr_snapshot.len - offset);
+	pos = fr_snapshot.read_off + offset;
+
+	for (uint32_t i = 0; i < len; i++) {
+		buf[i] = tracing_buffer[(pos + i) % sizeof(tracing_buffer)];
+	}
+
+	return len;
+}
+
+void tracing_buffer_snapshot_clear(void)
+{
+	fr_snapshot.magic = 0U;
+	fr_frozen = false;
+	ring_buf_init(&tracing_ring_buf,
+		      sizeof(tracing_buffer), tracing_buffer);
+}
+
+#endif /* CONFIG_TRACING_FLIGHT_RECORDER */
+
+#endif /* CONFIG_TRACING_PERCPU_BUFFER */
@@ -35,7 +35,14 @@ static atomic_t tracing_state;
 static atomic_t tracing_packet_drop_num;
 static struct tracing_backend *working_backend;
 
-#ifdef CONFIG_TRACING_ASYNC
+#ifdef CONFIG_TRACING_PERCPU_BUFFER
+#include <sys/byteorder.h>
+
+/* First byte of the frame prefixed to every per-CPU chunk */
+#define TRACING_FRAME_SYNC 0x7a
+#endif
+
+#if defined(CONFIG_TRACING_ASYNC) && !defined(CONFIG_TRACING_FLIGHT_RECORDER)
 #define TRACING_THREAD_NAME "tracing_thread"
 
 static k_tid_t tracing_thread_tid;
@@ -45,6 +52,48 @@ static K_SEM_DEFINE(tracing_thread_sem, 0, 1);
 static K_THREAD_STACK_DEFINE(tracing_thread_stack,
 			CONFIG_TRACING_THREAD_STACK_SIZE);
 
+#ifdef CONFIG_TRACING_PERCPU_BUFFER
+static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
+{
+	uint8_t *transferring_buf;
+	uint32_t transferring_length, tracing_buffer_max_length;
+	uint8_t frame[4];
+
+	tracing_thread_tid = k_current_get();
+
+	tracing_buffer_max_length = tracing_buffer_capacity_get();
+
+	while (true) {
+		if (tracing_buffer_is_empty()) {
+			k_sem_take(&tracing_thread_sem, K_FOREVER);
+		} else {
+			for (uint8_t cpu = 0; cpu < CONFIG_MP_NUM_CPUS;
+			     cpu++) {
+				transferring_length =
+					tracing_buffer_cpu_get_claim(
+						cpu, &transferring_buf,
+						tracing_buffer_max_length);
+				if (transferring_length == 0U) {
+					continue;
+				}
+
+				/* Frame each chunk so the host can
+				 * demultiplex the per-CPU streams.
+				 */
+				frame[0] = TRACING_FRAME_SYNC;
+				frame[1] = cpu;
+				sys_put_le16(transferring_length, &frame[2]);
+				tracing_buffer_handle(frame, sizeof(frame));
+
+				tracing_buffer_handle(transferring_buf,
+						      transferring_length);
+				tracing_buffer_cpu_get_finish(
+						cpu, transferring_length);
+			}
+		}
+	}
+}
+#else
 static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 {
 	uint8_t *transferring_buf;
@@ -68,6 +117,7 @@ static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 		}
 	}
 }
+#endif /* CONFIG_TRACING_PERCPU_BUFFER */
 
 static void tracing_thread_timer_expiry_fn(struct k_timer *timer)
 {
@@ -91,13 +141,21 @@ static int tracing_init(struct device *arg)
 
 	atomic_set(&tracing_packet_drop_num, 0);
 
+#ifdef CONFIG_TRACING_FLIGHT_RECORDER
+	if (tracing_buffer_snapshot_valid()) {
+		/* Preserve last boot's snapshot until it is cleared. */
+		tracing_set_state(TRACING_DISABLE);
+		return 0;
+	}
+#endif
+
 	if (IS_ENABLED(CONFIG_TRACING_HANDLE_HOST_CMD)) {
 		tracing_set_state(TRACING_DISABLE);
 	} else {
 		tracing_set_state(TRACING_ENABLE);
 	}
 
-#ifdef CONFIG_TRACING_ASYNC
+#if defined(CONFIG_TRACING_ASYNC) && !defined(CONFIG_TRACING_FLIGHT_RECORDER)
 	k_timer_init(&tracing_thread_timer,
 		     tracing_thread_timer_expiry_fn, NULL);
 
@@ -113,7 +171,7 @@ static int tracing_init(struct device *arg)
 
 SYS_INIT(tracing_init, APPLICATION, 0);
 
-#ifdef CONFIG_TRACING_ASYNC
+#if defined(CONFIG_TRACING_ASYNC) && !defined(CONFIG_TRACING_FLIGHT_RECORDER)
 void tracing_trigger_output(bool before_put_is_empty)
 {
 	if (before_put_is_empty) {
@@ -129,6 +187,42 @@ bool is_tracing_thread(void)
 }
 #endif
 
+#ifdef CONFIG_TRACING_FLIGHT_RECORDER
+void tracing_trigger_output(bool before_put_is_empty)
+{
+	/* Nothing drains the recorder; events just accumulate. */
+	ARG_UNUSED(before_put_is_empty);
+}
+
+bool is_tracing_thread(void)
+{
+	return false;
+}
+
+void tracing_flight_recorder_freeze(void)
+{
+	tracing_set_state(TRACING_DISABLE);
+	tracing_buffer_freeze();
+}
+
+uint32_t tracing_flight_recorder_size(void)
+{
+	return tracing_buffer_snapshot_size();
+}
+
+uint32_t tracing_flight_recorder_read(uint32_t offset, uint8_t *buf,
+				      uint32_t len)
+{
+	return tracing_buffer_snapshot_read(offset, buf, len);
+}
+
+void tracing_flight_recorder_clear(void)
+{
+	tracing_buffer_snapshot_clear();
+	tracing_set_state(TRACING_ENABLE);
+}
+#endif
+
 bool is_tracing_enabled(void)
 {
 	return atomic_get(&tracing_state) == TRACING_ENABLE;
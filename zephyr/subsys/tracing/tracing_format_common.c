@@ -17,6 +17,11 @@ static int str_put(int c, void *ctx)
 		uint32_t claimed_size;
 
 		claimed_size = tracing_buffer_put_claim(&buf, 1);
+		if (claimed_size == 0 &&
+		    IS_ENABLED(CONFIG_TRACING_FLIGHT_RECORDER)) {
+			tracing_buffer_make_room(1);
+			claimed_size = tracing_buffer_put_claim(&buf, 1);
+		}
 		if (claimed_size) {
 			*buf = (uint8_t)c;
 			str_ctx->length++;
@@ -49,7 +54,14 @@ bool tracing_format_string_put(const char *str, va_list args)
 
 bool tracing_format_raw_data_put(uint8_t *data, uint32_t size)
 {
-	uint32_t space = tracing_buffer_space_get();
+	uint32_t space;
+
+	if (IS_ENABLED(CONFIG_TRACING_FLIGHT_RECORDER)) {
+		/* Overwrite the oldest events rather than drop the new one */
+		tracing_buffer_make_room(size);
+	}
+
+	space = tracing_buffer_space_get();
 
 	if (space >= size) {
 		tracing_buffer_put(data, size);
@@ -69,6 +81,10 @@ bool tracing_format_data_put(tracing_data_t *tracing_data_array, uint32_t count)
 		uint8_t *data = tracing_data->data, *buf;
 		uint32_t length = tracing_data->length, claimed_size;
 
+		if (IS_ENABLED(CONFIG_TRACING_FLIGHT_RECORDER)) {
+			tracing_buffer_make_room(length);
+		}
+
 		do {
 			claimed_size = tracing_buffer_put_claim(&buf, length);
 			memcpy(buf, data, claimed_size);
@@ -187,6 +187,15 @@ void usb_transfer_ep_callback(uint8_t ep, enum usb_dc_ep_cb_status_code status)
 		/* If we are not in IRQ context, no need to defer work */
 		/* Read (out) needs to be done from ep_callback */
 		usb_transfer_work(&trans->work);
+#ifdef CONFIG_USB_TRANSFER_WRITE_IN_ISR
+	} else if (trans->bsize != 0U) {
+		/* Queue the next chunk from the interrupt itself, so it
+		 * reaches the controller while the host fetches the
+		 * previous packet.  Completion (ZLP and callback) is
+		 * still deferred to the work queue below.
+		 */
+		usb_transfer_work(&trans->work);
+#endif
 	} else {
 		k_work_submit(&trans->work);
 	}
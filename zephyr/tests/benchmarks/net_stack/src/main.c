@@ -0,0 +1,476 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <string.h>
+#include <device.h>
+#include <init.h>
+#include <sys/printk.h>
+#include <net/buf.h>
+#include <net/net_core.h>
+#include <net/net_pkt.h>
+#include <net/net_ip.h>
+#include <net/net_if.h>
+#include <net/net_context.h>
+#include <net/dummy.h>
+#include <net/udp.h>
+#include <net/socket.h>
+
+#include "udp_internal.h"
+#include "ipv4.h"
+
+/* Network stack throughput benchmark with a synthetic traffic source
+ * and sink at the L2 boundary, so the measured cycles cover only the
+ * stack itself (net_core.c, udp.c, tcp2.c) and never a real driver.
+ *
+ * The single dummy-L2 interface below runs in one of two modes:
+ *
+ * - sink: send() counts the packet and drops it, making outbound UDP
+ *   essentially free at L2 so the TX numbers isolate the send path.
+ * - reflect: send() clones the packet, swaps the IPv4 addresses and
+ *   feeds it back with net_recv_data(), the same trick the loopback
+ *   driver uses, so a TCP connection can be driven end to end without
+ *   hardware.
+ *
+ * Inbound UDP is generated by building packets directly (the pktgen
+ * part) and injecting them with net_recv_data(); a packet-build-only
+ * baseline is reported so the RX cost can be read as the difference.
+ *
+ * Output format matches tests/benchmarks/primitives:
+ *
+ *     BENCH|<name>|<avg_cycles>|<iterations>
+ *
+ * ending with "BENCHMARK DONE", consumable by the same
+ * compare_bench.py regression gate.
+ */
+
+#define N_RUNS 500
+
+#define BENCH_PORT 4242
+#define PEER_PORT 4243
+#define TCP_PORT 4244
+
+#define TCP_CHUNK 256
+#define N_TCP_CHUNKS 200
+
+static uint64_t total_cycles;
+static uint32_t t_start;
+
+static inline void bench_start(void)
+{
+	total_cycles = 0U;
+	t_start = k_cycle_get_32();
+}
+
+static inline void bench_end(const char *name, int iterations)
+{
+	total_cycles = k_cycle_get_32() - t_start;
+	printk("BENCH|%s|%u|%d\n", name,
+	       (uint32_t)(total_cycles / iterations), iterations);
+}
+
+/* Synthetic L2 source/sink interface */
+
+static struct in_addr my_addr = { { { 192, 0, 2, 1 } } };
+static struct in_addr peer_addr = { { { 192, 0, 2, 2 } } };
+
+static struct net_if *bench_iface;
+static bool reflect_mode;
+static uint32_t sink_count;
+
+struct bench_dev_context {
+	uint8_t mac_addr[6];
+};
+
+static struct bench_dev_context bench_dev_data;
+
+static int bench_dev_init(struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return 0;
+}
+
+static void bench_iface_init(struct net_if *iface)
+{
+	struct bench_dev_context *ctx = net_if_get_device(iface)->driver_data;
+
+	/* RFC 7042, s.2.1.1 address for use in documentation */
+	memcpy(ctx->mac_addr, "\x00\x00\x5e\x00\x53\x01", 6);
+	net_if_set_link_addr(iface, ctx->mac_addr, 6, NET_LINK_DUMMY);
+
+	bench_iface = iface;
+}
+
+static int bench_dev_send(struct device *dev, struct net_pkt *pkt)
+{
+	struct net_pkt *cloned;
+	struct in_addr addr;
+	int ret;
+
+	ARG_UNUSED(dev);
+
+	if (!reflect_mode) {
+		sink_count++;
+		return 0;
+	}
+
+	/* Reflect the packet back like drivers/net/loopback.c does:
+	 * swap the IPv4 addresses and re-inject a clone, so the
+	 * original follows the normal "sent and dropped" life cycle
+	 * that TCP's reference counting relies on.
+	 */
+	net_ipaddr_copy(&addr, &NET_IPV4_HDR(pkt)->src);
+	net_ipaddr_copy(&NET_IPV4_HDR(pkt)->src, &NET_IPV4_HDR(pkt)->dst);
+	net_ipaddr_copy(&NET_IPV4_HDR(pkt)->dst, &addr);
+
+	cloned = net_pkt_clone(pkt, K_MSEC(100));
+	if (!cloned) {
+		return -ENOMEM;
+	}
+
+	ret = net_recv_data(net_pkt_iface(cloned), cloned);
+	if (ret < 0) {
+		net_pkt_unref(cloned);
+	}
+
+	k_yield();
+
+	return 0;
+}
+
+static struct dummy_api bench_dev_api = {
+	.iface_api.init = bench_iface_init,
+	.send = bench_dev_send,
+};
+
+NET_DEVICE_INIT(bench_netdev, "bench_netdev", bench_dev_init,
+		device_pm_control_nop, &bench_dev_data, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &bench_dev_api,
+		DUMMY_L2, NET_L2_GET_CTX_TYPE(DUMMY_L2), 127);
+
+/* UDP packet generator: src is the (nonexistent) peer, dst is us */
+
+static const uint8_t udp_payload[32] = { 42 };
+
+static struct net_pkt *build_udp_pkt(void)
+{
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_alloc_with_buffer(bench_iface, sizeof(udp_payload),
+					AF_INET, IPPROTO_UDP, K_SECONDS(1));
+	if (!pkt) {
+		return NULL;
+	}
+
+	if (net_ipv4_create(pkt, &peer_addr, &my_addr) ||
+	    net_udp_create(pkt, htons(PEER_PORT), htons(BENCH_PORT)) ||
+	    net_pkt_write(pkt, udp_payload, sizeof(udp_payload))) {
+		net_pkt_unref(pkt);
+		return NULL;
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_ipv4_finalize(pkt, IPPROTO_UDP);
+
+	return pkt;
+}
+
+/* Baseline: packet build + free only, no stack traversal. Subtracting
+ * this from udp.rx gives the pure net_core.c + udp.c per-packet cost.
+ */
+static void bench_pkt_build(void)
+{
+	struct net_pkt *pkt;
+
+	bench_start();
+	for (int i = 0; i < N_RUNS; i++) {
+		pkt = build_udp_pkt();
+		if (!pkt) {
+			printk("pkt build failed at %d\n", i);
+			return;
+		}
+		net_pkt_unref(pkt);
+	}
+	bench_end("net_pkt.build_free", N_RUNS);
+}
+
+/* UDP RX: inject generated packets at the L2 boundary and wait for
+ * delivery to a bound context. The semaphore keeps the measurement
+ * correct whether RX is dispatched directly or through the traffic
+ * class queues.
+ */
+static K_SEM_DEFINE(rx_sem, 0, 1);
+static uint32_t rx_count;
+
+static void udp_recv_cb(struct net_context *context, struct net_pkt *pkt,
+			union net_ip_header *ip_hdr,
+			union net_proto_header *proto_hdr,
+			int status, void *user_data)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto_hdr);
+	ARG_UNUSED(status);
+	ARG_UNUSED(user_data);
+
+	if (pkt) {
+		rx_count++;
+		net_pkt_unref(pkt);
+	}
+
+	k_sem_give(&rx_sem);
+}
+
+static void bench_udp_rx(void)
+{
+	struct sockaddr_in bind_addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(BENCH_PORT),
+	};
+	struct net_context *ctx;
+	struct net_pkt *pkt;
+	int ret;
+
+	ret = net_context_get(AF_INET, SOCK_DGRAM, IPPROTO_UDP, &ctx);
+	if (ret < 0) {
+		printk("udp.rx: context get failed (%d)\n", ret);
+		return;
+	}
+
+	net_ipaddr_copy(&bind_addr.sin_addr, &my_addr);
+
+	ret = net_context_bind(ctx, (struct sockaddr *)&bind_addr,
+			       sizeof(bind_addr));
+	if (ret < 0) {
+		printk("udp.rx: bind failed (%d)\n", ret);
+		goto out;
+	}
+
+	ret = net_context_recv(ctx, udp_recv_cb, K_NO_WAIT, NULL);
+	if (ret < 0) {
+		printk("udp.rx: recv setup failed (%d)\n", ret);
+		goto out;
+	}
+
+	rx_count = 0U;
+
+	bench_start();
+	for (int i = 0; i < N_RUNS; i++) {
+		pkt = build_udp_pkt();
+		if (!pkt) {
+			printk("udp.rx: pkt build failed at %d\n", i);
+			goto out;
+		}
+
+		ret = net_recv_data(bench_iface, pkt);
+		if (ret < 0) {
+			net_pkt_unref(pkt);
+			printk("udp.rx: inject failed (%d)\n", ret);
+			goto out;
+		}
+
+		k_sem_take(&rx_sem, K_FOREVER);
+	}
+	bench_end("udp.rx", N_RUNS);
+
+	if (rx_count != N_RUNS) {
+		printk("udp.rx: delivered %u of %d packets\n",
+		       rx_count, N_RUNS);
+	}
+
+out:
+	net_context_put(ctx);
+}
+
+/* UDP TX: net_context_sendto() out through the sink, so the reported
+ * cycles are the full send path down to the driver boundary.
+ */
+static void bench_udp_tx(void)
+{
+	struct sockaddr_in dst_addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(PEER_PORT),
+	};
+	struct sockaddr_in bind_addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(BENCH_PORT),
+	};
+	struct net_context *ctx;
+	int ret;
+
+	ret = net_context_get(AF_INET, SOCK_DGRAM, IPPROTO_UDP, &ctx);
+	if (ret < 0) {
+		printk("udp.tx: context get failed (%d)\n", ret);
+		return;
+	}
+
+	/* The raw net_context API does not bind implicitly the way the
+	 * socket layer does, and sending on an unbound context leaves
+	 * the source address NULL for the IPv4 header build. Bind
+	 * explicitly so the send path has a local address to use.
+	 */
+	net_ipaddr_copy(&bind_addr.sin_addr, &my_addr);
+
+	ret = net_context_bind(ctx, (struct sockaddr *)&bind_addr,
+			       sizeof(bind_addr));
+	if (ret < 0) {
+		printk("udp.tx: bind failed (%d)\n", ret);
+		goto out;
+	}
+
+	net_ipaddr_copy(&dst_addr.sin_addr, &peer_addr);
+
+	sink_count = 0U;
+
+	bench_start();
+	for (int i = 0; i < N_RUNS; i++) {
+		ret = net_context_sendto(ctx, udp_payload,
+					 sizeof(udp_payload),
+					 (struct sockaddr *)&dst_addr,
+					 sizeof(dst_addr),
+					 NULL, K_NO_WAIT, NULL);
+		if (ret < 0) {
+			printk("udp.tx: send failed (%d)\n", ret);
+			goto out;
+		}
+	}
+	bench_end("udp.tx", N_RUNS);
+
+	if (sink_count != N_RUNS) {
+		printk("udp.tx: sink saw %u of %d packets\n",
+		       sink_count, N_RUNS);
+	}
+
+out:
+	net_context_put(ctx);
+}
+
+/* TCP: stream N_TCP_CHUNKS fixed-size chunks through tcp2.c over the
+ * reflecting interface, server and client on the same node. The
+ * per-chunk average includes ACK processing and both directions of
+ * the stack, which is what a tcp2.c regression would move.
+ */
+static K_THREAD_STACK_DEFINE(tcp_server_stack, 2048);
+static struct k_thread tcp_server_thread;
+static K_SEM_DEFINE(tcp_ready_sem, 0, 1);
+static K_SEM_DEFINE(tcp_done_sem, 0, 1);
+
+static void tcp_server(void *p1, void *p2, void *p3)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(TCP_PORT),
+	};
+	uint8_t buf[TCP_CHUNK];
+	int serv, sock;
+	size_t total = 0;
+	ssize_t len;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	net_ipaddr_copy(&addr.sin_addr, &my_addr);
+
+	serv = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (serv < 0 ||
+	    zsock_bind(serv, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+	    zsock_listen(serv, 2) < 0) {
+		printk("tcp: server setup failed (%d)\n", errno);
+		k_sem_give(&tcp_done_sem);
+		return;
+	}
+
+	k_sem_give(&tcp_ready_sem);
+
+	sock = zsock_accept(serv, NULL, NULL);
+	if (sock < 0) {
+		printk("tcp: accept failed (%d)\n", errno);
+		k_sem_give(&tcp_done_sem);
+		zsock_close(serv);
+		return;
+	}
+
+	while (total < (size_t)N_TCP_CHUNKS * TCP_CHUNK) {
+		len = zsock_recv(sock, buf, sizeof(buf), 0);
+		if (len <= 0) {
+			printk("tcp: recv failed (%d)\n", errno);
+			break;
+		}
+		total += len;
+	}
+
+	zsock_close(sock);
+	zsock_close(serv);
+
+	k_sem_give(&tcp_done_sem);
+}
+
+static void bench_tcp_stream(void)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(TCP_PORT),
+	};
+	uint8_t chunk[TCP_CHUNK];
+	int sock;
+
+	reflect_mode = true;
+
+	memset(chunk, 42, sizeof(chunk));
+	net_ipaddr_copy(&addr.sin_addr, &my_addr);
+
+	k_thread_create(&tcp_server_thread, tcp_server_stack,
+			K_THREAD_STACK_SIZEOF(tcp_server_stack),
+			tcp_server, NULL, NULL, NULL,
+			k_thread_priority_get(k_current_get()),
+			0, K_NO_WAIT);
+
+	k_sem_take(&tcp_ready_sem, K_FOREVER);
+
+	sock = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (sock < 0 ||
+	    zsock_connect(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		printk("tcp: connect failed (%d)\n", errno);
+		goto out;
+	}
+
+	bench_start();
+	for (int i = 0; i < N_TCP_CHUNKS; i++) {
+		if (zsock_send(sock, chunk, sizeof(chunk), 0) < 0) {
+			printk("tcp: send failed at %d (%d)\n", i, errno);
+			goto out;
+		}
+	}
+	k_sem_take(&tcp_done_sem, K_FOREVER);
+	bench_end("tcp.stream", N_TCP_CHUNKS);
+
+out:
+	if (sock >= 0) {
+		zsock_close(sock);
+	}
+	reflect_mode = false;
+}
+
+void main(void)
+{
+	printk("Network stack throughput benchmark\n");
+
+	if (!bench_iface) {
+		printk("no benchmark interface\n");
+		return;
+	}
+
+	net_if_ipv4_addr_add(bench_iface, &my_addr, NET_ADDR_MANUAL, 0);
+
+	bench_pkt_build();
+	bench_udp_rx();
+	bench_udp_tx();
+	bench_tcp_stream();
+
+	printk("BENCHMARK DONE\n");
+}
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+# Copyright (c) 2020 Nordic Semiconductor ASA
+# SPDX-License-Identifier: Apache-2.0
+"""Compare primitives benchmark console output against a baseline.
+
+Usage:
+    compare_bench.py --baseline baseline.csv --log console.log \
+                     [--tolerance 15]
+
+The baseline file holds one "name,cycles" line per benchmark, recorded
+on the same board/configuration with a known-good tree (copy the BENCH
+lines from a reference run). The script exits non-zero when any
+benchmark in the log exceeds its baseline by more than the tolerance
+percentage, which makes it usable directly as a CI gate. Benchmarks
+present in the log but missing from the baseline are reported and
+ignored, so new benchmarks can be added without breaking old baselines.
+"""
+
+import argparse
+import re
+import sys
+
+BENCH_RE = re.compile(r"BENCH\|([^|]+)\|(\d+)\|(\d+)")
+
+
+def parse_baseline(path):
+    baseline = {}
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            name, cycles = line.split(",")
+            baseline[name.strip()] = int(cycles)
+    return baseline
+
+
+def parse_log(path):
+    results = {}
+    with open(path) as f:
+        for line in f:
+            m = BENCH_RE.search(line)
+            if m and m.group(1) != "config":
+                results[m.group(1)] = int(m.group(2))
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--baseline", required=True,
+                        help="baseline csv, one name,cycles line per bench")
+    parser.add_argument("--log", required=True,
+                        help="captured console output of the benchmark run")
+    parser.add_argument("--tolerance", type=float, default=15.0,
+                        help="allowed regression in percent (default 15)")
+    args = parser.parse_args()
+
+    baseline = parse_baseline(args.baseline)
+    results = parse_log(args.log)
+
+    if not results:
+        print("error: no BENCH lines found in %s" % args.log)
+        return 1
+
+    failed = False
+    for name, cycles in sorted(results.items()):
+        if name not in baseline:
+            print("%-24s %8d cycles (no baseline, ignored)" % (name, cycles))
+            continue
+
+        ref = baseline[name]
+        delta = 100.0 * (cycles - ref) / ref
+        status = "ok"
+        if delta > args.tolerance:
+            status = "REGRESSION"
+            failed = True
+        print("%-24s %8d cycles, baseline %8d (%+6.1f%%) %s"
+              % (name, cycles, ref, delta, status))
+
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
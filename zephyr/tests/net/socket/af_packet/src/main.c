@@ -13,6 +13,7 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
 
 #include <fcntl.h>
 #include <net/socket.h>
+#include <net/socket_filter.h>
 #include <net/ethernet.h>
 
 #if defined(CONFIG_NET_SOCKETS_LOG_LEVEL_DBG)
@@ -220,11 +221,153 @@ static void test_packet_sockets(void)
 		       (struct sockaddr *)&src, &addrlen);
 	zassert_equal(ret, sizeof(data_to_send), "Cannot receive all data (%d)",
 		      -errno);
+
+	close(sock1);
+	close(sock2);
+}
+
+static void attach_reject(int sock, struct sock_filter *insns,
+			  unsigned short len, const char *why)
+{
+	struct sock_fprog prog = {
+		.len = len,
+		.filter = insns,
+	};
+	int ret;
+
+	ret = setsockopt(sock, SOL_SOCKET, SO_ATTACH_FILTER,
+			 &prog, sizeof(prog));
+	zassert_equal(ret, -1, "Filter with %s was accepted", why);
+	zassert_equal(errno, EINVAL, "Wrong errno for %s (%d)", why, errno);
+}
+
+static void test_packet_sockets_filter(void)
+{
+	struct user_data ud = { 0 };
+	uint8_t data_to_send[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	uint8_t data_to_receive[sizeof(data_to_send)];
+	struct sockaddr_ll dst, src;
+	socklen_t addrlen = sizeof(struct sockaddr_ll);
+	struct sock_filter accept_all[] = {
+		BPF_STMT(BPF_RET | BPF_K, 0xffffffff),
+	};
+	struct sock_filter reject_all[] = {
+		BPF_STMT(BPF_RET | BPF_K, 0),
+	};
+	struct sock_filter lsh_oob[] = {
+		BPF_STMT(BPF_ALU | BPF_LSH | BPF_K, 32),
+		BPF_STMT(BPF_RET | BPF_K, 0xffffffff),
+	};
+	struct sock_filter rsh_oob[] = {
+		BPF_STMT(BPF_ALU | BPF_RSH | BPF_K, 0xffffffff),
+		BPF_STMT(BPF_RET | BPF_K, 0xffffffff),
+	};
+	struct sock_filter jump_oob[] = {
+		BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, 0, 1, 0),
+		BPF_STMT(BPF_RET | BPF_K, 0xffffffff),
+	};
+	struct sock_filter mem_oob[] = {
+		BPF_STMT(BPF_ST, BPF_MEMWORDS),
+		BPF_STMT(BPF_RET | BPF_K, 0xffffffff),
+	};
+	struct sock_filter div_zero[] = {
+		BPF_STMT(BPF_ALU | BPF_DIV | BPF_K, 0),
+		BPF_STMT(BPF_RET | BPF_K, 0xffffffff),
+	};
+	struct sock_filter no_ret[] = {
+		BPF_STMT(BPF_LD | BPF_IMM, 1),
+	};
+	struct sock_fprog prog;
+	int ret, sock1, sock2;
+
+	net_if_foreach(iface_cb, &ud);
+
+	zassert_not_null(ud.first, "1st Ethernet interface not found");
+	zassert_not_null(ud.second, "2nd Ethernet interface not found");
+
+	sock1 = setup_socket(ud.first);
+	zassert_true(sock1 >= 0, "Cannot create 1st socket (%d)", sock1);
+
+	sock2 = setup_socket(ud.second);
+	zassert_true(sock2 >= 0, "Cannot create 2nd socket (%d)", sock2);
+
+	ret = bind_socket(sock1, ud.first);
+	zassert_equal(ret, 0, "Cannot bind 1st socket (%d)", -errno);
+
+	ret = bind_socket(sock2, ud.second);
+	zassert_equal(ret, 0, "Cannot bind 2nd socket (%d)", -errno);
+
+	/* Programs the validator must refuse */
+	attach_reject(sock2, lsh_oob, ARRAY_SIZE(lsh_oob),
+		      "out of range left shift");
+	attach_reject(sock2, rsh_oob, ARRAY_SIZE(rsh_oob),
+		      "out of range right shift");
+	attach_reject(sock2, jump_oob, ARRAY_SIZE(jump_oob),
+		      "out of bounds jump");
+	attach_reject(sock2, mem_oob, ARRAY_SIZE(mem_oob),
+		      "out of bounds scratch store");
+	attach_reject(sock2, div_zero, ARRAY_SIZE(div_zero),
+		      "constant division by zero");
+	attach_reject(sock2, no_ret, ARRAY_SIZE(no_ret),
+		      "missing return");
+
+	/* A reject-all program drops frames before they are queued */
+	prog.len = ARRAY_SIZE(reject_all);
+	prog.filter = reject_all;
+	ret = setsockopt(sock2, SOL_SOCKET, SO_ATTACH_FILTER,
+			 &prog, sizeof(prog));
+	zassert_equal(ret, 0, "Cannot attach filter (%d)", -errno);
+
+	memset(&dst, 0, sizeof(dst));
+	dst.sll_ifindex = net_if_get_by_iface(ud.first);
+	dst.sll_family = AF_PACKET;
+
+	ret = sendto(sock2, data_to_send, sizeof(data_to_send), 0,
+		     (const struct sockaddr *)&dst, sizeof(struct sockaddr_ll));
+	zassert_equal(ret, sizeof(data_to_send), "Cannot send all data (%d)",
+		      -errno);
+
+	k_msleep(10);
+
+	setblocking(sock2, false);
+
+	memset(&src, 0, sizeof(src));
+	ret = recvfrom(sock2, data_to_receive, sizeof(data_to_receive), 0,
+		       (struct sockaddr *)&src, &addrlen);
+	zassert_equal(ret, -1, "Filtered frame was received (%d)", ret);
+	zassert_equal(errno, EAGAIN, "Wrong errno (%d)", errno);
+
+	/* Replacing the filter in place lets traffic through again */
+	prog.len = ARRAY_SIZE(accept_all);
+	prog.filter = accept_all;
+	ret = setsockopt(sock2, SOL_SOCKET, SO_ATTACH_FILTER,
+			 &prog, sizeof(prog));
+	zassert_equal(ret, 0, "Cannot replace filter (%d)", -errno);
+
+	ret = sendto(sock2, data_to_send, sizeof(data_to_send), 0,
+		     (const struct sockaddr *)&dst, sizeof(struct sockaddr_ll));
+	zassert_equal(ret, sizeof(data_to_send), "Cannot send all data (%d)",
+		      -errno);
+
+	k_msleep(10);
+
+	memset(&src, 0, sizeof(src));
+	ret = recvfrom(sock2, data_to_receive, sizeof(data_to_receive), 0,
+		       (struct sockaddr *)&src, &addrlen);
+	zassert_equal(ret, sizeof(data_to_send), "Cannot receive all data (%d)",
+		      -errno);
+
+	ret = setsockopt(sock2, SOL_SOCKET, SO_DETACH_FILTER, NULL, 0);
+	zassert_equal(ret, 0, "Cannot detach filter (%d)", -errno);
+
+	close(sock1);
+	close(sock2);
 }
 
 void test_main(void)
 {
 	ztest_test_suite(socket_packet,
-			 ztest_unit_test(test_packet_sockets));
+			 ztest_unit_test(test_packet_sockets),
+			 ztest_unit_test(test_packet_sockets_filter));
 	ztest_run_test_suite(socket_packet);
 }